@@ -0,0 +1,408 @@
+/**
+ ******************************************************************************
+ * @file    bench_main.c
+ * @brief   On-Target Benchmark of every Stage of the Render Path
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ *
+ * Entry point of the Audio_Synth_H533_bench image, built from the firmware
+ * sources with this file in place of main.c. Runs the stages of the render
+ * path over fixed voices (the cases of Tools/synth_bench.cpp), times every
+ * call with the DWT cycle counter with the interrupts masked, and prints a
+ * table over USER_UART (115200 8N1):
+ *   stage, variant, voices, min / mean cycles per frame, mean cycles per
+ *   voice sample and the share of one sample period at the sample rate
+ *
+ * The results stay in bench_results[] once the run ends with "BENCH DONE".
+ * With a debugger attached the core then halts on a breakpoint, a script can
+ * read the table and quit. With AUDIO_BENCH_SEMIHOSTING the table goes to the
+ * debugger or simulator console instead and the image exits with the result.
+ *
+ * The CMSIS-DSP copy of this project (V1.10.0) has no DSP_Lib_TestSuite. The
+ * JTest flows of the F072 project (Drivers/CMSIS/DSP/DSP_Lib_TestSuite/Common/
+ * JTest, jtest_FVP.ini, jtest_MPS2.ini, jtest_Simulator.ini) are Keil uVision
+ * debugger scripts that break on the JTest framework of CMSIS-DSP V1.5.3 in a
+ * uVision project, they do not drive a CMake / arm-none-eabi-gcc image.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#include "audio_config.h"
+#include "channel_common.h"
+#include "effects.h"
+#include "filter.h"
+#include "gain.h"
+#include "mixer.h"
+#include "sample_rate.h"
+#include "synth.h"
+#include "uart.h"
+#include "voice_bank.h"
+
+/* Private includes ----------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "stm32h5xx_hal.h"
+
+#if BENCH_SEMIHOSTING
+extern void initialise_monitor_handles(void); // librdimon
+#endif
+
+#if !AUDIO_MIXER || !AUDIO_EFFECTS
+#error "The bench times the mixer and the effects bus, build it with AUDIO_MIXER and AUDIO_EFFECTS"
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+
+#define BENCH_CALLS 64    // Timed calls per case
+#define BENCH_RESULTS 128 // Room for every stage, variant and voice count
+
+/**
+ * @brief One stage to time
+ */
+typedef struct
+{
+  const char *stage;                      // Part of the render path
+  const char *variant;                    // Waveform, filter mode or effect
+  void (*setup)(uint8_t voices, int arg); // Voices, routes and effects before timing
+  void (*run)(uint8_t voices);            // One call, frames frames of audio
+  int arg;                                // Passed to setup
+  uint16_t frames;                        // Frames of audio per call of run
+  uint8_t scales;                         // 1 if the stage is timed at every voice count
+} bench_case_t;
+
+typedef struct
+{
+  const char *stage;
+  const char *variant;
+  uint8_t voices;       // 0 for the stages that do not depend on the voice count
+  uint32_t min_cycles;  // Cheapest call
+  uint32_t mean_cycles; // Mean over BENCH_CALLS calls
+  uint16_t frames;      // Frames per call
+} bench_result_t;
+
+/* Function Prototypes -------------------------------------------------------*/
+
+static void setup_voices(uint8_t voices, waveforms_t wave);
+static void setup_oscillator(uint8_t voices, int wave);
+static void setup_filter(uint8_t voices, int mode);
+static void setup_render(uint8_t voices, int arg);
+static void setup_effects(uint8_t voices, int effect);
+
+static void run_oscillator(uint8_t voices);
+static void run_volume(uint8_t voices);
+static void run_mix(uint8_t voices);
+static void run_control(uint8_t voices);
+static void run_render(uint8_t voices);
+static void run_effects(uint8_t voices);
+
+static uint32_t bench_overhead();
+static void bench_case(const bench_case_t *bench, uint8_t voices, uint32_t overhead);
+static void bench_print(const bench_result_t *result, uint32_t budget);
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+bench_result_t bench_results[BENCH_RESULTS]; // Left in SRAM for the debugger
+uint16_t bench_result_count;
+
+static uint32_t frames[AUDIO_BLOCK_SIZE * VOICE_COUNT];
+static int16_t send[AUDIO_BLOCK_SIZE];
+static int16_t left[AUDIO_BLOCK_SIZE];
+static int16_t right[AUDIO_BLOCK_SIZE];
+static uint32_t ramp_block; // Blocks rendered by run_volume(), flips the gain target
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Setup Functions                                                         */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Start the first voices on a held note, each routed to a PWM output and the effects send
+ */
+static void setup_voices(uint8_t voices, waveforms_t wave)
+{
+  synth_init();
+
+  for (uint8_t voice = 0; voice < voices; voice++)
+  {
+    voice_enable(voice, 1);
+    voice_set_waveform(voice, wave);
+    voice_frequency(voice, CHANNEL_FREQ_Q16(110.0f * (voice % 32 + 1)));
+    voice_volume(voice, 100);
+    voice_envelope(voice, 0, 0, MIDI_MAX_VAL, 0);
+    voice_on_off(voice, 1);
+
+    mixer_route(voice, voice % VOICE_COUNT, MIXER_GAIN_UNITY / voices);
+    mixer_route(voice, MIXER_OUTPUT_FX, MIXER_GAIN_UNITY / voices);
+  }
+
+  // Let the envelopes and the gain ramps settle
+  for (uint8_t tick = 0; tick < 2; tick++)
+  {
+    synth_control();
+    for (uint8_t voice = 0; voice < voices; voice++)
+      mixer_render_voice(voice, AUDIO_BLOCK_SIZE);
+  }
+}
+
+static void setup_oscillator(uint8_t voices, int wave)
+{
+  setup_voices(voices, (waveforms_t)wave);
+}
+
+static void setup_filter(uint8_t voices, int mode)
+{
+  setup_voices(voices, WAVEFORM_RAMP);
+
+  for (uint8_t voice = 0; voice < voices; voice++)
+    voice_filter(voice, (filter_mode_t)mode, 60 + voice % 40, 100);
+}
+
+static void setup_render(uint8_t voices, int arg)
+{
+  (void)arg;
+  setup_voices(voices, WAVEFORM_SINE);
+
+  for (uint8_t output = 0; output < VOICE_COUNT; output++)
+    mixer_return(output, MIXER_GAIN_UNITY / 4, MIXER_GAIN_UNITY / 4);
+  for (uint8_t effect = 0; effect < EFFECT_COUNT; effect++)
+    effects_enable((effect_t)effect, 1);
+}
+
+/**
+ * @brief One effect on (the whole chain with EFFECT_COUNT), a ramp on the send
+ */
+static void setup_effects(uint8_t voices, int effect)
+{
+  (void)voices;
+  synth_init();
+
+  for (uint8_t each = 0; each < EFFECT_COUNT; each++)
+    effects_enable((effect_t)each, effect == EFFECT_COUNT || effect == each);
+
+  for (uint16_t n = 0; n < AUDIO_BLOCK_SIZE; n++)
+    send[n] = (int16_t)((n * 2048) - 0x8000); // One ramp period per block
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Run Functions                                                           */
+/*                                                                            */
+/* ========================================================================== */
+
+static void run_oscillator(uint8_t voices)
+{
+  for (uint8_t voice = 0; voice < voices; voice++)
+    mixer_render_voice(voice, AUDIO_BLOCK_SIZE);
+}
+
+/**
+ * @brief Render with a new gain target every block, as a volume change or an envelope does
+ */
+static void run_volume(uint8_t voices)
+{
+  int32_t target = (ramp_block++ & 0x1) ? gain_from_midi(60) : gain_from_midi(120);
+
+  for (uint8_t voice = 0; voice < voices; voice++)
+  {
+    voice_bank.gain_target[voice] = target;
+    mixer_render_voice(voice, AUDIO_BLOCK_SIZE);
+  }
+}
+
+static void run_mix(uint8_t voices)
+{
+  (void)voices;
+  mixer_mix(frames, AUDIO_BLOCK_SIZE);
+}
+
+static void run_control(uint8_t voices)
+{
+  (void)voices;
+  synth_control();
+}
+
+static void run_render(uint8_t voices)
+{
+  (void)voices;
+  synth_render(frames, AUDIO_BLOCK_SIZE);
+}
+
+static void run_effects(uint8_t voices)
+{
+  (void)voices;
+  effects_process(send, left, right, AUDIO_BLOCK_SIZE);
+}
+
+static const bench_case_t cases[] = {
+    {"oscillator", "sine", setup_oscillator, run_oscillator, WAVEFORM_SINE, AUDIO_BLOCK_SIZE, 1},
+    {"oscillator", "trig", setup_oscillator, run_oscillator, WAVEFORM_TRIG, AUDIO_BLOCK_SIZE, 1},
+    {"oscillator", "ramp", setup_oscillator, run_oscillator, WAVEFORM_RAMP, AUDIO_BLOCK_SIZE, 1},
+    {"oscillator", "square", setup_oscillator, run_oscillator, WAVEFORM_SQUARE, AUDIO_BLOCK_SIZE, 1},
+    {"volume", "ramped", setup_oscillator, run_volume, WAVEFORM_SINE, AUDIO_BLOCK_SIZE, 1},
+    {"filter", "low-pass", setup_filter, run_oscillator, FILTER_LOW_PASS, AUDIO_BLOCK_SIZE, 1},
+    {"filter", "band-pass", setup_filter, run_oscillator, FILTER_BAND_PASS, AUDIO_BLOCK_SIZE, 1},
+    {"mix", "outputs", setup_oscillator, run_mix, WAVEFORM_SINE, AUDIO_BLOCK_SIZE, 1},
+    {"control", "tick", setup_oscillator, run_control, WAVEFORM_SINE, CONTROL_TICK_SAMPLES, 1},
+    {"render", "block", setup_render, run_render, 0, AUDIO_BLOCK_SIZE, 1},
+    {"effects", "chorus", setup_effects, run_effects, EFFECT_CHORUS, AUDIO_BLOCK_SIZE, 0},
+    {"effects", "delay", setup_effects, run_effects, EFFECT_DELAY, AUDIO_BLOCK_SIZE, 0},
+    {"effects", "reverb", setup_effects, run_effects, EFFECT_REVERB, AUDIO_BLOCK_SIZE, 0},
+    {"effects", "chain", setup_effects, run_effects, EFFECT_COUNT, AUDIO_BLOCK_SIZE, 0},
+};
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Benchmark Functions                                                     */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Time a stage at a voice count, BENCH_CALLS calls with the interrupts masked
+ * @param overhead Cycles of two back to back counter reads, taken off every call
+ */
+static void bench_case(const bench_case_t *bench, uint8_t voices, uint32_t overhead)
+{
+  uint32_t min_cycles = UINT32_MAX;
+  uint64_t total_cycles = 0;
+
+  bench->setup(voices, bench->arg);
+
+  __disable_irq();
+  bench->run(voices); // Warm the instruction cache
+
+  for (uint16_t call = 0; call < BENCH_CALLS; call++)
+  {
+    uint32_t start = DWT->CYCCNT;
+
+    bench->run(voices);
+
+    uint32_t cycles = DWT->CYCCNT - start - overhead;
+
+    total_cycles += cycles;
+    if (cycles < min_cycles)
+      min_cycles = cycles;
+  }
+  __enable_irq();
+
+  if (bench_result_count >= BENCH_RESULTS)
+    return;
+
+  bench_result_t *result = &bench_results[bench_result_count++];
+
+  result->stage = bench->stage;
+  result->variant = bench->variant;
+  result->voices = bench->scales ? voices : 0;
+  result->min_cycles = min_cycles;
+  result->mean_cycles = (uint32_t)(total_cycles / BENCH_CALLS);
+  result->frames = bench->frames;
+}
+
+/**
+ * @brief Print a result, tenths of a cycle without the float printf
+ * @param budget Cycles in one sample period
+ */
+static void bench_print(const bench_result_t *result, uint32_t budget)
+{
+  uint32_t min_frame = result->min_cycles * 10 / result->frames;
+  uint32_t mean_frame = result->mean_cycles * 10 / result->frames;
+  uint32_t mean_voice = result->voices ? mean_frame / result->voices : mean_frame;
+  uint32_t load = mean_frame * 100 / budget; // Tenths of a percent
+
+  printf("%-10s %-9s %2u  %6lu.%lu  %6lu.%lu  %6lu.%lu  %3lu.%lu%%\r\n", result->stage, result->variant,
+         result->voices, min_frame / 10, min_frame % 10, mean_frame / 10, mean_frame % 10, mean_voice / 10,
+         mean_voice % 10, load / 10, load % 10);
+}
+
+/**
+ * @brief Read the counter back to back, the cost of the timing itself
+ */
+static uint32_t bench_overhead()
+{
+  __disable_irq();
+  uint32_t start = DWT->CYCCNT;
+  uint32_t overhead = DWT->CYCCNT - start;
+  __enable_irq();
+
+  return overhead;
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*        Main Loop                                                           */
+/*                                                                            */
+/* ========================================================================== */
+
+int main(void)
+{
+  // Same clock and cache setup as the firmware
+  SystemClock_Config();
+  MX_ICACHE_Init();
+
+#if BENCH_SEMIHOSTING
+  initialise_monitor_handles();
+#else
+  uart_user_init();
+#endif
+
+  // Enable the cycle counter
+  DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  uint32_t overhead = bench_overhead();
+  uint32_t budget = SystemCoreClock / sample_rate_get();
+
+  printf("\r\nAudio_Synth_H533_bench: %lu Hz core, %lu Hz sample rate, %lu cycles per sample, blocks of %u\r\n",
+         SystemCoreClock, sample_rate_get(), budget, AUDIO_BLOCK_SIZE);
+  printf("stage      variant   voices  min/frame  mean/frame  mean/voice  load\r\n");
+
+  for (uint16_t n = 0; n < sizeof(cases) / sizeof(cases[0]); n++)
+  {
+    const bench_case_t *bench = &cases[n];
+
+    if (!bench->scales)
+    {
+      bench_case(bench, 0, overhead);
+      bench_print(&bench_results[bench_result_count - 1], budget);
+      continue;
+    }
+
+    for (uint16_t voices = 1; voices <= VOICE_BANK_VOICES; voices *= 2)
+    {
+      bench_case(bench, (uint8_t)voices, overhead);
+      bench_print(&bench_results[bench_result_count - 1], budget);
+    }
+  }
+
+  printf("BENCH DONE %u\r\n", bench_result_count);
+
+#if BENCH_SEMIHOSTING
+  exit(0);
+#endif
+
+  // Halt for the debugger running the bench, the results are in bench_results[]
+  if (DCB->DHCSR & DCB_DHCSR_C_DEBUGEN_Msk)
+    __BKPT(0);
+
+  while (1)
+    ;
+}
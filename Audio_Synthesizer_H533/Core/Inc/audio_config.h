@@ -8,11 +8,155 @@
 #ifndef _AUDIO_CONFIG_H_
 #define _AUDIO_CONFIG_H_
 
-#define SAMPLE_FREQUENCY_BITS 16
-#define SAMPLE_FREQUENCY (uint16_t)(0x1 << SAMPLE_FREQUENCY_BITS) // 16,384 Samples / Second
-#define SAMPLE_FREQUENCY_MASK (uint16_t)(SAMPLE_FREQUENCY - 1)
+#define SAMPLE_FREQUENCY (65536UL)     // Default rate, 65,536 Samples / Second (see sample_rate.h)
+#define SAMPLE_FREQUENCY_MIN (16000UL) // Lowest rate sample_rate_set() accepts
+#define SAMPLE_FREQUENCY_MAX (96000UL) // Highest rate, sizes the buffers holding a time (effects lines)
 
 #define MIDI_MAX_VAL (0x7F)
 #define MIDI_MIN_VAL (0x00)
 
-#endif /* _AUDIO_CONFIG_H_ */
\ No newline at end of file
+/* ========================================================================== */
+/*                                                                            */
+/*    Voice Definitions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+#define VOICE_COUNT 7      // PWM outputs, CHANNEL1 - CHANNEL7
+#define PWM_OUTPUT_BITS 10 // Resolution of the PWM compare values
+
+// 1: Render voices with the compile-time specialized kernels (oscillator.hpp), 0: Use the C render loop
+#ifndef OSCILLATOR_KERNELS
+#define OSCILLATOR_KERNELS 1
+#endif
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Mixer Definitions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+// 1: Render virtual voices and sum them into the outputs (mixer.h), 0: Render one voice per PWM output
+#ifndef AUDIO_MIXER
+#define AUDIO_MIXER 1
+#endif
+
+#ifndef MIXER_VOICE_COUNT
+#define MIXER_VOICE_COUNT 16 // Virtual voices, mixed in pairs (even, at least VOICE_COUNT)
+#endif
+#define MIXER_OUTPUT_COUNT (VOICE_COUNT + 2) // PWM outputs CHANNEL1 - CHANNEL7, the DAC, then the effects send
+
+// Error feedback order of the mixer PWM quantizer, 0: Truncate, 1 / 2: Push the quantization noise above the audio band
+#ifndef PWM_NOISE_SHAPING
+#define PWM_NOISE_SHAPING 2
+#endif
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Effects Definitions                                                     */
+/*                                                                            */
+/* ========================================================================== */
+
+// 1: Run the mixer effects send through chorus, delay and reverb (effects.h), 0: No effects bus
+#ifndef AUDIO_EFFECTS
+#define AUDIO_EFFECTS 1
+#endif
+
+#define EFFECTS_ARENA_BYTES (144 * 1024) // SRAM holding every effect delay line, all of them up to ~67 kHz
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Modulation Definitions                                                  */
+/*                                                                            */
+/* ========================================================================== */
+
+// 1: Evaluate the LFOs and the modulation matrix once per block (modulation.h), 0: No modulation
+#ifndef AUDIO_MODULATION
+#define AUDIO_MODULATION 1
+#endif
+
+#define MODULATION_LFO_COUNT 4    // Global LFOs
+#define MODULATION_ROUTE_COUNT 16 // Source to destination slots of the matrix
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Block Rendering Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+// 1: Render blocks into a DMA double buffer, 0: Render every sample in the sample timer IRQ
+#ifndef AUDIO_BLOCK_RENDER
+#define AUDIO_BLOCK_RENDER 1
+#endif
+
+// Samples rendered per half buffer (latency = AUDIO_BLOCK_SIZE / SAMPLE_FREQUENCY)
+#ifndef AUDIO_BLOCK_SIZE
+#define AUDIO_BLOCK_SIZE 32
+#endif
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Scheduler Definitions                                                   */
+/*                                                                            */
+/* ========================================================================== */
+
+// 1: Run the control rate work (MIDI events, LFOs, modulation, envelopes) in PendSV below the audio
+//    interrupts (scheduler.h), 0: Run it in the audio interrupt before every block
+#ifndef AUDIO_SCHEDULER
+#define AUDIO_SCHEDULER AUDIO_BLOCK_RENDER
+#endif
+
+// Audio blocks per control tick (control rate = SAMPLE_FREQUENCY / CONTROL_TICK_SAMPLES)
+#ifndef CONTROL_RATE_DIVIDER
+#define CONTROL_RATE_DIVIDER 1
+#endif
+
+#if AUDIO_SCHEDULER
+#define CONTROL_TICK_SAMPLES (AUDIO_BLOCK_SIZE * CONTROL_RATE_DIVIDER) // Samples between two control ticks
+#else
+#define CONTROL_TICK_SAMPLES AUDIO_BLOCK_SIZE // One tick per block, in the audio interrupt
+#endif
+
+#if AUDIO_SCHEDULER && !AUDIO_BLOCK_RENDER
+#error "The control rate scheduler counts rendered blocks, it needs AUDIO_BLOCK_RENDER"
+#endif
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Profiler Definitions                                                    */
+/*                                                                            */
+/* ========================================================================== */
+
+// 1: Time the audio callback, its stages and every voice with the DWT cycle counter (profiler.h),
+//    0: No instrumentation. On in Debug builds, compiled out of Release builds
+#ifndef AUDIO_PROFILER
+#ifdef DEBUG
+#define AUDIO_PROFILER 1
+#else
+#define AUDIO_PROFILER 0
+#endif
+#endif
+
+#define PROFILER_HISTOGRAM_BINS 16 // Callback cost buckets, each 1 / PROFILER_HISTOGRAM_BINS of the deadline
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Memory Placement Definitions                                            */
+/*                                                                            */
+/* ========================================================================== */
+
+// 1: Run the audio hot path and read the wavetables from SRAM (no flash wait states), 0: Leave them in flash
+#ifndef AUDIO_SRAM_HOT_PATH
+#define AUDIO_SRAM_HOT_PATH 1
+#endif
+
+// Placement of the hot path, copied from flash to SRAM by the startup (see STM32H533xx_FLASH.ld).
+// Host builds have no such sections, the annotations expand to nothing there
+#if AUDIO_SRAM_HOT_PATH && defined(__arm__)
+#define AUDIO_RAMFUNC __attribute__((section(".ramfunc"))) // Code run by the audio interrupts
+#define AUDIO_RAMDATA __attribute__((section(".ramdata"))) // Constant tables read by that code
+#else
+#define AUDIO_RAMFUNC
+#define AUDIO_RAMDATA
+#endif
+
+#endif /* _AUDIO_CONFIG_H_ */
@@ -0,0 +1,64 @@
+/**
+ ******************************************************************************
+ * @file           : block_renderer.h
+ * @brief          : DMA Double-Buffered Block Renderer Header
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "audio_config.h"
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Controller Definitions                                                  */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef _BLOCK_RENDERER_H_
+#define _BLOCK_RENDERER_H_
+
+#define BLOCK_RENDERER_CHANNELS VOICE_COUNT // CCR values per frame (TIM3 CCR1 - CCR4, TIM4 CCR1 - CCR3)
+
+/**
+ * @brief Render callback, fills count frames of BLOCK_RENDERER_CHANNELS CCR values
+ */
+typedef void (*block_renderer_cb_t)(uint32_t *frames, uint16_t count);
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Render both halves of the buffer and start the DMA and sample timer
+ */
+void block_renderer_start();
+
+/**
+ * @brief Halt the sample timer and the DMA transfer
+ */
+void block_renderer_stop();
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Register the Block Render Callback
+ * @param cb Pointer to the function to invoke when a half buffer is free
+ */
+void block_renderer_register_cb(block_renderer_cb_t cb);
+
+/**
+ * @brief Intialize the block renderer component
+ * @note Initializes the sample timer, which then drives the DMA instead of its callback
+ */
+void block_renderer_init();
+
+#endif /* _BLOCK_RENDERER_H_ */
\ No newline at end of file
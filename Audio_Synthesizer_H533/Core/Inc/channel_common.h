@@ -34,19 +34,10 @@ typedef enum
   CHANNEL3,
   CHANNEL4,
   CHANNEL5,
-  CHANNEL6
+  CHANNEL6,
+  CHANNEL7
 } channel_t;
 
-typedef struct
-{
-  uint32_t count;
-  uint16_t freq;
-  uint8_t vol;
-  uint8_t on_off;
-  uint8_t enabled;
-  channel_t channel;
-  waveforms_t waveform;
-  const unsigned short *waveform_data;
-} channel_state_t;
+#define CHANNEL_FREQ_Q16(hz) ((uint32_t)((hz) * 65536.0f)) // Convert Hz into a Q16.16 frequency
 
 #endif /* _CHANNEL_COMMON_H_ */
\ No newline at end of file
@@ -0,0 +1,164 @@
+/**
+ ******************************************************************************
+ * @file           : channel_timer.h
+ * @brief          : Channel 1 to 7 Timer Control Interface Header
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "channel_common.h"
+#include "effects.h"
+#include "filter.h"
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Controller Definitions                                                  */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef _CHANNEL_TIMER_H_
+#define _CHANNEL_TIMER_H_
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Enable the Channel Output
+ * @param channel The channel to enable
+ */
+void channel_enable(channel_t channel);
+
+/**
+ * @brief Disable the Channel Output
+ * @param channel The channel to disable
+ */
+void channel_disable(channel_t channel);
+
+/**
+ * @brief Set the current output waveform
+ * @param channel The channel to modify
+ * @param wave The waveform to synthesize
+ */
+void channel_set_waveform(channel_t channel, waveforms_t wave);
+
+/**
+ * @brief Turn the channel note on or off (no more PWM)
+ * @param channel The channel to modify
+ * @param state Turn the channel on or off (1 is on, 0 is off)
+ */
+void channel_on_off(channel_t channel, uint8_t state);
+
+/**
+ * @brief Set the channel volume
+ * @param channel The channel to modify
+ * @param volume Volume of the signal (up to 127)
+ */
+void channel_volume(channel_t channel, uint8_t volume);
+
+/**
+ * @brief Set the channel envelope
+ * @param channel The channel to modify
+ * @param attack_ms Time from silence to full scale
+ * @param decay_ms Time from full scale to the sustain level
+ * @param sustain Sustain level (up to 127)
+ * @param release_ms Time from the sustain level to silence
+ * @note channel_on_off() opens and closes the envelope gate, so notes fade in and out
+ */
+void channel_envelope(channel_t channel, uint16_t attack_ms, uint16_t decay_ms, uint8_t sustain, uint16_t release_ms);
+
+/**
+ * @brief Set the channel filter
+ * @param channel The channel to modify
+ * @param mode The filter type, FILTER_OFF to bypass it
+ * @param cutoff Cutoff as a MIDI key number (up to 127, 69 is 440 Hz)
+ * @param resonance Resonance (up to 127)
+ * @note Filters are applied to the voices rendered for the mixer (AUDIO_MIXER)
+ */
+void channel_filter(channel_t channel, filter_mode_t mode, uint8_t cutoff, uint8_t resonance);
+
+/**
+ * @brief Set the pulse width of the channel square
+ * @param channel The channel to modify
+ * @param width High part of the period in 128ths (1 to 127, 64 is a square)
+ */
+void channel_pulse_width(channel_t channel, uint8_t width);
+
+/**
+ * @brief Set the channel frequency
+ * @param channel The channel to modify
+ * @param freq Frequency of the signal to synthesize
+ */
+void channel_frequency(channel_t channel, uint16_t freq);
+
+/**
+ * @brief Set the channel frequency with sub-Hz resolution
+ * @param channel The channel to modify
+ * @param freq Frequency of the signal to synthesize in Hz (Q16.16)
+ */
+void channel_frequency_q16(channel_t channel, uint32_t freq);
+
+/**
+ * @brief Move the audio to a new sample rate
+ * @param rate Samples per second, clamped to SAMPLE_FREQUENCY_MIN - SAMPLE_FREQUENCY_MAX
+ * @return The rate the sample timer runs at, the nearest whole period to the request
+ * @note Call with the audio stopped (block_renderer_stop()), then restart it. Retimes the sample timer and
+ *       recomputes the voices, LFOs and effects and resets the profiler, the scheduler stats need a reset
+ *       to pick up the new budget. The noise channel has its own noise_channel_sample_rate()
+ */
+uint32_t channel_sample_rate(uint32_t rate);
+
+/**
+ * @brief Advance every channel by one sample and write the compare registers
+ * @note Per-sample replacement for synth_render(), call from the sample timer
+ */
+void channel_update();
+
+/**
+ * @brief Get the CPU cycles spent rendering a voice in the last block
+ * @param voice The voice to query (a channel_t, or a virtual voice with the mixer)
+ * @return Cycles of the last synth_render() call (divide by the block size for cycles per sample),
+ *         0 without AUDIO_PROFILER. The full history is in profiler_get_stats()
+ */
+uint32_t channel_get_voice_cycles(uint8_t voice);
+
+/**
+ * @brief Get the CPU cycles spent summing the voices into the outputs in the last block
+ * @return Cycles of the last mixer_mix() call, 0 without the mixer or AUDIO_PROFILER
+ */
+uint32_t channel_get_mix_cycles();
+
+/**
+ * @brief Get the CPU cycles spent on the LFOs and the modulation matrix in the last tick
+ * @return Cycles of the last modulation_tick() call, once per control tick, 0 without AUDIO_MODULATION
+ *         or AUDIO_PROFILER
+ */
+uint32_t channel_get_modulation_cycles();
+
+/**
+ * @brief Get the CPU cycles an effect of the effects bus spent in the last block
+ * @param effect The effect to query
+ * @return Cycles of its last stage in mixer_mix(), 0 while off or without AUDIO_EFFECTS or AUDIO_PROFILER
+ * @note Part of channel_get_mix_cycles(), compare against the cycles of a voice to budget polyphony
+ */
+uint32_t channel_get_effect_cycles(effect_t effect);
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Intialize the channel 1 to 7 timers and the voice bank
+ * @note Call after the sample timer is initialized, both timers start on its next update
+ *       so the PWM outputs stay phase-aligned
+ */
+void channel_timer_init();
+
+#endif /* _CHANNEL_TIMER_H_ */
\ No newline at end of file
@@ -18,6 +18,26 @@
 
 #define SAMPLE_TIMER TIM2
 #define SAMPLE_TIMER_IRQ TIM2_IRQn // Ensure to update the IRQ cb if necessary
+#define SAMPLE_TIMER_TRIGGER TIM_SMCR_TS_0 // ITR1, the sample timer TRGO as seen by the channel timers
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Block Renderer Definitions                                              */
+/*                                                                            */
+/* ========================================================================== */
+
+#define BLOCK_RENDERER_DMA GPDMA1_Channel7           // Channels 1 - 4, must be a 2D addressing channel (6 or 7)
+#define BLOCK_RENDERER_DMA_IRQ GPDMA1_Channel7_IRQn // Ensure to update the IRQ cb if necessary
+#define BLOCK_RENDERER_DMA5_7 GPDMA1_Channel6        // Channels 5 - 7, must be a 2D addressing channel (6 or 7)
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Scheduler Definitions                                                   */
+/*                                                                            */
+/* ========================================================================== */
+
+#define SCHEDULER_IRQ PendSV_IRQn   // Control rate tick, the handler calls scheduler_handler()
+#define SCHEDULER_IRQ_PRIORITY 14   // Below every audio interrupt (0), above SysTick (15)
 
 /* ========================================================================== */
 /*                                                                            */
@@ -26,6 +46,7 @@
 /* ========================================================================== */
 
 #define CHANNEL1_4_TIMER TIM3 // Ensure to update the RCC if necessary
+#define CHANNEL1_4_DMA_REQUEST GPDMA1_REQUEST_TIM3_TRIG // DMA burst source, the sample timer trigger
 
 #define CHANNEL1_4_GPIO_PORT GPIOC
 #define CHANNEL1_GPIO_PIN GPIO_PIN_6
@@ -40,6 +61,7 @@
 /* ========================================================================== */
 
 #define CHANNEL5_7_TIMER TIM4 // Ensure to update the RCC if necessary
+#define CHANNEL5_7_DMA_REQUEST GPDMA1_REQUEST_TIM4_CH4 // DMA burst source, compare 4 captures the trigger (no pin)
 
 #define CHANNEL5_7_GPIO_PORT GPIOB
 #define CHANNEL5_GPIO_PIN GPIO_PIN_6
@@ -52,8 +74,11 @@
 /*                                                                            */
 /* ========================================================================== */
 
-#define CHANNEL8_DAC DAC1 // Ensure to update the RCC if necessary
-#define CHANNEL8_DAC_CH DAC1_CHANNEL_2
+#define CHANNEL8_DAC DAC1                     // Ensure to update the RCC if necessary
+#define CHANNEL8_DAC_TRIGGER DAC_CR_TSEL2_1   // TSEL2 = 2, TIM2 TRGO (the sample timer)
+#define CHANNEL8_DMA GPDMA1_Channel5          // Any linear channel (0 - 5)
+#define CHANNEL8_DMA_IRQ GPDMA1_Channel5_IRQn // Ensure to update the IRQ cb if necessary
+#define CHANNEL8_DMA_REQUEST GPDMA1_REQUEST_DAC1_CH2
 
 #define CHANNEL8_GPIO_PORT GPIOA
 #define CHANNEL8_GPIO_PIN GPIO_PIN_5
@@ -64,13 +89,23 @@
 /*                                                                            */
 /* ========================================================================== */
 
-#define USER_UART UART1
+#define USER_UART USART1 // Ensure to update the RCC if necessary
+#define USER_UART_BAUD 115200
+#define USER_UART_AF GPIO_AF4_USART1
 
 #define USER_UART_PORT GPIOB
 #define USER_UART_TX_PIN GPIO_PIN_14
 #define USER_UART_RX_PIN GPIO_PIN_15
 
-#define MIDI_UART UART3
+#define MIDI_UART USART3                              // Ensure to update the RCC if necessary
+#define MIDI_UART_IRQ USART3_IRQn                     // Idle line, ensure to update the IRQ cb if necessary
+#define MIDI_UART_IRQ_PRIORITY SCHEDULER_IRQ_PRIORITY // With the control tick, below every audio interrupt
+#define MIDI_UART_BAUD 31250
+#define MIDI_UART_AF GPIO_AF7_USART3
+
+#define MIDI_UART_DMA GPDMA1_Channel0          // Any linear channel (0 - 5)
+#define MIDI_UART_DMA_IRQ GPDMA1_Channel0_IRQn // Ensure to update the IRQ cb if necessary
+#define MIDI_UART_DMA_REQUEST GPDMA1_REQUEST_USART3_RX
 
 #define MIDI_UART_PORT GPIOB
 #define MIDI_UART_TX_PIN GPIO_PIN_10
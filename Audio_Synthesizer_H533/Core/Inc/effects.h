@@ -0,0 +1,163 @@
+/**
+ ******************************************************************************
+ * @file           : effects.h
+ * @brief          : Master Effects Bus Header
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "audio_config.h"
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Effects Definitions                                                     */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef _EFFECTS_H_
+#define _EFFECTS_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * The mixer sums the voices routed to MIXER_OUTPUT_FX into a mono send, the chain
+ * turns it into a stereo return and mixer_return() adds the return to the outputs:
+ *   send -> chorus (mono to stereo) -> delay (stereo) -> reverb (stereo) -> return
+ * A disabled effect passes its input through untouched and costs nothing.
+ */
+
+#define EFFECTS_DELAY_SAMPLES 16384  // Longest delay, 250 ms at 65.5 kHz (an eighth at 120 BPM)
+#define EFFECTS_CHORUS_SAMPLES 2048  // Chorus line, 21 ms at SAMPLE_FREQUENCY_MAX
+#define EFFECTS_CHORUS_BASE_MS 12    // Centre of the chorus sweep
+#define EFFECTS_CHORUS_DEPTH_MS 8    // Sweep around the centre at full depth
+#define EFFECTS_REVERB_COMBS 8       // Parallel feedback combs per side
+#define EFFECTS_REVERB_ALLPASSES 4   // Series allpasses per side
+
+typedef enum
+{
+  EFFECT_CHORUS,
+  EFFECT_DELAY,
+  EFFECT_REVERB,
+  EFFECT_COUNT
+} effect_t;
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Turn an effect of the chain on or off
+ * @param effect The effect
+ * @param state 1 to process (from silent lines), 0 to pass through
+ * @note Effects whose lines did not fit in the arena stay off
+ */
+void effects_enable(effect_t effect, uint8_t state);
+
+/**
+ * @brief Set the stereo delay
+ * @param left_ms Left delay time (clamped to EFFECTS_DELAY_SAMPLES)
+ * @param right_ms Right delay time
+ * @param feedback Echo fed back into the same side (up to 127)
+ * @param cross Echo fed into the other side (up to 127), ping-pong without feedback
+ * @param mix Echo added to the input (up to 127)
+ * @note feedback + cross above 127 grows without bound until the delay line saturates
+ */
+void effects_delay(uint16_t left_ms, uint16_t right_ms, uint8_t feedback, uint8_t cross, uint8_t mix);
+
+/**
+ * @brief Set both delay times to a note length at a tempo
+ * @param bpm Tempo in quarter notes per minute
+ * @param numerator Note length numerator (3 with 16 is a dotted eighth)
+ * @param denominator Note length denominator (4 is a quarter note)
+ */
+void effects_delay_sync(uint16_t bpm, uint8_t numerator, uint8_t denominator);
+
+/**
+ * @brief Set the chorus
+ * @param rate Sweep frequency in Hz (Q16.16)
+ * @param depth Sweep around EFFECTS_CHORUS_BASE_MS (up to 127, EFFECTS_CHORUS_DEPTH_MS at 127)
+ * @param mix Swept voices added to the input (up to 127)
+ * @note The left and right taps sweep a quarter period apart
+ */
+void effects_chorus(uint32_t rate, uint8_t depth, uint8_t mix);
+
+/**
+ * @brief Set the reverb
+ * @param size Room size (up to 127), longer tails as it grows
+ * @param damping High frequency loss of the tail (up to 127)
+ * @param mix Reverb added to the input (up to 127)
+ */
+void effects_reverb(uint8_t size, uint8_t damping, uint8_t mix);
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Render Functions                                                        */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Run a block of the send through the chain
+ * @param send Mono Q15 input
+ * @param left Q15 left return
+ * @param right Q15 right return
+ * @param count Number of samples (up to AUDIO_BLOCK_SIZE)
+ */
+void effects_process(const int16_t *send, int16_t *left, int16_t *right, uint16_t count);
+
+/**
+ * @brief Check if any effect of the chain is on
+ */
+uint8_t effects_active();
+
+/**
+ * @brief Get the cycles an effect spent on the last block
+ * @param effect The effect
+ * @return Counter ticks of its last effects_process() stage, 0 without a counter or while off
+ */
+uint32_t effects_get_cycles(effect_t effect);
+
+/**
+ * @brief Set the counter timing each effect
+ * @param counter Free-running counter read before and after each effect (DWT->CYCCNT on the target)
+ */
+void effects_cycle_counter(uint32_t (*counter)());
+
+/**
+ * @brief Get the SRAM taken from the arena by the delay lines
+ * @return Bytes used out of EFFECTS_ARENA_BYTES
+ */
+uint32_t effects_arena_used();
+
+/**
+ * @brief Carve the lines again and recompute the delay and chorus for the current sample rate
+ * @note Call after sample_timer_set_rate() with the audio stopped, the effects restart from silence.
+ *       The delay times are clamped to EFFECTS_DELAY_SAMPLES, and above ~67 kHz the reverb no longer
+ *       fits in the arena and stays off until the rate comes back down
+ */
+void effects_sample_rate();
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Carve the delay lines out of the arena and turn every effect off
+ * @note The settings start at a 125 ms / 188 ms delay, a slow chorus and a medium room
+ */
+void effects_init();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _EFFECTS_H_ */
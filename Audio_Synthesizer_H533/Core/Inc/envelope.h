@@ -0,0 +1,129 @@
+/**
+ ******************************************************************************
+ * @file           : envelope.h
+ * @brief          : ADSR Envelope Generator Header
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "audio_config.h"
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Envelope Definitions                                                    */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef _ENVELOPE_H_
+#define _ENVELOPE_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define ENVELOPE_FULL ((int32_t)0x1 << 30) // Gain of 1.0, envelope levels are Q30
+
+// Samples between two envelope evaluations, the renderers ramp the gain linearly in between
+#if AUDIO_BLOCK_RENDER
+#define ENVELOPE_TICK_SAMPLES CONTROL_TICK_SAMPLES
+#else
+#define ENVELOPE_TICK_SAMPLES 1
+#endif
+
+typedef enum
+{
+  ENVELOPE_IDLE,    // Silent, the voice is not rendered
+  ENVELOPE_ATTACK,  // Rising towards full scale
+  ENVELOPE_DECAY,   // Falling towards the sustain level
+  ENVELOPE_SUSTAIN, // Holding while the note is on
+  ENVELOPE_RELEASE  // Falling towards silence after the note off
+} envelope_stage_t;
+
+/**
+ * @brief Exponential ADSR state of one voice
+ * @note Each segment covers a fixed fraction of the distance to a target past its end
+ *       (one-pole), so it reaches the end in a finite number of ticks
+ */
+typedef struct
+{
+  int32_t level;         // Current gain (Q30)
+  int32_t sustain;       // Sustain gain (Q30)
+  int32_t attack;        // Fraction of the distance covered per tick (Q30)
+  int32_t decay;         // Fraction of the distance covered per tick (Q30)
+  int32_t release;       // Fraction of the distance covered per tick (Q30)
+  uint16_t attack_ms;    // Segment times, kept to recompute the coefficients at a new sample rate
+  uint16_t decay_ms;     //
+  uint16_t release_ms;   //
+  uint8_t sustain_value; // Sustain level (up to 127)
+  uint8_t stage;         // envelope_stage_t
+} envelope_t;
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Set the segment times and the sustain level
+ * @param env The envelope to modify
+ * @param attack_ms Time from silence to full scale
+ * @param decay_ms Time from full scale to the sustain level
+ * @param sustain Sustain level (up to 127)
+ * @param release_ms Time from the sustain level to silence
+ * @note Computes the per-tick coefficients (floating point), call from the control path
+ */
+void envelope_set(envelope_t *env, uint16_t attack_ms, uint16_t decay_ms, uint8_t sustain, uint16_t release_ms);
+
+/**
+ * @brief Open or close the gate
+ * @param env The envelope to modify
+ * @param state 1 starts the attack from the current level, 0 starts the release
+ */
+void envelope_gate(envelope_t *env, uint8_t state);
+
+/**
+ * @brief Advance the envelope by one tick (ENVELOPE_TICK_SAMPLES samples)
+ * @param env The envelope to advance
+ * @return The level at the end of the tick (Q30)
+ */
+int32_t envelope_tick(envelope_t *env);
+
+/**
+ * @brief Recompute the per-tick coefficients for the current sample rate
+ * @param env The envelope to update
+ * @note The level and stage are kept, the segments continue at the new rate
+ */
+void envelope_sample_rate(envelope_t *env);
+
+/**
+ * @brief Check if the envelope is silent and done
+ * @param env The envelope to query
+ * @return 1 once the release has finished (or before the first gate)
+ */
+static inline uint8_t envelope_idle(const envelope_t *env)
+{
+  return env->stage == ENVELOPE_IDLE;
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Reset an envelope to idle with short click-free attack and release times
+ * @param env The envelope to reset
+ */
+void envelope_init(envelope_t *env);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ENVELOPE_H_ */
@@ -0,0 +1,117 @@
+/**
+ ******************************************************************************
+ * @file           : filter.h
+ * @brief          : Resonant State-Variable Filter Header
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "audio_config.h"
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Filter Definitions                                                      */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef _FILTER_H_
+#define _FILTER_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define FILTER_KEYS 128            // Cutoffs of the coefficient table, one per MIDI key (8.2 Hz - 12.5 kHz)
+#define FILTER_MODULATION_RANGE 48 // Cutoff offset at full modulation depth in semitones
+
+typedef enum
+{
+  FILTER_OFF,      // Samples pass untouched, no cost
+  FILTER_LOW_PASS, // 12 dB / octave low-pass
+  FILTER_BAND_PASS // Band-pass, unity gain at the cutoff
+} filter_mode_t;
+
+/**
+ * @brief Trapezoidal (zero-delay feedback) state-variable filter of one voice
+ * @note Stable at every cutoff and resonance, so the coefficients can jump between blocks
+ */
+typedef struct
+{
+  int32_t ic1;   // First integrator state (Q23)
+  int32_t ic2;   // Second integrator state (Q23)
+  int32_t a1;    // Coefficients of the current block (Q31)
+  int32_t a2;    //
+  int32_t a3;    //
+  int32_t bp;    // Band-pass output scale, k (Q29), makes the peak unity
+  int32_t key;   // Cutoff as a key number before modulation (Q8)
+  float damping; // k = 1 / Q, precomputed from the resonance
+  uint8_t mode;  // filter_mode_t
+} filter_t;
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Set the filter type, cutoff and resonance
+ * @param filter The filter to modify
+ * @param mode The filter type
+ * @param cutoff Cutoff as a MIDI key number (up to 127, 69 is 440 Hz)
+ * @param resonance Resonance (up to 127), 0 is Q = 0.5 and 127 rings at Q = 25
+ * @note Applies the cutoff with no modulation
+ */
+void filter_set(filter_t *filter, filter_mode_t mode, uint8_t cutoff, uint8_t resonance);
+
+/**
+ * @brief Move the cutoff away from its set value until the next call
+ * @param filter The filter to modify
+ * @param offset Cutoff modulation (Q15), full scale is FILTER_MODULATION_RANGE semitones
+ * @note Interpolates the coefficient table, no trigonometry, call once per block
+ */
+void filter_modulate(filter_t *filter, int32_t offset);
+
+/**
+ * @brief Filter a block of Q15 samples in place
+ * @param filter The filter to run
+ * @param samples First sample
+ * @param count Number of samples
+ * @param stride Distance between two samples
+ */
+void filter_process(filter_t *filter, int16_t *samples, uint16_t count, uint16_t stride);
+
+/**
+ * @brief Clear the filter memory
+ * @param filter The filter to clear
+ */
+void filter_reset(filter_t *filter);
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Compute the coefficient table of the sample rate
+ * @note Call once before filter_set() and again after a sample rate change, uses trigonometry
+ *       (floating point). The filters pick the new table up at their next filter_modulate()
+ */
+void filter_table_init();
+
+/**
+ * @brief Reset a filter to off with its cutoff fully open
+ * @param filter The filter to reset
+ */
+void filter_init(filter_t *filter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _FILTER_H_ */
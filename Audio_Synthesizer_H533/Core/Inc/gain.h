@@ -0,0 +1,94 @@
+/**
+ ******************************************************************************
+ * @file           : gain.h
+ * @brief          : Gain Stage Header
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdint.h>
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include <arm_acle.h>
+#endif
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Gain Definitions                                                        */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef _GAIN_H_
+#define _GAIN_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define GAIN_UNITY ((int32_t)0x1 << 16) // Gain of 1.0, gains are Q16 so a Q15 sample times a gain stays Q15
+
+/**
+ * @brief Scale a Q15 sample by a gain
+ * @param gain Gain (Q16, up to GAIN_UNITY)
+ * @param sample Q15 sample, only the low 16 bits are used
+ * @return The scaled Q15 sample
+ * @note One SMULWB on cores with the DSP extension
+ */
+static inline int32_t gain_apply(int32_t gain, int32_t sample)
+{
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+  return __smulwb(gain, sample);
+#else
+  return (int32_t)(((int64_t)gain * (int16_t)sample) >> 16);
+#endif
+}
+
+/**
+ * @brief Ramp a gain linearly towards a target across a block
+ * @param gain Gain before the block, updated to the gain after the block (Q16)
+ * @param target Gain to reach at the end of the block (Q16)
+ * @param count Samples in the block
+ * @param step Output, gain change per sample, add it before each sample is scaled
+ * @return Gain before the first sample
+ * @note Ramps shorter than one step per sample jump straight to the target (under -66 dB)
+ */
+static inline int32_t gain_ramp(int32_t *gain, int32_t target, uint16_t count, int32_t *step)
+{
+  int32_t start = *gain;
+  int32_t distance = target - start;
+
+  if (distance < (int32_t)count && distance > -(int32_t)count)
+  {
+    *step = 0;
+    *gain = target;
+    return target;
+  }
+
+  *step = distance / (int32_t)count;
+  *gain = start + *step * count;
+  return start;
+}
+
+/**
+ * @brief Convert a MIDI volume or velocity to a gain
+ * @param value MIDI value (up to 127), 127 is unity and 0 is silent
+ * @return The gain (Q16), following the dB law of gain_data.h (GAIN_RANGE_DB across the range)
+ */
+int32_t gain_from_midi(uint8_t value);
+
+/**
+ * @brief Multiply two gains
+ * @return a * b (Q16)
+ */
+static inline int32_t gain_mul(int32_t a, int32_t b)
+{
+  return (int32_t)(((int64_t)a * b) >> 16);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _GAIN_H_ */
@@ -0,0 +1,183 @@
+/**
+ ******************************************************************************
+ * @file           : midi.h
+ * @brief          : MIDI Message Handling Header
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdint.h>
+
+/* ========================================================================== */
+/*                                                                            */
+/*    MIDI Definitions                                                        */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef _MIDI_H_
+#define _MIDI_H_
+
+#define MIDI_NOTE_NONE 0xFF // No key held on a voice
+#define MIDI_QUEUE_LENGTH 64 // Messages held until the next control tick (a power of two)
+
+/**
+ * @brief Kind of a parsed message, the channel messages match the high nibble of their status
+ */
+typedef enum
+{
+  MIDI_EVENT_NOTE_OFF = 0x8,
+  MIDI_EVENT_NOTE_ON = 0x9,
+  MIDI_EVENT_KEY_PRESSURE = 0xA,
+  MIDI_EVENT_CONTROL_CHANGE = 0xB,
+  MIDI_EVENT_PROGRAM_CHANGE = 0xC,
+  MIDI_EVENT_CHANNEL_PRESSURE = 0xD,
+  MIDI_EVENT_PITCH_BEND = 0xE,
+  MIDI_EVENT_SYSTEM_COMMON,    // F1 - F6, data1 and data2 as sent
+  MIDI_EVENT_SYSTEM_EXCLUSIVE, // F0 ... F7, see sysex
+  MIDI_EVENT_REAL_TIME         // F8 - FF, single byte
+} midi_event_type_t;
+
+/**
+ * @brief Message completed by midi_parse(), valid until the next byte is parsed
+ */
+typedef struct
+{
+  uint8_t type;          // midi_event_type_t
+  uint8_t status;        // Status byte, the low nibble is the channel of a channel message
+  uint8_t data1;         // First data byte, 0 if the message has none
+  uint8_t data2;         // Second data byte, 0 if the message has fewer
+  const uint8_t *sysex;  // System exclusive bytes between F0 and F7, in the parser buffer
+  uint16_t sysex_length; // Bytes at sysex, cut to the buffer capacity
+} midi_event_t;
+
+/**
+ * @brief Incremental parser state, one per byte stream
+ */
+typedef struct
+{
+  uint8_t status;          // Running status, 0 if the next data byte has no message to join
+  uint8_t expected;        // Data bytes of a status message
+  uint8_t count;           // Data bytes received of the current message
+  uint8_t data[2];         // Data bytes received
+  uint8_t in_sysex;        // 1 between F0 and the byte ending it
+  uint8_t *sysex;          // Buffer of the system exclusive bytes, NULL skips them
+  uint16_t sysex_capacity; // Bytes the buffer holds
+  uint16_t sysex_length;   // Bytes stored of the current system exclusive message
+  midi_event_t event;      // Last completed message
+} midi_parser_t;
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Start a note, the voice of the MIDI channel enters its attack
+ * @param channel MIDI channel (0 - 15), one voice per channel
+ * @param key Key number (0 - 127)
+ * @param velocity Key velocity (0 - 127), 0 is a note off
+ */
+void midi_note_on(uint8_t channel, uint8_t key, uint8_t velocity);
+
+/**
+ * @brief Stop a note, the voice of the MIDI channel enters its release
+ * @param channel MIDI channel (0 - 15)
+ * @param key Key number (0 - 127), ignored unless it is the key the voice plays
+ */
+void midi_note_off(uint8_t channel, uint8_t key);
+
+/**
+ * @brief Change a controller of a MIDI channel
+ * @param channel MIDI channel (0 - 15)
+ * @param control Controller number (0 - 119), only the modulation wheel (1) and channel volume (7) are handled
+ * @param value Controller value (0 - 127)
+ */
+void midi_control_change(uint8_t channel, uint8_t control, uint8_t value);
+
+/**
+ * @brief Change the channel pressure (aftertouch) of a MIDI channel
+ * @param channel MIDI channel (0 - 15)
+ * @param pressure Pressure (0 - 127), a modulation source of the channel voice
+ */
+void midi_channel_pressure(uint8_t channel, uint8_t pressure);
+
+/**
+ * @brief Feed one byte of a MIDI stream to a parser
+ * @param parser Parser of the stream
+ * @param byte Next byte received
+ * @return The message the byte completes, NULL if none. Points into the parser, no copy is made
+ * @note O(1) per byte. Running status is kept across messages, real-time bytes (F8 - FF) are
+ *       returned at once wherever they fall and the interrupted message carries on. A status
+ *       byte other than F7 inside a system exclusive message abandons it
+ */
+const midi_event_t *midi_parse(midi_parser_t *parser, uint8_t byte);
+
+/**
+ * @brief Apply a parsed message to the voices
+ * @param event The message
+ * @note Note on, note off, control change and channel pressure drive the voices, the other messages are skipped
+ */
+void midi_apply(const midi_event_t *event);
+
+/**
+ * @brief Handle a buffer of MIDI bytes at once
+ * @param data Message bytes
+ * @param length Number of bytes
+ * @note Parsed as one stream across calls, a message may be split between buffers
+ */
+void midi_process(const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Queue the message completed by a received byte for the next control tick
+ * @param byte Next byte of the MIDI input
+ * @return 1 unless the byte completed a message and the queue was full
+ * @note Only the messages midi_apply() acts on are queued. One producer at a time (the UART
+ *       interrupt or the main loop), midi_dispatch() is the consumer
+ */
+uint8_t midi_receive(uint8_t byte);
+
+/**
+ * @brief Queue a buffer of MIDI bytes for the next control tick, see midi_receive()
+ * @param data Message bytes
+ * @param length Number of bytes
+ * @return 1 if every message was queued, 0 if the queue filled up and the rest was dropped
+ */
+uint8_t midi_post(const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Apply the queued messages to the voices
+ * @note Called from the control tick (see scheduler.h), so voice changes never race the block render.
+ *       Without AUDIO_SCHEDULER synth_render() calls it, or channel_update() when rendering per sample
+ */
+void midi_dispatch();
+
+/**
+ * @brief Get the frequency of a key (equal temperament, A4 = 440 Hz)
+ * @param key Key number (0 - 127)
+ * @return Frequency in Hz (Q16.16)
+ */
+uint32_t midi_note_frequency(uint8_t key);
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Reset a parser, no running status
+ * @param parser Parser to reset
+ * @param sysex Buffer of the system exclusive bytes, NULL to skip them
+ * @param capacity Bytes the buffer holds
+ */
+void midi_parser_init(midi_parser_t *parser, uint8_t *sysex, uint16_t capacity);
+
+/**
+ * @brief Enable the voice of every MIDI channel, all notes off
+ * @note Call after the voice bank is initialized (channel_timer_init())
+ */
+void midi_init();
+
+#endif /* _MIDI_H_ */
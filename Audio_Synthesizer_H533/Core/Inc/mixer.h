@@ -0,0 +1,119 @@
+/**
+ ******************************************************************************
+ * @file           : mixer.h
+ * @brief          : Virtual Voice Mixer Header
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "audio_config.h"
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Mixer Definitions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef _MIXER_H_
+#define _MIXER_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define MIXER_OUTPUT_DAC VOICE_COUNT       // Output index of the DAC, after the PWM outputs
+#define MIXER_OUTPUT_FX (VOICE_COUNT + 1)  // Output index of the effects send, see effects.h
+#define MIXER_GAIN_UNITY ((int16_t)0x7FFF) // Q15 route gain of 1.0
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Set the gain of a voice in an output
+ * @param voice The virtual voice (up to MIXER_VOICE_COUNT - 1)
+ * @param output The PWM output (channel_t), MIXER_OUTPUT_DAC or MIXER_OUTPUT_FX
+ * @param gain Q15 gain, 0 removes the route, negative values invert the voice
+ * @note Routes sum with saturation, the outputs clip instead of wrapping
+ */
+void mixer_route(uint8_t voice, uint8_t output, int16_t gain);
+
+/**
+ * @brief Get the gain of a voice in an output
+ * @param voice The virtual voice
+ * @param output The PWM output (channel_t), MIXER_OUTPUT_DAC or MIXER_OUTPUT_FX
+ * @return Q15 gain, 0 if not routed
+ */
+int16_t mixer_get_route(uint8_t voice, uint8_t output);
+
+/**
+ * @brief Set the gains of the effects return in an output
+ * @param output The PWM output (channel_t) or MIXER_OUTPUT_DAC
+ * @param left Q15 gain of the left return, 0 removes it
+ * @param right Q15 gain of the right return, 0 removes it
+ * @note Only mixed while a voice is routed to MIXER_OUTPUT_FX and an effect is on
+ */
+void mixer_return(uint8_t output, int16_t left, int16_t right);
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Render Functions                                                        */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Render a block of one virtual voice into the mixer input
+ * @param voice The virtual voice
+ * @param count Number of samples to render (up to AUDIO_BLOCK_SIZE)
+ * @note Render every voice, then call mixer_mix() with the same count. A voice routed to no output
+ *       is skipped and holds its phase
+ */
+void mixer_render_voice(uint8_t voice, uint16_t count);
+
+/**
+ * @brief Sum the rendered voices into every output
+ * @param frames Interleaved output, frames[n * VOICE_COUNT + channel] holds the CCR of sample n
+ * @param count Number of samples to mix (up to AUDIO_BLOCK_SIZE)
+ * @note The DAC output is appended to the DAC bus, see mixer_dac_bus(), so consecutive counts
+ *       should add up to AUDIO_BLOCK_SIZE (mixer_render() splits its blocks accordingly)
+ *       The effects send is processed first and its return added to each output before quantizing
+ */
+void mixer_mix(uint32_t *frames, uint16_t count);
+
+/**
+ * @brief Render every virtual voice and mix them into the outputs
+ * @param frames Interleaved output, frames[n * VOICE_COUNT + channel] holds the CCR of sample n
+ * @param count Number of samples to render (any count, split in blocks of AUDIO_BLOCK_SIZE)
+ */
+void mixer_render(uint32_t *frames, uint16_t count);
+
+/**
+ * @brief Get the last complete block of the DAC output
+ * @return AUDIO_BLOCK_SIZE Q15 samples, NULL while neither a voice nor the effects return reaches the DAC
+ * @note The block stays valid until the mixer completes the next one
+ */
+const int16_t *mixer_dac_bus();
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Clear the routes and returns, then send every voice to PWM output voice % VOICE_COUNT
+ * @note The voices themselves live in the voice bank, see voice_bank.h
+ */
+void mixer_init();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MIXER_H_ */
@@ -0,0 +1,128 @@
+/**
+ ******************************************************************************
+ * @file           : modulation.h
+ * @brief          : LFO and Modulation Matrix Header
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "audio_config.h"
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Modulation Definitions                                                  */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef _MODULATION_H_
+#define _MODULATION_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define MODULATION_TICK_SAMPLES CONTROL_TICK_SAMPLES // Samples between two evaluations of the matrix
+#define MODULATION_PITCH_RANGE 12                    // Pitch offset at full depth in semitones
+
+typedef enum
+{
+  MODULATION_LFO_SINE,       // Read from the sine wavetable
+  MODULATION_LFO_TRIANGLE,   // Read from the triangle wavetable
+  MODULATION_LFO_SAMPLE_HOLD // A new random value every period
+} modulation_lfo_wave_t;
+
+typedef enum
+{
+  MODULATION_SOURCE_NONE,       // Unused route
+  MODULATION_SOURCE_LFO1,       // Global LFOs, bipolar unless set unipolar
+  MODULATION_SOURCE_LFO2,       //
+  MODULATION_SOURCE_LFO3,       //
+  MODULATION_SOURCE_LFO4,       //
+  MODULATION_SOURCE_ENVELOPE,   // ADSR level of the voice, unipolar
+  MODULATION_SOURCE_VELOCITY,   // Velocity of the voice note, unipolar
+  MODULATION_SOURCE_MOD_WHEEL,  // Controller 1 of the voice MIDI channel, unipolar
+  MODULATION_SOURCE_AFTERTOUCH, // Channel pressure of the voice MIDI channel, unipolar
+  MODULATION_SOURCE_COUNT
+} modulation_source_t;
+
+typedef enum
+{
+  MODULATION_DEST_PITCH,       // Full scale is MODULATION_PITCH_RANGE semitones up or down
+  MODULATION_DEST_VOLUME,      // Attenuation, full scale negative is silent (positive sums are clipped at unity)
+  MODULATION_DEST_CUTOFF,      // Filter cutoff, full scale is FILTER_MODULATION_RANGE semitones up or down
+  MODULATION_DEST_PULSE_WIDTH, // Square pulse width, full scale is half a period wider or narrower
+  MODULATION_DEST_COUNT
+} modulation_destination_t;
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Configure a global LFO
+ * @param lfo The LFO (up to MODULATION_LFO_COUNT - 1)
+ * @param wave The LFO waveform
+ * @param rate Frequency in Hz (Q16.16)
+ * @param unipolar 1 for values from 0 to full scale, 0 for values around 0
+ */
+void modulation_lfo(uint8_t lfo, modulation_lfo_wave_t wave, uint32_t rate, uint8_t unipolar);
+
+/**
+ * @brief Recompute the LFO increments for the current sample rate
+ */
+void modulation_sample_rate();
+
+/**
+ * @brief Set a slot of the modulation matrix, applied to every voice
+ * @param slot The route (up to MODULATION_ROUTE_COUNT - 1)
+ * @param source The source, MODULATION_SOURCE_NONE clears the slot
+ * @param destination The destination
+ * @param depth Amount of the source added to the destination (Q15, negative inverts)
+ */
+void modulation_route(uint8_t slot, modulation_source_t source, modulation_destination_t destination, int16_t depth);
+
+/**
+ * @brief Set a MIDI controller source of a voice
+ * @param voice The voice of the MIDI channel
+ * @param source MODULATION_SOURCE_MOD_WHEEL or MODULATION_SOURCE_AFTERTOUCH
+ * @param value Controller value (up to 127)
+ */
+void modulation_controller(uint8_t voice, modulation_source_t source, uint8_t value);
+
+/**
+ * @brief Advance the LFOs by one tick and apply the matrix to every voice in use
+ * @note Call once every MODULATION_TICK_SAMPLES, from the control tick (see synth_control())
+ */
+void modulation_tick();
+
+/**
+ * @brief Get the sum of the routes into a destination of a voice after the last tick
+ * @param voice The voice to query
+ * @param destination The destination
+ * @return The modulation (Q15, saturated)
+ */
+int32_t modulation_output(uint8_t voice, modulation_destination_t destination);
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Clear the matrix and the controllers, reset the LFOs to bipolar sines at 1 Hz
+ * @note Call after the voice bank is initialized
+ */
+void modulation_init();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MODULATION_H_ */
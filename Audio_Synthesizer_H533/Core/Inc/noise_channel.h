@@ -1,68 +1,97 @@
-// /**
-//  *******************************************************************************
-//  * @file    noise_channel.h
-//  * @brief   DAC-based Noise Channel Control Interface Header
-//  *******************************************************************************
-//  */
-
-//  #ifndef _NOISE_CHANNEL_H_
-//  #define _NOISE_CHANNEL_H_
- 
-//  #include <stdlib.h>
-//  #include <stdint.h>
-//  #include "channel_common.h"
-//  #include "audio_config.h"
- 
-//  /* Exported Functions --------------------------------------------------------*/
- 
-//  /**
-//    * @brief  Enable the noise channel output via DAC.
-//    * @note   Starts the DAC conversion.
-//    */
-//  void noise_channel_enable(void);
- 
-//  /**
-//    * @brief  Disable the noise channel output.
-//    * @note   Stops the DAC conversion.
-//    */
-//  void noise_channel_disable(void);
- 
-//  /**
-//    * @brief  Set the waveform for the noise channel.
-//    * @param  wave  The waveform to use (should be WAVEFORM_NOISE).
-//    */
-//  void noise_channel_set_waveform(waveforms_t wave);
- 
-//  /**
-//    * @brief  Turn the noise channel on or off.
-//    * @param  state  1 to turn on, 0 to turn off.
-//    * @note   When turned on, the sample counter is reset.
-//    */
-//  void noise_channel_on_off(uint8_t state);
- 
-//  /**
-//    * @brief  Set the noise channel volume.
-//    * @param  volume  Volume level (0 ~ 127).
-//    */
-//  void noise_channel_volume(uint8_t volume);
- 
-//  /**
-//    * @brief  Set the noise channel frequency.
-//    * @param  freq  Frequency parameter affecting sample index increment.
-//    */
-//  void noise_channel_frequency(uint16_t freq);
- 
-//  /**
-//    * @brief  Update the DAC output based on the noise channel state.
-//    * @note   This function should be called periodically (e.g., via a timer interrupt or DMA trigger)
-//    *         to output the next sample from the noise waveform.
-//    */
-//  void noise_channel_update(void);
- 
-//  /**
-//    * @brief  Initialize the DAC-based noise channel.
-//    */
-//  void noise_channel_init(void);
- 
-//  #endif /* _NOISE_CHANNEL_H_ */
- 
\ No newline at end of file
+/**
+ ******************************************************************************
+ * @file           : noise_channel.h
+ * @brief          : DAC Noise Channel Control Interface Header
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "channel_common.h"
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Controller Definitions                                                  */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef _NOISE_CHANNEL_H_
+#define _NOISE_CHANNEL_H_
+
+#define NOISE_DAC_BITS 12                                     // Resolution of the DAC
+#define NOISE_DAC_MID ((uint32_t)0x1 << (NOISE_DAC_BITS - 1)) // Mid-scale output, a Q15 zero
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Enable the noise channel output
+ * @note Starts the DAC and its DMA, conversions follow the sample timer
+ */
+void noise_channel_enable();
+
+/**
+ * @brief Disable the noise channel output
+ * @note Stops the DAC and its DMA
+ */
+void noise_channel_disable();
+
+/**
+ * @brief Turn the noise on or off (silence is mid-scale)
+ * @param state Turn the channel on or off (1 is on, 0 is off)
+ */
+void noise_channel_on_off(uint8_t state);
+
+/**
+ * @brief Set the noise volume
+ * @param volume Volume of the signal (up to 127), mapped to a gain by gain_from_midi()
+ * @note The gain ramps to the new value across the next block
+ */
+void noise_channel_volume(uint8_t volume);
+
+/**
+ * @brief Set the sample-and-hold rate of pitched noise
+ * @param freq New random values per second, 0 for white noise (a new value every sample)
+ */
+void noise_channel_frequency(uint16_t freq);
+
+/**
+ * @brief Set the sample-and-hold rate of pitched noise with sub-Hz resolution
+ * @param freq New random values per second (Q16.16), 0 for white noise
+ */
+void noise_channel_frequency_q16(uint32_t freq);
+
+/**
+ * @brief Recompute the sample-and-hold increment for the current sample rate
+ * @note Call after sample_timer_set_rate(), the pitched noise keeps its rate in Hz
+ */
+void noise_channel_sample_rate();
+
+/**
+ * @brief Render a block of DAC values
+ * @param samples Output, one right-aligned DAC value per word
+ * @param count Number of samples to render (even)
+ * @note Called from the DMA interrupt, exposed to render the channel off target
+ *       Voices the mixer routes to MIXER_OUTPUT_DAC are added to the noise (one block later)
+ */
+void noise_channel_render(uint32_t *samples, uint16_t count);
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Intialize the noise channel DAC, DMA and generator
+ * @note Call after the sample timer is initialized (block_renderer_init() or sample_timer_init()),
+ *       the generator is seeded from the RNG peripheral
+ */
+void noise_channel_init();
+
+#endif /* _NOISE_CHANNEL_H_ */
\ No newline at end of file
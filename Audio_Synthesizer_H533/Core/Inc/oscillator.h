@@ -0,0 +1,70 @@
+/**
+ ******************************************************************************
+ * @file           : oscillator.h
+ * @brief          : Oscillator Kernel Interface Header
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "channel_common.h"
+#include "wavetable.h"
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Oscillator Definitions                                                  */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef _OSCILLATOR_H_
+#define _OSCILLATOR_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Block render kernel of one waveform, see oscillator.hpp
+ * @param level Mip level of the voice, chosen for the block by wavetable_select()
+ * @param phase Phase before the first sample, a full turn is 2^32
+ * @param phase_inc Phase advance per sample
+ * @param width Pulse width of the square, see wavetable_pulse() (the other waveforms ignore it)
+ * @param gain Volume and envelope gain before the first sample (Q16)
+ * @param gain_step Gain change per sample
+ * @param frames First frame word of the voice
+ * @param count Number of samples to render
+ * @param stride Words per frame
+ * @return Phase after the last sample
+ */
+typedef uint32_t (*oscillator_kernel_t)(const wavetable_level_t *level, uint32_t phase, uint32_t phase_inc, uint32_t width,
+                                        int32_t gain, int32_t gain_step, uint32_t *frames, uint16_t count, uint16_t stride);
+
+/**
+ * @brief Block render kernel of one waveform producing Q15 samples for the mixer
+ * @note Same parameters as oscillator_kernel_t, frames holds one Q15 sample per voice
+ */
+typedef uint32_t (*oscillator_q15_kernel_t)(const wavetable_level_t *level, uint32_t phase, uint32_t phase_inc, uint32_t width,
+                                            int32_t gain, int32_t gain_step, int16_t *frames, uint16_t count, uint16_t stride);
+
+/**
+ * @brief Get the kernel rendering a waveform
+ * @param wave The waveform to synthesize
+ * @return The kernel, NULL if the waveform has no PWM kernel
+ */
+oscillator_kernel_t oscillator_kernel(waveforms_t wave);
+
+/**
+ * @brief Get the kernel rendering a waveform as Q15 samples
+ * @param wave The waveform to synthesize
+ * @return The kernel, NULL if the waveform has no Q15 kernel
+ */
+oscillator_q15_kernel_t oscillator_q15_kernel(waveforms_t wave);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _OSCILLATOR_H_ */
\ No newline at end of file
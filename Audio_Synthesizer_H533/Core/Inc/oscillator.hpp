@@ -0,0 +1,218 @@
+/**
+ ******************************************************************************
+ * @file           : oscillator.hpp
+ * @brief          : Compile-Time Specialized Oscillator Kernels
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "gain.h"
+#include "wavetable.h"
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Oscillator Definitions                                                  */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef _OSCILLATOR_HPP_
+#define _OSCILLATOR_HPP_
+
+/*
+ * A kernel is oscillator::render<Wave, Output>, where
+ *   Wave   reads one Q15 sample at a phase of a mip level (FullTable<Interp>, QuarterTable<Interp>,
+ *          PulseTable<Interp>)
+ *   Interp reads a stored table between samples (Linear, Truncate)
+ *   Output turns a Q15 sample into the value written to the frame (Pwm<bits>, Q15)
+ * Every policy is resolved at compile time, the inner loop has no branches and
+ * keeps the whole voice in registers.
+ */
+namespace oscillator
+{
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Interpolation Policies                                                  */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Linearly interpolate between neighbouring samples (uses the guard sample)
+ */
+struct Linear
+{
+  static inline int32_t read(const int16_t *data, uint32_t bits, uint32_t phase)
+  {
+    uint32_t index = phase >> (32 - bits);
+    int32_t frac = (int32_t)((phase << bits) >> 17); // Q15 fraction between index and index + 1
+    int32_t a = data[index];
+    int32_t b = data[index + 1];
+
+    return a + (((b - a) * frac) >> 15);
+  }
+};
+
+/**
+ * @brief Truncate to the nearest lower sample
+ */
+struct Truncate
+{
+  static inline int32_t read(const int16_t *data, uint32_t bits, uint32_t phase)
+  {
+    return data[phase >> (32 - bits)];
+  }
+};
+
+#if WAVETABLE_INTERPOLATE
+typedef Linear DefaultInterp;
+#else
+typedef Truncate DefaultInterp;
+#endif
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Waveform Policies                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Table storing the whole wave
+ */
+template <class Interp>
+struct FullTable
+{
+  const int16_t *data;
+  uint32_t bits;
+
+  FullTable(const wavetable_level_t *level, uint32_t) : data(level->data), bits(level->bits) {}
+
+  inline int32_t operator()(uint32_t phase) const
+  {
+    return Interp::read(data, bits, phase);
+  }
+};
+
+/**
+ * @brief Table storing the first quarter of an odd / even symmetric wave
+ * @note The quadrant mirror and the negation are done with masks instead of branches
+ */
+template <class Interp>
+struct QuarterTable
+{
+  const int16_t *data;
+  uint32_t bits;
+
+  QuarterTable(const wavetable_level_t *level, uint32_t) : data(level->data), bits(level->bits) {}
+
+  inline int32_t operator()(uint32_t phase) const
+  {
+    uint32_t reverse = 0 - ((phase >> 30) & 0x1); // All ones in the second and fourth quarters
+    int32_t negate = -(int32_t)(phase >> 31);      // All ones in the second half
+    int32_t sample = Interp::read(data, bits, (phase << 2) ^ reverse);
+
+    return (sample ^ negate) - negate;
+  }
+};
+
+/**
+ * @brief Band-limited pulse read from a ramp table, see wavetable_pulse()
+ * @note The gain keeping narrow pulses within full scale is computed once per block
+ */
+template <class Interp>
+struct PulseTable
+{
+  const int16_t *data;
+  uint32_t bits;
+  uint32_t width;
+  int32_t gain;
+
+  PulseTable(const wavetable_level_t *level, uint32_t width)
+      : data(level->data), bits(level->bits), width(width), gain(wavetable_pulse_gain(width)) {}
+
+  inline int32_t operator()(uint32_t phase) const
+  {
+    int32_t sample = ((Interp::read(data, bits, phase) - Interp::read(data, bits, phase + width)) * gain) >> 15;
+
+    return sample > INT16_MAX ? INT16_MAX : (sample < INT16_MIN ? INT16_MIN : sample);
+  }
+};
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Output Policies                                                         */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Unsigned PWM compare value centred on 50% duty cycle
+ */
+template <unsigned Bits>
+struct Pwm
+{
+  typedef uint32_t value_type;
+
+  static const uint32_t mid = (uint32_t)0x1 << (Bits - 1);
+  static const uint32_t shift = 16 - Bits; // Q15 to a compare offset around mid
+
+  static inline uint32_t write(int32_t sample)
+  {
+    return mid + (sample >> shift);
+  }
+};
+
+/**
+ * @brief Signed Q15 sample, the input of the mixer
+ */
+struct Q15
+{
+  typedef int16_t value_type;
+
+  static const uint32_t shift = 0;
+
+  static inline int16_t write(int32_t sample)
+  {
+    return (int16_t)sample;
+  }
+};
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Kernels                                                                 */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Render a block of one voice
+ * @param level Mip level of the voice, chosen for the block by wavetable_select()
+ * @param phase Phase before the first sample, a full turn is 2^32
+ * @param phase_inc Phase advance per sample
+ * @param width Pulse width of a PulseTable wave, ignored by the others
+ * @param gain Volume and envelope gain before the first sample (Q16)
+ * @param gain_step Gain change per sample, a linear ramp across the block
+ * @param frames First frame value of the voice
+ * @param count Number of samples to render
+ * @param stride Values per frame
+ * @return Phase after the last sample
+ */
+template <class Wave, class Output>
+uint32_t render(const wavetable_level_t *level, uint32_t phase, uint32_t phase_inc, uint32_t width, int32_t gain,
+                int32_t gain_step, typename Output::value_type *frames, uint16_t count, uint16_t stride)
+{
+  const Wave wave(level, width);
+
+  for (uint16_t n = 0; n < count; n++, frames += stride)
+  {
+    phase += phase_inc; // Wraps for free at 2^32
+    gain += gain_step;
+    *frames = Output::write(gain_apply(gain, wave(phase)));
+  }
+
+  return phase;
+}
+
+} // namespace oscillator
+
+#endif /* _OSCILLATOR_HPP_ */
\ No newline at end of file
@@ -0,0 +1,165 @@
+/**
+ ******************************************************************************
+ * @file           : profiler.h
+ * @brief          : Audio Interrupt Cycle Profiler Header
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "audio_config.h"
+#include "voice_bank.h"
+
+#if AUDIO_PROFILER
+#include "stm32h5xx.h" // DWT, the cycle counter of the timing macros
+#endif
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Profiler Definitions                                                    */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef _PROFILER_H_
+#define _PROFILER_H_
+
+/*
+ * Every cost is read from the DWT cycle counter (DWT->CYCCNT) around the code it times:
+ *   Callback - the whole audio callback, a block in the block renderer DMA interrupt
+ *              (or a sample in the sample timer interrupt without AUDIO_BLOCK_RENDER)
+ *   Stages   - the parts of the callback, see profiler_stage_t
+ *   Voices   - the render of each voice
+ * A callback that returns after the next one was due is a missed deadline. With AUDIO_PROFILER 0
+ * the macros below expand to nothing and none of this is compiled.
+ */
+
+#if AUDIO_BLOCK_RENDER
+#define PROFILER_CALLBACK_SAMPLES AUDIO_BLOCK_SIZE // Samples rendered per audio callback
+#else
+#define PROFILER_CALLBACK_SAMPLES 1
+#endif
+
+/**
+ * @brief Parts of the audio path timed on their own
+ */
+typedef enum
+{
+  PROFILER_STAGE_MODULATION, // LFOs and modulation matrix
+  PROFILER_STAGE_ENVELOPES,  // Envelopes and gain targets of every voice
+  PROFILER_STAGE_VOICES,     // Render of every voice
+  PROFILER_STAGE_MIX,        // Mixer sum, effects bus and quantizer
+  PROFILER_STAGE_EFFECTS,    // Effects bus alone, part of PROFILER_STAGE_MIX
+  PROFILER_STAGE_COUNT
+} profiler_stage_t;
+
+typedef struct
+{
+  uint32_t count;        // Timings since the last reset
+  uint32_t last_cycles;  // CPU cycles of the last timing
+  uint32_t min_cycles;   // Cheapest timing
+  uint32_t max_cycles;   // Most expensive timing
+  uint64_t total_cycles; // Sum over all timings (mean = total_cycles / count)
+} profiler_counter_t;
+
+typedef struct
+{
+  profiler_counter_t callback;                 // Whole audio callback
+  uint32_t histogram[PROFILER_HISTOGRAM_BINS]; // Callbacks per cost bucket, the last one also holds the overruns
+  uint32_t missed;                             // Callbacks that returned after the next one was due
+  uint32_t budget;                             // CPU cycles between two callbacks
+  profiler_counter_t stage[PROFILER_STAGE_COUNT];
+  profiler_counter_t voice[VOICE_BANK_VOICES];
+} profiler_stats_t;
+
+#if AUDIO_PROFILER
+
+/*
+ * Timing macros, host builds have no DWT and set AUDIO_PROFILER to 0
+ *   PROFILER_START(start)            - declare start and read the counter into it
+ *   PROFILER_CALLBACK(start, missed) - record the audio callback, missed is true past the deadline
+ *   PROFILER_STAGE(stage, start)     - record a profiler_stage_t
+ *   PROFILER_VOICE(voice, start)     - record a voice
+ */
+#define PROFILER_START(start) uint32_t start = DWT->CYCCNT
+#define PROFILER_CALLBACK(start, missed) profiler_callback(DWT->CYCCNT - (start), (missed) ? 1 : 0)
+#define PROFILER_STAGE(stage, start) profiler_stage((stage), DWT->CYCCNT - (start))
+#define PROFILER_VOICE(voice, start) profiler_voice((voice), DWT->CYCCNT - (start))
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Record an audio callback
+ * @param cycles CPU cycles the callback took
+ * @param missed 1 if the next callback was already due when it returned
+ */
+void profiler_callback(uint32_t cycles, uint8_t missed);
+
+/**
+ * @brief Record a stage of the audio path
+ * @param stage The stage timed
+ * @param cycles CPU cycles the stage took
+ */
+void profiler_stage(profiler_stage_t stage, uint32_t cycles);
+
+/**
+ * @brief Record the render of a voice
+ * @param voice The voice timed
+ * @param cycles CPU cycles the render took
+ */
+void profiler_voice(uint8_t voice, uint32_t cycles);
+
+/**
+ * @brief Get the cycles of the last timing of a stage
+ * @param stage The stage to query
+ * @return CPU cycles, 0 if the stage has not run
+ */
+uint32_t profiler_get_stage_cycles(profiler_stage_t stage);
+
+/**
+ * @brief Get the cycles of the last render of a voice
+ * @param voice The voice to query
+ * @return CPU cycles, 0 if the voice has not rendered
+ */
+uint32_t profiler_get_voice_cycles(uint8_t voice);
+
+/**
+ * @brief Copy the statistics
+ * @param stats Destination of the statistics
+ * @note Masks the interrupts for the copy, every timing is from the same callback
+ */
+void profiler_get_stats(profiler_stats_t *stats);
+
+/**
+ * @brief Clear the statistics and read the deadline of the sample timer
+ * @note Call again after a sample rate change, the budget follows the timer period
+ */
+void profiler_reset();
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Start the DWT cycle counter and clear the statistics
+ * @note Call after the sample timer is initialized, the budget is read from its period
+ */
+void profiler_init();
+
+#else
+
+#define PROFILER_START(start)
+#define PROFILER_CALLBACK(start, missed)
+#define PROFILER_STAGE(stage, start)
+#define PROFILER_VOICE(voice, start)
+
+#endif /* AUDIO_PROFILER */
+
+#endif /* _PROFILER_H_ */
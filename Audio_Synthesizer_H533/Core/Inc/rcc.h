@@ -26,5 +26,20 @@ void RCC_GPIOC_CLK_Enable(void);
 // Timer RCC Enables
 void RCC_TIM2_CLK_Enable(void);
 void RCC_TIM3_CLK_Enable(void);
+void RCC_TIM4_CLK_Enable(void);
+
+// DMA RCC Enables
+void RCC_GPDMA1_CLK_Enable(void);
+
+// UART RCC Enables
+void RCC_USART1_CLK_Enable(void);
+void RCC_USART3_CLK_Enable(void);
+
+// Analog and Security RCC Enables
+void RCC_DAC1_CLK_Enable(void);
+void RCC_RNG_CLK_Enable(void);
+
+// Oscillator Enables
+void RCC_HSI48_Enable(void);
 
 #endif /* _RCC_H_ */
\ No newline at end of file
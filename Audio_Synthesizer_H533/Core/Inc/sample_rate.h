@@ -0,0 +1,65 @@
+/**
+ ******************************************************************************
+ * @file           : sample_rate.h
+ * @brief          : Runtime Sample Rate Header
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "audio_config.h"
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Sample Rate Definitions                                                 */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef _SAMPLE_RATE_H_
+#define _SAMPLE_RATE_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * Everything that turns a time or a frequency into samples reads sample_rate_get(), the tables
+ * (wavetables, gain) do not depend on the rate. To change it:
+ *   at init    - sample_rate_set() before sample_timer_init() / block_renderer_init()
+ *   at runtime - block_renderer_stop(), channel_sample_rate(), noise_channel_sample_rate(),
+ *                block_renderer_start()
+ */
+
+extern uint32_t sample_rate_hz; // Rate the sample timer runs at, read through sample_rate_get()
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Get the sample rate
+ * @return Samples per second
+ */
+static inline uint32_t sample_rate_get()
+{
+  return sample_rate_hz;
+}
+
+/**
+ * @brief Set the sample rate the rate-dependent values are computed with
+ * @param rate Samples per second, clamped to SAMPLE_FREQUENCY_MIN - SAMPLE_FREQUENCY_MAX
+ * @return The rate stored
+ * @note Does not reprogram the timer or recompute anything, see sample_timer_set_rate()
+ */
+uint32_t sample_rate_set(uint32_t rate);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SAMPLE_RATE_H_ */
@@ -41,6 +41,14 @@ void sample_timer_stop();
  */
 void sample_timer_start();
 
+/**
+ * @brief Set the sample timer period to the nearest period of a sample rate
+ * @param rate Samples per second, clamped to SAMPLE_FREQUENCY_MIN - SAMPLE_FREQUENCY_MAX
+ * @return The rate the timer runs at, also stored as sample_rate_get()
+ * @note Only reprograms the timer, see channel_sample_rate() to recompute the voices
+ */
+uint32_t sample_timer_set_rate(uint32_t rate);
+
 /* ========================================================================== */
 /*                                                                            */
 /*    Initialization Functions                                                */
@@ -55,7 +63,22 @@ void sample_timer_register_cb(sample_timer_cb_t cb);
 
 /**
  * @brief Intialize the sample timer component
+ * @note Runs at the nearest rate to sample_rate_get() (SAMPLE_FREQUENCY unless sample_rate_set() was called),
+ *       starts the profiler with AUDIO_PROFILER
  */
 void sample_timer_init();
 
+/**
+ * @brief Drive the channel timer DMA bursts from the sample timer instead of the callback
+ * @note Call after sample_timer_init(), the registered callback is no longer invoked
+ *       Outputs the update on TRGO, the channel timers turn it into their burst requests
+ */
+void sample_timer_enable_dma();
+
+/**
+ * @brief Output the sample timer update on TRGO to trigger other peripherals (DAC, channel timers)
+ * @note Call after sample_timer_init()
+ */
+void sample_timer_enable_trigger();
+
 #endif /* _SAMPLE_TIMER_H_ */
\ No newline at end of file
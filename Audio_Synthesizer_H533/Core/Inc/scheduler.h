@@ -0,0 +1,96 @@
+/**
+ ******************************************************************************
+ * @file           : scheduler.h
+ * @brief          : Control Rate / Audio Rate Scheduler Header
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "audio_config.h"
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Scheduler Definitions                                                   */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef _SCHEDULER_H_
+#define _SCHEDULER_H_
+
+/*
+ * Two rates share the CPU:
+ *   Audio rate   - the block render, in the block renderer DMA interrupt (highest priority)
+ *   Control rate - MIDI events, LFOs, modulation and envelopes, in PendSV (SCHEDULER_IRQ_PRIORITY)
+ * The audio interrupt pends PendSV every CONTROL_RATE_DIVIDER blocks, the tick then runs as soon as
+ * the audio interrupt returns and is itself preempted by the next block if it runs long.
+ */
+
+/**
+ * @brief Control tick callback, runs once every CONTROL_TICK_SAMPLES
+ */
+typedef void (*scheduler_cb_t)();
+
+typedef struct
+{
+  uint32_t ticks;        // Control ticks run since the last reset
+  uint32_t last_cycles;  // CPU cycles of the last tick (including audio blocks that preempted it)
+  uint32_t max_cycles;   // Most expensive tick
+  uint64_t total_cycles; // Sum over all ticks (mean = total_cycles / ticks)
+  uint32_t late;         // Audio blocks that started while a tick was running
+  uint32_t overruns;     // Ticks dropped because the previous one had not finished
+  uint32_t budget;       // CPU cycles between two ticks, shared with the audio rate
+} scheduler_stats_t;
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Count a rendered audio block, pend the control tick every CONTROL_RATE_DIVIDER blocks
+ * @note Call from the audio interrupt once the block is rendered
+ */
+void scheduler_block();
+
+/**
+ * @brief Run the control tick
+ * @note Called from PendSV_Handler() (stm32h5xx_it.c)
+ */
+void scheduler_handler();
+
+/**
+ * @brief Copy the control tick statistics
+ * @param stats Destination of the statistics
+ * @note The audio load is in profiler_get_stats() (AUDIO_PROFILER), both budgets are in CPU cycles
+ */
+void scheduler_get_stats(scheduler_stats_t *stats);
+
+/**
+ * @brief Clear the control tick statistics
+ */
+void scheduler_reset_stats();
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Register the Control Tick Callback
+ * @param cb Pointer to the function to invoke every control tick
+ */
+void scheduler_register_cb(scheduler_cb_t cb);
+
+/**
+ * @brief Intialize the scheduler component
+ * @note Sets the PendSV priority below the audio interrupts, call after block_renderer_init()
+ *       (which enables the cycle counter)
+ */
+void scheduler_init();
+
+#endif /* _SCHEDULER_H_ */
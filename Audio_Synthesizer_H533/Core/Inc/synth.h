@@ -0,0 +1,79 @@
+/**
+ ******************************************************************************
+ * @file           : synth.h
+ * @brief          : Hardware Independent Synthesis Core Header
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "audio_config.h"
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Synthesis Core Definitions                                              */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef _SYNTH_H_
+#define _SYNTH_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * The voices, mixer, effects and modulation render blocks of PWM compare values without touching a
+ * peripheral. A board layer owns the clocks and the outputs:
+ *   Target - block_renderer.c feeds the frames to the channel timer CCRs, scheduler.c runs the tick
+ *   Host   - Host/board_host.c writes the frames to memory (Host/CMakeLists.txt builds the core natively)
+ */
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Run one control tick: the LFOs and modulation matrix, then the envelopes of every voice
+ * @note Called by the scheduler every CONTROL_TICK_SAMPLES below the audio interrupts (AUDIO_SCHEDULER),
+ *       or by synth_render() before every block without it
+ */
+void synth_control();
+
+/**
+ * @brief Render a block of frames
+ * @param frames Output, one compare value per channel (VOICE_COUNT words) per frame
+ * @param count Number of frames to render
+ * @note Called from the audio interrupt on target, matches block_renderer_cb_t. Without AUDIO_SCHEDULER it
+ *       applies the queued MIDI (midi_dispatch()) and runs synth_control() first
+ */
+void synth_render(uint32_t *frames, uint16_t count);
+
+/**
+ * @brief Recompute the voices, LFOs and effects for the current sample rate
+ * @note Call after sample_rate_set() (or sample_timer_set_rate() on target) with the audio stopped
+ */
+void synth_sample_rate();
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Reset the voices, mixer, effects and modulation
+ * @note Every voice starts disabled and silent, the mixer routes voice n to output n
+ */
+void synth_init();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SYNTH_H_ */
@@ -0,0 +1,64 @@
+/**
+ ******************************************************************************
+ * @file           : uart.h
+ * @brief          : UART Control Interface Header
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdint.h>
+
+/* ========================================================================== */
+/*                                                                            */
+/*    UART Definitions                                                        */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef _UART_H_
+#define _UART_H_
+
+/*
+ * USER_UART is the console: transmit only, polled, 8N1 at USER_UART_BAUD. Once it is initialized
+ * printf() writes to it (__io_putchar(), see syscalls.c), before that the characters are dropped.
+ *
+ * MIDI_UART is the MIDI input: receive only, 8N1 at MIDI_UART_BAUD. The GPDMA copies every byte into
+ * a circular buffer, which is handed to midi_receive() in batches when half or all of it has filled
+ * or when the line goes idle after a burst. A dense stream costs a few interrupts per burst instead
+ * of one per byte, and both interrupts run at MIDI_UART_IRQ_PRIORITY, below the audio.
+ */
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Send bytes over the user UART
+ * @param data Bytes to send
+ * @param length Number of bytes
+ * @note Blocks until the last byte has left the shift register, returns at once before uart_user_init()
+ */
+void uart_user_write(const uint8_t *data, uint16_t length);
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Intialize the user UART transmitter
+ * @note Call after SystemClock_Config(), the baud rate is derived from PCLK2
+ */
+void uart_user_init();
+
+/**
+ * @brief Intialize the MIDI UART receiver and start receiving into the circular buffer
+ * @note Call after SystemClock_Config(), the baud rate is derived from PCLK1. The bytes go
+ *       through midi_receive(), midi_dispatch() applies them at the control tick
+ */
+void uart_midi_init();
+
+#endif /* _UART_H_ */
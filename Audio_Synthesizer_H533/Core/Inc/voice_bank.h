@@ -0,0 +1,230 @@
+/**
+ ******************************************************************************
+ * @file           : voice_bank.h
+ * @brief          : Voice Bank Synthesis Interface Header
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "audio_config.h"
+#include "channel_common.h"
+#include "envelope.h"
+#include "filter.h"
+#include "oscillator.h"
+#include "wavetable.h"
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Voice Bank Definitions                                                  */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef _VOICE_BANK_H_
+#define _VOICE_BANK_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#if AUDIO_MIXER
+#define VOICE_BANK_VOICES MIXER_VOICE_COUNT // Virtual voices, summed into the outputs by the mixer
+#else
+#define VOICE_BANK_VOICES VOICE_COUNT // One voice per PWM output
+#endif
+
+#define VOICE_BANK_LINE 32                                        // Bytes per cache line
+#define VOICE_BANK_CAPACITY ((VOICE_BANK_VOICES + 7) & ~7)        // Rounded up so each word array fills whole lines
+#define VOICE_BANK_MID ((uint32_t)0x1 << (PWM_OUTPUT_BITS - 1))   // 50% duty cycle, a Q15 zero
+#define VOICE_BANK_FULL (((uint32_t)0x1 << PWM_OUTPUT_BITS) - 1)  // 100% duty cycle
+
+/**
+ * @brief Struct-of-arrays voice state, indexed by voice (the first VOICE_COUNT match channel_t)
+ * @note The per-sample fields lead so a block render touches as few lines as possible
+ */
+typedef struct
+{
+  uint32_t phase[VOICE_BANK_CAPACITY];                     // Position in the waveform, a full turn is 2^32
+  uint32_t phase_inc[VOICE_BANK_CAPACITY];                 // Phase advance per sample, base_inc after pitch modulation
+  uint32_t pulse_width[VOICE_BANK_CAPACITY];               // High part of the square period, width_base after modulation
+  const wavetable_t *wavetable[VOICE_BANK_CAPACITY];       // Mipmap of the current waveform
+  oscillator_kernel_t kernel[VOICE_BANK_CAPACITY];         // Block render kernel of the current waveform
+  oscillator_q15_kernel_t q15_kernel[VOICE_BANK_CAPACITY]; // Same waveform rendered for the mixer
+  int32_t gain[VOICE_BANK_CAPACITY];                       // Gain reached by the last block (Q16), ramped per block
+  int32_t gain_target[VOICE_BANK_CAPACITY];                // Gain set by the last control tick (Q16), see voice_bank_control()
+  int32_t vol_gain[VOICE_BANK_CAPACITY];                   // Volume times velocity gain (Q16), precomputed from vol
+  int32_t mod_gain[VOICE_BANK_CAPACITY];                   // Volume modulation gain (Q16), see modulation.h
+  envelope_t envelope[VOICE_BANK_CAPACITY];                // ADSR, evaluated once per control tick
+  filter_t filter[VOICE_BANK_CAPACITY];                    // Resonant filter of the Q15 (mixer) render
+  uint8_t waveform[VOICE_BANK_CAPACITY];                   // waveforms_t
+  uint8_t on_off[VOICE_BANK_CAPACITY];                     // Note gate, the voice sounds until its release ends
+  uint8_t enabled[VOICE_BANK_CAPACITY];                    // Voice in use
+  uint32_t freq[VOICE_BANK_CAPACITY];                      // Frequency in Hz (Q16.16)
+  uint32_t base_inc[VOICE_BANK_CAPACITY];                  // Phase advance per sample of freq, before modulation
+  uint32_t width_base[VOICE_BANK_CAPACITY];                // High part of the square period, before modulation
+  uint8_t vol[VOICE_BANK_CAPACITY];                        // Volume (up to 127)
+  uint8_t velocity[VOICE_BANK_CAPACITY];                   // Velocity of the last note (up to 127)
+} __attribute__((aligned(VOICE_BANK_LINE))) voice_bank_t;
+
+extern voice_bank_t voice_bank;
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Mark a voice as in use or unused (unused voices are not rendered)
+ * @param voice The voice to modify
+ * @param state 1 to render the voice, 0 to skip it
+ */
+void voice_enable(uint8_t voice, uint8_t state);
+
+/**
+ * @brief Set the voice waveform
+ * @param voice The voice to modify
+ * @param wave The waveform to synthesize
+ */
+void voice_set_waveform(uint8_t voice, waveforms_t wave);
+
+/**
+ * @brief Turn the voice note on or off
+ * @param voice The voice to modify
+ * @param state Turn the voice on or off (1 is on, 0 is off)
+ * @note Turning a voice on starts the attack, restarting the waveform if the voice was silent,
+ *       turning it off starts the release
+ */
+void voice_on_off(uint8_t voice, uint8_t state);
+
+/**
+ * @brief Set the voice envelope
+ * @param voice The voice to modify
+ * @param attack_ms Time from silence to full scale
+ * @param decay_ms Time from full scale to the sustain level
+ * @param sustain Sustain level (up to 127)
+ * @param release_ms Time from the sustain level to silence
+ */
+void voice_envelope(uint8_t voice, uint16_t attack_ms, uint16_t decay_ms, uint8_t sustain, uint16_t release_ms);
+
+/**
+ * @brief Set the voice filter
+ * @param voice The voice to modify
+ * @param mode The filter type, FILTER_OFF to bypass it
+ * @param cutoff Cutoff as a MIDI key number (up to 127)
+ * @param resonance Resonance (up to 127)
+ * @note Only the Q15 render (voice_bank_render_q15(), used by the mixer) is filtered
+ */
+void voice_filter(uint8_t voice, filter_mode_t mode, uint8_t cutoff, uint8_t resonance);
+
+/**
+ * @brief Set the pulse width of the voice square
+ * @param voice The voice to modify
+ * @param width High part of the period in 128ths (1 to 127, 64 is a square)
+ * @note Only WAVEFORM_SQUARE reads it, MODULATION_DEST_PULSE_WIDTH moves it at control rate
+ */
+void voice_pulse_width(uint8_t voice, uint8_t width);
+
+/**
+ * @brief Set the voice volume
+ * @param voice The voice to modify
+ * @param volume Volume of the signal (up to 127), mapped to a gain by gain_from_midi()
+ * @note The gain ramps to the new value across the next block
+ */
+void voice_volume(uint8_t voice, uint8_t volume);
+
+/**
+ * @brief Set the velocity of the voice note
+ * @param voice The voice to modify
+ * @param velocity Velocity of the note (up to 127), scales the volume through gain_from_midi()
+ */
+void voice_velocity(uint8_t voice, uint8_t velocity);
+
+/**
+ * @brief Set the voice frequency
+ * @param voice The voice to modify
+ * @param freq Frequency of the signal in Hz (Q16.16)
+ */
+void voice_frequency(uint8_t voice, uint32_t freq);
+
+/**
+ * @brief Apply the modulation of a voice until the next call
+ * @param voice The voice to modify
+ * @param pitch Frequency ratio (Q16, 65536 leaves the frequency unchanged)
+ * @param gain Gain on top of the volume and envelope (Q16, up to GAIN_UNITY)
+ * @param cutoff Filter cutoff offset (Q15), see filter_modulate()
+ * @param width Pulse width offset (Q15), full scale is half a period wider or narrower
+ * @note Called by modulation_tick() once per control tick, the gain takes effect at the next voice_bank_control()
+ */
+void voice_modulate(uint8_t voice, int32_t pitch, int32_t gain, int32_t cutoff, int32_t width);
+
+/**
+ * @brief Advance the envelope of every sounding voice by one tick and set its gain target
+ * @note The target is the envelope times the volume and its modulation, the renderers ramp the gain
+ *       to it across the next block. Call once every ENVELOPE_TICK_SAMPLES
+ */
+void voice_bank_control();
+
+/**
+ * @brief Recompute the pitch, envelope and filter coefficients of every voice for the current sample rate
+ * @note Call after sample_timer_set_rate() with the audio stopped, the voices keep their settings in Hz and ms
+ */
+void voice_bank_sample_rate();
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Render Functions                                                        */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Render a block of one voice as PWM compare values
+ * @param voice The voice to render
+ * @param frames Interleaved output, frames[n * stride + voice] holds sample n
+ * @param count Number of samples to render
+ * @param stride Words per frame
+ */
+void voice_bank_render_voice(uint8_t voice, uint32_t *frames, uint16_t count, uint16_t stride);
+
+/**
+ * @brief Render a block of one voice as Q15 samples (volume applied)
+ * @param voice The voice to render
+ * @param samples Interleaved output, samples[n * stride + voice] holds sample n
+ * @param count Number of samples to render
+ * @param stride Samples per frame
+ * @note Silent voices render zeros, used by the mixer, the voice filter is applied
+ */
+void voice_bank_render_q15(uint8_t voice, int16_t *samples, uint16_t count, uint16_t stride);
+
+/**
+ * @brief Render a block of every voice as PWM compare values
+ * @param frames Interleaved output, frames[n * VOICE_COUNT + voice] holds sample n
+ * @param count Number of samples to render
+ */
+void voice_bank_render(uint32_t *frames, uint16_t count);
+
+/**
+ * @brief Render one sample of every voice straight into the compare registers
+ * @param ccr Table of VOICE_COUNT compare register pointers, indexed by voice
+ */
+void voice_bank_update(volatile uint32_t *const *ccr);
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Reset every voice to a silent sine at full volume with the default envelope
+ */
+void voice_bank_init();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _VOICE_BANK_H_ */
\ No newline at end of file
@@ -0,0 +1,186 @@
+/**
+ ******************************************************************************
+ * @file           : wavetable.h
+ * @brief          : Compact Wavetable Lookup Interface Header
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdint.h>
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Wavetable Definitions                                                   */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef _WAVETABLE_H_
+#define _WAVETABLE_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// 1: Linearly interpolate between table samples, 0: Truncate to the nearest lower sample
+#ifndef WAVETABLE_INTERPOLATE
+#define WAVETABLE_INTERPOLATE 1
+#endif
+
+#define WAVETABLE_PULSE_SQUARE ((uint32_t)0x1 << 31) // Pulse high for half the period
+#define WAVETABLE_PULSE_MIN ((uint32_t)0x1 << 25)    // Narrowest pulse, 1/128 of the period
+#define WAVETABLE_PULSE_MAX (0 - WAVETABLE_PULSE_MIN) // Widest pulse, 127/128 of the period
+
+typedef struct
+{
+  const int16_t *data; // Q15 samples, (1 << bits) + 1 guard sample
+  uint8_t bits;        // log2 of the stored length
+  uint8_t quarter;     // 1 if only the first quarter-wave is stored (odd / even symmetric waves)
+} wavetable_level_t;
+
+/**
+ * @brief Band-limited mipmap, one level per octave of phase increment
+ * @note Level l serves phase increments in [2^(base + l), 2^(base + l + 1)) and holds no
+ *       harmonic above the Nyquist frequency there, the first and last levels also cover
+ *       everything below and above them
+ */
+typedef struct
+{
+  const wavetable_level_t *levels; // Level 0 holds the most harmonics
+  uint8_t count;                   // Number of levels
+  uint8_t base;                    // log2 of the highest phase increment served by level 0
+} wavetable_t;
+
+extern const wavetable_t wavetable_sine;
+extern const wavetable_t wavetable_trig;
+extern const wavetable_t wavetable_ramp; // Also the source of the square, see wavetable_pulse()
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Lookup Functions                                                        */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Calculate the per-sample phase advance of an oscillator
+ * @param freq Frequency in Hz (Q16.16)
+ * @param sample_rate Sample rate in Hz
+ * @return Phase increment, a full turn is 2^32
+ * @note Uses a 64-bit division, call when the frequency changes, not per sample
+ */
+static inline uint32_t wavetable_phase_increment(uint32_t freq, uint32_t sample_rate)
+{
+  return (uint32_t)(((uint64_t)freq << 16) / sample_rate);
+}
+
+/**
+ * @brief Pick the mip level free of aliasing at a phase increment
+ * @param table The wavetable to read
+ * @param phase_inc Phase advance per sample
+ * @return The level to read, call once per block or frequency change, not per sample
+ */
+static inline const wavetable_level_t *wavetable_select(const wavetable_t *table, uint32_t phase_inc)
+{
+  int32_t level = (31 - __builtin_clz(phase_inc | 0x1)) - table->base; // Octave of the increment
+
+  if (level < 0)
+    level = 0;
+  if (level >= table->count)
+    level = table->count - 1;
+
+  return &table->levels[level];
+}
+
+/**
+ * @brief Read a stored table at a phase spanning its whole length
+ * @param data Table samples, including the guard sample
+ * @param bits log2 of the stored length
+ * @param phase Position in the table, a full turn is 2^32
+ * @return The Q15 sample
+ */
+static inline int16_t wavetable_read(const int16_t *data, uint8_t bits, uint32_t phase)
+{
+  uint32_t index = phase >> (32 - bits);
+
+#if WAVETABLE_INTERPOLATE
+  int32_t frac = (int32_t)((phase << bits) >> 17); // Q15 fraction between index and index + 1
+  int32_t a = data[index];
+  int32_t b = data[index + 1]; // Guard sample makes this safe at the end of the table
+
+  return (int16_t)(a + (((b - a) * frac) >> 15));
+#else
+  return data[index];
+#endif
+}
+
+/**
+ * @brief Read a quarter-wave table, rebuilding the full wave through symmetry
+ * @param data Quarter-wave samples, including the guard sample
+ * @param bits log2 of the stored quarter length
+ * @param phase Position in the full wave, a full turn is 2^32
+ * @return The Q15 sample
+ */
+static inline int16_t wavetable_read_quarter(const int16_t *data, uint8_t bits, uint32_t phase)
+{
+  uint32_t quadrant = phase >> 30;
+  uint32_t offset = phase << 2; // Position within the quadrant
+
+  if (quadrant & 0x1) // Second and fourth quarters run backwards
+    offset = ~offset;
+
+  int16_t sample = wavetable_read(data, bits, offset);
+
+  return (quadrant & 0x2) ? -sample : sample; // Second half is the negated first half
+}
+
+/**
+ * @brief Look up a wavetable sample
+ * @param level The mip level to read, see wavetable_select()
+ * @param phase Position in the full wave, a full turn is 2^32
+ * @return The Q15 sample
+ */
+static inline int16_t wavetable_lookup(const wavetable_level_t *level, uint32_t phase)
+{
+  if (level->quarter)
+    return wavetable_read_quarter(level->data, level->bits, phase);
+
+  return wavetable_read(level->data, level->bits, phase);
+}
+
+/**
+ * @brief Get the gain keeping a pulse of a width within full scale
+ * @param width High part of the period, a full turn is 2^32 (WAVETABLE_PULSE_MIN to WAVETABLE_PULSE_MAX)
+ * @return Gain (Q15), 31744 for a square
+ * @note The difference of two ramps swings by 2 * max(width, 1 - width) of full scale, the gain scales it
+ *       back with 1/32 of headroom for the ringing of the two edges. Call once per block
+ */
+static inline int32_t wavetable_pulse_gain(uint32_t width)
+{
+  uint32_t longest = (width & 0x80000000) ? width : 0 - width; // Longer of the high and low parts
+
+  return (int32_t)((31UL << 25) / (longest >> 16));
+}
+
+/**
+ * @brief Look up a band-limited pulse, the difference of a ramp and the same ramp ahead by width
+ * @param level Mip level of wavetable_ramp
+ * @param phase Position in the full wave, the pulse is low first and high for the last width of the turn
+ * @param width High part of the period, a full turn is 2^32 (WAVETABLE_PULSE_MIN to WAVETABLE_PULSE_MAX)
+ * @param gain See wavetable_pulse_gain()
+ * @return The Q15 sample, saturated
+ */
+static inline int16_t wavetable_pulse(const wavetable_level_t *level, uint32_t phase, uint32_t width, int32_t gain)
+{
+  int32_t ramp = wavetable_read(level->data, level->bits, phase);
+  int32_t ahead = wavetable_read(level->data, level->bits, phase + width);
+  int32_t sample = ((ramp - ahead) * gain) >> 15;
+
+  return (int16_t)(sample > INT16_MAX ? INT16_MAX : (sample < INT16_MIN ? INT16_MIN : sample));
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _WAVETABLE_H_ */
\ No newline at end of file
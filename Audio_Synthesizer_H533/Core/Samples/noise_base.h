@@ -1,4100 +0,0 @@
-/* noise_base.h - Generated from MATLAB */
-const unsigned short noise_base[65536] = {
-    258, 343, 748, 697, 334, 369, 337, 477, 891, 976, 577, 967, 852, 277, 345, 171, 
-    988, 421, 886, 942, 806, 353, 70, 781, 609, 577, 700, 641, 759, 743, 344, 263, 
-    238, 954, 457, 776, 421, 725, 683, 937, 755, 326, 909, 297, 940, 1010, 475, 872, 
-    342, 85, 1020, 277, 628, 944, 266, 359, 787, 533, 362, 365, 789, 108, 81, 981, 
-    930, 379, 99, 376, 706, 938, 575, 604, 357, 326, 15, 425, 951, 341, 309, 140, 
-    632, 558, 946, 216, 851, 393, 789, 221, 904, 457, 915, 367, 711, 602, 838, 168, 
-    170, 577, 586, 895, 612, 513, 311, 371, 846, 534, 576, 764, 674, 1014, 704, 609, 
-    775, 586, 817, 945, 789, 275, 970, 884, 603, 155, 764, 600, 774, 64, 423, 911, 
-    897, 962, 343, 95, 508, 96, 890, 109, 655, 344, 323, 874, 582, 492, 651, 261, 
-    106, 369, 530, 156, 127, 883, 273, 337, 288, 728, 25, 5, 84, 298, 880, 91, 
-    931, 147, 690, 217, 331, 516, 4, 46, 904, 71, 608, 348, 935, 679, 279, 403, 
-    160, 766, 36, 1003, 517, 681, 553, 449, 408, 232, 332, 659, 742, 26, 361, 380, 
-    121, 176, 450, 219, 369, 703, 789, 347, 18, 163, 295, 429, 316, 467, 341, 146, 
-    282, 533, 823, 1012, 695, 201, 141, 585, 105, 849, 838, 795, 784, 772, 258, 831, 
-    436, 890, 148, 974, 156, 40, 396, 295, 348, 674, 380, 767, 756, 340, 786, 275, 
-    198, 40, 402, 759, 746, 497, 133, 703, 271, 374, 990, 3, 431, 783, 340, 9, 
-    904, 918, 82, 765, 18, 82, 283, 693, 327, 42, 684, 586, 182, 541, 972, 974, 
-    97, 789, 436, 395, 941, 543, 223, 292, 286, 102, 385, 748, 423, 246, 568, 63, 
-    109, 384, 974, 90, 926, 514, 260, 305, 619, 147, 122, 119, 34, 61, 793, 742, 
-    920, 197, 317, 236, 13, 111, 662, 368, 878, 492, 160, 331, 606, 920, 769, 737, 
-    136, 794, 609, 1014, 15, 853, 144, 968, 351, 619, 68, 814, 283, 34, 838, 793, 
-    134, 125, 347, 398, 273, 36, 391, 573, 298, 22, 284, 640, 244, 189, 794, 862, 
-    671, 227, 595, 981, 331, 133, 757, 950, 376, 124, 162, 888, 498, 205, 259, 720, 
-    785, 497, 946, 636, 229, 840, 173, 942, 794, 942, 230, 447, 670, 1022, 52, 294, 
-    163, 942, 113, 74, 660, 476, 411, 829, 62, 68, 972, 591, 1016, 193, 974, 661, 
-    428, 120, 279, 56, 23, 624, 957, 736, 48, 882, 51, 832, 315, 897, 534, 489, 
-    462, 347, 404, 398, 606, 95, 402, 917, 512, 935, 164, 300, 856, 805, 944, 216, 
-    364, 708, 953, 443, 624, 704, 813, 887, 455, 736, 794, 479, 636, 703, 169, 276, 
-    516, 210, 463, 823, 688, 270, 17, 639, 689, 410, 907, 493, 492, 930, 321, 285, 
-    881, 867, 842, 601, 1007, 256, 767, 315, 21, 280, 1015, 387, 1015, 268, 665, 734, 
-    734, 754, 112, 138, 599, 526, 650, 935, 366, 438, 815, 303, 611, 853, 89, 601, 
-    810, 54, 310, 56, 274, 310, 490, 748, 408, 532, 127, 675, 434, 878, 981, 250, 
-    775, 994, 703, 612, 484, 128, 484, 701, 428, 359, 209, 200, 212, 121, 643, 986, 
-    997, 905, 758, 777, 861, 272, 330, 987, 338, 864, 865, 454, 953, 163, 9, 857, 
-    351, 128, 572, 218, 669, 425, 427, 728, 941, 657, 338, 736, 221, 325, 168, 197, 
-    876, 178, 219, 771, 870, 330, 451, 815, 955, 450, 163, 818, 235, 30, 757, 335, 
-    94, 237, 59, 818, 458, 68, 998, 312, 213, 630, 812, 688, 220, 694, 106, 710, 
-    830, 988, 849, 902, 584, 941, 99, 94, 719, 130, 648, 1001, 324, 583, 310, 344, 
-    645, 885, 227, 389, 221, 452, 505, 781, 157, 909, 985, 969, 404, 799, 858, 780, 
-    398, 353, 1000, 822, 72, 680, 813, 762, 512, 778, 578, 792, 640, 823, 558, 255, 
-    916, 875, 602, 53, 508, 773, 918, 86, 519, 17, 203, 383, 743, 655, 1004, 397, 
-    126, 891, 811, 873, 847, 1007, 332, 252, 193, 21, 272, 272, 938, 495, 1022, 28, 
-    910, 482, 159, 666, 359, 103, 364, 678, 152, 747, 508, 481, 585, 656, 272, 507, 
-    881, 709, 529, 777, 100, 477, 760, 920, 103, 310, 128, 511, 779, 682, 636, 194, 
-    433, 977, 138, 573, 48, 200, 520, 434, 951, 621, 389, 60, 556, 538, 918, 752, 
-    611, 876, 103, 569, 309, 959, 429, 26, 241, 767, 916, 748, 294, 812, 233, 559, 
-    337, 688, 716, 587, 715, 923, 501, 270, 705, 858, 997, 894, 397, 70, 602, 681, 
-    275, 648, 794, 661, 662, 296, 807, 297, 983, 431, 457, 363, 282, 975, 322, 264, 
-    49, 302, 116, 762, 269, 861, 778, 261, 708, 98, 733, 659, 905, 375, 168, 183, 
-    450, 344, 331, 99, 526, 45, 527, 38, 390, 598, 958, 17, 320, 674, 339, 348, 
-    804, 233, 64, 959, 60, 61, 534, 999, 48, 463, 811, 854, 186, 421, 922, 403, 
-    601, 334, 282, 367, 646, 454, 678, 492, 394, 383, 979, 166, 489, 989, 949, 13, 
-    20, 447, 53, 877, 842, 491, 668, 261, 692, 272, 880, 447, 920, 938, 916, 530, 
-    640, 111, 14, 505, 414, 1020, 1023, 303, 520, 865, 590, 526, 26, 13, 689, 874, 
-    877, 775, 236, 536, 528, 639, 516, 322, 31, 47, 509, 55, 889, 342, 433, 2, 
-    419, 710, 437, 227, 896, 873, 328, 391, 241, 958, 169, 642, 143, 160, 882, 202, 
-    983, 372, 4, 876, 868, 553, 487, 87, 388, 536, 994, 449, 831, 917, 849, 501, 
-    785, 13, 356, 219, 644, 339, 204, 883, 734, 338, 968, 604, 442, 209, 193, 11, 
-    867, 287, 411, 734, 871, 456, 730, 909, 646, 1010, 178, 643, 701, 171, 152, 145, 
-    94, 939, 873, 365, 94, 340, 69, 90, 740, 420, 532, 276, 741, 889, 180, 405, 
-    412, 535, 179, 425, 4, 937, 442, 754, 102, 85, 801, 945, 234, 463, 212, 109, 
-    88, 1016, 451, 260, 746, 395, 602, 796, 728, 969, 778, 178, 512, 304, 883, 679, 
-    703, 118, 624, 371, 414, 196, 850, 967, 924, 615, 434, 8, 50, 532, 493, 13, 
-    471, 26, 787, 442, 984, 580, 894, 586, 487, 607, 960, 12, 287, 77, 685, 643, 
-    95, 684, 110, 648, 175, 315, 348, 869, 226, 834, 584, 601, 681, 171, 467, 368, 
-    120, 271, 764, 623, 342, 358, 486, 373, 746, 502, 59, 1007, 74, 403, 758, 711, 
-    12, 557, 408, 316, 497, 1022, 978, 835, 990, 347, 904, 382, 189, 259, 594, 480, 
-    748, 843, 811, 363, 149, 157, 370, 505, 507, 439, 88, 785, 518, 951, 566, 229, 
-    703, 288, 884, 284, 657, 532, 732, 500, 231, 421, 285, 346, 708, 742, 604, 67, 
-    243, 143, 822, 823, 687, 428, 368, 116, 91, 193, 940, 793, 869, 1020, 766, 53, 
-    20, 828, 701, 945, 861, 593, 786, 878, 403, 122, 454, 224, 122, 69, 510, 388, 
-    169, 821, 1, 523, 289, 313, 667, 467, 638, 397, 284, 150, 529, 531, 563, 479, 
-    656, 392, 210, 38, 920, 52, 299, 63, 96, 981, 542, 875, 632, 783, 93, 417, 
-    999, 29, 131, 32, 230, 139, 779, 48, 215, 998, 275, 395, 62, 210, 864, 632, 
-    750, 143, 1009, 687, 913, 250, 631, 435, 395, 920, 864, 558, 818, 98, 351, 553, 
-    455, 100, 626, 659, 594, 444, 694, 195, 928, 1010, 966, 328, 80, 13, 732, 921, 
-    645, 277, 195, 1006, 420, 636, 947, 647, 157, 237, 961, 504, 497, 546, 919, 494, 
-    74, 783, 494, 172, 300, 281, 299, 963, 418, 427, 477, 320, 882, 569, 566, 82, 
-    361, 341, 861, 310, 341, 817, 614, 100, 763, 354, 276, 244, 866, 579, 238, 279, 
-    912, 524, 826, 925, 716, 503, 421, 504, 580, 843, 525, 209, 499, 36, 31, 604, 
-    212, 622, 103, 243, 857, 936, 117, 179, 949, 911, 1007, 710, 748, 956, 734, 487, 
-    603, 730, 114, 834, 493, 699, 914, 708, 9, 309, 560, 633, 547, 21, 549, 19, 
-    842, 769, 482, 788, 592, 327, 373, 171, 374, 881, 45, 985, 17, 499, 391, 703, 
-    570, 909, 583, 724, 518, 663, 199, 486, 101, 973, 376, 877, 1002, 314, 857, 47, 
-    889, 343, 308, 916, 531, 266, 963, 827, 103, 1009, 118, 536, 105, 88, 570, 940, 
-    62, 900, 503, 349, 842, 969, 665, 1001, 517, 926, 557, 838, 892, 840, 799, 904, 
-    32, 1005, 899, 663, 723, 971, 442, 933, 1006, 451, 255, 644, 612, 10, 549, 531, 
-    944, 179, 611, 6, 828, 600, 289, 236, 99, 544, 140, 785, 47, 12, 844, 854, 
-    178, 807, 314, 953, 901, 209, 552, 747, 819, 870, 482, 885, 649, 226, 143, 148, 
-    792, 513, 338, 850, 747, 35, 816, 775, 709, 511, 199, 680, 167, 398, 156, 53, 
-    708, 69, 584, 972, 111, 579, 135, 113, 822, 917, 297, 579, 20, 312, 930, 607, 
-    595, 887, 854, 147, 54, 898, 429, 150, 230, 314, 781, 321, 20, 849, 1015, 1002, 
-    619, 592, 368, 893, 843, 282, 486, 68, 11, 860, 99, 516, 855, 668, 634, 691, 
-    849, 448, 55, 226, 902, 578, 197, 79, 194, 988, 388, 749, 125, 626, 242, 799, 
-    315, 300, 907, 336, 134, 540, 218, 927, 432, 498, 82, 985, 490, 175, 60, 826, 
-    11, 202, 728, 513, 843, 170, 865, 306, 597, 995, 879, 738, 688, 818, 823, 358, 
-    22, 569, 243, 372, 432, 650, 867, 892, 971, 913, 119, 734, 658, 70, 794, 320, 
-    365, 124, 263, 402, 999, 340, 570, 788, 564, 295, 494, 681, 974, 929, 868, 784, 
-    136, 677, 610, 441, 741, 983, 63, 280, 580, 791, 234, 508, 218, 995, 303, 702, 
-    379, 395, 389, 568, 337, 261, 886, 77, 886, 856, 478, 790, 778, 176, 986, 901, 
-    615, 22, 186, 306, 556, 722, 35, 374, 586, 344, 257, 577, 825, 953, 854, 927, 
-    588, 969, 42, 739, 649, 203, 723, 909, 74, 962, 639, 322, 574, 88, 252, 356, 
-    885, 101, 756, 288, 123, 854, 782, 784, 97, 727, 474, 96, 598, 840, 149, 887, 
-    992, 97, 397, 787, 301, 896, 156, 973, 559, 861, 850, 400, 269, 792, 853, 275, 
-    765, 630, 416, 670, 467, 767, 105, 164, 569, 425, 339, 219, 790, 744, 861, 155, 
-    835, 95, 540, 174, 650, 150, 943, 775, 951, 857, 13, 330, 297, 117, 870, 1002, 
-    543, 565, 549, 333, 565, 183, 546, 241, 462, 249, 876, 51, 197, 915, 794, 137, 
-    365, 559, 139, 574, 431, 386, 589, 874, 865, 808, 153, 630, 180, 474, 45, 864, 
-    547, 944, 749, 402, 628, 622, 917, 993, 588, 348, 900, 979, 761, 941, 690, 960, 
-    142, 530, 494, 469, 761, 510, 159, 687, 827, 657, 451, 265, 601, 319, 843, 337, 
-    572, 928, 58, 695, 724, 971, 980, 835, 884, 171, 334, 791, 35, 39, 1020, 225, 
-    682, 466, 279, 300, 955, 886, 100, 137, 689, 425, 522, 4, 801, 12, 697, 919, 
-    984, 239, 391, 591, 836, 900, 166, 559, 31, 609, 911, 492, 268, 186, 888, 938, 
-    221, 967, 547, 859, 990, 1012, 377, 537, 667, 156, 89, 253, 141, 734, 14, 633, 
-    997, 600, 516, 157, 679, 726, 596, 614, 23, 767, 683, 8, 664, 147, 667, 339, 
-    661, 625, 828, 906, 741, 568, 711, 562, 418, 169, 234, 126, 204, 63, 912, 748, 
-    124, 198, 406, 743, 382, 292, 108, 815, 524, 618, 48, 430, 859, 403, 420, 287, 
-    243, 904, 32, 746, 295, 620, 790, 971, 261, 424, 25, 480, 645, 657, 515, 414, 
-    579, 590, 772, 124, 689, 868, 288, 783, 488, 171, 785, 983, 243, 52, 112, 821, 
-    399, 585, 150, 517, 968, 922, 427, 465, 328, 101, 441, 322, 1011, 444, 411, 404, 
-    166, 427, 521, 288, 667, 636, 725, 259, 502, 329, 662, 1005, 800, 403, 468, 565, 
-    685, 804, 418, 711, 287, 140, 12, 37, 361, 822, 446, 147, 319, 129, 859, 456, 
-    101, 964, 985, 281, 864, 900, 640, 472, 709, 321, 528, 353, 569, 730, 369, 173, 
-    665, 345, 535, 637, 695, 945, 88, 523, 611, 757, 178, 565, 709, 24, 721, 386, 
-    981, 619, 430, 371, 38, 178, 412, 245, 129, 439, 1012, 560, 519, 307, 582, 319, 
-    44, 486, 719, 724, 598, 395, 47, 595, 284, 314, 526, 351, 807, 784, 266, 373, 
-    277, 502, 465, 937, 808, 646, 494, 309, 920, 679, 733, 210, 844, 702, 745, 764, 
-    544, 42, 475, 708, 817, 472, 83, 697, 841, 966, 114, 954, 747, 311, 550, 705, 
-    390, 764, 965, 893, 1020, 235, 151, 397, 77, 525, 76, 930, 515, 147, 582, 99, 
-    810, 323, 294, 387, 366, 668, 409, 516, 950, 437, 428, 512, 893, 953, 467, 664, 
-    789, 357, 649, 172, 278, 224, 424, 290, 462, 765, 233, 67, 71, 246, 830, 953, 
-    354, 436, 503, 892, 694, 508, 883, 493, 50, 604, 510, 960, 5, 986, 847, 773, 
-    769, 184, 315, 959, 282, 877, 502, 135, 623, 741, 594, 681, 886, 509, 297, 1022, 
-    506, 852, 755, 518, 992, 57, 108, 760, 94, 647, 492, 495, 432, 596, 767, 108, 
-    484, 111, 136, 346, 93, 934, 676, 598, 158, 603, 644, 287, 159, 535, 265, 81, 
-    46, 76, 491, 551, 883, 299, 4, 557, 633, 381, 478, 837, 85, 68, 835, 257, 
-    237, 378, 12, 395, 828, 796, 399, 848, 492, 243, 790, 430, 28, 373, 443, 503, 
-    293, 485, 459, 979, 603, 503, 227, 662, 349, 701, 921, 328, 307, 96, 208, 993, 
-    658, 419, 231, 634, 878, 919, 616, 679, 455, 148, 593, 1015, 371, 536, 359, 13, 
-    443, 253, 676, 408, 935, 422, 429, 150, 511, 394, 309, 796, 127, 551, 872, 379, 
-    360, 988, 318, 229, 961, 678, 415, 414, 501, 340, 983, 897, 516, 109, 582, 390, 
-    614, 52, 714, 793, 837, 909, 697, 923, 884, 664, 412, 546, 36, 124, 580, 1013, 
-    367, 942, 478, 462, 980, 642, 875, 342, 559, 638, 835, 437, 46, 811, 802, 695, 
-    973, 403, 130, 668, 912, 164, 544, 475, 284, 823, 434, 71, 149, 536, 292, 461, 
-    811, 845, 591, 800, 364, 33, 877, 347, 405, 790, 967, 128, 675, 78, 441, 964, 
-    618, 63, 266, 721, 971, 333, 424, 696, 7, 444, 620, 910, 603, 768, 421, 889, 
-    666, 596, 40, 642, 409, 219, 474, 702, 276, 711, 968, 461, 278, 807, 429, 625, 
-    184, 252, 908, 138, 291, 239, 272, 18, 108, 659, 713, 1015, 886, 39, 717, 102, 
-    828, 72, 661, 666, 720, 485, 120, 813, 832, 648, 330, 516, 141, 411, 615, 890, 
-    64, 704, 750, 115, 947, 81, 93, 815, 118, 5, 17, 582, 983, 126, 96, 669, 
-    222, 250, 185, 922, 444, 467, 193, 952, 814, 183, 221, 811, 516, 324, 75, 758, 
-    982, 29, 207, 168, 210, 320, 880, 521, 604, 591, 476, 71, 203, 409, 574, 441, 
-    476, 941, 471, 223, 276, 9, 841, 952, 509, 674, 309, 150, 238, 567, 755, 174, 
-    222, 452, 643, 239, 86, 361, 136, 474, 97, 731, 376, 781, 486, 581, 287, 154, 
-    226, 684, 261, 104, 687, 194, 373, 556, 102, 558, 527, 630, 162, 278, 812, 446, 
-    136, 279, 672, 514, 396, 381, 891, 659, 465, 14, 255, 670, 514, 423, 783, 257, 
-    257, 506, 1002, 745, 141, 634, 758, 354, 316, 230, 179, 33, 131, 825, 150, 997, 
-    196, 518, 226, 502, 439, 6, 200, 776, 326, 360, 688, 614, 422, 819, 705, 989, 
-    910, 626, 988, 479, 606, 391, 821, 423, 274, 264, 793, 724, 442, 373, 891, 764, 
-    300, 273, 486, 192, 475, 954, 535, 603, 890, 448, 330, 773, 859, 591, 682, 466, 
-    124, 491, 564, 532, 566, 307, 391, 395, 300, 8, 237, 189, 775, 813, 318, 398, 
-    239, 466, 961, 838, 418, 733, 32, 853, 951, 38, 455, 829, 74, 342, 212, 903, 
-    776, 290, 490, 766, 334, 303, 872, 576, 385, 94, 484, 688, 415, 665, 991, 174, 
-    129, 937, 740, 680, 850, 626, 292, 50, 883, 62, 499, 649, 735, 360, 730, 543, 
-    193, 123, 660, 136, 801, 191, 563, 639, 712, 882, 563, 943, 68, 986, 885, 49, 
-    675, 925, 207, 132, 638, 24, 343, 934, 89, 565, 879, 421, 419, 674, 332, 154, 
-    453, 999, 859, 275, 277, 543, 709, 430, 619, 616, 867, 278, 391, 878, 212, 140, 
-    887, 793, 781, 609, 323, 650, 766, 901, 392, 102, 761, 174, 784, 696, 223, 547, 
-    627, 883, 28, 579, 94, 352, 784, 570, 150, 904, 69, 339, 27, 287, 211, 789, 
-    95, 220, 89, 803, 605, 328, 641, 925, 265, 401, 201, 839, 58, 464, 253, 380, 
-    161, 603, 569, 147, 1002, 754, 109, 93, 540, 330, 491, 107, 999, 786, 908, 688, 
-    841, 224, 828, 264, 766, 403, 11, 166, 175, 477, 388, 213, 140, 705, 678, 231, 
-    357, 759, 104, 834, 398, 310, 873, 584, 358, 533, 323, 503, 454, 810, 559, 424, 
-    235, 218, 825, 964, 256, 861, 16, 141, 866, 321, 563, 823, 19, 322, 448, 5, 
-    461, 570, 250, 595, 640, 379, 96, 760, 718, 369, 781, 727, 613, 326, 575, 221, 
-    161, 540, 316, 622, 492, 579, 144, 480, 416, 457, 710, 251, 238, 129, 564, 560, 
-    99, 328, 174, 873, 362, 543, 348, 914, 118, 858, 282, 248, 356, 166, 830, 70, 
-    752, 777, 64, 816, 97, 30, 923, 756, 98, 600, 384, 793, 849, 873, 476, 446, 
-    639, 933, 789, 892, 167, 911, 420, 656, 120, 867, 933, 160, 157, 744, 555, 131, 
-    854, 543, 821, 84, 230, 872, 640, 725, 117, 946, 807, 678, 88, 839, 1019, 166, 
-    935, 621, 228, 708, 719, 972, 43, 117, 656, 796, 49, 700, 435, 785, 370, 203, 
-    925, 108, 588, 248, 738, 638, 465, 802, 345, 155, 638, 283, 16, 996, 117, 234, 
-    114, 996, 157, 711, 125, 735, 929, 756, 237, 221, 733, 806, 416, 829, 62, 186, 
-    281, 976, 163, 367, 339, 841, 158, 542, 392, 963, 974, 1018, 386, 390, 685, 128, 
-    426, 129, 520, 927, 717, 545, 634, 120, 138, 426, 728, 727, 624, 777, 598, 401, 
-    1017, 620, 949, 897, 90, 289, 55, 153, 767, 409, 716, 89, 678, 397, 445, 813, 
-    307, 394, 900, 925, 804, 317, 16, 169, 262, 485, 391, 35, 1018, 111, 848, 962, 
-    854, 167, 192, 366, 690, 952, 158, 956, 833, 175, 589, 69, 996, 238, 908, 666, 
-    409, 425, 155, 25, 84, 159, 999, 171, 745, 225, 262, 509, 3, 44, 598, 900, 
-    211, 988, 531, 671, 202, 94, 461, 306, 553, 636, 301, 338, 0, 88, 978, 191, 
-    713, 688, 393, 788, 264, 215, 806, 879, 307, 844, 512, 342, 150, 269, 665, 80, 
-    830, 599, 767, 666, 994, 1001, 718, 124, 834, 750, 954, 99, 781, 391, 502, 575, 
-    116, 92, 560, 97, 151, 917, 267, 872, 38, 545, 743, 6, 801, 424, 194, 684, 
-    959, 306, 932, 378, 545, 629, 437, 132, 668, 788, 536, 632, 326, 607, 893, 939, 
-    301, 602, 423, 582, 780, 610, 419, 934, 167, 152, 620, 840, 391, 501, 266, 216, 
-    597, 828, 443, 513, 691, 778, 529, 657, 115, 214, 495, 643, 888, 176, 717, 563, 
-    955, 604, 962, 898, 380, 455, 230, 504, 845, 167, 933, 874, 86, 962, 980, 969, 
-    332, 204, 352, 800, 886, 981, 243, 840, 775, 356, 491, 987, 84, 687, 405, 402, 
-    1011, 530, 673, 125, 641, 109, 38, 566, 170, 807, 139, 801, 429, 323, 401, 921, 
-    679, 830, 886, 923, 964, 666, 392, 960, 227, 781, 922, 500, 367, 226, 232, 256, 
-    529, 182, 667, 155, 428, 785, 271, 253, 788, 528, 969, 491, 342, 762, 628, 634, 
-    625, 716, 628, 760, 675, 985, 517, 164, 425, 420, 135, 310, 691, 102, 929, 900, 
-    117, 703, 463, 863, 197, 685, 550, 501, 310, 969, 77, 346, 529, 1022, 165, 175, 
-    162, 283, 748, 680, 164, 29, 949, 762, 617, 368, 638, 413, 664, 574, 200, 84, 
-    745, 533, 529, 26, 475, 510, 253, 858, 954, 1010, 674, 250, 501, 650, 58, 88, 
-    196, 245, 789, 1, 50, 835, 138, 327, 209, 181, 187, 980, 573, 792, 866, 489, 
-    24, 332, 214, 887, 378, 331, 561, 215, 105, 278, 397, 722, 439, 608, 319, 745, 
-    352, 997, 422, 491, 657, 790, 265, 186, 1001, 818, 333, 341, 211, 697, 201, 283, 
-    651, 104, 82, 760, 342, 631, 486, 767, 641, 307, 952, 501, 113, 836, 926, 647, 
-    348, 561, 83, 357, 947, 866, 200, 829, 280, 656, 568, 579, 878, 103, 896, 747, 
-    453, 211, 159, 746, 305, 578, 568, 729, 1010, 496, 764, 545, 1014, 125, 974, 135, 
-    123, 935, 971, 680, 574, 161, 713, 422, 598, 1012, 18, 636, 143, 822, 83, 337, 
-    263, 75, 278, 522, 407, 4, 131, 940, 281, 769, 1001, 587, 490, 121, 563, 716, 
-    724, 247, 503, 566, 451, 684, 956, 667, 171, 245, 394, 328, 591, 1010, 274, 591, 
-    299, 940, 117, 485, 818, 845, 382, 298, 383, 1010, 443, 835, 65, 438, 20, 390, 
-    423, 573, 904, 498, 782, 686, 828, 1016, 849, 212, 896, 135, 396, 138, 994, 78, 
-    791, 791, 322, 418, 565, 445, 120, 783, 677, 880, 956, 481, 843, 91, 306, 81, 
-    357, 828, 717, 998, 947, 96, 138, 59, 628, 850, 608, 368, 995, 269, 996, 563, 
-    456, 920, 514, 940, 955, 117, 755, 677, 784, 133, 1002, 687, 898, 55, 503, 499, 
-    595, 933, 771, 907, 178, 75, 275, 217, 336, 676, 491, 216, 851, 226, 740, 677, 
-    231, 759, 913, 738, 420, 732, 964, 957, 580, 36, 61, 193, 385, 582, 685, 926, 
-    798, 907, 669, 129, 1, 178, 649, 837, 459, 828, 29, 35, 392, 314, 327, 236, 
-    907, 498, 42, 729, 659, 976, 677, 288, 797, 75, 296, 339, 208, 600, 574, 4, 
-    707, 304, 511, 413, 641, 668, 65, 642, 501, 11, 5, 498, 819, 723, 239, 414, 
-    721, 302, 903, 65, 638, 610, 809, 613, 867, 162, 975, 679, 898, 120, 775, 505, 
-    234, 522, 148, 86, 513, 993, 135, 991, 818, 1001, 938, 541, 994, 270, 520, 498, 
-    508, 330, 711, 283, 475, 707, 205, 551, 393, 815, 165, 681, 324, 343, 508, 628, 
-    302, 48, 819, 204, 448, 393, 552, 404, 441, 164, 225, 27, 545, 733, 3, 385, 
-    229, 949, 373, 903, 105, 24, 27, 163, 659, 805, 367, 463, 394, 918, 964, 226, 
-    799, 464, 534, 971, 174, 704, 368, 80, 303, 770, 803, 730, 101, 433, 936, 433, 
-    123, 279, 680, 854, 375, 964, 160, 835, 716, 659, 584, 1, 869, 771, 111, 912, 
-    365, 154, 809, 546, 314, 424, 749, 388, 339, 168, 385, 603, 351, 279, 256, 877, 
-    545, 670, 270, 917, 990, 448, 898, 876, 169, 18, 410, 351, 769, 131, 983, 208, 
-    530, 715, 790, 680, 300, 987, 371, 185, 606, 499, 252, 965, 497, 934, 135, 316, 
-    426, 415, 989, 190, 774, 970, 582, 81, 63, 644, 204, 770, 336, 470, 470, 342, 
-    709, 642, 119, 58, 441, 954, 109, 22, 697, 752, 248, 902, 607, 602, 424, 80, 
-    744, 874, 351, 894, 841, 196, 676, 87, 657, 575, 933, 846, 366, 782, 751, 82, 
-    520, 312, 612, 517, 173, 829, 668, 549, 911, 55, 297, 586, 513, 746, 483, 950, 
-    978, 686, 525, 821, 228, 905, 735, 845, 113, 576, 895, 836, 70, 559, 1010, 807, 
-    242, 399, 130, 107, 339, 763, 422, 877, 605, 694, 547, 94, 400, 457, 60, 734, 
-    305, 1019, 86, 15, 204, 826, 481, 320, 292, 1003, 776, 133, 642, 468, 692, 724, 
-    177, 516, 544, 549, 425, 569, 691, 523, 578, 96, 481, 172, 738, 1005, 940, 416, 
-    764, 449, 868, 456, 733, 672, 68, 628, 241, 545, 187, 1007, 708, 297, 686, 587, 
-    837, 256, 239, 275, 219, 995, 966, 913, 34, 307, 351, 219, 1007, 313, 720, 463, 
-    963, 388, 911, 250, 98, 218, 473, 829, 656, 571, 696, 334, 464, 681, 331, 377, 
-    710, 399, 437, 227, 770, 793, 446, 73, 680, 441, 950, 764, 368, 385, 157, 680, 
-    183, 903, 12, 58, 788, 47, 897, 787, 99, 456, 594, 621, 211, 157, 518, 495, 
-    125, 307, 139, 53, 393, 757, 671, 981, 517, 651, 354, 252, 974, 169, 540, 1020, 
-    931, 667, 134, 741, 648, 816, 766, 35, 514, 384, 914, 187, 118, 412, 697, 768, 
-    734, 750, 323, 686, 116, 971, 489, 609, 614, 405, 87, 267, 271, 515, 218, 362, 
-    199, 521, 705, 463, 989, 780, 13, 923, 526, 642, 737, 25, 685, 779, 129, 700, 
-    725, 742, 852, 614, 999, 927, 62, 770, 516, 185, 21, 995, 66, 701, 937, 750, 
-    859, 820, 108, 732, 1000, 93, 849, 286, 50, 557, 813, 553, 214, 307, 609, 693, 
-    611, 322, 901, 991, 942, 360, 128, 246, 493, 939, 284, 649, 604, 445, 851, 120, 
-    477, 335, 202, 828, 860, 764, 809, 953, 819, 743, 643, 28, 398, 166, 301, 685, 
-    901, 71, 136, 568, 919, 11, 505, 466, 873, 661, 314, 59, 126, 964, 891, 431, 
-    38, 796, 329, 645, 725, 910, 442, 986, 559, 702, 522, 62, 328, 348, 583, 227, 
-    528, 916, 225, 457, 498, 829, 1020, 426, 55, 914, 927, 127, 216, 552, 520, 563, 
-    19, 774, 451, 358, 905, 982, 594, 524, 322, 332, 73, 444, 608, 353, 508, 420, 
-    284, 863, 52, 750, 973, 331, 886, 325, 248, 242, 364, 188, 577, 863, 459, 528, 
-    737, 736, 56, 410, 912, 564, 409, 1009, 797, 973, 620, 248, 585, 733, 568, 398, 
-    722, 797, 332, 972, 24, 338, 306, 731, 421, 934, 652, 453, 465, 897, 387, 723, 
-    159, 941, 150, 337, 347, 939, 248, 787, 126, 665, 377, 985, 388, 601, 435, 30, 
-    273, 358, 850, 385, 953, 547, 734, 423, 501, 573, 544, 512, 46, 862, 824, 53, 
-    913, 769, 938, 43, 524, 609, 37, 95, 994, 322, 591, 165, 736, 24, 350, 496, 
-    1007, 544, 653, 360, 1006, 133, 280, 747, 469, 867, 1010, 894, 413, 316, 603, 820, 
-    623, 886, 969, 331, 990, 532, 750, 661, 702, 379, 726, 563, 463, 721, 739, 192, 
-    912, 244, 162, 39, 626, 436, 909, 571, 372, 382, 549, 63, 618, 113, 188, 519, 
-    515, 418, 647, 776, 658, 760, 374, 407, 586, 91, 851, 66, 604, 564, 930, 220, 
-    300, 882, 925, 77, 887, 944, 918, 687, 389, 223, 383, 597, 250, 957, 429, 666, 
-    46, 356, 301, 315, 108, 879, 27, 133, 819, 426, 979, 540, 1013, 979, 588, 330, 
-    938, 853, 276, 930, 794, 429, 842, 394, 544, 45, 1015, 486, 950, 697, 465, 94, 
-    1003, 297, 325, 609, 930, 371, 283, 512, 557, 1019, 727, 787, 724, 737, 728, 874, 
-    301, 863, 999, 678, 420, 176, 463, 928, 533, 875, 332, 883, 534, 936, 285, 948, 
-    881, 321, 127, 685, 802, 395, 396, 872, 459, 848, 855, 914, 769, 690, 123, 30, 
-    628, 749, 975, 641, 480, 497, 887, 837, 622, 581, 519, 885, 688, 295, 927, 60, 
-    541, 520, 499, 870, 904, 953, 154, 32, 200, 652, 768, 316, 435, 642, 638, 602, 
-    314, 333, 967, 888, 648, 569, 378, 543, 712, 753, 658, 789, 229, 442, 287, 844, 
-    581, 796, 412, 702, 850, 830, 863, 356, 961, 74, 196, 562, 484, 77, 28, 52, 
-    403, 995, 366, 542, 772, 369, 220, 14, 687, 187, 549, 269, 334, 1001, 204, 821, 
-    468, 586, 190, 122, 266, 632, 508, 1011, 146, 362, 541, 701, 528, 92, 981, 457, 
-    334, 37, 525, 824, 958, 496, 481, 864, 124, 154, 680, 837, 832, 893, 421, 119, 
-    26, 143, 693, 861, 618, 174, 581, 865, 396, 629, 523, 432, 102, 794, 267, 57, 
-    371, 209, 700, 124, 508, 669, 544, 977, 728, 869, 475, 851, 565, 372, 693, 784, 
-    473, 631, 199, 692, 201, 579, 973, 985, 799, 789, 510, 114, 937, 875, 199, 388, 
-    204, 648, 113, 994, 965, 659, 438, 856, 148, 170, 936, 492, 408, 532, 939, 681, 
-    102, 951, 231, 847, 946, 829, 740, 146, 742, 790, 702, 969, 732, 251, 189, 267, 
-    80, 31, 495, 416, 479, 643, 299, 107, 545, 936, 625, 904, 330, 229, 747, 360, 
-    384, 299, 344, 854, 953, 676, 819, 296, 1003, 957, 258, 718, 232, 719, 381, 782, 
-    592, 354, 663, 809, 219, 987, 188, 704, 898, 983, 458, 676, 182, 583, 896, 193, 
-    533, 422, 400, 471, 862, 108, 597, 427, 292, 873, 330, 48, 754, 26, 6, 435, 
-    117, 113, 614, 380, 202, 557, 415, 907, 333, 379, 451, 113, 543, 142, 663, 980, 
-    680, 814, 434, 150, 494, 849, 314, 921, 549, 68, 177, 68, 841, 288, 822, 128, 
-    389, 212, 188, 752, 777, 1000, 699, 842, 165, 74, 489, 373, 668, 800, 638, 43, 
-    567, 844, 537, 997, 544, 964, 789, 1012, 555, 711, 483, 260, 179, 910, 721, 90, 
-    677, 931, 751, 261, 166, 258, 680, 489, 499, 294, 681, 524, 640, 489, 341, 914, 
-    369, 556, 188, 987, 878, 216, 529, 52, 424, 343, 355, 50, 236, 216, 209, 718, 
-    186, 336, 260, 531, 583, 247, 159, 876, 279, 550, 656, 887, 995, 584, 783, 726, 
-    989, 643, 560, 575, 205, 690, 188, 657, 448, 687, 860, 809, 784, 561, 11, 828, 
-    833, 666, 55, 454, 305, 442, 1019, 980, 639, 363, 959, 141, 279, 275, 685, 74, 
-    171, 535, 212, 681, 976, 423, 47, 474, 828, 987, 130, 417, 626, 175, 696, 510, 
-    434, 1010, 452, 806, 558, 880, 926, 804, 902, 100, 231, 665, 483, 718, 151, 205, 
-    385, 340, 355, 626, 518, 261, 1016, 546, 320, 413, 807, 21, 122, 295, 923, 519, 
-    932, 276, 854, 636, 600, 636, 368, 486, 321, 68, 248, 620, 442, 445, 97, 60, 
-    894, 170, 144, 670, 87, 793, 536, 248, 131, 124, 46, 809, 80, 472, 873, 669, 
-    820, 1008, 724, 381, 721, 824, 90, 70, 791, 885, 362, 701, 618, 200, 664, 337, 
-    434, 828, 726, 307, 101, 359, 884, 901, 1004, 444, 194, 380, 395, 205, 852, 361, 
-    442, 345, 152, 233, 636, 798, 238, 24, 603, 158, 135, 616, 738, 752, 905, 868, 
-    281, 504, 379, 783, 823, 599, 696, 230, 217, 702, 911, 259, 866, 128, 654, 971, 
-    806, 624, 584, 5, 617, 254, 315, 720, 505, 990, 52, 949, 272, 966, 659, 484, 
-    806, 8, 151, 702, 553, 558, 494, 111, 580, 356, 842, 487, 1003, 64, 225, 583, 
-    301, 358, 514, 923, 503, 56, 180, 419, 665, 500, 959, 920, 675, 851, 883, 362, 
-    405, 63, 590, 752, 932, 510, 349, 260, 880, 570, 990, 950, 421, 77, 995, 381, 
-    108, 252, 908, 710, 245, 895, 744, 742, 672, 722, 4, 855, 636, 301, 571, 113, 
-    227, 548, 613, 907, 154, 1019, 230, 979, 170, 680, 343, 525, 472, 676, 129, 556, 
-    135, 428, 644, 523, 957, 627, 1019, 983, 643, 250, 442, 428, 929, 129, 1008, 229, 
-    740, 877, 297, 983, 399, 626, 798, 317, 995, 832, 973, 432, 378, 669, 902, 834, 
-    612, 513, 427, 501, 943, 543, 805, 95, 103, 277, 970, 998, 739, 682, 885, 443, 
-    266, 436, 873, 819, 913, 141, 792, 313, 205, 430, 51, 291, 91, 42, 314, 850, 
-    11, 873, 349, 368, 404, 686, 141, 401, 325, 845, 110, 961, 422, 797, 444, 193, 
-    81, 931, 370, 899, 537, 431, 910, 390, 375, 223, 907, 407, 145, 835, 470, 265, 
-    720, 450, 26, 329, 439, 278, 163, 810, 560, 317, 916, 375, 336, 629, 200, 335, 
-    181, 469, 820, 445, 85, 595, 567, 36, 168, 942, 391, 531, 325, 545, 698, 339, 
-    210, 679, 967, 137, 314, 761, 611, 53, 627, 252, 363, 23, 598, 89, 686, 583, 
-    941, 278, 829, 137, 109, 819, 316, 83, 999, 239, 186, 861, 251, 93, 1012, 467, 
-    575, 360, 54, 13, 952, 453, 718, 964, 16, 266, 488, 581, 777, 257, 413, 79, 
-    206, 910, 673, 650, 16, 189, 25, 813, 308, 498, 504, 61, 731, 0, 735, 471, 
-    720, 807, 8, 256, 95, 803, 16, 854, 70, 194, 78, 768, 149, 399, 470, 203, 
-    331, 981, 161, 733, 240, 830, 803, 760, 760, 88, 311, 468, 557, 435, 230, 364, 
-    89, 430, 55, 1022, 194, 275, 111, 973, 673, 897, 934, 29, 468, 435, 499, 929, 
-    924, 644, 886, 683, 359, 229, 175, 4, 500, 492, 284, 785, 773, 306, 495, 408, 
-    387, 520, 786, 396, 658, 314, 422, 124, 735, 535, 395, 515, 72, 610, 650, 348, 
-    233, 374, 37, 183, 121, 709, 741, 0, 681, 972, 679, 25, 51, 432, 147, 340, 
-    284, 992, 272, 413, 274, 799, 727, 775, 240, 437, 158, 18, 573, 408, 183, 804, 
-    317, 539, 317, 897, 86, 489, 120, 728, 560, 971, 692, 283, 477, 678, 636, 98, 
-    758, 874, 693, 725, 99, 395, 55, 808, 190, 351, 82, 838, 164, 799, 993, 385, 
-    823, 152, 902, 507, 159, 696, 630, 621, 789, 279, 998, 464, 439, 511, 59, 453, 
-    242, 203, 524, 654, 140, 269, 735, 512, 165, 371, 123, 736, 279, 695, 693, 267, 
-    494, 494, 416, 889, 895, 373, 598, 824, 765, 208, 188, 252, 894, 443, 303, 444, 
-    601, 732, 182, 911, 362, 923, 587, 462, 490, 754, 600, 744, 401, 907, 983, 591, 
-    332, 43, 406, 747, 621, 736, 257, 54, 777, 804, 86, 784, 798, 810, 834, 606, 
-    511, 594, 127, 809, 273, 799, 887, 827, 349, 221, 108, 822, 524, 458, 598, 320, 
-    209, 653, 497, 105, 64, 739, 248, 718, 560, 787, 746, 574, 275, 354, 782, 573, 
-    117, 608, 426, 438, 127, 348, 372, 618, 690, 220, 154, 126, 263, 35, 870, 744, 
-    422, 149, 560, 826, 372, 484, 459, 729, 827, 226, 306, 1003, 721, 410, 385, 339, 
-    750, 555, 566, 141, 700, 294, 942, 126, 775, 454, 909, 869, 665, 996, 884, 484, 
-    928, 333, 652, 958, 413, 906, 631, 92, 736, 129, 873, 52, 370, 894, 527, 601, 
-    717, 883, 214, 394, 819, 508, 101, 404, 919, 156, 781, 1001, 160, 927, 363, 707, 
-    74, 365, 879, 460, 107, 528, 431, 800, 937, 693, 605, 513, 882, 376, 602, 60, 
-    755, 404, 221, 166, 610, 140, 10, 844, 191, 81, 93, 772, 946, 111, 643, 846, 
-    90, 20, 920, 494, 833, 949, 141, 145, 894, 317, 175, 861, 478, 548, 1009, 114, 
-    652, 134, 924, 941, 568, 334, 934, 444, 802, 237, 253, 62, 547, 498, 819, 693, 
-    714, 364, 568, 543, 393, 769, 696, 605, 73, 153, 329, 894, 808, 689, 409, 976, 
-    872, 398, 696, 478, 154, 246, 223, 595, 330, 27, 617, 559, 620, 498, 1020, 317, 
-    278, 210, 881, 131, 837, 880, 509, 893, 727, 644, 646, 943, 1007, 685, 150, 34, 
-    219, 342, 571, 407, 49, 512, 455, 315, 880, 552, 362, 87, 416, 475, 227, 71, 
-    740, 218, 304, 589, 779, 840, 497, 481, 512, 776, 300, 833, 719, 5, 161, 674, 
-    878, 402, 708, 1004, 940, 527, 648, 389, 92, 237, 86, 1011, 472, 784, 765, 481, 
-    458, 823, 613, 437, 319, 317, 736, 703, 566, 900, 66, 912, 640, 61, 1005, 916, 
-    310, 556, 356, 373, 525, 820, 488, 1014, 382, 867, 34, 795, 340, 266, 664, 989, 
-    598, 887, 534, 422, 552, 293, 696, 416, 137, 595, 126, 964, 330, 738, 850, 64, 
-    242, 621, 849, 704, 48, 700, 919, 59, 99, 407, 915, 686, 844, 889, 645, 586, 
-    468, 453, 87, 29, 826, 690, 285, 197, 403, 647, 231, 40, 91, 331, 621, 438, 
-    920, 537, 850, 529, 405, 211, 738, 374, 567, 654, 771, 461, 21, 201, 265, 528, 
-    254, 652, 709, 778, 267, 200, 860, 217, 737, 612, 153, 586, 411, 347, 562, 876, 
-    464, 363, 424, 329, 929, 972, 722, 94, 828, 277, 703, 935, 95, 304, 788, 531, 
-    631, 122, 573, 979, 744, 945, 54, 742, 84, 741, 47, 599, 308, 424, 981, 203, 
-    505, 91, 860, 659, 7, 981, 229, 235, 796, 1016, 559, 105, 57, 231, 316, 831, 
-    876, 147, 218, 27, 345, 692, 978, 51, 728, 237, 163, 761, 994, 379, 670, 697, 
-    129, 990, 248, 545, 851, 698, 529, 419, 148, 251, 715, 428, 155, 832, 98, 894, 
-    527, 167, 763, 440, 161, 87, 884, 795, 273, 291, 621, 48, 855, 992, 768, 946, 
-    109, 930, 839, 659, 1022, 219, 1014, 23, 404, 576, 577, 480, 454, 206, 200, 872, 
-    707, 387, 194, 261, 304, 917, 1014, 86, 355, 90, 645, 257, 436, 521, 285, 551, 
-    821, 125, 768, 491, 1022, 478, 554, 90, 993, 637, 460, 931, 928, 129, 263, 617, 
-    192, 272, 177, 520, 641, 424, 96, 358, 541, 1016, 108, 645, 618, 793, 480, 149, 
-    222, 892, 964, 109, 515, 312, 794, 745, 274, 786, 861, 412, 962, 15, 628, 162, 
-    390, 434, 697, 395, 260, 787, 186, 1022, 328, 123, 795, 985, 401, 691, 303, 234, 
-    860, 399, 637, 834, 979, 507, 864, 557, 616, 454, 698, 688, 940, 627, 238, 146, 
-    177, 771, 77, 75, 261, 157, 195, 662, 807, 8, 1007, 8, 830, 111, 942, 29, 
-    621, 738, 79, 741, 938, 714, 908, 616, 1000, 827, 990, 451, 716, 623, 402, 136, 
-    664, 571, 303, 50, 724, 130, 920, 56, 270, 79, 954, 7, 130, 1023, 330, 21, 
-    187, 229, 978, 135, 358, 942, 405, 898, 614, 536, 94, 979, 550, 830, 555, 716, 
-    1009, 92, 972, 49, 972, 197, 206, 346, 23, 373, 500, 180, 850, 25, 683, 745, 
-    58, 621, 9, 666, 452, 625, 156, 149, 999, 747, 21, 329, 378, 207, 503, 154, 
-    864, 542, 611, 321, 350, 470, 67, 301, 705, 149, 1002, 1013, 149, 432, 707, 616, 
-    927, 168, 354, 486, 357, 590, 574, 984, 495, 486, 572, 716, 921, 289, 719, 637, 
-    293, 930, 803, 958, 913, 343, 633, 476, 124, 958, 541, 934, 244, 330, 657, 399, 
-    54, 807, 683, 631, 83, 273, 615, 976, 240, 182, 408, 435, 615, 93, 975, 192, 
-    996, 369, 1000, 144, 258, 187, 421, 500, 812, 588, 487, 550, 41, 472, 734, 611, 
-    994, 678, 155, 132, 932, 941, 142, 50, 263, 963, 407, 393, 781, 163, 868, 343, 
-    648, 31, 645, 796, 450, 111, 85, 639, 321, 869, 82, 777, 710, 720, 165, 335, 
-    770, 118, 888, 565, 892, 998, 633, 281, 12, 978, 711, 155, 649, 209, 958, 232, 
-    154, 1010, 985, 881, 442, 490, 834, 430, 6, 86, 464, 985, 300, 340, 737, 147, 
-    774, 844, 689, 216, 1020, 892, 825, 509, 541, 231, 535, 231, 330, 221, 489, 510, 
-    853, 354, 44, 823, 697, 843, 135, 56, 859, 808, 1012, 29, 774, 168, 314, 372, 
-    436, 933, 781, 677, 865, 63, 6, 68, 81, 914, 306, 119, 152, 777, 416, 642, 
-    77, 725, 918, 259, 921, 165, 919, 706, 991, 418, 945, 335, 55, 648, 200, 26, 
-    594, 522, 651, 835, 810, 427, 285, 673, 534, 41, 693, 279, 373, 826, 973, 396, 
-    999, 101, 944, 3, 838, 894, 797, 927, 360, 890, 626, 1023, 284, 301, 887, 339, 
-    214, 473, 605, 10, 102, 739, 51, 333, 303, 943, 718, 102, 263, 221, 334, 360, 
-    865, 111, 142, 210, 47, 586, 869, 325, 18, 430, 703, 150, 250, 206, 271, 647, 
-    307, 390, 614, 232, 566, 331, 732, 178, 923, 61, 820, 9, 73, 362, 414, 447, 
-    191, 54, 952, 616, 973, 555, 990, 165, 0, 882, 327, 199, 1023, 215, 279, 971, 
-    15, 908, 669, 977, 391, 614, 259, 614, 208, 700, 155, 338, 792, 350, 64, 746, 
-    612, 43, 811, 816, 942, 575, 139, 344, 588, 221, 769, 699, 533, 654, 969, 26, 
-    367, 470, 264, 352, 921, 878, 593, 33, 279, 772, 797, 700, 866, 661, 769, 702, 
-    20, 242, 336, 359, 26, 397, 195, 432, 317, 650, 175, 107, 310, 323, 36, 267, 
-    341, 990, 439, 746, 196, 241, 600, 654, 438, 656, 910, 670, 389, 311, 303, 907, 
-    153, 926, 528, 345, 50, 859, 941, 963, 309, 371, 315, 405, 157, 167, 873, 788, 
-    503, 1023, 417, 752, 918, 508, 589, 754, 858, 662, 459, 299, 91, 736, 908, 657, 
-    538, 192, 261, 562, 334, 165, 933, 856, 689, 471, 54, 47, 265, 156, 661, 195, 
-    797, 230, 469, 266, 784, 854, 309, 415, 954, 206, 787, 644, 253, 397, 262, 918, 
-    407, 891, 108, 676, 496, 109, 676, 70, 735, 562, 1007, 61, 478, 44, 989, 444, 
-    108, 594, 57, 912, 281, 484, 733, 562, 207, 503, 680, 119, 225, 449, 707, 464, 
-    954, 791, 10, 948, 105, 418, 69, 744, 967, 687, 473, 158, 79, 468, 409, 915, 
-    553, 263, 511, 234, 170, 325, 617, 483, 794, 840, 287, 673, 124, 775, 22, 472, 
-    254, 739, 871, 64, 683, 692, 37, 467, 124, 460, 924, 17, 933, 316, 871, 68, 
-    250, 354, 456, 129, 535, 864, 687, 950, 457, 192, 418, 112, 140, 115, 815, 944, 
-    450, 361, 769, 492, 580, 191, 415, 380, 101, 951, 770, 92, 353, 270, 491, 505, 
-    942, 168, 859, 785, 551, 147, 615, 922, 237, 617, 709, 33, 330, 610, 569, 265, 
-    249, 339, 904, 471, 49, 641, 958, 647, 730, 36, 469, 296, 988, 428, 47, 634, 
-    474, 231, 977, 619, 845, 153, 608, 774, 126, 1011, 70, 203, 234, 324, 521, 395, 
-    975, 340, 680, 825, 79, 80, 59, 379, 643, 853, 392, 522, 281, 403, 813, 102, 
-    158, 54, 452, 1009, 100, 837, 643, 501, 474, 551, 372, 699, 956, 502, 592, 300, 
-    665, 915, 809, 11, 650, 62, 421, 956, 36, 797, 712, 0, 499, 251, 614, 652, 
-    705, 372, 661, 598, 7, 106, 864, 154, 116, 532, 426, 704, 728, 986, 416, 542, 
-    724, 909, 1021, 437, 345, 183, 386, 731, 636, 306, 700, 265, 44, 226, 628, 264, 
-    346, 473, 327, 376, 425, 985, 607, 459, 280, 774, 409, 371, 424, 554, 752, 1002, 
-    758, 1000, 145, 220, 787, 961, 850, 241, 563, 635, 984, 978, 207, 299, 587, 516, 
-    41, 226, 297, 39, 655, 363, 572, 216, 984, 578, 654, 7, 508, 326, 687, 126, 
-    13, 544, 440, 698, 1004, 345, 392, 764, 736, 1007, 446, 567, 924, 119, 78, 862, 
-    330, 477, 729, 463, 320, 22, 5, 68, 46, 513, 249, 371, 881, 946, 965, 11, 
-    951, 282, 96, 836, 652, 584, 0, 305, 900, 449, 234, 749, 168, 579, 671, 41, 
-    169, 150, 730, 882, 490, 499, 529, 363, 201, 328, 803, 62, 615, 773, 788, 243, 
-    711, 335, 949, 519, 251, 104, 795, 918, 533, 454, 715, 981, 633, 41, 798, 611, 
-    480, 242, 489, 770, 354, 926, 669, 538, 596, 608, 656, 132, 288, 871, 192, 324, 
-    794, 543, 367, 926, 65, 790, 253, 880, 344, 940, 379, 942, 378, 214, 616, 230, 
-    320, 246, 149, 384, 642, 791, 492, 53, 903, 382, 439, 211, 726, 547, 795, 147, 
-    271, 529, 401, 134, 111, 120, 969, 335, 38, 407, 1007, 252, 5, 686, 274, 579, 
-    777, 172, 966, 445, 53, 412, 883, 51, 50, 315, 452, 428, 465, 195, 42, 643, 
-    815, 573, 722, 233, 75, 407, 323, 258, 134, 564, 324, 311, 674, 418, 501, 104, 
-    97, 248, 723, 827, 744, 43, 109, 1023, 851, 878, 242, 1016, 395, 669, 881, 421, 
-    576, 524, 269, 846, 460, 397, 807, 367, 66, 247, 573, 101, 576, 136, 766, 630, 
-    760, 169, 189, 955, 273, 891, 635, 72, 863, 748, 589, 12, 821, 981, 795, 343, 
-    756, 1015, 199, 190, 461, 29, 330, 334, 585, 417, 682, 439, 967, 498, 761, 164, 
-    306, 747, 766, 986, 63, 851, 624, 383, 847, 290, 95, 601, 768, 255, 401, 580, 
-    996, 949, 815, 207, 559, 232, 699, 883, 516, 491, 107, 854, 693, 77, 214, 747, 
-    175, 306, 900, 804, 503, 74, 485, 626, 505, 846, 50, 310, 8, 847, 941, 969, 
-    322, 804, 657, 665, 138, 923, 839, 243, 149, 816, 926, 690, 356, 891, 583, 220, 
-    253, 39, 375, 673, 750, 82, 171, 879, 921, 914, 277, 627, 835, 768, 222, 492, 
-    955, 622, 363, 993, 308, 231, 478, 716, 92, 32, 531, 903, 108, 778, 866, 91, 
-    328, 171, 867, 496, 716, 518, 300, 643, 650, 786, 655, 711, 167, 986, 677, 241, 
-    218, 1003, 749, 483, 668, 228, 982, 263, 1018, 863, 598, 794, 286, 253, 77, 647, 
-    671, 288, 405, 621, 90, 381, 364, 411, 479, 143, 369, 124, 436, 170, 328, 261, 
-    264, 538, 752, 106, 763, 606, 262, 73, 632, 74, 132, 820, 495, 56, 682, 55, 
-    817, 636, 431, 146, 634, 851, 112, 768, 219, 707, 661, 204, 553, 474, 628, 194, 
-    797, 320, 77, 625, 264, 728, 961, 742, 555, 920, 759, 498, 592, 918, 45, 130, 
-    111, 486, 866, 748, 638, 1023, 886, 63, 181, 771, 6, 766, 726, 317, 995, 610, 
-    459, 825, 439, 223, 363, 609, 646, 233, 18, 687, 582, 83, 978, 841, 58, 981, 
-    707, 240, 524, 973, 993, 790, 51, 533, 590, 755, 848, 667, 406, 385, 57, 410, 
-    211, 823, 182, 390, 270, 20, 597, 237, 677, 38, 165, 544, 624, 556, 71, 99, 
-    812, 301, 199, 189, 188, 802, 535, 787, 433, 823, 959, 499, 373, 429, 398, 678, 
-    991, 768, 607, 1001, 567, 773, 276, 870, 624, 510, 449, 193, 893, 95, 779, 4, 
-    79, 131, 960, 787, 559, 817, 578, 923, 863, 853, 203, 662, 75, 917, 713, 206, 
-    645, 19, 827, 17, 866, 164, 729, 380, 583, 978, 639, 64, 210, 73, 18, 551, 
-    922, 844, 447, 98, 416, 393, 659, 576, 199, 632, 330, 894, 775, 770, 553, 552, 
-    80, 353, 710, 281, 146, 630, 560, 100, 705, 318, 936, 798, 550, 411, 824, 172, 
-    760, 292, 249, 268, 375, 920, 869, 524, 109, 611, 574, 8, 530, 271, 479, 224, 
-    918, 204, 676, 223, 675, 281, 440, 1009, 100, 788, 993, 119, 709, 643, 339, 652, 
-    644, 241, 688, 283, 950, 726, 486, 421, 783, 310, 967, 503, 695, 330, 394, 537, 
-    156, 530, 448, 764, 982, 452, 992, 512, 217, 521, 49, 761, 5, 577, 254, 450, 
-    832, 859, 993, 560, 276, 13, 512, 252, 445, 12, 623, 280, 930, 878, 438, 223, 
-    551, 701, 740, 380, 685, 199, 269, 630, 682, 555, 401, 936, 279, 86, 164, 33, 
-    780, 673, 63, 120, 808, 433, 376, 789, 819, 413, 393, 243, 338, 523, 956, 359, 
-    979, 372, 516, 239, 773, 811, 79, 951, 814, 595, 71, 662, 180, 179, 451, 211, 
-    839, 793, 472, 940, 779, 560, 217, 570, 120, 975, 780, 438, 527, 280, 3, 839, 
-    820, 739, 34, 660, 578, 4, 1015, 956, 769, 729, 526, 35, 775, 241, 495, 264, 
-    13, 668, 407, 431, 209, 812, 726, 77, 891, 427, 34, 397, 928, 532, 622, 726, 
-    400, 299, 1012, 916, 119, 913, 649, 970, 442, 442, 910, 905, 508, 321, 348, 506, 
-    152, 38, 911, 89, 191, 683, 317, 880, 744, 56, 755, 710, 926, 942, 324, 477, 
-    140, 96, 552, 140, 345, 360, 514, 690, 18, 757, 738, 252, 969, 118, 137, 153, 
-    955, 162, 120, 374, 851, 978, 854, 85, 625, 207, 602, 947, 413, 960, 757, 67, 
-    147, 887, 330, 781, 901, 517, 482, 701, 301, 670, 928, 822, 735, 710, 614, 659, 
-    387, 630, 75, 214, 320, 900, 207, 262, 851, 451, 972, 604, 557, 687, 348, 1007, 
-    416, 979, 813, 971, 511, 113, 574, 655, 669, 817, 839, 181, 583, 108, 828, 326, 
-    769, 952, 1005, 58, 863, 696, 517, 302, 306, 949, 996, 1003, 665, 158, 197, 960, 
-    256, 226, 833, 452, 781, 153, 94, 180, 214, 543, 262, 1000, 42, 804, 733, 757, 
-    426, 529, 442, 183, 572, 299, 264, 615, 707, 488, 118, 655, 482, 1023, 352, 235, 
-    72, 30, 167, 227, 383, 911, 161, 586, 630, 409, 147, 885, 748, 730, 258, 972, 
-    702, 215, 197, 667, 131, 110, 926, 271, 78, 311, 683, 645, 82, 376, 943, 835, 
-    265, 404, 694, 5, 452, 97, 534, 402, 1011, 673, 591, 781, 817, 930, 316, 170, 
-    875, 284, 200, 425, 102, 10, 43, 587, 266, 529, 624, 181, 70, 972, 695, 747, 
-    582, 506, 395, 76, 374, 782, 188, 531, 834, 489, 361, 810, 103, 860, 638, 361, 
-    89, 1014, 86, 821, 160, 982, 821, 123, 896, 888, 467, 44, 153, 1013, 503, 952, 
-    55, 316, 898, 37, 984, 522, 934, 587, 739, 925, 804, 599, 809, 766, 321, 514, 
-    759, 547, 714, 693, 784, 649, 551, 626, 819, 629, 60, 350, 541, 343, 589, 238, 
-    158, 778, 150, 463, 301, 9, 960, 97, 472, 716, 409, 910, 626, 999, 577, 181, 
-    401, 254, 138, 847, 130, 106, 230, 560, 897, 339, 379, 804, 512, 92, 345, 64, 
-    358, 721, 662, 146, 23, 193, 514, 211, 856, 689, 17, 493, 121, 171, 165, 361, 
-    460, 862, 934, 780, 23, 948, 586, 917, 905, 786, 181, 470, 637, 482, 505, 704, 
-    34, 93, 2, 842, 628, 441, 959, 26, 186, 438, 228, 705, 315, 460, 146, 831, 
-    963, 14, 454, 568, 329, 892, 149, 966, 602, 669, 169, 666, 992, 867, 544, 543, 
-    480, 771, 948, 920, 359, 873, 765, 232, 864, 233, 771, 412, 350, 151, 259, 830, 
-    279, 171, 1004, 695, 62, 486, 71, 395, 639, 920, 799, 594, 702, 1015, 155, 331, 
-    121, 96, 592, 482, 915, 159, 79, 337, 213, 216, 40, 1006, 220, 408, 63, 457, 
-    757, 148, 524, 829, 266, 180, 308, 102, 355, 554, 91, 654, 526, 10, 735, 710, 
-    590, 827, 38, 328, 424, 881, 658, 404, 388, 688, 76, 635, 616, 697, 999, 557, 
-    334, 658, 717, 393, 921, 88, 38, 265, 331, 753, 917, 760, 538, 984, 253, 578, 
-    612, 698, 615, 310, 331, 161, 611, 591, 836, 222, 176, 679, 319, 736, 141, 510, 
-    369, 163, 352, 47, 325, 240, 392, 283, 488, 967, 344, 413, 392, 346, 596, 510, 
-    547, 192, 946, 779, 904, 475, 598, 480, 756, 288, 137, 901, 243, 846, 441, 422, 
-    908, 317, 771, 845, 522, 326, 831, 889, 292, 97, 455, 740, 397, 810, 656, 27, 
-    86, 583, 948, 148, 632, 373, 836, 582, 1010, 668, 203, 87, 129, 1010, 985, 894, 
-    786, 582, 56, 820, 486, 451, 945, 264, 157, 27, 241, 824, 58, 905, 382, 204, 
-    313, 104, 220, 339, 654, 624, 323, 79, 518, 562, 757, 958, 6, 165, 938, 85, 
-    362, 282, 199, 366, 292, 91, 127, 481, 535, 351, 596, 349, 851, 882, 267, 36, 
-    376, 482, 339, 715, 307, 255, 769, 435, 751, 476, 103, 590, 462, 690, 292, 745, 
-    899, 34, 762, 708, 896, 246, 846, 818, 821, 97, 648, 905, 301, 264, 572, 850, 
-    758, 188, 871, 710, 71, 959, 566, 544, 332, 750, 309, 216, 154, 101, 185, 858, 
-    346, 769, 924, 528, 439, 234, 386, 1019, 294, 134, 523, 751, 323, 64, 887, 674, 
-    148, 665, 198, 921, 1003, 552, 268, 460, 5, 395, 565, 913, 267, 736, 54, 792, 
-    744, 400, 586, 388, 377, 744, 875, 680, 660, 599, 334, 238, 594, 788, 212, 762, 
-    480, 1009, 393, 1008, 531, 738, 264, 987, 949, 164, 75, 208, 556, 480, 291, 928, 
-    353, 553, 76, 454, 707, 67, 583, 460, 18, 785, 567, 19, 349, 632, 147, 14, 
-    594, 635, 614, 343, 835, 400, 902, 4, 837, 353, 314, 302, 255, 842, 257, 414, 
-    668, 922, 1003, 553, 41, 946, 329, 51, 245, 75, 617, 500, 905, 214, 690, 984, 
-    863, 607, 615, 504, 682, 393, 263, 529, 491, 986, 89, 210, 190, 845, 312, 570, 
-    911, 897, 420, 67, 867, 241, 57, 861, 98, 187, 65, 576, 898, 312, 667, 228, 
-    35, 659, 552, 1019, 429, 973, 1016, 203, 891, 714, 230, 614, 19, 730, 535, 748, 
-    544, 887, 313, 5, 193, 933, 916, 860, 264, 213, 356, 441, 611, 386, 988, 332, 
-    591, 153, 653, 625, 348, 26, 748, 374, 443, 126, 937, 329, 18, 947, 666, 443, 
-    764, 63, 222, 773, 232, 869, 183, 297, 1016, 409, 961, 1012, 297, 922, 853, 681, 
-    671, 251, 114, 976, 818, 265, 512, 53, 423, 284, 280, 946, 267, 768, 644, 343, 
-    185, 439, 999, 690, 760, 149, 374, 16, 249, 867, 925, 336, 90, 625, 217, 474, 
-    830, 23, 1013, 439, 471, 682, 319, 406, 810, 719, 764, 588, 635, 204, 921, 100, 
-    302, 919, 796, 180, 946, 861, 197, 475, 299, 696, 238, 698, 745, 93, 588, 227, 
-    90, 195, 1019, 3, 324, 716, 261, 321, 301, 591, 436, 541, 941, 38, 439, 113, 
-    231, 168, 473, 354, 783, 817, 651, 261, 1, 869, 690, 21, 342, 784, 528, 19, 
-    327, 469, 567, 520, 683, 575, 729, 994, 938, 392, 296, 282, 797, 397, 872, 872, 
-    238, 296, 158, 1006, 851, 614, 421, 177, 74, 992, 292, 844, 881, 546, 668, 985, 
-    367, 834, 694, 247, 10, 119, 541, 456, 241, 806, 569, 1015, 499, 402, 813, 1004, 
-    292, 458, 901, 814, 8, 38, 557, 538, 238, 383, 676, 127, 502, 90, 3, 226, 
-    657, 583, 574, 32, 641, 659, 558, 866, 817, 898, 728, 171, 934, 788, 343, 912, 
-    862, 206, 784, 549, 398, 110, 189, 47, 467, 957, 544, 26, 640, 667, 610, 518, 
-    69, 147, 899, 506, 617, 517, 332, 656, 34, 61, 915, 396, 134, 812, 828, 244, 
-    485, 130, 12, 418, 217, 806, 8, 866, 841, 721, 783, 785, 840, 618, 85, 525, 
-    543, 553, 384, 812, 355, 529, 314, 1023, 557, 515, 69, 447, 177, 45, 190, 405, 
-    159, 688, 184, 891, 786, 478, 430, 935, 311, 481, 864, 186, 388, 70, 894, 96, 
-    533, 534, 550, 511, 565, 197, 422, 211, 183, 681, 618, 35, 1007, 248, 270, 807, 
-    36, 90, 808, 64, 274, 270, 210, 331, 24, 218, 988, 116, 244, 228, 667, 965, 
-    899, 128, 71, 40, 359, 767, 977, 411, 717, 526, 522, 95, 616, 10, 915, 57, 
-    192, 240, 66, 156, 392, 184, 37, 169, 80, 837, 186, 868, 241, 259, 861, 251, 
-    213, 792, 308, 799, 916, 191, 856, 889, 751, 425, 482, 656, 773, 929, 281, 374, 
-    792, 652, 49, 299, 562, 925, 723, 1009, 402, 576, 296, 245, 732, 529, 26, 927, 
-    225, 274, 824, 65, 199, 440, 26, 656, 26, 583, 335, 1006, 705, 231, 329, 367, 
-    848, 307, 610, 529, 550, 371, 520, 528, 707, 1011, 752, 724, 640, 455, 438, 499, 
-    458, 634, 884, 679, 680, 643, 87, 506, 409, 271, 926, 820, 134, 184, 3, 969, 
-    136, 591, 619, 805, 883, 550, 614, 137, 148, 481, 743, 761, 355, 59, 426, 485, 
-    58, 643, 387, 338, 639, 339, 921, 808, 25, 867, 591, 95, 741, 467, 507, 182, 
-    838, 814, 331, 304, 774, 652, 407, 947, 1006, 692, 484, 113, 994, 475, 683, 41, 
-    649, 727, 506, 769, 363, 580, 513, 794, 671, 776, 810, 16, 745, 642, 851, 167, 
-    1006, 827, 645, 740, 248, 711, 622, 13, 999, 935, 491, 624, 308, 780, 340, 249, 
-    391, 60, 606, 277, 146, 665, 941, 946, 333, 953, 430, 603, 224, 1005, 1003, 248, 
-    779, 41, 590, 717, 542, 501, 245, 389, 220, 587, 1000, 141, 111, 613, 477, 929, 
-    705, 16, 188, 817, 912, 292, 817, 897, 193, 409, 715, 666, 137, 732, 922, 662, 
-    150, 328, 494, 807, 982, 488, 518, 595, 775, 801, 229, 161, 600, 531, 868, 571, 
-    262, 536, 260, 143, 30, 707, 586, 542, 199, 464, 214, 488, 741, 39, 643, 807, 
-    990, 13, 927, 946, 255, 989, 531, 246, 228, 464, 993, 132, 165, 8, 678, 150, 
-    205, 279, 221, 602, 145, 315, 507, 8, 556, 400, 564, 666, 72, 830, 73, 108, 
-    1005, 602, 333, 1017, 431, 268, 878, 612, 2, 877, 9, 825, 13, 559, 406, 295, 
-    532, 462, 930, 48, 363, 213, 192, 210, 117, 356, 637, 214, 451, 318, 920, 887, 
-    77, 422, 929, 93, 950, 900, 307, 5, 1020, 596, 281, 582, 547, 271, 530, 886, 
-    994, 889, 53, 238, 1006, 454, 292, 590, 924, 413, 466, 9, 1005, 920, 463, 2, 
-    595, 445, 721, 666, 127, 415, 11, 189, 784, 143, 457, 366, 322, 458, 1007, 725, 
-    1018, 136, 16, 758, 194, 363, 288, 419, 836, 213, 135, 857, 697, 250, 657, 63, 
-    730, 1021, 729, 983, 803, 255, 7, 556, 1021, 636, 271, 621, 956, 571, 352, 446, 
-    756, 240, 181, 161, 745, 692, 49, 714, 19, 830, 592, 904, 159, 557, 396, 398, 
-    221, 505, 733, 446, 931, 463, 439, 509, 484, 664, 485, 512, 632, 752, 486, 810, 
-    534, 1016, 669, 548, 793, 413, 28, 879, 893, 952, 616, 205, 267, 108, 95, 733, 
-    232, 810, 323, 848, 891, 664, 914, 625, 63, 743, 814, 266, 423, 962, 366, 65, 
-    791, 190, 933, 533, 738, 934, 948, 384, 618, 616, 306, 389, 289, 476, 297, 848, 
-    71, 391, 415, 489, 221, 838, 957, 891, 489, 998, 189, 621, 468, 200, 312, 325, 
-    619, 476, 379, 961, 934, 990, 588, 438, 5, 25, 611, 135, 959, 317, 851, 34, 
-    880, 926, 193, 527, 276, 148, 306, 878, 878, 142, 300, 890, 550, 201, 863, 329, 
-    906, 555, 484, 86, 107, 862, 908, 497, 495, 58, 62, 197, 364, 956, 592, 57, 
-    258, 775, 251, 1010, 363, 940, 982, 974, 618, 248, 188, 163, 763, 420, 228, 709, 
-    459, 659, 837, 918, 907, 331, 207, 55, 875, 840, 115, 987, 821, 80, 718, 819, 
-    320, 641, 119, 84, 214, 157, 899, 403, 697, 671, 287, 847, 894, 296, 412, 833, 
-    51, 98, 323, 925, 589, 174, 82, 560, 853, 145, 924, 401, 112, 310, 952, 103, 
-    761, 437, 297, 275, 1015, 322, 257, 455, 911, 78, 323, 941, 283, 638, 503, 518, 
-    337, 15, 630, 1006, 617, 523, 505, 215, 653, 755, 257, 670, 609, 551, 88, 1012, 
-    80, 90, 15, 977, 561, 620, 13, 562, 518, 822, 521, 776, 1002, 935, 332, 562, 
-    871, 741, 750, 964, 689, 500, 351, 889, 350, 358, 229, 69, 960, 307, 943, 226, 
-    461, 235, 487, 277, 362, 372, 672, 286, 61, 377, 268, 430, 204, 800, 136, 350, 
-    321, 899, 561, 58, 832, 674, 119, 286, 543, 749, 846, 234, 944, 376, 38, 664, 
-    837, 431, 824, 211, 318, 893, 600, 769, 773, 28, 657, 709, 237, 297, 210, 863, 
-    97, 195, 781, 220, 47, 182, 447, 718, 447, 340, 497, 11, 55, 365, 787, 629, 
-    597, 721, 522, 590, 988, 150, 794, 706, 121, 777, 341, 692, 407, 136, 631, 815, 
-    602, 578, 185, 523, 987, 560, 567, 198, 276, 951, 105, 188, 248, 762, 249, 421, 
-    271, 481, 393, 213, 79, 963, 534, 286, 426, 270, 537, 415, 566, 277, 811, 32, 
-    696, 893, 1015, 815, 666, 547, 294, 100, 604, 936, 380, 290, 228, 54, 919, 204, 
-    731, 748, 234, 704, 780, 358, 251, 228, 252, 748, 823, 795, 166, 355, 31, 35, 
-    491, 24, 897, 694, 838, 200, 467, 459, 234, 113, 598, 592, 760, 791, 540, 366, 
-    348, 923, 690, 333, 880, 720, 941, 622, 325, 520, 883, 8, 601, 869, 154, 343, 
-    212, 518, 827, 23, 988, 354, 600, 300, 130, 1, 186, 277, 126, 755, 828, 546, 
-    922, 95, 95, 611, 793, 876, 842, 301, 702, 128, 667, 279, 979, 425, 596, 718, 
-    294, 137, 882, 314, 860, 555, 163, 405, 73, 145, 640, 50, 107, 206, 568, 561, 
-    423, 391, 311, 993, 852, 785, 177, 17, 177, 447, 135, 814, 742, 90, 74, 20, 
-    472, 128, 768, 659, 828, 507, 1005, 402, 510, 378, 260, 317, 827, 333, 503, 989, 
-    7, 263, 927, 443, 541, 246, 548, 441, 681, 658, 584, 727, 179, 49, 1017, 893, 
-    767, 835, 863, 906, 700, 413, 983, 816, 697, 949, 438, 505, 463, 11, 964, 801, 
-    984, 529, 877, 658, 163, 576, 968, 1008, 418, 972, 610, 351, 996, 462, 293, 402, 
-    1007, 124, 407, 735, 736, 699, 530, 79, 585, 389, 807, 752, 44, 585, 331, 428, 
-    196, 205, 494, 245, 174, 956, 697, 776, 487, 966, 689, 487, 182, 683, 427, 133, 
-    699, 573, 918, 269, 595, 586, 68, 692, 7, 590, 781, 360, 846, 822, 107, 65, 
-    212, 269, 500, 786, 1013, 361, 391, 994, 474, 508, 167, 60, 503, 168, 809, 257, 
-    189, 314, 896, 95, 651, 163, 89, 780, 546, 725, 123, 388, 600, 636, 268, 770, 
-    999, 365, 892, 83, 900, 774, 414, 629, 691, 878, 760, 872, 501, 94, 434, 256, 
-    622, 879, 722, 666, 804, 425, 115, 821, 352, 719, 665, 0, 268, 238, 847, 524, 
-    385, 660, 168, 592, 584, 448, 273, 708, 998, 927, 689, 600, 430, 550, 385, 121, 
-    993, 774, 575, 941, 157, 349, 490, 278, 893, 438, 768, 910, 239, 822, 984, 166, 
-    664, 631, 223, 1010, 708, 649, 436, 860, 980, 979, 504, 795, 359, 913, 649, 598, 
-    751, 357, 860, 69, 146, 406, 69, 787, 412, 504, 443, 696, 153, 631, 662, 949, 
-    67, 970, 49, 174, 544, 144, 261, 912, 737, 408, 41, 998, 700, 455, 831, 932, 
-    208, 597, 980, 281, 363, 962, 571, 645, 843, 916, 408, 468, 489, 409, 864, 348, 
-    456, 518, 355, 1006, 694, 193, 251, 99, 659, 996, 691, 559, 605, 719, 118, 99, 
-    639, 907, 140, 670, 831, 563, 423, 284, 689, 621, 643, 152, 56, 129, 411, 535, 
-    203, 477, 776, 421, 853, 466, 934, 99, 941, 635, 335, 234, 494, 96, 943, 410, 
-    454, 68, 548, 567, 266, 931, 12, 742, 877, 535, 606, 507, 62, 654, 328, 1016, 
-    243, 663, 186, 321, 557, 327, 105, 779, 879, 266, 730, 468, 528, 334, 406, 529, 
-    548, 996, 1015, 823, 240, 967, 37, 434, 404, 607, 964, 563, 266, 669, 555, 779, 
-    697, 526, 438, 865, 759, 537, 129, 111, 439, 468, 860, 923, 655, 797, 199, 700, 
-    728, 775, 811, 688, 122, 729, 383, 236, 793, 453, 736, 995, 873, 312, 966, 963, 
-    470, 801, 445, 556, 674, 551, 40, 252, 656, 179, 876, 442, 974, 627, 643, 880, 
-    939, 565, 839, 467, 993, 6, 95, 915, 886, 414, 331, 238, 244, 979, 634, 58, 
-    721, 271, 139, 663, 477, 248, 970, 486, 461, 798, 499, 123, 825, 193, 450, 519, 
-    512, 640, 948, 8, 1006, 202, 363, 1009, 494, 171, 981, 1000, 311, 682, 158, 439, 
-    557, 226, 967, 475, 478, 77, 295, 848, 614, 309, 142, 380, 389, 981, 903, 207, 
-    89, 469, 125, 826, 147, 236, 723, 797, 704, 121, 682, 529, 51, 930, 913, 119, 
-    434, 620, 389, 257, 793, 990, 550, 795, 139, 318, 217, 748, 869, 510, 685, 440, 
-    230, 305, 1018, 839, 320, 958, 718, 882, 113, 236, 486, 940, 615, 260, 453, 168, 
-    603, 536, 763, 148, 816, 167, 224, 19, 772, 424, 410, 830, 35, 703, 260, 317, 
-    495, 847, 445, 323, 721, 551, 134, 779, 421, 777, 164, 679, 100, 790, 23, 294, 
-    722, 831, 738, 844, 910, 351, 484, 689, 112, 140, 859, 403, 850, 22, 997, 108, 
-    733, 979, 856, 407, 800, 482, 334, 244, 172, 143, 545, 7, 73, 872, 617, 405, 
-    744, 32, 551, 545, 76, 1008, 32, 688, 418, 364, 263, 300, 281, 253, 311, 761, 
-    229, 522, 629, 267, 932, 78, 506, 29, 546, 377, 182, 248, 582, 67, 206, 859, 
-    741, 780, 330, 736, 217, 302, 323, 198, 276, 63, 430, 868, 359, 947, 684, 578, 
-    174, 501, 967, 696, 888, 997, 442, 804, 612, 670, 62, 364, 472, 346, 40, 410, 
-    864, 467, 820, 386, 571, 412, 758, 810, 668, 1009, 1006, 458, 1003, 866, 36, 433, 
-    981, 828, 306, 231, 182, 396, 251, 509, 417, 813, 577, 651, 132, 432, 422, 240, 
-    343, 621, 512, 838, 243, 370, 472, 759, 679, 107, 101, 676, 697, 683, 473, 968, 
-    643, 24, 17, 54, 787, 603, 425, 836, 839, 455, 1004, 577, 961, 311, 866, 520, 
-    1005, 339, 428, 878, 495, 1015, 625, 316, 732, 165, 214, 166, 327, 639, 63, 209, 
-    666, 241, 171, 267, 268, 764, 127, 467, 604, 862, 887, 734, 867, 141, 137, 269, 
-    263, 137, 884, 595, 963, 509, 729, 63, 46, 952, 6, 398, 479, 291, 873, 467, 
-    206, 854, 2, 873, 480, 747, 576, 30, 893, 448, 732, 67, 964, 802, 973, 382, 
-    584, 19, 496, 203, 373, 372, 550, 785, 910, 23, 601, 16, 47, 390, 694, 530, 
-    956, 979, 835, 423, 81, 2, 555, 626, 882, 364, 867, 462, 774, 850, 497, 578, 
-    250, 946, 478, 660, 952, 356, 364, 776, 136, 570, 380, 459, 477, 184, 360, 852, 
-    13, 666, 1006, 275, 684, 102, 792, 7, 627, 282, 417, 1007, 884, 957, 309, 408, 
-    575, 123, 264, 875, 182, 968, 900, 718, 433, 637, 969, 455, 1015, 858, 499, 938, 
-    204, 498, 615, 570, 893, 760, 332, 44, 362, 778, 989, 789, 292, 371, 753, 230, 
-    928, 17, 799, 643, 487, 1, 75, 469, 606, 427, 719, 711, 632, 418, 369, 13, 
-    988, 143, 225, 321, 911, 115, 163, 53, 825, 839, 356, 1021, 284, 495, 802, 164, 
-    892, 783, 505, 614, 64, 220, 171, 49, 554, 971, 298, 489, 257, 327, 628, 754, 
-    1015, 20, 928, 751, 172, 965, 243, 958, 348, 252, 633, 947, 652, 1002, 821, 494, 
-    600, 829, 394, 674, 624, 560, 207, 543, 593, 238, 1022, 322, 207, 268, 835, 898, 
-    654, 933, 578, 585, 754, 116, 358, 498, 116, 752, 557, 132, 60, 107, 70, 368, 
-    454, 338, 152, 895, 588, 1018, 273, 235, 517, 456, 599, 858, 407, 819, 293, 144, 
-    753, 62, 716, 614, 34, 954, 998, 522, 146, 166, 117, 463, 548, 839, 863, 309, 
-    888, 518, 586, 137, 949, 7, 205, 177, 997, 629, 496, 559, 714, 131, 367, 291, 
-    907, 165, 420, 718, 400, 852, 879, 714, 321, 870, 892, 255, 962, 20, 140, 168, 
-    2, 512, 895, 292, 279, 487, 99, 698, 904, 942, 986, 884, 918, 501, 236, 383, 
-    189, 341, 535, 807, 617, 67, 693, 54, 262, 1012, 827, 255, 417, 183, 726, 886, 
-    354, 303, 226, 936, 367, 502, 230, 713, 828, 569, 264, 235, 268, 634, 91, 321, 
-    282, 484, 67, 800, 289, 957, 937, 589, 1004, 267, 386, 801, 996, 676, 93, 799, 
-    550, 759, 1010, 184, 110, 560, 210, 599, 892, 660, 546, 225, 307, 376, 848, 845, 
-    587, 9, 442, 665, 53, 731, 587, 100, 577, 157, 465, 743, 352, 304, 38, 554, 
-    223, 993, 48, 527, 3, 789, 159, 938, 382, 501, 920, 257, 608, 836, 116, 548, 
-    840, 657, 590, 694, 989, 55, 942, 305, 602, 200, 626, 651, 275, 465, 785, 832, 
-    131, 442, 975, 465, 86, 638, 841, 664, 149, 365, 489, 575, 186, 792, 583, 1018, 
-    1015, 961, 116, 435, 216, 912, 549, 106, 258, 911, 264, 869, 237, 738, 157, 74, 
-    590, 353, 957, 41, 910, 339, 1010, 257, 35, 889, 619, 491, 403, 983, 33, 386, 
-    717, 214, 546, 368, 730, 7, 654, 129, 793, 550, 607, 122, 626, 501, 387, 11, 
-    880, 912, 772, 819, 136, 281, 959, 1019, 974, 511, 645, 18, 381, 9, 559, 432, 
-    797, 787, 151, 153, 549, 574, 319, 209, 634, 475, 630, 6, 495, 352, 125, 491, 
-    447, 694, 677, 136, 230, 137, 549, 53, 261, 456, 207, 907, 586, 622, 537, 658, 
-    298, 332, 818, 800, 645, 459, 12, 125, 774, 452, 728, 981, 261, 113, 399, 255, 
-    239, 533, 390, 287, 545, 652, 206, 473, 107, 362, 684, 481, 191, 30, 536, 393, 
-    565, 965, 572, 104, 228, 780, 56, 663, 172, 528, 288, 665, 396, 420, 68, 388, 
-    540, 464, 604, 990, 96, 59, 888, 712, 866, 614, 807, 369, 919, 130, 589, 738, 
-    735, 728, 808, 503, 376, 804, 89, 429, 1023, 594, 780, 382, 564, 928, 930, 463, 
-    49, 766, 537, 232, 818, 331, 829, 1022, 892, 336, 668, 259, 951, 450, 528, 107, 
-    716, 621, 536, 668, 1013, 814, 659, 905, 220, 434, 993, 673, 612, 318, 8, 1008, 
-    223, 750, 820, 614, 152, 169, 358, 719, 4, 156, 975, 1016, 369, 336, 633, 521, 
-    581, 928, 676, 805, 277, 186, 857, 50, 134, 305, 580, 454, 948, 1023, 615, 830, 
-    834, 63, 211, 357, 215, 218, 337, 281, 750, 724, 293, 6, 314, 348, 454, 203, 
-    378, 765, 326, 1001, 982, 867, 602, 111, 198, 506, 91, 952, 888, 705, 327, 301, 
-    615, 269, 315, 296, 919, 939, 529, 506, 901, 631, 148, 113, 151, 987, 502, 645, 
-    404, 810, 705, 727, 118, 958, 330, 1000, 527, 524, 120, 657, 341, 1007, 1000, 969, 
-    26, 372, 64, 157, 953, 343, 340, 491, 714, 357, 253, 874, 903, 889, 178, 227, 
-    447, 47, 641, 94, 589, 673, 531, 71, 896, 337, 974, 931, 979, 246, 214, 514, 
-    547, 46, 42, 781, 479, 696, 610, 541, 979, 413, 826, 1021, 640, 256, 893, 57, 
-    203, 950, 462, 801, 268, 1012, 614, 430, 957, 374, 599, 183, 613, 571, 595, 357, 
-    198, 560, 817, 377, 490, 911, 848, 891, 970, 287, 49, 162, 126, 706, 16, 821, 
-    254, 931, 273, 975, 360, 812, 96, 683, 276, 825, 907, 23, 682, 735, 441, 187, 
-    782, 163, 405, 901, 917, 503, 358, 348, 799, 933, 928, 386, 771, 456, 711, 764, 
-    154, 682, 145, 689, 680, 22, 311, 126, 602, 628, 809, 728, 964, 493, 557, 480, 
-    704, 171, 297, 579, 410, 113, 869, 489, 392, 222, 589, 481, 517, 519, 331, 114, 
-    321, 67, 141, 260, 149, 905, 116, 954, 860, 473, 196, 258, 840, 430, 301, 903, 
-    889, 837, 43, 700, 854, 268, 72, 615, 34, 549, 228, 691, 19, 866, 221, 781, 
-    242, 73, 440, 605, 994, 698, 409, 55, 653, 95, 325, 621, 410, 957, 985, 496, 
-    985, 74, 198, 1, 895, 881, 20, 7, 333, 822, 544, 981, 110, 840, 705, 832, 
-    799, 450, 772, 932, 143, 842, 318, 278, 845, 241, 216, 817, 312, 385, 20, 608, 
-    537, 19, 394, 353, 119, 534, 906, 995, 749, 542, 1023, 354, 374, 11, 7, 213, 
-    780, 811, 350, 58, 200, 597, 946, 379, 253, 137, 904, 493, 348, 330, 730, 399, 
-    339, 519, 33, 800, 724, 796, 260, 314, 837, 140, 714, 962, 405, 385, 57, 131, 
-    104, 774, 886, 1020, 100, 176, 496, 959, 521, 221, 52, 665, 412, 226, 49, 477, 
-    584, 747, 993, 514, 382, 773, 437, 633, 854, 103, 517, 834, 389, 138, 744, 101, 
-    778, 720, 898, 866, 335, 103, 709, 86, 522, 447, 289, 714, 583, 515, 52, 934, 
-    284, 707, 50, 332, 21, 112, 219, 948, 703, 374, 1017, 65, 524, 824, 747, 611, 
-    115, 559, 909, 261, 405, 260, 431, 686, 945, 183, 919, 702, 738, 400, 843, 638, 
-    851, 86, 26, 10, 825, 99, 342, 420, 1015, 1005, 224, 378, 196, 183, 632, 965, 
-    163, 866, 758, 393, 266, 802, 331, 387, 974, 450, 507, 60, 316, 131, 20, 138, 
-    307, 238, 662, 387, 763, 178, 827, 17, 609, 307, 164, 18, 844, 735, 788, 1000, 
-    316, 281, 905, 423, 489, 746, 154, 427, 240, 175, 956, 589, 316, 126, 714, 982, 
-    53, 727, 888, 759, 990, 963, 176, 727, 602, 378, 516, 852, 225, 979, 655, 589, 
-    454, 614, 315, 891, 342, 319, 777, 265, 133, 591, 136, 543, 554, 272, 600, 240, 
-    287, 579, 461, 864, 37, 200, 21, 576, 55, 344, 469, 896, 706, 237, 500, 672, 
-    211, 1002, 943, 118, 961, 423, 242, 27, 624, 938, 661, 641, 225, 565, 481, 599, 
-    539, 763, 633, 588, 333, 593, 48, 153, 559, 885, 172, 446, 210, 717, 258, 86, 
-    95, 1011, 1006, 905, 779, 121, 929, 448, 846, 92, 303, 349, 264, 783, 528, 287, 
-    480, 714, 387, 698, 425, 6, 968, 850, 890, 882, 533, 670, 124, 728, 802, 500, 
-    912, 159, 776, 197, 708, 988, 72, 927, 89, 519, 362, 236, 789, 575, 297, 92, 
-    536, 351, 777, 81, 550, 700, 778, 435, 253, 196, 326, 408, 342, 261, 601, 665, 
-    485, 308, 637, 912, 895, 851, 805, 543, 10, 404, 900, 18, 114, 195, 656, 488, 
-    230, 539, 697, 762, 837, 942, 878, 537, 180, 558, 915, 562, 323, 580, 504, 231, 
-    1021, 1015, 850, 790, 826, 652, 144, 933, 276, 1015, 469, 650, 676, 55, 43, 284, 
-    76, 647, 355, 577, 3, 76, 768, 51, 527, 179, 781, 610, 917, 841, 684, 636, 
-    1012, 592, 501, 677, 828, 150, 108, 1004, 845, 740, 185, 73, 87, 809, 315, 679, 
-    814, 632, 575, 855, 466, 183, 10, 930, 675, 382, 633, 166, 143, 135, 982, 625, 
-    327, 293, 103, 721, 885, 10, 692, 175, 583, 775, 163, 511, 70, 126, 675, 496, 
-    509, 367, 152, 717, 13, 173, 170, 948, 725, 164, 328, 707, 462, 25, 347, 802, 
-    423, 761, 437, 701, 927, 795, 472, 449, 4, 878, 441, 728, 368, 800, 619, 554, 
-    631, 140, 698, 494, 752, 384, 507, 741, 1011, 852, 1020, 995, 624, 255, 981, 977, 
-    677, 418, 96, 107, 984, 949, 870, 15, 496, 576, 728, 319, 658, 432, 647, 247, 
-    781, 491, 350, 135, 647, 468, 35, 524, 2, 17, 607, 728, 238, 787, 248, 684, 
-    147, 539, 215, 519, 515, 541, 834, 796, 618, 954, 670, 91, 74, 812, 434, 241, 
-    771, 577, 676, 147, 636, 556, 956, 0, 85, 665, 469, 359, 506, 248, 312, 83, 
-    923, 581, 133, 510, 497, 437, 406, 458, 771, 458, 1, 256, 499, 639, 285, 337, 
-    115, 787, 481, 618, 564, 706, 531, 148, 385, 209, 31, 230, 251, 183, 846, 616, 
-    724, 543, 387, 504, 339, 656, 948, 655, 637, 749, 597, 908, 662, 268, 117, 943, 
-    32, 363, 576, 481, 535, 468, 744, 687, 1017, 993, 468, 78, 903, 212, 986, 947, 
-    400, 31, 669, 811, 979, 568, 670, 228, 512, 641, 355, 597, 157, 81, 601, 371, 
-    218, 71, 488, 742, 254, 192, 53, 446, 235, 450, 762, 219, 627, 340, 111, 836, 
-    73, 640, 795, 13, 256, 1000, 689, 310, 585, 259, 57, 194, 399, 944, 210, 60, 
-    376, 857, 1013, 205, 737, 1009, 996, 88, 74, 482, 686, 118, 28, 186, 859, 179, 
-    339, 407, 683, 438, 607, 199, 382, 402, 522, 839, 88, 209, 777, 897, 908, 967, 
-    821, 901, 149, 993, 434, 163, 154, 565, 192, 305, 747, 984, 646, 215, 135, 37, 
-    359, 189, 27, 679, 502, 854, 62, 346, 419, 321, 574, 465, 771, 708, 734, 494, 
-    479, 513, 389, 932, 662, 868, 658, 156, 118, 320, 343, 744, 768, 462, 757, 838, 
-    983, 643, 49, 110, 784, 319, 917, 844, 203, 900, 253, 829, 951, 174, 385, 664, 
-    486, 110, 708, 288, 674, 853, 625, 66, 581, 977, 348, 842, 78, 576, 972, 512, 
-    353, 516, 544, 950, 248, 668, 597, 249, 188, 49, 540, 673, 337, 172, 169, 46, 
-    234, 590, 415, 167, 377, 616, 985, 1015, 71, 237, 282, 829, 999, 0, 483, 486, 
-    132, 375, 496, 822, 698, 21, 136, 652, 425, 76, 886, 361, 886, 339, 712, 660, 
-    575, 949, 603, 421, 534, 899, 472, 445, 608, 76, 36, 301, 775, 786, 91, 312, 
-    209, 12, 662, 723, 798, 867, 691, 702, 834, 3, 901, 458, 840, 848, 892, 281, 
-    91, 4, 956, 749, 840, 144, 718, 714, 381, 582, 380, 634, 711, 379, 388, 357, 
-    787, 112, 683, 928, 816, 212, 577, 613, 554, 345, 152, 271, 685, 556, 323, 868, 
-    399, 223, 89, 124, 278, 850, 677, 963, 972, 443, 527, 58, 891, 329, 505, 616, 
-    610, 310, 733, 796, 1013, 496, 545, 695, 85, 110, 436, 323, 879, 532, 615, 208, 
-    779, 263, 704, 648, 551, 754, 942, 920, 717, 750, 737, 681, 331, 526, 446, 63, 
-    768, 79, 165, 832, 862, 237, 132, 87, 208, 322, 25, 787, 276, 300, 287, 568, 
-    496, 766, 980, 122, 813, 38, 1003, 519, 171, 50, 274, 54, 811, 195, 414, 100, 
-    817, 358, 929, 199, 566, 165, 217, 673, 985, 766, 1006, 625, 597, 810, 386, 805, 
-    302, 565, 940, 647, 115, 174, 174, 815, 275, 76, 854, 128, 848, 600, 510, 104, 
-    107, 496, 890, 96, 708, 133, 721, 473, 524, 902, 38, 877, 394, 135, 681, 280, 
-    427, 435, 824, 729, 129, 783, 537, 760, 358, 1020, 534, 798, 29, 248, 731, 446, 
-    502, 190, 248, 71, 942, 287, 1016, 926, 680, 623, 587, 244, 317, 449, 480, 550, 
-    897, 469, 667, 1020, 83, 420, 593, 797, 322, 332, 188, 143, 180, 243, 257, 726, 
-    548, 820, 444, 366, 216, 910, 45, 330, 150, 616, 946, 416, 993, 426, 979, 464, 
-    80, 737, 202, 754, 613, 132, 93, 688, 440, 262, 405, 316, 345, 532, 235, 1019, 
-    62, 362, 289, 445, 359, 846, 513, 352, 913, 502, 992, 729, 902, 601, 425, 648, 
-    433, 307, 785, 851, 838, 280, 826, 454, 433, 755, 994, 729, 498, 885, 216, 729, 
-    352, 158, 717, 946, 797, 921, 364, 37, 877, 348, 756, 468, 151, 795, 323, 111, 
-    1008, 328, 1009, 191, 307, 994, 914, 678, 669, 362, 712, 533, 258, 360, 184, 703, 
-    192, 890, 363, 743, 864, 883, 978, 896, 413, 235, 483, 461, 490, 181, 389, 375, 
-    436, 241, 643, 80, 892, 287, 509, 115, 679, 585, 146, 80, 516, 541, 771, 759, 
-    181, 307, 296, 803, 246, 560, 223, 680, 791, 977, 810, 360, 662, 63, 99, 703, 
-    939, 411, 184, 69, 71, 925, 436, 425, 554, 833, 504, 407, 352, 921, 277, 723, 
-    472, 623, 934, 668, 670, 975, 1018, 667, 721, 223, 195, 291, 660, 628, 892, 286, 
-    238, 267, 587, 959, 961, 159, 161, 245, 818, 520, 999, 96, 336, 1019, 506, 473, 
-    468, 1007, 347, 696, 379, 806, 53, 113, 764, 330, 500, 85, 409, 177, 331, 396, 
-    789, 447, 707, 1015, 108, 499, 830, 71, 644, 906, 854, 360, 167, 552, 774, 285, 
-    834, 765, 469, 512, 166, 991, 94, 938, 112, 784, 501, 971, 430, 211, 670, 836, 
-    860, 282, 41, 459, 995, 733, 503, 557, 295, 169, 672, 518, 977, 645, 904, 868, 
-    361, 775, 434, 912, 231, 589, 141, 102, 451, 696, 420, 332, 999, 684, 258, 684, 
-    208, 448, 865, 8, 607, 960, 293, 850, 140, 813, 165, 35, 261, 777, 938, 306, 
-    21, 702, 998, 259, 384, 776, 395, 369, 809, 777, 71, 298, 867, 24, 768, 662, 
-    642, 211, 789, 343, 1017, 185, 576, 127, 589, 704, 137, 533, 612, 148, 938, 639, 
-    766, 795, 461, 61, 336, 29, 576, 315, 456, 524, 908, 113, 721, 176, 284, 734, 
-    167, 711, 222, 556, 1021, 278, 998, 734, 780, 349, 409, 879, 105, 426, 808, 533, 
-    156, 166, 326, 351, 419, 394, 529, 955, 32, 554, 518, 402, 9, 1003, 919, 746, 
-    425, 46, 872, 822, 531, 220, 973, 141, 659, 415, 25, 560, 296, 964, 778, 25, 
-    161, 595, 600, 792, 246, 537, 567, 345, 906, 192, 604, 138, 746, 264, 612, 48, 
-    109, 195, 560, 552, 504, 152, 331, 40, 71, 35, 577, 545, 600, 252, 770, 792, 
-    558, 858, 215, 436, 123, 708, 911, 157, 454, 1014, 572, 535, 797, 907, 111, 651, 
-    341, 222, 2, 6, 529, 358, 265, 847, 279, 786, 93, 722, 876, 425, 1008, 580, 
-    404, 700, 203, 186, 831, 711, 83, 678, 523, 172, 53, 407, 74, 598, 84, 708, 
-    111, 80, 968, 496, 29, 640, 252, 393, 305, 146, 134, 68, 821, 467, 615, 341, 
-    220, 575, 896, 470, 848, 627, 723, 125, 306, 698, 770, 558, 739, 474, 44, 51, 
-    677, 884, 503, 437, 811, 400, 487, 170, 570, 51, 697, 964, 678, 118, 158, 300, 
-    949, 827, 589, 577, 566, 962, 674, 330, 37, 995, 475, 605, 737, 11, 850, 642, 
-    1020, 56, 329, 1008, 797, 738, 753, 109, 896, 888, 62, 793, 103, 789, 799, 34, 
-    413, 200, 610, 671, 512, 261, 236, 255, 436, 305, 80, 203, 180, 83, 655, 232, 
-    971, 151, 410, 419, 608, 433, 925, 9, 691, 961, 650, 587, 521, 392, 889, 629, 
-    717, 977, 233, 745, 203, 452, 347, 685, 1005, 685, 143, 471, 23, 373, 341, 949, 
-    325, 649, 747, 215, 393, 120, 132, 700, 728, 414, 6, 355, 587, 545, 233, 1003, 
-    245, 477, 648, 1018, 858, 511, 202, 40, 590, 238, 442, 81, 904, 481, 553, 118, 
-    832, 484, 641, 587, 551, 626, 162, 809, 149, 634, 331, 711, 626, 367, 159, 263, 
-    479, 237, 57, 536, 941, 466, 480, 399, 1008, 61, 805, 391, 621, 562, 548, 317, 
-    911, 197, 207, 751, 160, 797, 32, 432, 157, 519, 179, 411, 958, 298, 147, 935, 
-    946, 180, 38, 393, 779, 521, 510, 675, 160, 724, 579, 854, 812, 25, 458, 303, 
-    43, 826, 694, 483, 227, 306, 549, 260, 259, 770, 265, 12, 469, 229, 877, 658, 
-    141, 808, 583, 125, 595, 290, 951, 380, 31, 931, 170, 430, 359, 521, 29, 226, 
-    703, 702, 520, 23, 727, 99, 226, 546, 634, 443, 555, 931, 75, 182, 795, 651, 
-    145, 641, 95, 793, 810, 285, 588, 948, 349, 582, 762, 833, 927, 905, 813, 987, 
-    985, 296, 903, 143, 804, 64, 0, 313, 240, 475, 276, 65, 850, 915, 89, 792, 
-    823, 968, 173, 931, 913, 724, 462, 0, 48, 218, 487, 49, 713, 822, 480, 407, 
-    610, 624, 144, 786, 810, 38, 770, 394, 428, 374, 326, 460, 8, 405, 526, 845, 
-    254, 8, 285, 50, 73, 92, 633, 694, 312, 944, 11, 180, 820, 872, 832, 848, 
-    1005, 318, 235, 503, 722, 434, 145, 544, 939, 111, 232, 933, 27, 715, 175, 598, 
-    884, 852, 385, 636, 303, 492, 529, 163, 498, 862, 679, 404, 138, 409, 216, 324, 
-    853, 555, 163, 136, 773, 650, 715, 996, 423, 240, 164, 140, 130, 618, 988, 181, 
-    58, 715, 117, 270, 15, 86, 393, 906, 955, 190, 514, 137, 347, 597, 217, 372, 
-    828, 38, 998, 843, 308, 589, 502, 412, 2, 332, 369, 725, 964, 255, 596, 780, 
-    988, 759, 4, 282, 121, 135, 390, 738, 588, 936, 684, 446, 1011, 238, 232, 428, 
-    200, 141, 263, 293, 421, 209, 347, 515, 942, 946, 439, 419, 1019, 985, 839, 674, 
-    15, 394, 404, 87, 1020, 411, 438, 927, 991, 746, 526, 517, 873, 421, 585, 258, 
-    50, 398, 628, 885, 568, 252, 646, 514, 137, 220, 195, 572, 776, 678, 727, 558, 
-    573, 333, 989, 116, 685, 903, 755, 960, 477, 285, 489, 906, 762, 347, 64, 652, 
-    959, 789, 919, 723, 106, 335, 578, 230, 561, 177, 714, 825, 154, 706, 710, 432, 
-    306, 149, 483, 309, 645, 55, 14, 933, 315, 457, 401, 244, 933, 726, 133, 757, 
-    862, 9, 913, 689, 901, 572, 770, 201, 979, 21, 88, 576, 28, 601, 893, 921, 
-    614, 929, 756, 705, 773, 808, 831, 670, 567, 524, 541, 1, 325, 387, 903, 986, 
-    261, 927, 381, 409, 919, 960, 936, 186, 149, 879, 445, 997, 861, 403, 259, 458, 
-    416, 916, 260, 256, 716, 492, 107, 493, 874, 470, 989, 257, 988, 525, 918, 794, 
-    846, 434, 679, 830, 829, 12, 103, 883, 52, 9, 186, 73, 725, 191, 822, 524, 
-    764, 562, 8, 306, 127, 637, 618, 699, 63, 947, 658, 811, 567, 388, 869, 991, 
-    79, 685, 442, 635, 600, 147, 748, 387, 332, 18, 613, 342, 251, 878, 748, 389, 
-    473, 130, 625, 632, 547, 967, 508, 758, 762, 1022, 498, 410, 115, 55, 365, 645, 
-    556, 78, 969, 9, 651, 957, 523, 789, 561, 240, 376, 411, 788, 212, 264, 933, 
-    683, 785, 146, 531, 236, 381, 957, 612, 163, 461, 326, 357, 790, 703, 227, 998, 
-    207, 447, 473, 69, 989, 850, 273, 933, 682, 169, 803, 180, 404, 425, 219, 556, 
-    366, 68, 41, 260, 740, 865, 793, 829, 969, 246, 84, 225, 1000, 933, 646, 1016, 
-    601, 403, 341, 693, 692, 380, 464, 709, 355, 148, 372, 806, 969, 83, 921, 821, 
-    758, 290, 708, 99, 1004, 921, 865, 664, 700, 472, 851, 634, 903, 64, 673, 988, 
-    86, 166, 666, 246, 771, 289, 419, 488, 17, 708, 584, 952, 314, 32, 560, 533, 
-    805, 681, 1009, 708, 563, 644, 993, 128, 327, 371, 734, 817, 251, 260, 996, 994, 
-    117, 996, 836, 623, 288, 748, 32, 765, 964, 537, 680, 582, 890, 303, 10, 437, 
-    239, 458, 546, 604, 718, 19, 105, 656, 890, 236, 441, 1011, 181, 733, 30, 160, 
-    674, 622, 674, 460, 201, 212, 356, 721, 103, 588, 855, 59, 69, 117, 42, 292, 
-    237, 939, 383, 639, 502, 729, 975, 195, 603, 763, 327, 747, 645, 922, 425, 293, 
-    965, 335, 1021, 995, 775, 159, 831, 1001, 410, 113, 563, 652, 810, 59, 377, 905, 
-    707, 582, 961, 313, 818, 401, 967, 264, 582, 894, 697, 255, 602, 383, 1015, 729, 
-    59, 458, 767, 97, 295, 463, 897, 861, 589, 799, 637, 350, 57, 787, 387, 104, 
-    631, 253, 1005, 932, 473, 99, 828, 526, 826, 26, 671, 357, 918, 871, 149, 257, 
-    804, 465, 799, 817, 284, 884, 1023, 822, 152, 569, 296, 898, 781, 771, 972, 583, 
-    105, 610, 957, 986, 671, 873, 541, 144, 778, 716, 287, 460, 864, 360, 984, 176, 
-    398, 827, 315, 81, 857, 668, 971, 222, 610, 80, 851, 755, 369, 166, 879, 32, 
-    501, 222, 269, 55, 15, 772, 638, 546, 843, 263, 816, 714, 10, 973, 409, 40, 
-    428, 371, 684, 551, 931, 842, 164, 310, 161, 367, 60, 776, 1020, 716, 321, 349, 
-    849, 202, 280, 395, 614, 284, 2, 820, 7, 205, 546, 211, 986, 518, 54, 967, 
-    312, 500, 577, 923, 719, 624, 30, 568, 546, 806, 194, 515, 776, 55, 290, 457, 
-    709, 112, 971, 121, 401, 354, 296, 628, 780, 265, 411, 934, 57, 945, 53, 779, 
-    545, 10, 923, 66, 313, 928, 40, 702, 275, 180, 727, 399, 403, 562, 503, 591, 
-    491, 130, 835, 31, 243, 255, 918, 511, 361, 940, 504, 513, 500, 697, 234, 604, 
-    542, 562, 526, 635, 711, 900, 415, 621, 248, 517, 877, 58, 705, 253, 128, 103, 
-    584, 727, 576, 92, 247, 650, 971, 720, 414, 155, 156, 671, 36, 399, 701, 975, 
-    431, 254, 910, 219, 636, 375, 955, 797, 533, 836, 668, 939, 907, 428, 888, 111, 
-    13, 720, 98, 904, 795, 700, 431, 976, 499, 807, 490, 423, 128, 416, 632, 614, 
-    934, 824, 339, 600, 684, 76, 599, 499, 229, 934, 26, 412, 926, 154, 341, 449, 
-    24, 210, 1003, 114, 556, 572, 578, 926, 373, 948, 427, 774, 1011, 441, 611, 134, 
-    1000, 941, 13, 640, 982, 919, 798, 437, 731, 76, 612, 647, 391, 510, 408, 1, 
-    761, 379, 708, 157, 112, 52, 543, 149, 371, 868, 138, 211, 218, 252, 581, 866, 
-    569, 252, 208, 602, 550, 143, 47, 495, 698, 74, 975, 286, 714, 142, 957, 742, 
-    765, 420, 278, 286, 852, 211, 394, 962, 1008, 379, 7, 133, 631, 300, 830, 199, 
-    709, 729, 696, 661, 904, 50, 29, 19, 431, 803, 973, 456, 100, 966, 907, 472, 
-    498, 679, 933, 519, 765, 197, 754, 549, 137, 543, 624, 465, 320, 509, 574, 914, 
-    180, 387, 815, 518, 212, 807, 883, 46, 412, 108, 998, 327, 685, 528, 1011, 249, 
-    779, 677, 40, 3, 134, 431, 1005, 888, 574, 667, 431, 153, 792, 737, 224, 458, 
-    231, 991, 93, 318, 184, 597, 593, 274, 134, 688, 237, 40, 42, 982, 405, 576, 
-    1, 11, 230, 1008, 366, 96, 672, 837, 153, 913, 522, 755, 489, 475, 966, 162, 
-    729, 559, 253, 791, 470, 264, 1009, 739, 314, 730, 656, 850, 873, 745, 405, 69, 
-    169, 1011, 246, 955, 107, 976, 27, 709, 269, 210, 935, 297, 272, 518, 595, 29, 
-    63, 1019, 618, 850, 372, 775, 627, 877, 950, 528, 787, 810, 632, 709, 361, 72, 
-    649, 847, 451, 79, 90, 108, 474, 852, 235, 725, 646, 744, 224, 349, 636, 449, 
-    494, 259, 952, 788, 326, 509, 804, 154, 602, 270, 93, 534, 706, 575, 535, 314, 
-    488, 865, 917, 212, 657, 245, 638, 921, 510, 437, 959, 8, 686, 652, 304, 285, 
-    174, 621, 950, 823, 322, 263, 266, 486, 456, 844, 508, 556, 196, 658, 571, 255, 
-    227, 778, 7, 144, 38, 688, 278, 660, 175, 279, 26, 921, 74, 91, 521, 164, 
-    212, 607, 2, 702, 454, 115, 951, 588, 279, 6, 353, 832, 381, 861, 932, 605, 
-    626, 621, 930, 855, 852, 473, 137, 699, 87, 61, 707, 535, 939, 466, 805, 388, 
-    419, 945, 254, 49, 996, 899, 810, 669, 130, 452, 3, 649, 666, 174, 945, 161, 
-    598, 698, 925, 687, 572, 25, 778, 402, 459, 233, 819, 936, 729, 1015, 168, 756, 
-    179, 272, 269, 33, 394, 16, 356, 517, 545, 412, 147, 873, 886, 52, 979, 375, 
-    1023, 556, 824, 804, 682, 101, 131, 447, 801, 273, 337, 942, 493, 213, 900, 640, 
-    422, 973, 946, 982, 324, 522, 59, 635, 265, 320, 93, 145, 153, 320, 880, 665, 
-    779, 128, 784, 540, 872, 669, 438, 804, 235, 768, 442, 783, 161, 343, 740, 392, 
-    80, 47, 236, 790, 807, 664, 766, 720, 352, 829, 246, 558, 412, 541, 990, 498, 
-    107, 443, 948, 966, 77, 812, 670, 932, 902, 171, 751, 196, 536, 467, 988, 596, 
-    985, 696, 413, 128, 478, 974, 912, 283, 309, 199, 402, 989, 590, 13, 942, 260, 
-    462, 349, 401, 306, 32, 552, 937, 291, 933, 615, 134, 17, 757, 44, 234, 178, 
-    496, 741, 567, 239, 287, 89, 931, 400, 919, 759, 981, 840, 326, 133, 795, 960, 
-    6, 944, 928, 317, 493, 597, 252, 442, 623, 487, 487, 848, 378, 790, 251, 818, 
-    808, 477, 916, 398, 975, 215, 164, 711, 212, 994, 651, 231, 265, 62, 55, 9, 
-    165, 599, 88, 66, 552, 845, 363, 533, 544, 874, 831, 67, 234, 455, 146, 448, 
-    967, 306, 100, 40, 579, 992, 723, 945, 415, 91, 230, 871, 617, 50, 755, 591, 
-    400, 882, 1005, 1012, 822, 504, 293, 488, 466, 948, 21, 19, 198, 502, 62, 228, 
-    27, 474, 762, 783, 509, 927, 729, 133, 69, 385, 341, 572, 112, 981, 104, 385, 
-    5, 207, 854, 701, 736, 524, 586, 322, 430, 974, 959, 536, 760, 430, 966, 725, 
-    547, 1020, 223, 340, 603, 795, 897, 343, 763, 111, 971, 228, 259, 739, 803, 62, 
-    990, 536, 906, 500, 943, 328, 173, 901, 458, 871, 155, 60, 351, 355, 60, 249, 
-    969, 77, 587, 478, 59, 111, 80, 380, 657, 661, 720, 1020, 74, 479, 40, 671, 
-    720, 115, 597, 941, 959, 465, 1009, 861, 398, 900, 617, 45, 416, 837, 337, 476, 
-    981, 147, 8, 645, 875, 619, 233, 989, 645, 199, 696, 155, 95, 402, 69, 786, 
-    229, 932, 225, 546, 351, 509, 284, 154, 296, 70, 576, 556, 18, 882, 421, 233, 
-    448, 149, 597, 1015, 91, 607, 998, 920, 279, 661, 134, 743, 447, 552, 127, 318, 
-    531, 537, 573, 308, 494, 827, 521, 844, 89, 231, 791, 58, 699, 897, 376, 30, 
-    348, 554, 444, 767, 288, 980, 935, 972, 646, 206, 879, 741, 35, 417, 628, 456, 
-    649, 259, 151, 3, 9, 344, 424, 878, 634, 736, 746, 790, 300, 1017, 992, 938, 
-    445, 326, 635, 718, 138, 1006, 1017, 780, 361, 732, 800, 846, 550, 188, 275, 556, 
-    665, 599, 702, 827, 616, 1009, 203, 880, 426, 400, 450, 674, 518, 16, 669, 470, 
-    275, 985, 6, 160, 545, 870, 173, 86, 217, 212, 405, 543, 57, 811, 508, 375, 
-    636, 449, 717, 57, 196, 918, 573, 243, 568, 984, 245, 13, 448, 32, 559, 618, 
-    386, 865, 757, 571, 265, 146, 53, 300, 405, 585, 1008, 280, 1022, 610, 494, 996, 
-    974, 451, 340, 508, 589, 986, 990, 1006, 449, 850, 525, 595, 469, 484, 115, 399, 
-    439, 229, 381, 360, 946, 667, 62, 0, 961, 944, 60, 460, 462, 631, 200, 843, 
-    588, 619, 157, 441, 334, 722, 968, 486, 543, 188, 992, 569, 1016, 396, 13, 446, 
-    772, 172, 858, 277, 290, 91, 588, 249, 896, 959, 717, 600, 598, 560, 460, 458, 
-    743, 161, 208, 22, 906, 265, 195, 858, 137, 695, 990, 27, 554, 659, 759, 602, 
-    925, 948, 642, 929, 714, 21, 176, 455, 40, 149, 711, 608, 511, 755, 308, 352, 
-    703, 35, 455, 399, 729, 457, 393, 637, 30, 366, 458, 799, 330, 990, 390, 13, 
-    455, 629, 92, 231, 887, 405, 220, 612, 646, 920, 660, 502, 116, 133, 83, 936, 
-    710, 553, 616, 213, 919, 574, 522, 114, 957, 89, 185, 622, 92, 197, 56, 874, 
-    829, 793, 477, 709, 260, 716, 897, 649, 422, 472, 19, 60, 106, 698, 786, 199, 
-    53, 578, 603, 952, 95, 241, 931, 1010, 671, 437, 866, 382, 269, 124, 1018, 330, 
-    627, 322, 614, 537, 456, 122, 874, 431, 49, 585, 104, 159, 538, 802, 765, 925, 
-    227, 406, 144, 234, 376, 243, 592, 543, 341, 236, 450, 74, 460, 635, 188, 982, 
-    439, 910, 739, 1020, 911, 276, 308, 792, 704, 140, 296, 7, 231, 249, 975, 46, 
-    839, 823, 312, 361, 438, 845, 675, 165, 852, 894, 129, 105, 708, 57, 389, 284, 
-    480, 973, 515, 716, 806, 141, 324, 954, 745, 893, 92, 333, 201, 471, 212, 149, 
-    822, 477, 980, 928, 340, 478, 930, 206, 709, 322, 737, 383, 754, 66, 677, 462, 
-    536, 846, 1005, 505, 630, 400, 443, 330, 677, 677, 529, 463, 472, 495, 979, 1019, 
-    268, 796, 952, 206, 1017, 806, 541, 681, 128, 150, 832, 555, 884, 144, 78, 184, 
-    212, 593, 855, 41, 209, 544, 555, 1014, 1019, 270, 312, 320, 649, 255, 501, 375, 
-    40, 409, 629, 672, 211, 806, 281, 511, 145, 487, 991, 264, 471, 675, 430, 336, 
-    859, 540, 986, 996, 111, 652, 862, 832, 485, 245, 115, 217, 784, 350, 167, 462, 
-    278, 520, 925, 454, 845, 21, 47, 669, 868, 338, 812, 257, 363, 972, 494, 173, 
-    992, 832, 645, 98, 815, 789, 410, 160, 245, 383, 350, 252, 276, 231, 27, 93, 
-    88, 961, 614, 682, 785, 689, 591, 505, 279, 666, 391, 217, 12, 988, 630, 796, 
-    465, 446, 914, 683, 54, 695, 1023, 158, 665, 434, 351, 1021, 510, 807, 377, 798, 
-    193, 305, 630, 235, 511, 618, 20, 275, 716, 494, 539, 970, 639, 916, 910, 531, 
-    47, 270, 925, 361, 329, 876, 541, 78, 1021, 161, 347, 187, 980, 940, 957, 415, 
-    258, 902, 227, 455, 379, 393, 196, 265, 977, 376, 2, 1002, 118, 307, 46, 588, 
-    367, 640, 717, 908, 170, 16, 1012, 963, 372, 769, 22, 891, 753, 703, 608, 679, 
-    558, 588, 926, 44, 315, 747, 441, 760, 137, 1020, 563, 750, 519, 588, 64, 941, 
-    676, 217, 687, 808, 87, 534, 629, 752, 589, 124, 346, 556, 385, 708, 975, 1016, 
-    777, 567, 95, 970, 679, 860, 996, 177, 941, 855, 292, 519, 692, 252, 722, 131, 
-    77, 551, 694, 712, 92, 345, 835, 623, 206, 953, 164, 339, 0, 974, 504, 1001, 
-    558, 668, 290, 879, 115, 711, 421, 309, 183, 772, 418, 764, 903, 615, 521, 654, 
-    250, 94, 942, 121, 173, 868, 701, 946, 650, 556, 887, 364, 707, 680, 168, 992, 
-    495, 247, 502, 888, 832, 326, 958, 657, 525, 142, 639, 123, 864, 565, 777, 737, 
-    153, 670, 561, 45, 276, 555, 265, 473, 503, 668, 375, 446, 432, 784, 982, 723, 
-    779, 804, 120, 876, 710, 1015, 901, 895, 980, 355, 352, 905, 515, 837, 864, 620, 
-    909, 114, 881, 207, 448, 1013, 678, 193, 1003, 563, 456, 700, 527, 776, 736, 662, 
-    90, 602, 292, 296, 469, 52, 66, 999, 903, 860, 925, 382, 736, 1006, 8, 463, 
-    301, 627, 454, 902, 385, 733, 484, 279, 699, 335, 889, 751, 603, 700, 882, 51, 
-    48, 923, 73, 383, 116, 709, 947, 288, 586, 403, 465, 907, 893, 950, 364, 877, 
-    58, 75, 891, 886, 658, 661, 359, 68, 330, 983, 834, 487, 997, 227, 209, 142, 
-    607, 285, 573, 642, 534, 887, 564, 1009, 781, 743, 944, 894, 222, 685, 71, 94, 
-    957, 629, 720, 985, 830, 698, 358, 805, 557, 244, 62, 707, 946, 151, 744, 471, 
-    275, 798, 564, 694, 750, 344, 134, 86, 805, 530, 805, 937, 825, 119, 985, 17, 
-    92, 925, 657, 325, 668, 648, 175, 733, 698, 184, 99, 190, 903, 275, 954, 305, 
-    809, 233, 848, 995, 240, 977, 188, 757, 213, 681, 533, 816, 411, 983, 459, 713, 
-    56, 520, 649, 304, 508, 883, 419, 493, 818, 52, 527, 633, 641, 546, 917, 389, 
-    376, 116, 971, 944, 462, 248, 518, 900, 424, 732, 446, 662, 366, 138, 529, 394, 
-    728, 860, 525, 152, 48, 897, 643, 664, 683, 70, 450, 360, 265, 47, 900, 348, 
-    210, 84, 451, 416, 1013, 149, 860, 329, 521, 322, 8, 747, 133, 126, 949, 527, 
-    156, 909, 407, 292, 383, 314, 805, 756, 470, 821, 529, 63, 899, 267, 250, 1, 
-    713, 424, 839, 152, 65, 580, 358, 764, 927, 87, 470, 768, 137, 93, 827, 813, 
-    598, 783, 543, 704, 545, 76, 759, 740, 788, 840, 912, 56, 29, 87, 757, 841, 
-    185, 853, 39, 464, 380, 436, 96, 504, 460, 734, 433, 704, 541, 52, 477, 983, 
-    688, 869, 834, 765, 839, 702, 79, 211, 802, 368, 728, 810, 425, 4, 881, 1005, 
-    463, 845, 432, 483, 200, 286, 239, 408, 41, 189, 160, 81, 282, 80, 734, 170, 
-    599, 866, 248, 413, 725, 814, 265, 642, 614, 892, 749, 444, 872, 419, 829, 118, 
-    336, 667, 798, 689, 301, 506, 654, 458, 637, 291, 453, 395, 924, 909, 114, 26, 
-    683, 132, 411, 697, 525, 550, 776, 866, 931, 503, 888, 143, 265, 709, 1014, 36, 
-    92, 26, 704, 616, 7, 108, 911, 287, 986, 730, 789, 500, 1000, 217, 1016, 778, 
-    492, 647, 811, 665, 198, 465, 311, 30, 323, 965, 246, 586, 935, 209, 143, 705, 
-    19, 705, 902, 184, 172, 722, 454, 1019, 403, 862, 456, 41, 290, 480, 429, 210, 
-    849, 834, 412, 213, 123, 468, 976, 770, 1013, 14, 541, 486, 972, 652, 930, 372, 
-    1013, 621, 169, 109, 1016, 268, 843, 247, 835, 631, 317, 20, 646, 1003, 658, 833, 
-    674, 648, 598, 43, 576, 77, 524, 647, 1004, 139, 564, 186, 56, 794, 744, 722, 
-    257, 513, 417, 876, 744, 356, 634, 309, 657, 356, 84, 544, 661, 379, 610, 447, 
-    187, 366, 948, 145, 1014, 199, 403, 403, 61, 256, 517, 87, 840, 472, 663, 207, 
-    899, 851, 107, 171, 225, 1001, 751, 276, 400, 623, 605, 248, 300, 837, 962, 76, 
-    264, 45, 468, 309, 399, 308, 24, 101, 590, 417, 236, 387, 654, 161, 223, 302, 
-    699, 834, 303, 165, 847, 481, 781, 905, 611, 822, 852, 823, 692, 558, 491, 320, 
-    496, 444, 579, 264, 111, 986, 70, 1021, 960, 558, 873, 616, 441, 59, 318, 4, 
-    770, 976, 992, 841, 84, 366, 269, 155, 689, 43, 38, 78, 222, 703, 882, 193, 
-    983, 27, 2, 708, 424, 754, 355, 422, 621, 221, 688, 928, 995, 1019, 131, 1013, 
-    811, 614, 500, 711, 58, 685, 1016, 334, 80, 749, 295, 477, 988, 1, 535, 922, 
-    930, 44, 483, 135, 646, 909, 786, 115, 54, 299, 865, 704, 959, 300, 5, 729, 
-    305, 428, 326, 549, 520, 746, 297, 670, 566, 491, 280, 755, 842, 277, 524, 0, 
-    372, 309, 447, 458, 356, 248, 889, 828, 944, 241, 433, 947, 43, 472, 437, 999, 
-    725, 936, 620, 773, 358, 737, 188, 977, 734, 409, 773, 143, 99, 198, 466, 204, 
-    815, 580, 13, 732, 211, 121, 503, 390, 353, 589, 225, 721, 276, 981, 728, 3, 
-    369, 81, 275, 303, 313, 116, 972, 795, 697, 539, 803, 526, 209, 494, 96, 142, 
-    550, 0, 440, 58, 639, 716, 861, 405, 40, 519, 486, 630, 917, 735, 991, 540, 
-    999, 971, 344, 765, 624, 758, 544, 761, 42, 627, 102, 259, 766, 151, 292, 41, 
-    675, 522, 553, 607, 699, 333, 893, 9, 839, 608, 1007, 291, 579, 64, 319, 61, 
-    214, 647, 766, 515, 63, 850, 349, 186, 358, 139, 50, 522, 816, 249, 30, 30, 
-    14, 642, 202, 817, 319, 614, 38, 604, 1005, 47, 104, 653, 322, 200, 292, 339, 
-    737, 71, 514, 81, 465, 725, 741, 264, 558, 1002, 368, 854, 97, 1021, 758, 979, 
-    1005, 371, 288, 773, 497, 877, 291, 159, 11, 615, 697, 1015, 825, 299, 376, 326, 
-    185, 333, 204, 540, 9, 149, 588, 39, 567, 882, 708, 1007, 366, 450, 789, 438, 
-    256, 188, 481, 191, 971, 571, 479, 200, 755, 685, 539, 775, 249, 942, 303, 903, 
-    852, 522, 334, 465, 899, 328, 188, 699, 883, 548, 54, 7, 238, 215, 269, 113, 
-    245, 405, 797, 564, 482, 147, 305, 65, 807, 330, 483, 710, 184, 107, 732, 158, 
-    529, 537, 423, 128, 557, 100, 977, 919, 226, 90, 703, 660, 557, 271, 2, 594, 
-    647, 590, 577, 659, 507, 91, 539, 279, 973, 73, 196, 807, 96, 346, 645, 185, 
-    725, 487, 821, 105, 653, 64, 816, 357, 726, 181, 935, 381, 924, 269, 229, 432, 
-    610, 195, 72, 674, 789, 659, 645, 486, 797, 59, 35, 36, 130, 563, 743, 114, 
-    919, 1000, 754, 110, 681, 846, 786, 954, 978, 216, 705, 947, 183, 432, 800, 632, 
-    866, 927, 338, 596, 84, 761, 854, 898, 952, 303, 119, 255, 783, 522, 714, 283, 
-    68, 957, 159, 695, 548, 985, 398, 866, 99, 315, 272, 305, 221, 550, 654, 992, 
-    159, 954, 962, 1021, 500, 515, 904, 710, 125, 748, 839, 693, 256, 880, 314, 880, 
-    1018, 432, 994, 899, 435, 953, 58, 738, 385, 132, 297, 721, 367, 119, 123, 697, 
-    110, 692, 455, 369, 159, 475, 344, 139, 517, 58, 847, 531, 204, 660, 14, 493, 
-    353, 194, 547, 218, 24, 267, 879, 271, 726, 760, 322, 746, 455, 823, 699, 505, 
-    255, 987, 450, 420, 320, 370, 532, 111, 203, 448, 305, 571, 92, 488, 88, 474, 
-    579, 367, 645, 418, 663, 634, 923, 992, 440, 998, 531, 587, 786, 41, 55, 430, 
-    308, 176, 29, 255, 650, 98, 757, 251, 678, 321, 255, 230, 547, 502, 302, 218, 
-    403, 802, 536, 624, 448, 715, 451, 810, 215, 836, 378, 548, 186, 793, 735, 866, 
-    408, 627, 471, 304, 229, 834, 106, 97, 649, 787, 972, 917, 592, 647, 245, 472, 
-    332, 839, 356, 292, 606, 226, 829, 64, 112, 146, 682, 118, 75, 128, 497, 202, 
-    704, 935, 338, 903, 895, 99, 494, 11, 482, 494, 13, 119, 1000, 624, 73, 802, 
-    601, 327, 143, 699, 267, 731, 967, 217, 790, 539, 329, 864, 607, 114, 787, 252, 
-    455, 331, 4, 59, 59, 106, 375, 1, 763, 437, 232, 679, 754, 203, 129, 1016, 
-    177, 217, 541, 71, 323, 506, 382, 582, 390, 404, 38, 880, 86, 620, 101, 363, 
-    965, 812, 345, 6, 213, 184, 788, 95, 391, 974, 846, 540, 655, 109, 712, 296, 
-    409, 44, 239, 752, 739, 703, 347, 509, 253, 594, 225, 570, 267, 41, 82, 855, 
-    387, 497, 903, 999, 827, 537, 863, 649, 563, 509, 428, 1020, 800, 725, 313, 290, 
-    589, 140, 773, 12, 22, 354, 880, 424, 752, 227, 694, 937, 823, 628, 572, 381, 
-    770, 372, 79, 381, 752, 871, 299, 677, 982, 603, 7, 315, 424, 362, 992, 866, 
-    323, 378, 196, 610, 490, 181, 46, 397, 22, 702, 627, 512, 594, 706, 27, 221, 
-    139, 688, 428, 118, 710, 650, 797, 927, 673, 400, 389, 223, 376, 372, 390, 767, 
-    395, 151, 87, 734, 534, 771, 553, 648, 803, 128, 610, 684, 610, 471, 484, 155, 
-    446, 289, 815, 136, 256, 256, 832, 137, 898, 314, 640, 834, 401, 716, 680, 619, 
-    451, 1004, 657, 2, 83, 216, 934, 728, 357, 261, 808, 334, 749, 658, 538, 276, 
-    475, 1020, 1009, 691, 941, 993, 889, 40, 808, 998, 224, 123, 163, 378, 717, 912, 
-    879, 316, 714, 840, 626, 308, 714, 691, 255, 288, 834, 390, 371, 220, 310, 713, 
-    411, 600, 803, 1021, 217, 828, 707, 873, 1015, 658, 984, 434, 763, 1009, 161, 132, 
-    797, 738, 224, 229, 584, 31, 502, 237, 104, 933, 586, 114, 682, 233, 1023, 620, 
-    541, 928, 148, 549, 566, 322, 322, 781, 233, 418, 951, 552, 125, 554, 914, 419, 
-    371, 136, 921, 84, 804, 881, 553, 412, 510, 387, 992, 269, 528, 462, 166, 538, 
-    222, 647, 769, 155, 42, 191, 52, 176, 576, 687, 233, 990, 164, 624, 50, 388, 
-    515, 10, 11, 79, 330, 198, 346, 299, 812, 985, 377, 889, 227, 66, 662, 51, 
-    668, 655, 664, 563, 205, 810, 82, 180, 585, 271, 300, 291, 354, 213, 322, 212, 
-    390, 614, 646, 224, 197, 859, 783, 308, 92, 84, 675, 469, 805, 754, 251, 889, 
-    372, 582, 274, 286, 446, 872, 690, 83, 1017, 794, 319, 263, 955, 590, 86, 940, 
-    682, 474, 520, 822, 734, 646, 896, 652, 303, 176, 379, 396, 580, 635, 694, 402, 
-    931, 594, 595, 1014, 1006, 574, 781, 261, 504, 66, 143, 862, 879, 1011, 356, 377, 
-    319, 1022, 163, 1010, 124, 220, 672, 283, 331, 410, 580, 114, 131, 75, 182, 191, 
-    640, 29, 486, 507, 334, 427, 165, 25, 733, 531, 273, 423, 171, 250, 776, 857, 
-    489, 294, 776, 751, 67, 1013, 40, 796, 996, 425, 318, 618, 137, 186, 465, 332, 
-    488, 46, 25, 90, 753, 822, 203, 939, 919, 597, 697, 854, 772, 592, 409, 43, 
-    50, 310, 753, 312, 362, 571, 196, 602, 43, 819, 374, 251, 573, 639, 309, 483, 
-    602, 891, 174, 495, 543, 855, 931, 1, 219, 266, 660, 979, 829, 626, 338, 421, 
-    599, 362, 407, 2, 691, 946, 1016, 239, 894, 718, 92, 47, 892, 976, 985, 129, 
-    754, 998, 375, 521, 323, 130, 837, 763, 610, 589, 267, 65, 447, 565, 664, 442, 
-    426, 52, 163, 802, 151, 930, 605, 907, 54, 477, 114, 922, 975, 832, 339, 277, 
-    52, 910, 1008, 373, 661, 29, 235, 738, 946, 581, 858, 949, 257, 34, 739, 48, 
-    567, 58, 920, 535, 740, 142, 268, 260, 810, 915, 484, 613, 446, 486, 162, 301, 
-    609, 828, 954, 603, 899, 296, 444, 488, 519, 534, 1021, 890, 133, 231, 484, 125, 
-    208, 484, 769, 711, 103, 390, 446, 253, 618, 924, 536, 930, 863, 266, 960, 252, 
-    539, 82, 235, 475, 900, 993, 408, 923, 56, 318, 876, 878, 598, 244, 574, 987, 
-    610, 967, 581, 185, 691, 489, 120, 933, 807, 555, 761, 943, 681, 505, 153, 245, 
-    997, 925, 732, 191, 260, 518, 680, 677, 952, 797, 290, 43, 884, 965, 76, 290, 
-    58, 212, 486, 538, 217, 184, 755, 557, 39, 136, 81, 896, 866, 510, 885, 514, 
-    571, 514, 873, 221, 329, 684, 432, 552, 682, 523, 746, 874, 927, 3, 474, 549, 
-    239, 288, 173, 159, 432, 243, 892, 298, 125, 843, 154, 276, 444, 985, 815, 621, 
-    607, 654, 828, 939, 919, 179, 164, 34, 346, 760, 36, 356, 793, 499, 96, 104, 
-    725, 99, 693, 173, 816, 213, 666, 407, 490, 555, 675, 199, 318, 213, 47, 818, 
-    842, 760, 502, 583, 377, 855, 921, 677, 797, 2, 890, 70, 587, 606, 840, 628, 
-    550, 548, 996, 134, 583, 439, 73, 298, 940, 104, 636, 473, 989, 1014, 851, 510, 
-    869, 900, 516, 542, 168, 667, 206, 966, 1016, 928, 522, 350, 855, 85, 96, 636, 
-    141, 1008, 81, 588, 662, 496, 874, 395, 65, 191, 390, 766, 215, 455, 202, 296, 
-    896, 605, 218, 495, 724, 279, 776, 553, 125, 134, 507, 24, 228, 364, 167, 776, 
-    849, 108, 353, 8, 637, 219, 133, 885, 193, 108, 504, 747, 890, 374, 588, 256, 
-    900, 44, 612, 249, 878, 795, 392, 574, 89, 604, 389, 56, 420, 520, 113, 163, 
-    859, 805, 401, 840, 833, 747, 554, 27, 435, 803, 518, 630, 474, 624, 704, 253, 
-    545, 452, 619, 1001, 209, 722, 422, 761, 685, 183, 494, 878, 480, 427, 683, 624, 
-    1018, 377, 876, 815, 190, 367, 102, 961, 72, 372, 831, 81, 292, 728, 619, 1011, 
-    747, 734, 684, 610, 228, 186, 47, 634, 502, 622, 915, 892, 947, 411, 100, 727, 
-    955, 181, 601, 975, 652, 900, 24, 85, 757, 840, 284, 169, 106, 999, 39, 903, 
-    980, 360, 275, 980, 904, 431, 659, 66, 430, 454, 126, 405, 588, 578, 310, 245, 
-    441, 548, 597, 641, 732, 510, 283, 372, 313, 524, 204, 88, 805, 506, 572, 403, 
-    1008, 721, 278, 4, 673, 491, 910, 90, 973, 91, 578, 314, 112, 6, 88, 764, 
-    50, 190, 343, 154, 39, 310, 112, 948, 807, 92, 891, 538, 394, 506, 247, 591, 
-    871, 114, 827, 746, 160, 671, 58, 315, 362, 31, 404, 151, 164, 927, 765, 525, 
-    973, 740, 168, 189, 207, 42, 956, 96, 985, 1, 620, 987, 706, 963, 508, 618, 
-    768, 501, 29, 66, 909, 368, 380, 127, 776, 164, 354, 263, 493, 659, 540, 953, 
-    270, 628, 743, 212, 406, 842, 626, 516, 556, 504, 860, 437, 605, 968, 330, 128, 
-    628, 649, 400, 190, 179, 832, 796, 620, 317, 629, 462, 618, 647, 766, 45, 464, 
-    981, 414, 500, 428, 451, 946, 315, 571, 80, 972, 124, 385, 943, 961, 730, 498, 
-    363, 945, 610, 295, 609, 574, 512, 472, 525, 480, 576, 677, 474, 380, 173, 943, 
-    203, 281, 245, 803, 576, 977, 380, 55, 640, 476, 763, 922, 859, 340, 305, 232, 
-    18, 918, 745, 283, 705, 106, 971, 301, 308, 513, 887, 1000, 222, 1020, 692, 294, 
-    949, 31, 95, 169, 536, 570, 1015, 398, 331, 157, 158, 366, 728, 229, 140, 764, 
-    947, 1018, 587, 656, 571, 921, 20, 366, 148, 442, 655, 1, 520, 394, 457, 128, 
-    256, 510, 275, 491, 218, 650, 656, 1021, 278, 56, 281, 960, 565, 561, 773, 612, 
-    726, 225, 431, 291, 954, 792, 1000, 88, 610, 670, 613, 222, 515, 1009, 5, 490, 
-    612, 497, 934, 233, 331, 53, 578, 870, 765, 493, 483, 283, 581, 818, 525, 1019, 
-    694, 439, 569, 248, 335, 857, 789, 959, 917, 938, 876, 1002, 483, 961, 1018, 171, 
-    939, 392, 937, 35, 771, 179, 192, 145, 810, 107, 808, 221, 385, 119, 5, 940, 
-    393, 257, 487, 336, 314, 190, 497, 509, 301, 828, 742, 174, 316, 704, 361, 139, 
-    165, 718, 986, 869, 364, 618, 883, 840, 877, 490, 709, 188, 163, 1018, 67, 1016, 
-    222, 906, 345, 324, 317, 730, 679, 735, 107, 717, 82, 912, 710, 446, 672, 970, 
-    789, 904, 351, 320, 519, 524, 595, 310, 246, 733, 788, 810, 747, 49, 293, 664, 
-    565, 721, 972, 413, 895, 68, 823, 345, 794, 63, 589, 563, 818, 387, 547, 972, 
-    124, 369, 147, 602, 559, 344, 301, 583, 821, 407, 705, 930, 116, 117, 643, 125, 
-    712, 104, 503, 420, 922, 528, 688, 213, 544, 530, 566, 142, 903, 126, 169, 426, 
-    510, 861, 969, 778, 577, 579, 498, 386, 83, 609, 587, 205, 637, 341, 344, 402, 
-    642, 452, 202, 259, 809, 92, 57, 360, 89, 523, 842, 228, 612, 87, 41, 966, 
-    466, 976, 829, 479, 849, 225, 963, 303, 942, 315, 772, 354, 222, 2, 1023, 425, 
-    666, 749, 758, 281, 151, 257, 561, 973, 416, 91, 284, 343, 577, 631, 914, 177, 
-    822, 76, 36, 675, 311, 664, 451, 587, 346, 271, 916, 623, 426, 983, 294, 913, 
-    389, 945, 600, 359, 303, 348, 650, 146, 798, 287, 303, 404, 324, 239, 242, 386, 
-    77, 819, 233, 197, 266, 81, 770, 226, 636, 85, 808, 19, 146, 573, 204, 690, 
-    256, 422, 622, 235, 553, 172, 469, 268, 278, 615, 761, 383, 955, 769, 345, 802, 
-    215, 796, 774, 331, 551, 487, 499, 103, 302, 153, 520, 627, 443, 851, 244, 202, 
-    123, 867, 65, 881, 58, 1006, 511, 453, 446, 298, 330, 1010, 1019, 71, 430, 558, 
-    310, 268, 360, 781, 184, 0, 501, 286, 425, 910, 5, 873, 367, 538, 841, 967, 
-    150, 985, 844, 620, 337, 770, 883, 468, 487, 36, 880, 477, 512, 788, 880, 105, 
-    543, 1019, 725, 732, 696, 618, 450, 148, 362, 216, 211, 714, 184, 483, 854, 875, 
-    930, 775, 77, 939, 732, 692, 551, 1013, 127, 913, 25, 451, 13, 704, 666, 558, 
-    717, 234, 156, 159, 550, 80, 955, 151, 505, 888, 319, 36, 254, 389, 930, 873, 
-    740, 124, 471, 403, 617, 961, 576, 621, 697, 258, 549, 145, 638, 545, 69, 29, 
-    194, 215, 444, 516, 18, 710, 148, 1010, 982, 423, 253, 491, 963, 195, 66, 207, 
-    267, 41, 937, 353, 644, 986, 15, 423, 911, 895, 829, 472, 239, 664, 190, 218, 
-    140, 1020, 836, 670, 603, 607, 441, 540, 337, 247, 871, 935, 387, 390, 537, 222, 
-    982, 192, 618, 904, 427, 335, 290, 375, 800, 305, 934, 261, 589, 90, 529, 982, 
-    201, 876, 572, 480, 513, 872, 100, 756, 172, 181, 338, 219, 17, 684, 502, 426, 
-    366, 518, 96, 571, 594, 525, 432, 475, 169, 486, 408, 1023, 221, 331, 288, 274, 
-    683, 264, 612, 714, 440, 33, 526, 198, 642, 317, 233, 90, 68, 278, 639, 273, 
-    883, 924, 482, 611, 654, 255, 507, 666, 8, 537, 826, 303, 84, 715, 783, 68, 
-    978, 628, 492, 28, 781, 952, 164, 956, 291, 257, 253, 190, 838, 545, 684, 149, 
-    868, 430, 46, 40, 927, 173, 876, 230, 514, 821, 912, 748, 932, 231, 407, 144, 
-    477, 399, 798, 99, 207, 827, 2, 919, 583, 152, 744, 735, 71, 541, 191, 203, 
-    709, 323, 885, 587, 203, 656, 408, 15, 363, 384, 744, 43, 936, 951, 569, 438, 
-    939, 1005, 112, 719, 162, 165, 653, 224, 547, 358, 517, 497, 957, 72, 902, 568, 
-    180, 887, 697, 824, 792, 438, 45, 646, 67, 589, 166, 730, 384, 221, 963, 90, 
-    111, 895, 778, 96, 612, 724, 491, 927, 93, 306, 612, 991, 773, 712, 245, 437, 
-    599, 460, 357, 856, 854, 950, 509, 716, 240, 46, 246, 403, 279, 118, 497, 823, 
-    991, 403, 134, 789, 122, 637, 615, 238, 321, 929, 539, 827, 597, 347, 56, 143, 
-    739, 771, 682, 594, 758, 772, 274, 941, 804, 976, 831, 523, 738, 772, 649, 171, 
-    291, 403, 755, 594, 41, 44, 122, 902, 230, 913, 802, 753, 80, 424, 807, 548, 
-    920, 11, 395, 117, 743, 895, 986, 305, 19, 20, 124, 240, 45, 976, 749, 471, 
-    557, 739, 29, 13, 759, 341, 155, 242, 605, 819, 627, 399, 593, 47, 540, 4, 
-    373, 299, 856, 184, 834, 831, 730, 969, 780, 665, 594, 294, 39, 144, 469, 180, 
-    333, 186, 846, 871, 374, 120, 438, 942, 512, 136, 468, 945, 555, 868, 266, 66, 
-    620, 332, 232, 401, 676, 45, 533, 34, 43, 519, 720, 494, 752, 957, 970, 629, 
-    958, 499, 568, 303, 859, 518, 403, 674, 53, 511, 836, 876, 810, 777, 216, 854, 
-    871, 213, 685, 937, 381, 47, 475, 719, 953, 223, 248, 274, 185, 408, 97, 146, 
-    900, 355, 899, 338, 835, 943, 44, 740, 1009, 337, 427, 926, 470, 46, 284, 476, 
-    392, 315, 573, 79, 353, 1017, 361, 491, 541, 883, 521, 969, 967, 718, 203, 11, 
-    942, 508, 240, 229, 790, 429, 789, 255, 817, 476, 110, 871, 571, 902, 165, 939, 
-    682, 99, 169, 447, 553, 825, 262, 532, 233, 850, 882, 589, 984, 406, 900, 37, 
-    310, 374, 102, 146, 143, 945, 775, 855, 721, 731, 973, 654, 179, 875, 704, 292, 
-    731, 820, 263, 232, 269, 727, 862, 125, 721, 159, 725, 38, 920, 242, 559, 819, 
-    923, 891, 612, 321, 48, 419, 128, 185, 840, 3, 50, 788, 308, 635, 122, 889, 
-    922, 310, 427, 678, 127, 1004, 307, 554, 13, 865, 397, 533, 120, 843, 886, 858, 
-    632, 325, 1022, 592, 715, 1011, 572, 420, 13, 1007, 586, 321, 752, 199, 296, 333, 
-    704, 783, 649, 101, 684, 347, 813, 390, 280, 895, 1010, 987, 738, 577, 551, 535, 
-    410, 163, 880, 0, 583, 820, 40, 382, 678, 399, 591, 305, 753, 948, 1001, 26, 
-    934, 410, 658, 837, 534, 10, 1023, 822, 725, 662, 540, 364, 731, 974, 801, 891, 
-    1021, 927, 549, 957, 911, 586, 549, 540, 724, 6, 12, 759, 425, 656, 416, 1021, 
-    433, 99, 561, 360, 300, 772, 360, 101, 334, 797, 100, 334, 791, 314, 194, 948, 
-    582, 211, 205, 323, 905, 737, 538, 64, 55, 449, 565, 31, 689, 756, 964, 653, 
-    425, 258, 503, 914, 665, 983, 691, 808, 414, 358, 309, 835, 534, 205, 410, 243, 
-    407, 735, 426, 631, 205, 42, 570, 55, 441, 434, 531, 81, 848, 279, 505, 103, 
-    384, 233, 496, 496, 483, 976, 793, 156, 548, 740, 87, 123, 551, 721, 376, 98, 
-    647, 523, 184, 786, 328, 96, 923, 722, 368, 480, 200, 889, 921, 991, 808, 819, 
-    1, 527, 247, 1, 393, 84, 522, 539, 915, 442, 559, 603, 952, 147, 23, 168, 
-    929, 1008, 255, 979, 735, 954, 244, 650, 627, 600, 906, 614, 554, 889, 439, 22, 
-    430, 571, 742, 662, 294, 266, 676, 4, 146, 747, 606, 238, 441, 453, 788, 1009, 
-    738, 860, 122, 196, 759, 412, 433, 500, 877, 723, 50, 484, 863, 969, 910, 966, 
-    168, 196, 443, 417, 307, 96, 238, 746, 740, 110, 412, 997, 916, 1020, 407, 111, 
-    963, 389, 198, 466, 117, 352, 895, 210, 39, 401, 12, 340, 345, 67, 950, 605, 
-    734, 737, 59, 779, 1011, 311, 74, 595, 976, 1008, 91, 354, 500, 917, 476, 951, 
-    26, 64, 193, 134, 178, 390, 467, 747, 861, 141, 976, 696, 551, 961, 430, 649, 
-    435, 668, 180, 943, 379, 854, 885, 905, 576, 773, 30, 81, 590, 365, 323, 242, 
-    252, 154, 127, 576, 538, 767, 164, 144, 109, 958, 11, 208, 657, 433, 980, 290, 
-    908, 67, 863, 283, 585, 665, 895, 499, 190, 357, 445, 619, 591, 518, 254, 546, 
-    791, 564, 757, 970, 814, 266, 1022, 328, 827, 753, 740, 76, 683, 439, 764, 320, 
-    887, 139, 753, 588, 548, 609, 757, 692, 885, 135, 507, 946, 212, 836, 477, 231, 
-    98, 580, 494, 714, 20, 733, 588, 579, 1017, 193, 389, 651, 129, 761, 803, 11, 
-    827, 972, 474, 749, 310, 55, 901, 629, 3, 986, 660, 500, 182, 398, 625, 667, 
-    873, 491, 561, 12, 1011, 38, 198, 451, 249, 678, 532, 737, 107, 205, 969, 972, 
-    663, 39, 126, 301, 697, 659, 192, 426, 801, 114, 423, 794, 449, 397, 51, 91, 
-    89, 179, 629, 673, 143, 727, 998, 156, 95, 233, 90, 724, 994, 404, 453, 833, 
-    976, 855, 295, 843, 1017, 752, 210, 733, 175, 291, 200, 86, 253, 205, 287, 977, 
-    376, 228, 805, 413, 294, 431, 661, 174, 894, 731, 163, 89, 122, 1020, 628, 273, 
-    256, 767, 352, 738, 787, 1017, 325, 485, 211, 803, 391, 240, 452, 32, 849, 898, 
-    968, 407, 367, 899, 1023, 172, 935, 1009, 809, 839, 576, 684, 624, 852, 926, 833, 
-    892, 982, 395, 624, 212, 595, 187, 713, 745, 577, 68, 55, 483, 288, 867, 673, 
-    988, 737, 326, 998, 560, 551, 841, 438, 1018, 162, 607, 581, 291, 914, 531, 357, 
-    274, 131, 579, 999, 63, 772, 309, 57, 497, 1005, 616, 839, 429, 869, 144, 570, 
-    984, 895, 294, 373, 489, 357, 388, 314, 70, 450, 573, 825, 526, 198, 428, 486, 
-    351, 464, 79, 816, 217, 160, 372, 571, 315, 478, 534, 54, 115, 190, 626, 1009, 
-    881, 311, 191, 934, 267, 686, 284, 137, 83, 445, 327, 247, 943, 187, 514, 613, 
-    456, 272, 339, 223, 234, 386, 797, 532, 142, 647, 783, 463, 658, 884, 172, 633, 
-    585, 164, 805, 398, 875, 902, 565, 715, 1022, 293, 727, 404, 716, 745, 21, 603, 
-    450, 598, 296, 809, 87, 614, 473, 483, 901, 775, 52, 654, 808, 86, 968, 803, 
-    232, 385, 880, 771, 351, 822, 610, 104, 755, 13, 956, 234, 665, 650, 639, 174, 
-    999, 706, 281, 195, 527, 932, 834, 696, 871, 771, 676, 338, 485, 56, 254, 759, 
-    85, 572, 979, 966, 376, 164, 92, 831, 697, 465, 588, 931, 925, 126, 93, 281, 
-    531, 359, 633, 894, 11, 986, 864, 94, 907, 521, 942, 201, 736, 690, 696, 38, 
-    828, 340, 46, 80, 629, 409, 984, 1006, 338, 90, 781, 411, 2, 855, 302, 429, 
-    151, 162, 620, 579, 182, 721, 221, 249, 395, 843, 845, 414, 484, 474, 121, 749, 
-    542, 749, 272, 284, 656, 883, 494, 186, 765, 555, 453, 88, 604, 692, 787, 843, 
-    513, 323, 757, 99, 211, 948, 533, 253, 429, 412, 222, 651, 282, 714, 313, 796, 
-    838, 410, 634, 227, 259, 620, 552, 582, 228, 199, 529, 257, 615, 71, 647, 139, 
-    462, 281, 253, 872, 604, 566, 209, 863, 620, 799, 171, 105, 547, 848, 549, 764, 
-    147, 149, 951, 667, 910, 538, 415, 846, 296, 172, 476, 623, 22, 918, 111, 459, 
-    165, 865, 613, 347, 294, 517, 493, 878, 314, 1007, 545, 505, 743, 188, 907, 696, 
-    123, 679, 830, 592, 582, 265, 901, 767, 256, 156, 557, 850, 236, 93, 231, 1013, 
-    44, 999, 412, 417, 756, 252, 249, 635, 906, 244, 342, 607, 75, 735, 387, 941, 
-    642, 521, 696, 80, 66, 155, 592, 513, 165, 178, 174, 385, 311, 443, 907, 379, 
-    77, 693, 976, 500, 134, 800, 355, 383, 181, 134, 466, 928, 393, 970, 975, 1010, 
-    509, 30, 874, 2, 774, 269, 903, 467, 358, 711, 883, 678, 640, 478, 90, 702, 
-    171, 854, 551, 704, 759, 559, 587, 412, 357, 195, 801, 668, 483, 641, 3, 835, 
-    592, 983, 978, 715, 803, 530, 957, 708, 742, 201, 444, 1016, 374, 335, 901, 868, 
-    617, 468, 206, 951, 17, 188, 1013, 812, 214, 866, 956, 110, 155, 556, 872, 476, 
-    516, 1020, 193, 281, 385, 45, 120, 503, 313, 225, 33, 16, 335, 508, 801, 340, 
-    819, 897, 324, 713, 945, 910, 613, 119, 141, 357, 74, 506, 67, 742, 760, 433, 
-    457, 611, 298, 679, 112, 110, 247, 378, 106, 180, 257, 912, 755, 492, 615, 15, 
-    222, 381, 716, 560, 968, 974, 691, 532, 175, 31, 36, 906, 237, 49, 156, 367, 
-    754, 845, 678, 727, 289, 556, 732, 945, 617, 428, 56, 977, 376, 121, 683, 202, 
-    264, 361, 390, 499, 740, 885, 527, 957, 723, 490, 372, 648, 645, 918, 737, 342, 
-    864, 526, 806, 417, 883, 702, 504, 750, 91, 141, 709, 736, 886, 331, 511, 681, 
-    89, 789, 828, 492, 366, 961, 213, 99, 576, 171, 756, 977, 229, 293, 250, 494, 
-    207, 334, 154, 472, 671, 78, 358, 217, 897, 567, 905, 364, 1009, 841, 881, 173, 
-    314, 760, 865, 1011, 160, 892, 789, 719, 507, 230, 723, 120, 278, 471, 101, 331, 
-    491, 262, 189, 649, 1011, 851, 615, 208, 273, 566, 39, 993, 214, 480, 726, 410, 
-    263, 272, 322, 990, 598, 179, 48, 331, 343, 475, 566, 884, 233, 552, 536, 185, 
-    190, 1017, 888, 659, 575, 104, 637, 245, 557, 898, 857, 471, 158, 429, 695, 352, 
-    163, 446, 200, 880, 284, 710, 345, 669, 453, 751, 521, 727, 478, 458, 556, 98, 
-    15, 607, 773, 172, 212, 917, 559, 826, 478, 47, 566, 644, 602, 300, 244, 478, 
-    412, 942, 30, 758, 673, 708, 45, 243, 901, 248, 848, 406, 387, 167, 516, 148, 
-    358, 3, 261, 473, 650, 441, 936, 750, 942, 639, 101, 763, 94, 445, 1005, 914, 
-    518, 641, 504, 338, 2, 859, 483, 973, 600, 267, 69, 82, 679, 796, 202, 435, 
-    668, 972, 732, 359, 430, 182, 322, 151, 179, 350, 744, 319, 544, 278, 534, 994, 
-    62, 255, 221, 285, 845, 343, 226, 170, 319, 365, 331, 284, 302, 391, 883, 721, 
-    762, 244, 129, 311, 854, 481, 208, 574, 772, 735, 746, 770, 459, 227, 950, 1016, 
-    789, 670, 756, 482, 538, 359, 953, 476, 563, 6, 312, 561, 271, 636, 1013, 908, 
-    895, 772, 709, 695, 532, 437, 733, 347, 103, 1023, 723, 531, 89, 932, 478, 561, 
-    35, 125, 462, 181, 396, 212, 359, 885, 706, 729, 31, 599, 567, 983, 940, 776, 
-    244, 722, 170, 371, 90, 219, 246, 250, 628, 98, 89, 204, 767, 752, 469, 870, 
-    191, 971, 20, 131, 670, 891, 974, 979, 561, 117, 817, 791, 792, 719, 793, 3, 
-    831, 51, 963, 158, 744, 158, 64, 394, 468, 102, 282, 736, 370, 394, 94, 984, 
-    650, 817, 672, 875, 909, 308, 734, 331, 291, 247, 853, 543, 432, 423, 845, 738, 
-    612, 322, 165, 85, 162, 797, 32, 880, 160, 364, 3, 890, 4, 817, 281, 39, 
-    235, 654, 231, 113, 87, 580, 882, 129, 746, 193, 174, 169, 819, 473, 888, 309, 
-    272, 229, 962, 872, 583, 36, 530, 1004, 690, 870, 170, 387, 81, 957, 1000, 754, 
-    561, 790, 735, 310, 281, 180, 687, 165, 294, 452, 607, 102, 757, 132, 798, 850, 
-    998, 280, 1017, 997, 751, 688, 766, 661, 977, 156, 161, 917, 230, 879, 894, 36, 
-    380, 38, 241, 443, 1011, 181, 778, 547, 618, 163, 775, 910, 866, 309, 335, 158, 
-    90, 113, 851, 673, 739, 655, 473, 203, 98, 332, 262, 210, 443, 802, 378, 193, 
-    733, 852, 1007, 830, 563, 8, 115, 41, 70, 171, 681, 859, 728, 615, 971, 769, 
-    295, 505, 319, 138, 977, 778, 64, 455, 812, 933, 872, 152, 742, 212, 999, 916, 
-    35, 803, 645, 571, 913, 547, 702, 976, 749, 345, 317, 210, 591, 827, 644, 437, 
-    367, 938, 157, 332, 206, 864, 476, 982, 13, 132, 935, 197, 448, 335, 775, 197, 
-    735, 223, 645, 564, 110, 663, 952, 523, 470, 169, 704, 392, 584, 227, 543, 188, 
-    352, 1006, 420, 699, 124, 517, 772, 280, 191, 966, 837, 345, 895, 755, 144, 222, 
-    275, 1012, 961, 531, 899, 221, 944, 922, 124, 669, 513, 924, 817, 159, 75, 152, 
-    714, 765, 389, 557, 317, 404, 970, 630, 837, 572, 291, 830, 157, 896, 279, 1003, 
-    646, 209, 546, 812, 663, 770, 49, 236, 39, 105, 397, 26, 293, 919, 614, 57, 
-    715, 141, 654, 715, 815, 662, 969, 899, 756, 409, 387, 327, 211, 773, 975, 431, 
-    899, 127, 758, 287, 381, 1008, 741, 1009, 628, 235, 237, 368, 90, 173, 792, 465, 
-    446, 17, 407, 712, 803, 703, 917, 415, 498, 935, 585, 735, 658, 605, 760, 799, 
-    221, 984, 229, 589, 564, 667, 753, 366, 478, 1011, 436, 723, 235, 81, 22, 1019, 
-    467, 669, 801, 497, 856, 351, 504, 239, 339, 374, 540, 974, 185, 162, 542, 977, 
-    233, 830, 462, 730, 516, 675, 930, 481, 794, 195, 307, 276, 488, 1013, 62, 106, 
-    326, 776, 668, 417, 131, 884, 94, 742, 79, 281, 992, 875, 939, 1012, 667, 288, 
-    461, 76, 562, 212, 541, 877, 473, 194, 92, 422, 229, 933, 56, 515, 765, 381, 
-    582, 320, 299, 69, 354, 1010, 140, 652, 502, 593, 621, 292, 201, 446, 436, 751, 
-    533, 191, 457, 285, 942, 986, 820, 847, 240, 592, 532, 842, 718, 597, 489, 382, 
-    897, 191, 447, 434, 849, 672, 368, 414, 341, 458, 575, 581, 937, 694, 249, 985, 
-    599, 918, 234, 439, 950, 631, 880, 366, 566, 562, 766, 621, 516, 111, 515, 616, 
-    872, 5, 806, 711, 796, 272, 471, 850, 451, 63, 782, 961, 14, 51, 83, 419, 
-    444, 175, 580, 976, 364, 508, 987, 1003, 225, 899, 229, 486, 888, 927, 672, 903, 
-    735, 245, 1001, 271, 67, 375, 334, 327, 259, 54, 29, 242, 747, 746, 836, 685, 
-    958, 603, 840, 656, 913, 779, 807, 397, 740, 338, 759, 187, 263, 126, 417, 614, 
-    881, 66, 760, 563, 482, 493, 214, 682, 626, 1004, 81, 627, 790, 287, 11, 121, 
-    56, 766, 955, 39, 139, 185, 883, 374, 569, 849, 609, 54, 775, 750, 630, 39, 
-    383, 386, 601, 226, 648, 222, 71, 682, 921, 1019, 686, 955, 565, 707, 495, 176, 
-    384, 801, 242, 791, 78, 273, 128, 392, 840, 267, 89, 38, 393, 720, 870, 831, 
-    29, 653, 958, 524, 174, 649, 708, 1000, 816, 423, 784, 379, 986, 551, 361, 778, 
-    1005, 390, 1002, 83, 410, 179, 494, 82, 26, 575, 428, 239, 65, 13, 799, 683, 
-    285, 417, 334, 920, 418, 662, 721, 96, 358, 722, 470, 621, 215, 548, 411, 321, 
-    382, 46, 120, 15, 369, 714, 743, 264, 854, 513, 480, 177, 155, 479, 306, 588, 
-    984, 959, 751, 823, 200, 511, 796, 767, 58, 726, 45, 198, 512, 116, 539, 270, 
-    623, 488, 710, 435, 204, 908, 746, 740, 640, 84, 424, 118, 147, 133, 908, 190, 
-    294, 477, 833, 332, 800, 553, 876, 955, 354, 554, 882, 93, 70, 1017, 653, 798, 
-    350, 508, 405, 851, 395, 947, 401, 615, 318, 269, 908, 532, 616, 622, 878, 518, 
-    744, 932, 920, 927, 725, 1000, 699, 533, 788, 799, 350, 126, 577, 225, 352, 12, 
-    36, 206, 803, 659, 95, 217, 541, 617, 15, 321, 286, 817, 626, 508, 421, 552, 
-    117, 529, 145, 407, 323, 294, 344, 984, 563, 902, 369, 439, 770, 417, 550, 185, 
-    344, 428, 588, 155, 299, 931, 786, 66, 1017, 646, 1009, 967, 141, 737, 998, 103, 
-    416, 225, 626, 45, 76, 943, 669, 631, 679, 975, 266, 351, 672, 72, 340, 453, 
-    457, 716, 204, 838, 612, 577, 432, 307, 130, 577, 767, 458, 919, 314, 616, 180, 
-    48, 21, 283, 379, 914, 171, 692, 805, 162, 700, 353, 664, 727, 498, 589, 174, 
-    359, 447, 609, 979, 741, 765, 679, 8, 557, 153, 504, 25, 153, 942, 467, 492, 
-    125, 250, 959, 793, 508, 354, 841, 171, 205, 471, 985, 977, 890, 308, 850, 268, 
-    504, 54, 398, 908, 627, 746, 698, 581, 842, 446, 918, 321, 738, 234, 171, 167, 
-    550, 761, 178, 752, 666, 834, 965, 111, 754, 627, 325, 807, 75, 329, 26, 482, 
-    690, 221, 894, 370, 681, 648, 138, 216, 136, 824, 74, 38, 815, 6, 55, 724, 
-    471, 716, 110, 889, 835, 681, 629, 1022, 27, 800, 687, 924, 736, 75, 429, 930, 
-    151, 93, 520, 451, 852, 36, 85, 1011, 37, 232, 940, 818, 101, 307, 751, 948, 
-    1008, 202, 659, 101, 204, 344, 768, 184, 663, 186, 635, 773, 251, 90, 854, 549, 
-    80, 486, 795, 56, 565, 430, 154, 1018, 881, 861, 867, 819, 477, 505, 176, 135, 
-    868, 491, 943, 128, 657, 158, 1015, 254, 872, 803, 919, 862, 197, 964, 208, 504, 
-    101, 92, 200, 568, 809, 533, 353, 273, 557, 101, 590, 162, 188, 159, 1, 153, 
-    904, 543, 844, 34, 862, 322, 771, 362, 10, 955, 992, 657, 409, 830, 213, 802, 
-    122, 280, 590, 480, 948, 548, 311, 560, 1, 649, 702, 438, 315, 493, 930, 105, 
-    522, 107, 926, 936, 134, 232, 760, 207, 598, 122, 365, 147, 181, 72, 296, 645, 
-    825, 236, 961, 174, 195, 454, 375, 637, 72, 579, 14, 234, 436, 811, 367, 215, 
-    616, 444, 773, 517, 857, 27, 798, 338, 493, 730, 826, 939, 6, 781, 596, 334, 
-    322, 694, 153, 350, 996, 367, 892, 608, 652, 317, 142, 646, 818, 487, 415, 211, 
-    228, 249, 774, 893, 187, 908, 329, 113, 282, 303, 737, 105, 337, 881, 535, 379, 
-    257, 616, 674, 30, 146, 1023, 131, 510, 599, 123, 24, 972, 646, 667, 715, 341, 
-    764, 664, 962, 17, 413, 956, 943, 757, 195, 996, 732, 317, 807, 319, 808, 914, 
-    1, 118, 218, 348, 61, 807, 83, 177, 779, 187, 146, 776, 183, 960, 213, 291, 
-    1002, 486, 275, 41, 772, 251, 926, 471, 739, 60, 12, 409, 1019, 957, 741, 963, 
-    284, 404, 244, 794, 69, 507, 89, 636, 324, 94, 941, 141, 1021, 865, 703, 954, 
-    585, 295, 621, 472, 242, 850, 286, 895, 108, 155, 738, 59, 19, 329, 697, 847, 
-    196, 940, 525, 664, 317, 551, 962, 762, 115, 800, 887, 506, 864, 202, 421, 560, 
-    495, 876, 576, 871, 449, 356, 409, 329, 204, 440, 904, 613, 810, 47, 897, 208, 
-    22, 898, 792, 867, 964, 541, 81, 24, 130, 638, 56, 240, 564, 506, 670, 1010, 
-    33, 59, 990, 339, 545, 925, 845, 305, 633, 921, 906, 80, 643, 948, 727, 464, 
-    843, 150, 287, 748, 419, 416, 934, 773, 498, 243, 382, 899, 872, 97, 228, 762, 
-    448, 886, 96, 809, 702, 693, 332, 433, 8, 8, 607, 43, 99, 133, 659, 780, 
-    891, 528, 998, 665, 367, 912, 736, 552, 67, 997, 6, 1017, 399, 855, 824, 884, 
-    876, 944, 871, 905, 13, 224, 204, 980, 393, 940, 767, 395, 979, 529, 141, 406, 
-    892, 315, 718, 618, 688, 367, 484, 570, 361, 519, 969, 244, 715, 601, 535, 290, 
-    696, 655, 300, 696, 908, 932, 919, 19, 749, 830, 225, 155, 979, 820, 221, 767, 
-    84, 85, 376, 967, 177, 837, 266, 6, 671, 106, 644, 839, 700, 309, 724, 676, 
-    941, 921, 330, 340, 778, 919, 692, 311, 35, 171, 991, 441, 809, 454, 735, 164, 
-    649, 70, 517, 861, 1, 641, 65, 952, 853, 841, 783, 714, 818, 920, 532, 238, 
-    4, 389, 563, 450, 620, 95, 446, 993, 245, 677, 162, 322, 65, 254, 447, 717, 
-    930, 67, 365, 275, 921, 128, 760, 992, 63, 638, 584, 52, 862, 753, 825, 575, 
-    925, 569, 651, 469, 217, 1021, 264, 230, 955, 336, 899, 334, 461, 514, 553, 523, 
-    67, 614, 630, 393, 557, 423, 8, 651, 752, 810, 473, 278, 234, 905, 667, 26, 
-    392, 901, 394, 876, 867, 428, 502, 944, 929, 429, 698, 169, 0, 602, 818, 864, 
-    103, 471, 717, 417, 188, 697, 487, 893, 294, 615, 431, 801, 566, 18, 339, 770, 
-    694, 464, 51, 818, 816, 756, 799, 83, 843, 557, 373, 645, 372, 82, 51, 672, 
-    958, 950, 415, 800, 542, 979, 746, 943, 801, 583, 129, 548, 513, 200, 222, 633, 
-    780, 115, 708, 61, 742, 257, 32, 632, 531, 12, 868, 381, 272, 814, 503, 791, 
-    484, 49, 556, 67, 366, 177, 138, 482, 683, 242, 198, 705, 597, 795, 394, 4, 
-    110, 94, 779, 812, 497, 351, 759, 117, 373, 855, 988, 423, 545, 32, 5, 725, 
-    179, 675, 755, 232, 325, 295, 418, 91, 368, 842, 146, 146, 811, 837, 879, 683, 
-    840, 794, 252, 491, 553, 336, 356, 622, 934, 149, 650, 897, 552, 774, 491, 563, 
-    333, 50, 794, 733, 808, 866, 994, 269, 18, 99, 392, 19, 767, 394, 512, 925, 
-    458, 328, 72, 944, 803, 216, 721, 218, 712, 14, 851, 836, 855, 772, 818, 400, 
-    905, 874, 597, 313, 577, 728, 410, 191, 558, 946, 576, 988, 238, 328, 40, 75, 
-    156, 665, 338, 71, 961, 318, 900, 325, 805, 68, 404, 777, 382, 443, 165, 996, 
-    410, 261, 861, 1017, 428, 482, 911, 848, 567, 752, 820, 332, 911, 904, 518, 203, 
-    623, 401, 807, 485, 466, 66, 319, 19, 428, 670, 210, 166, 712, 1005, 663, 654, 
-    859, 774, 343, 809, 401, 946, 870, 411, 416, 149, 54, 538, 89, 855, 155, 370, 
-    276, 332, 606, 346, 205, 510, 342, 880, 633, 996, 383, 834, 134, 158, 775, 628, 
-    806, 827, 187, 174, 248, 444, 899, 774, 394, 738, 349, 121, 296, 308, 845, 510, 
-    550, 528, 184, 690, 559, 169, 62, 144, 990, 565, 613, 512, 339, 995, 689, 113, 
-    732, 917, 1009, 852, 784, 154, 54, 549, 775, 119, 357, 758, 580, 223, 589, 373, 
-    898, 127, 81, 972, 610, 421, 1017, 867, 676, 849, 284, 124, 321, 367, 182, 967, 
-    468, 981, 925, 947, 680, 894, 732, 409, 144, 518, 360, 588, 748, 464, 1003, 794, 
-    209, 324, 214, 884, 804, 223, 298, 898, 362, 957, 826, 878, 540, 326, 857, 8, 
-    777, 364, 605, 500, 99, 49, 492, 972, 811, 616, 884, 1015, 128, 335, 795, 594, 
-    570, 774, 303, 297, 901, 971, 526, 152, 13, 140, 368, 134, 927, 999, 211, 82, 
-    996, 206, 359, 621, 561, 137, 641, 93, 654, 510, 392, 551, 303, 149, 670, 18, 
-    633, 137, 998, 102, 872, 675, 144, 872, 764, 322, 122, 315, 401, 174, 773, 141, 
-    979, 616, 925, 64, 63, 382, 387, 678, 609, 598, 383, 555, 473, 865, 329, 560, 
-    970, 953, 662, 53, 139, 1007, 350, 397, 706, 488, 540, 55, 788, 197, 595, 239, 
-    526, 81, 918, 652, 815, 113, 107, 435, 687, 479, 689, 354, 808, 237, 340, 140, 
-    738, 781, 530, 660, 936, 720, 269, 95, 583, 572, 623, 166, 1018, 356, 451, 702, 
-    692, 287, 151, 39, 891, 361, 946, 567, 764, 527, 143, 114, 899, 777, 267, 255, 
-    881, 8, 303, 587, 972, 582, 553, 472, 299, 556, 133, 995, 78, 943, 691, 385, 
-    301, 1003, 449, 159, 957, 147, 936, 956, 892, 308, 1014, 299, 266, 522, 385, 888, 
-    73, 766, 49, 243, 987, 936, 639, 1004, 992, 94, 27, 49, 689, 846, 332, 478, 
-    99, 158, 733, 578, 772, 905, 564, 963, 469, 896, 354, 250, 84, 782, 363, 257, 
-    846, 313, 284, 776, 960, 732, 166, 667, 350, 300, 694, 435, 902, 459, 760, 10, 
-    939, 30, 798, 179, 705, 189, 244, 186, 548, 357, 172, 623, 564, 245, 861, 181, 
-    424, 311, 645, 514, 626, 985, 400, 130, 839, 369, 257, 813, 325, 182, 243, 953, 
-    652, 455, 767, 277, 505, 672, 852, 832, 491, 753, 673, 856, 585, 59, 812, 223, 
-    960, 37, 906, 207, 1018, 366, 1023, 164, 698, 750, 600, 225, 289, 476, 655, 330, 
-    30, 452, 708, 327, 112, 488, 205, 701, 978, 867, 72, 586, 285, 505, 399, 940, 
-    680, 431, 968, 831, 852, 16, 524, 36, 471, 390, 642, 471, 235, 300, 903, 221, 
-    536, 925, 876, 965, 159, 400, 1022, 186, 437, 266, 333, 106, 89, 171, 52, 900, 
-    336, 672, 563, 932, 429, 444, 769, 448, 707, 266, 81, 293, 981, 874, 26, 459, 
-    124, 233, 829, 364, 892, 185, 601, 66, 702, 797, 1016, 343, 234, 777, 887, 764, 
-    514, 591, 299, 526, 44, 402, 884, 835, 667, 250, 1019, 506, 654, 857, 237, 859, 
-    132, 696, 995, 393, 11, 618, 672, 2, 602, 166, 116, 121, 801, 813, 54, 43, 
-    184, 489, 495, 809, 388, 358, 734, 174, 179, 270, 1010, 91, 878, 396, 274, 805, 
-    212, 1012, 450, 214, 939, 111, 501, 55, 366, 231, 803, 398, 174, 748, 36, 530, 
-    379, 769, 278, 105, 384, 720, 607, 925, 89, 472, 383, 510, 976, 515, 715, 837, 
-    312, 708, 527, 492, 711, 508, 660, 859, 666, 478, 266, 809, 142, 781, 784, 86, 
-    204, 313, 553, 931, 374, 848, 273, 984, 916, 939, 761, 844, 468, 663, 360, 38, 
-    454, 488, 839, 464, 240, 485, 879, 648, 917, 757, 382, 660, 72, 833, 62, 834, 
-    981, 599, 203, 566, 345, 157, 181, 950, 780, 774, 507, 161, 646, 790, 731, 945, 
-    651, 477, 159, 443, 822, 903, 930, 906, 685, 729, 765, 260, 503, 976, 400, 307, 
-    811, 194, 183, 205, 617, 157, 864, 585, 763, 635, 841, 619, 731, 983, 756, 397, 
-    89, 700, 176, 604, 338, 441, 521, 423, 305, 249, 286, 839, 943, 792, 971, 166, 
-    946, 427, 336, 584, 21, 449, 375, 933, 280, 382, 933, 73, 107, 680, 675, 846, 
-    157, 732, 115, 892, 574, 675, 446, 530, 685, 372, 718, 227, 937, 771, 23, 387, 
-    761, 531, 565, 285, 655, 701, 630, 446, 838, 592, 367, 181, 863, 999, 705, 529, 
-    996, 96, 224, 88, 79, 576, 94, 354, 554, 342, 635, 460, 735, 610, 669, 977, 
-    352, 968, 767, 937, 225, 648, 888, 959, 415, 57, 816, 944, 553, 859, 299, 984, 
-    321, 156, 196, 130, 922, 174, 376, 766, 311, 472, 56, 166, 684, 344, 863, 739, 
-    993, 569, 417, 395, 202, 450, 295, 792, 403, 1018, 496, 483, 225, 576, 490, 696, 
-    515, 645, 1003, 797, 75, 731, 23, 238, 738, 891, 247, 135, 826, 693, 784, 315, 
-    541, 587, 817, 877, 724, 62, 289, 346, 216, 781, 744, 451, 125, 716, 997, 330, 
-    811, 89, 666, 931, 74, 415, 865, 483, 948, 707, 201, 554, 198, 271, 985, 260, 
-    62, 335, 732, 50, 552, 600, 115, 970, 721, 456, 672, 396, 169, 566, 904, 394, 
-    781, 237, 873, 487, 660, 251, 723, 634, 962, 174, 682, 574, 596, 83, 271, 621, 
-    422, 560, 783, 218, 625, 566, 662, 446, 798, 117, 331, 990, 882, 892, 278, 549, 
-    535, 223, 377, 665, 285, 786, 147, 590, 962, 77, 563, 884, 261, 287, 694, 168, 
-    341, 240, 794, 442, 389, 658, 731, 939, 316, 383, 920, 730, 967, 364, 613, 488, 
-    22, 205, 292, 199, 554, 479, 355, 210, 385, 57, 1, 213, 691, 442, 1005, 1018, 
-    77, 506, 1005, 584, 360, 363, 444, 406, 769, 285, 861, 797, 580, 898, 121, 877, 
-    936, 238, 977, 62, 582, 441, 661, 816, 849, 819, 50, 221, 171, 340, 713, 436, 
-    616, 981, 455, 263, 419, 850, 525, 949, 671, 174, 430, 114, 76, 471, 66, 636, 
-    1, 308, 41, 358, 190, 284, 146, 268, 372, 531, 395, 439, 373, 422, 828, 153, 
-    718, 791, 953, 942, 676, 704, 213, 424, 106, 805, 495, 445, 598, 608, 96, 1011, 
-    661, 371, 770, 15, 51, 268, 1015, 741, 2, 462, 373, 555, 45, 975, 661, 409, 
-    504, 598, 736, 703, 817, 305, 804, 304, 961, 123, 878, 731, 793, 88, 393, 493, 
-    194, 389, 519, 423, 862, 239, 565, 571, 982, 194, 138, 830, 323, 208, 917, 972, 
-    535, 521, 917, 462, 394, 571, 223, 19, 379, 58, 812, 824, 562, 500, 701, 986, 
-    694, 659, 433, 681, 943, 593, 145, 226, 621, 134, 757, 522, 381, 54, 987, 45, 
-    962, 167, 1021, 103, 844, 702, 982, 496, 806, 773, 740, 270, 704, 954, 92, 586, 
-    592, 845, 341, 6, 687, 245, 887, 871, 1001, 844, 50, 912, 353, 91, 948, 875, 
-    844, 271, 783, 183, 553, 861, 190, 1008, 856, 556, 826, 381, 435, 731, 160, 551, 
-    574, 529, 995, 227, 210, 196, 371, 498, 612, 923, 88, 832, 472, 97, 138, 218, 
-    253, 251, 492, 38, 740, 886, 184, 1000, 340, 23, 547, 337, 257, 72, 87, 526, 
-    605, 770, 522, 569, 288, 799, 454, 877, 699, 545, 25, 728, 973, 247, 114, 38, 
-    131, 991, 529, 606, 752, 544, 970, 390, 578, 107, 645, 377, 727, 734, 60, 914, 
-    953, 876, 190, 320, 433, 412, 102, 283, 385, 1017, 437, 275, 43, 13, 15, 102, 
-    651, 49, 931, 404, 303, 513, 448, 60, 913, 1014, 143, 720, 700, 954, 290, 462, 
-    897, 202, 586, 410, 421, 193, 714, 720, 912, 165, 272, 429, 974, 735, 132, 936, 
-    189, 298, 642, 65, 859, 909, 970, 362, 446, 794, 761, 781, 563, 802, 862, 531, 
-    488, 450, 731, 770, 826, 952, 472, 999, 584, 359, 134, 534, 80, 590, 998, 969, 
-    103, 432, 680, 828, 882, 785, 862, 774, 580, 614, 125, 342, 994, 523, 328, 566, 
-    352, 660, 601, 419, 268, 141, 730, 464, 865, 39, 307, 82, 206, 119, 210, 961, 
-    275, 157, 671, 425, 619, 144, 817, 794, 169, 250, 835, 905, 416, 597, 323, 747, 
-    538, 712, 468, 390, 901, 670, 506, 854, 780, 1011, 627, 142, 669, 746, 469, 261, 
-    898, 707, 294, 712, 583, 925, 83, 155, 772, 656, 996, 753, 56, 607, 889, 418, 
-    945, 678, 590, 856, 78, 173, 198, 507, 312, 390, 633, 144, 285, 296, 439, 933, 
-    602, 634, 611, 15, 234, 16, 91, 711, 573, 577, 4, 656, 642, 595, 775, 136, 
-    468, 60, 772, 774, 289, 591, 676, 130, 795, 8, 835, 610, 1006, 219, 450, 473, 
-    392, 399, 268, 459, 424, 618, 479, 40, 156, 487, 777, 20, 814, 272, 457, 193, 
-    133, 541, 860, 865, 54, 482, 938, 285, 822, 90, 337, 251, 281, 516, 404, 108, 
-    928, 423, 955, 379, 355, 629, 259, 431, 352, 494, 563, 317, 1014, 567, 630, 20, 
-    935, 634, 436, 91, 292, 250, 199, 138, 660, 183, 148, 491, 61, 775, 485, 706, 
-    299, 120, 735, 762, 329, 877, 448, 896, 801, 617, 401, 663, 1004, 438, 897, 104, 
-    642, 309, 503, 759, 757, 319, 739, 415, 543, 178, 712, 342, 835, 335, 362, 410, 
-    1008, 206, 102, 712, 41, 596, 210, 538, 772, 401, 742, 279, 145, 199, 291, 119, 
-    62, 737, 1018, 278, 938, 50, 790, 788, 640, 665, 752, 223, 185, 447, 94, 784, 
-    452, 131, 289, 587, 985, 700, 522, 752, 601, 13, 411, 524, 33, 499, 953, 229, 
-    759, 575, 110, 675, 691, 235, 598, 998, 223, 756, 967, 45, 393, 762, 962, 169, 
-    358, 601, 314, 887, 569, 1005, 237, 874, 424, 366, 585, 371, 678, 329, 138, 903, 
-    111, 808, 606, 937, 848, 0, 675, 209, 902, 311, 100, 90, 368, 121, 534, 611, 
-    598, 247, 655, 12, 912, 572, 419, 717, 475, 458, 903, 1000, 606, 634, 705, 1, 
-    39, 794, 942, 663, 644, 586, 635, 81, 188, 362, 121, 884, 418, 848, 379, 885, 
-    289, 377, 900, 434, 70, 960, 190, 1006, 163, 884, 657, 313, 24, 970, 582, 263, 
-    170, 450, 184, 73, 386, 460, 346, 430, 167, 158, 932, 221, 924, 929, 487, 418, 
-    1003, 735, 244, 207, 709, 94, 907, 383, 669, 466, 381, 554, 619, 161, 832, 278, 
-    239, 782, 495, 59, 171, 1018, 809, 504, 757, 147, 42, 154, 772, 279, 160, 278, 
-    108, 107, 533, 212, 117, 788, 907, 135, 766, 463, 747, 769, 763, 789, 769, 749, 
-    399, 1020, 32, 795, 920, 245, 28, 971, 460, 107, 343, 779, 390, 605, 517, 810, 
-    711, 759, 983, 593, 987, 1021, 276, 591, 95, 104, 774, 175, 189, 184, 585, 561, 
-    446, 950, 293, 502, 331, 469, 15, 839, 969, 228, 476, 63, 812, 495, 916, 820, 
-    147, 338, 72, 80, 875, 322, 194, 661, 725, 442, 896, 917, 154, 338, 524, 915, 
-    2, 971, 324, 356, 577, 353, 531, 343, 171, 460, 253, 811, 981, 487, 177, 712, 
-    320, 346, 184, 980, 234, 763, 895, 100, 44, 941, 943, 917, 100, 911, 200, 667, 
-    224, 86, 472, 67, 179, 153, 184, 834, 766, 966, 696, 92, 106, 786, 1, 852, 
-    347, 894, 12, 249, 801, 213, 715, 89, 846, 442, 315, 857, 467, 83, 110, 1005, 
-    629, 287, 58, 402, 178, 399, 403, 192, 365, 305, 102, 572, 182, 138, 208, 11, 
-    875, 622, 34, 83, 844, 711, 95, 160, 829, 796, 204, 748, 856, 970, 230, 623, 
-    39, 545, 497, 494, 6, 71, 581, 990, 786, 999, 241, 353, 875, 70, 568, 688, 
-    506, 669, 209, 188, 879, 23, 235, 796, 459, 534, 775, 663, 768, 683, 426, 120, 
-    322, 131, 720, 700, 41, 894, 666, 999, 220, 230, 634, 407, 550, 394, 266, 695, 
-    739, 284, 20, 699, 440, 350, 106, 233, 106, 537, 6, 215, 353, 35, 982, 702, 
-    643, 542, 429, 687, 290, 57, 132, 674, 356, 772, 301, 214, 302, 554, 496, 59, 
-    497, 365, 128, 744, 186, 570, 220, 834, 912, 588, 446, 657, 370, 954, 251, 978, 
-    452, 524, 774, 196, 906, 415, 62, 608, 308, 626, 721, 950, 57, 685, 472, 985, 
-    89, 824, 223, 258, 127, 406, 824, 25, 825, 402, 990, 968, 1000, 198, 738, 270, 
-    579, 178, 462, 510, 420, 853, 601, 463, 260, 438, 46, 214, 241, 32, 281, 483, 
-    171, 992, 325, 447, 739, 677, 278, 523, 1003, 189, 143, 921, 212, 75, 805, 896, 
-    552, 561, 719, 883, 890, 252, 230, 121, 163, 924, 207, 686, 849, 299, 906, 635, 
-    490, 642, 508, 797, 988, 834, 445, 294, 815, 42, 181, 395, 847, 755, 645, 144, 
-    950, 532, 659, 975, 839, 281, 148, 853, 584, 428, 893, 15, 845, 211, 150, 422, 
-    861, 839, 1016, 689, 96, 165, 909, 84, 105, 470, 266, 205, 251, 699, 664, 395, 
-    1003, 208, 658, 478, 449, 331, 702, 260, 131, 170, 18, 130, 221, 654, 449, 267, 
-    881, 71, 545, 917, 568, 892, 486, 735, 558, 251, 804, 496, 523, 959, 386, 159, 
-    348, 29, 721, 748, 90, 11, 719, 512, 246, 536, 428, 290, 661, 44, 354, 1003, 
-    85, 380, 890, 490, 94, 1005, 356, 406, 638, 530, 405, 992, 268, 191, 122, 642, 
-    986, 569, 315, 916, 323, 494, 91, 874, 606, 737, 255, 563, 360, 973, 105, 122, 
-    518, 379, 103, 232, 592, 513, 294, 544, 859, 357, 671, 769, 355, 1013, 618, 4, 
-    1015, 693, 691, 23, 840, 309, 153, 286, 341, 309, 530, 807, 345, 605, 578, 227, 
-    796, 414, 178, 312, 823, 936, 881, 948, 822, 424, 317, 351, 502, 865, 105, 576, 
-    259, 124, 108, 712, 899, 1005, 961, 511, 589, 518, 971, 39, 182, 669, 194, 90, 
-    456, 311, 487, 357, 380, 907, 399, 196, 137, 470, 392, 851, 309, 863, 967, 4, 
-    649, 936, 6, 130, 739, 824, 845, 336, 332, 157, 292, 419, 965, 549, 336, 978, 
-    843, 976, 424, 136, 505, 357, 53, 780, 502, 172, 339, 822, 171, 597, 38, 405, 
-    360, 88, 97, 527, 316, 648, 179, 386, 845, 535, 258, 224, 894, 139, 17, 713, 
-    550, 208, 27, 924, 962, 1009, 106, 577, 449, 550, 774, 410, 313, 561, 424, 541, 
-    298, 499, 898, 241, 734, 317, 726, 62, 981, 487, 230, 509, 413, 775, 600, 436, 
-    981, 42, 217, 455, 718, 452, 554, 484, 848, 905, 30, 293, 79, 1012, 349, 157, 
-    725, 286, 608, 245, 959, 152, 508, 779, 973, 247, 703, 16, 936, 925, 334, 893, 
-    599, 681, 700, 704, 498, 269, 206, 496, 1015, 463, 947, 470, 329, 848, 607, 117, 
-    84, 417, 260, 768, 1008, 275, 418, 225, 808, 545, 317, 677, 110, 201, 152, 267, 
-    850, 120, 260, 765, 1021, 149, 678, 129, 248, 962, 142, 93, 98, 816, 142, 105, 
-    488, 83, 606, 151, 928, 357, 305, 464, 702, 36, 688, 749, 116, 428, 697, 460, 
-    363, 602, 461, 719, 1, 545, 553, 760, 910, 257, 785, 130, 39, 414, 177, 833, 
-    502, 413, 947, 799, 671, 916, 657, 418, 285, 9, 216, 466, 814, 108, 693, 171, 
-    481, 55, 653, 244, 217, 543, 57, 478, 41, 900, 971, 40, 887, 643, 795, 480, 
-    993, 758, 661, 989, 568, 700, 981, 326, 785, 652, 22, 93, 797, 29, 118, 70, 
-    381, 124, 42, 604, 1004, 950, 266, 236, 956, 935, 1021, 681, 569, 870, 745, 247, 
-    742, 245, 204, 475, 471, 473, 472, 687, 235, 506, 891, 451, 571, 24, 578, 328, 
-    491, 981, 87, 960, 801, 410, 48, 178, 938, 647, 383, 326, 9, 832, 521, 678, 
-    1007, 943, 209, 344, 336, 771, 201, 317, 151, 666, 223, 245, 165, 1002, 729, 398, 
-    81, 139, 742, 59, 611, 990, 876, 511, 187, 468, 45, 566, 943, 573, 512, 725, 
-    960, 129, 991, 504, 196, 609, 791, 564, 174, 817, 78, 892, 548, 64, 220, 678, 
-    228, 663, 119, 113, 895, 326, 1005, 998, 411, 986, 114, 327, 1020, 677, 419, 216, 
-    976, 535, 960, 454, 86, 240, 776, 441, 614, 555, 736, 551, 778, 983, 581, 403, 
-    104, 735, 154, 266, 716, 596, 887, 354, 798, 182, 541, 365, 263, 723, 784, 609, 
-    464, 993, 846, 204, 385, 442, 933, 987, 561, 348, 906, 717, 1007, 972, 835, 490, 
-    602, 232, 458, 562, 644, 544, 557, 547, 266, 171, 749, 665, 804, 200, 402, 234, 
-    996, 1003, 1018, 656, 804, 36, 325, 90, 616, 422, 694, 358, 2, 1021, 964, 596, 
-    383, 400, 575, 1002, 648, 803, 961, 139, 670, 767, 794, 87, 337, 553, 585, 899, 
-    36, 12, 200, 371, 151, 167, 63, 367, 1009, 750, 749, 817, 836, 662, 105, 538, 
-    284, 731, 233, 139, 264, 225, 551, 655, 574, 984, 781, 62, 622, 189, 506, 256, 
-    442, 518, 55, 183, 450, 368, 732, 847, 855, 785, 874, 845, 878, 213, 879, 31, 
-    47, 550, 501, 367, 321, 400, 238, 661, 157, 349, 872, 935, 1016, 339, 60, 49, 
-    355, 188, 922, 590, 233, 9, 661, 741, 319, 594, 1023, 49, 286, 374, 366, 395, 
-    712, 748, 410, 697, 1008, 298, 976, 470, 459, 245, 802, 859, 468, 431, 656, 732, 
-    833, 32, 515, 901, 466, 1002, 740, 718, 378, 790, 97, 148, 96, 618, 253, 761, 
-    344, 778, 851, 767, 330, 824, 438, 522, 146, 947, 471, 270, 814, 60, 159, 652, 
-    562, 895, 211, 134, 735, 290, 707, 197, 618, 648, 532, 314, 348, 65, 685, 709, 
-    404, 525, 497, 26, 324, 364, 955, 279, 291, 365, 212, 870, 888, 569, 861, 557, 
-    495, 652, 811, 822, 440, 704, 308, 1, 8, 957, 118, 260, 891, 423, 782, 281, 
-    161, 291, 256, 104, 313, 399, 723, 272, 996, 477, 398, 375, 124, 407, 858, 970, 
-    595, 720, 250, 967, 279, 499, 524, 304, 484, 9, 456, 137, 999, 433, 404, 584, 
-    87, 266, 12, 700, 716, 320, 663, 588, 918, 23, 446, 990, 767, 531, 442, 943, 
-    324, 337, 421, 7, 226, 190, 200, 286, 742, 318, 213, 199, 637, 368, 736, 414, 
-    953, 1004, 134, 451, 742, 439, 133, 756, 876, 877, 611, 847, 355, 707, 98, 343, 
-    781, 280, 647, 1016, 584, 23, 724, 191, 118, 39, 604, 981, 121, 269, 499, 250, 
-    215, 503, 51, 765, 532, 416, 597, 885, 31, 811, 270, 573, 806, 158, 831, 698, 
-    494, 38, 897, 524, 243, 33, 973, 108, 236, 390, 877, 164, 536, 753, 871, 324, 
-    562, 164, 335, 628, 949, 641, 1022, 96, 39, 23, 237, 219, 361, 528, 949, 183, 
-    903, 684, 936, 585, 986, 384, 532, 196, 750, 433, 517, 492, 780, 569, 395, 780, 
-    201, 250, 746, 351, 482, 423, 547, 958, 990, 665, 805, 50, 694, 211, 395, 873, 
-    292, 541, 387, 971, 364, 225, 283, 725, 457, 749, 86, 861, 292, 6, 775, 335, 
-    2, 165, 907, 681, 221, 617, 757, 978, 349, 816, 196, 601, 916, 948, 623, 627, 
-    831, 971, 810, 906, 356, 924, 702, 873, 677, 658, 429, 647, 103, 155, 418, 218, 
-    738, 220, 34, 339, 301, 207, 239, 503, 680, 254, 144, 556, 102, 249, 73, 629, 
-    80, 535, 506, 152, 316, 184, 962, 852, 655, 698, 654, 96, 137, 327, 232, 888, 
-    223, 236, 580, 690, 18, 977, 838, 150, 176, 445, 76, 920, 232, 694, 849, 794, 
-    844, 689, 629, 688, 327, 447, 348, 102, 120, 581, 513, 414, 64, 78, 134, 846, 
-    74, 203, 461, 1012, 682, 462, 64, 645, 189, 62, 788, 216, 693, 792, 777, 933, 
-    923, 600, 458, 860, 952, 934, 400, 858, 412, 18, 426, 586, 194, 771, 425, 499, 
-    638, 826, 158, 1021, 399, 556, 591, 415, 273, 642, 731, 323, 140, 306, 386, 720, 
-    102, 413, 730, 713, 28, 74, 603, 279, 114, 174, 642, 271, 189, 399, 767, 950, 
-    956, 469, 326, 113, 51, 900, 557, 611, 976, 373, 103, 818, 228, 50, 811, 725, 
-    600, 429, 754, 797, 183, 537, 173, 9, 959, 156, 998, 510, 964, 799, 686, 321, 
-    360, 343, 417, 170, 182, 374, 493, 636, 889, 201, 868, 678, 646, 432, 981, 528, 
-    804, 164, 905, 836, 394, 855, 876, 232, 640, 1004, 408, 685, 795, 585, 476, 872, 
-    364, 450, 468, 535, 614, 823, 27, 413, 321, 605, 323, 300, 355, 697, 648, 134, 
-    735, 581, 1011, 826, 835, 432, 946, 271, 967, 980, 302, 986, 922, 209, 778, 436, 
-    294, 4, 537, 893, 227, 402, 637, 59, 195, 172, 465, 105, 643, 965, 899, 424, 
-    1009, 204, 135, 595, 67, 978, 543, 510, 454, 933, 123, 597, 302, 783, 0, 1003, 
-    479, 91, 773, 562, 907, 273, 941, 274, 1003, 85, 99, 670, 893, 237, 572, 1019, 
-    251, 286, 291, 47, 802, 108, 856, 791, 662, 787, 113, 259, 270, 553, 387, 91, 
-    718, 382, 623, 334, 555, 787, 423, 278, 218, 477, 632, 522, 286, 375, 842, 978, 
-    102, 441, 936, 877, 786, 51, 936, 317, 191, 671, 823, 727, 884, 185, 51, 743, 
-    798, 273, 605, 185, 674, 439, 995, 432, 230, 827, 627, 14, 774, 251, 600, 410, 
-    160, 715, 846, 108, 241, 672, 724, 300, 276, 337, 485, 273, 599, 917, 912, 301, 
-    234, 913, 564, 384, 380, 926, 199, 288, 665, 530, 890, 507, 648, 450, 847, 354, 
-    441, 90, 619, 309, 482, 349, 677, 38, 895, 603, 856, 703, 211, 50, 421, 356, 
-    3, 160, 779, 282, 711, 187, 428, 912, 355, 1011, 486, 477, 858, 739, 949, 548, 
-    788, 793, 774, 629, 855, 283, 478, 350, 522, 926, 557, 394, 996, 6, 247, 164, 
-    529, 809, 342, 293, 248, 982, 919, 985, 769, 476, 0, 321, 154, 1007, 909, 871, 
-    867, 304, 931, 306, 768, 588, 695, 226, 396, 910, 71, 322, 84, 536, 417, 264, 
-    8, 475, 149, 229, 36, 965, 341, 881, 0, 269, 36, 806, 553, 377, 47, 522, 
-    922, 586, 3, 39, 302, 929, 191, 397, 475, 710, 252, 855, 410, 591, 157, 431, 
-    584, 517, 868, 790, 936, 526, 510, 372, 691, 291, 378, 505, 643, 498, 521, 730, 
-    526, 945, 142, 920, 923, 639, 915, 731, 994, 389, 814, 367, 829, 806, 25, 233, 
-    993, 679, 233, 130, 751, 666, 348, 205, 554, 563, 329, 57, 650, 708, 172, 547, 
-    1002, 327, 99, 247, 430, 256, 241, 816, 847, 613, 154, 521, 183, 519, 755, 329, 
-    850, 668, 694, 1003, 37, 337, 139, 351, 41, 258, 599, 629, 960, 591, 294, 0, 
-    757, 144, 884, 96, 575, 33, 737, 308, 992, 863, 83, 598, 385, 214, 477, 299, 
-    604, 495, 922, 268, 702, 974, 315, 319, 690, 965, 120, 900, 721, 952, 423, 122, 
-    156, 527, 699, 372, 883, 360, 151, 942, 995, 161, 1011, 106, 669, 545, 9, 901, 
-    130, 340, 317, 135, 945, 327, 786, 64, 123, 187, 969, 198, 610, 855, 602, 383, 
-    949, 887, 811, 471, 969, 511, 20, 308, 950, 243, 265, 615, 344, 485, 543, 147, 
-    790, 705, 895, 839, 441, 140, 643, 920, 791, 917, 996, 235, 996, 154, 936, 311, 
-    908, 89, 844, 321, 644, 478, 920, 877, 39, 792, 484, 163, 750, 49, 987, 607, 
-    609, 67, 410, 803, 874, 354, 809, 915, 887, 706, 395, 238, 782, 260, 1, 326, 
-    908, 948, 472, 620, 333, 640, 597, 12, 18, 586, 199, 438, 850, 861, 486, 290, 
-    479, 40, 19, 420, 828, 289, 461, 287, 1004, 309, 834, 83, 916, 256, 259, 701, 
-    582, 218, 942, 160, 355, 859, 336, 489, 641, 382, 763, 928, 1005, 884, 926, 66, 
-    846, 204, 939, 455, 588, 166, 391, 694, 936, 174, 930, 641, 418, 157, 962, 742, 
-    740, 862, 717, 67, 256, 36, 85, 821, 60, 651, 769, 749, 70, 944, 44, 497, 
-    917, 627, 363, 446, 869, 83, 163, 911, 680, 242, 818, 753, 544, 94, 89, 518, 
-    113, 874, 748, 977, 551, 913, 894, 578, 457, 395, 999, 509, 500, 869, 644, 1010, 
-    142, 7, 658, 198, 398, 943, 294, 787, 382, 116, 178, 294, 290, 963, 520, 1006, 
-    240, 955, 281, 733, 698, 146, 658, 187, 375, 271, 249, 1020, 939, 785, 663, 1015, 
-    97, 168, 798, 376, 73, 405, 42, 872, 311, 609, 296, 316, 578, 226, 684, 619, 
-    812, 48, 124, 613, 579, 367, 783, 598, 220, 1019, 332, 634, 752, 652, 669, 603, 
-    332, 52, 894, 692, 972, 135, 163, 373, 1016, 196, 430, 793, 437, 687, 1002, 113, 
-    871, 37, 341, 709, 96, 904, 482, 740, 698, 32, 6, 316, 968, 962, 657, 566, 
-    679, 937, 67, 408, 168, 627, 924, 705, 461, 327, 362, 197, 186, 215, 398, 980, 
-    238, 507, 159, 429, 876, 4, 100, 955, 298, 999, 479, 942, 902, 430, 780, 433, 
-    202, 908, 363, 929, 499, 24, 376, 674, 392, 198, 523, 885, 461, 389, 678, 497, 
-    574, 68, 964, 532, 784, 154, 756, 238, 497, 181, 792, 260, 411, 216, 254, 27, 
-    43, 101, 416, 106, 496, 374, 255, 250, 862, 12, 1015, 101, 1004, 577, 961, 156, 
-    536, 591, 10, 656, 922, 576, 554, 905, 754, 108, 950, 100, 951, 483, 230, 1011, 
-    202, 236, 721, 562, 536, 680, 275, 495, 472, 235, 665, 332, 722, 432, 978, 425, 
-    781, 642, 916, 865, 263, 567, 1020, 794, 90, 561, 940, 426, 15, 945, 482, 976, 
-    158, 97, 215, 421, 77, 122, 182, 1007, 637, 347, 866, 892, 873, 280, 612, 505, 
-    765, 228, 848, 488, 860, 8, 123, 479, 60, 556, 294, 555, 815, 500, 329, 375, 
-    544, 431, 97, 353, 91, 855, 654, 506, 1019, 906, 175, 80, 648, 229, 942, 570, 
-    865, 513, 814, 164, 667, 70, 666, 526, 338, 454, 424, 96, 341, 97, 62, 908, 
-    7, 636, 519, 633, 918, 862, 139, 457, 349, 1020, 1007, 431, 878, 959, 462, 145, 
-    782, 765, 852, 752, 203, 740, 577, 390, 939, 235, 955, 601, 516, 412, 683, 251, 
-    355, 627, 791, 441, 384, 232, 277, 593, 854, 477, 355, 759, 535, 488, 498, 203, 
-    802, 169, 813, 517, 683, 438, 102, 387, 98, 933, 977, 171, 370, 595, 234, 824, 
-    395, 920, 148, 656, 554, 763, 858, 973, 251, 754, 268, 181, 463, 753, 901, 79, 
-    589, 326, 812, 377, 31, 987, 930, 964, 806, 809, 406, 230, 140, 313, 782, 55, 
-    127, 231, 32, 457, 558, 249, 483, 560, 772, 738, 652, 455, 561, 214, 69, 132, 
-    347, 462, 321, 100, 768, 358, 992, 963, 899, 181, 293, 534, 985, 785, 540, 671, 
-    391, 580, 902, 513, 477, 476, 807, 475, 423, 862, 394, 901, 761, 768, 540, 500, 
-    146, 988, 907, 549, 947, 751, 433, 17, 354, 179, 353, 703, 347, 182, 578, 784, 
-    549, 62, 973, 60, 493, 784, 218, 446, 950, 42, 405, 273, 793, 999, 908, 112, 
-    562, 676, 172, 436, 226, 659, 105, 758, 116, 106, 929, 532, 578, 487, 758, 461, 
-    877, 373, 55, 956, 518, 957, 357, 690, 11, 693, 926, 255, 384, 343, 60, 150, 
-    287, 136, 927, 127, 772, 68, 78, 295, 229, 401, 550, 503, 271, 961, 436, 393, 
-    754, 367, 377, 570, 968, 674, 651, 689, 481, 513, 321, 129, 386, 473, 964, 128, 
-    159, 109, 832, 557, 421, 352, 765, 244, 34, 129, 838, 138, 728, 671, 347, 789, 
-    739, 83, 818, 54, 425, 855, 999, 681, 494, 762, 315, 763, 306, 357, 283, 254, 
-    795, 235, 659, 903, 781, 892, 428, 271, 28, 908, 918, 856, 469, 958, 17, 61, 
-    512, 917, 159, 234, 982, 278, 651, 653, 495, 625, 965, 672, 85, 480, 281, 587, 
-    401, 624, 229, 1007, 285, 927, 991, 570, 946, 137, 180, 799, 38, 33, 69, 607, 
-    752, 565, 477, 351, 510, 290, 589, 158, 830, 934, 86, 482, 734, 961, 166, 140, 
-    425, 15, 333, 345, 919, 282, 330, 600, 471, 526, 368, 26, 928, 112, 214, 380, 
-    709, 476, 238, 182, 329, 272, 619, 905, 143, 548, 992, 20, 710, 589, 134, 959, 
-    188, 778, 814, 106, 782, 467, 115, 143, 408, 13, 67, 1023, 312, 408, 307, 136, 
-    464, 1013, 590, 838, 288, 134, 558, 58, 33, 289, 637, 696, 645, 896, 252, 207, 
-    473, 763, 169, 712, 564, 254, 299, 842, 403, 318, 529, 604, 197, 719, 962, 897, 
-    875, 194, 221, 94, 406, 780, 846, 957, 501, 94, 290, 26, 54, 375, 12, 118, 
-    555, 739, 645, 215, 522, 972, 854, 480, 691, 443, 481, 922, 701, 521, 35, 352, 
-    388, 289, 418, 214, 125, 382, 930, 804, 412, 259, 31, 894, 655, 962, 789, 711, 
-    98, 759, 103, 308, 71, 329, 832, 796, 748, 661, 923, 133, 395, 728, 397, 729, 
-    148, 985, 981, 651, 343, 295, 677, 954, 353, 431, 556, 703, 298, 348, 277, 795, 
-    286, 805, 779, 91, 150, 277, 862, 231, 40, 758, 225, 893, 1023, 437, 250, 70, 
-    442, 331, 322, 608, 659, 35, 704, 418, 637, 293, 365, 651, 510, 577, 749, 358, 
-    698, 997, 318, 43, 435, 343, 491, 869, 185, 262, 12, 663, 694, 327, 950, 419, 
-    268, 601, 187, 847, 694, 397, 460, 31, 461, 871, 320, 929, 392, 425, 686, 295, 
-    956, 350, 8, 61, 134, 673, 192, 986, 85, 244, 115, 1000, 285, 898, 794, 83, 
-    527, 612, 525, 941, 30, 121, 150, 669, 635, 100, 564, 318, 253, 896, 218, 70, 
-    678, 787, 350, 321, 441, 978, 948, 124, 344, 447, 719, 66, 40, 82, 184, 808, 
-    81, 376, 294, 290, 270, 952, 717, 296, 124, 258, 682, 551, 800, 363, 242, 652, 
-    430, 907, 518, 553, 172, 832, 927, 867, 824, 127, 411, 765, 797, 47, 887, 147, 
-    365, 840, 170, 828, 650, 141, 577, 609, 994, 444, 668, 228, 621, 175, 979, 991, 
-    198, 140, 508, 463, 48, 423, 967, 338, 575, 917, 514, 402, 587, 122, 49, 497, 
-    633, 881, 612, 539, 749, 70, 22, 183, 494, 112, 672, 909, 193, 94, 442, 224, 
-    725, 302, 744, 262, 927, 143, 705, 83, 1013, 552, 59, 773, 34, 957, 929, 362, 
-    300, 939, 87, 836, 423, 250, 81, 101, 98, 394, 36, 227, 876, 1007, 436, 1002, 
-    622, 696, 900, 123, 253, 877, 339, 749, 864, 295, 265, 383, 858, 10, 524, 777, 
-    392, 275, 925, 979, 834, 431, 531, 908, 178, 733, 373, 787, 649, 848, 815, 458, 
-    530, 68, 73, 443, 131, 693, 85, 712, 243, 642, 617, 389, 965, 3, 745, 554, 
-    224, 196, 498, 721, 75, 1000, 446, 649, 356, 8, 892, 12, 197, 572, 311, 276, 
-    343, 858, 368, 34, 145, 309, 378, 211, 959, 985, 899, 679, 20, 285, 42, 1023, 
-    754, 424, 423, 871, 215, 217, 905, 180, 285, 380, 166, 167, 563, 0, 170, 573, 
-    722, 484, 91, 370, 641, 895, 579, 526, 410, 656, 796, 163, 545, 275, 786, 896, 
-    573, 293, 390, 469, 164, 632, 426, 826, 615, 663, 940, 732, 744, 262, 154, 3, 
-    598, 561, 381, 979, 637, 715, 478, 1020, 483, 1012, 963, 140, 329, 791, 5, 960, 
-    471, 478, 423, 14, 213, 597, 569, 400, 901, 586, 953, 609, 552, 327, 1017, 902, 
-    509, 513, 620, 793, 912, 780, 707, 949, 234, 454, 608, 764, 735, 671, 601, 958, 
-    654, 229, 173, 400, 470, 865, 546, 72, 362, 950, 424, 377, 871, 816, 358, 795, 
-    49, 604, 162, 960, 213, 417, 574, 422, 275, 783, 211, 629, 963, 420, 27, 516, 
-    23, 265, 171, 849, 436, 202, 827, 644, 240, 17, 347, 378, 826, 542, 188, 658, 
-    172, 215, 409, 1, 601, 165, 525, 545, 790, 402, 111, 716, 488, 963, 156, 19, 
-    820, 106, 509, 37, 508, 874, 87, 366, 434, 7, 650, 342, 288, 307, 222, 436, 
-    104, 544, 562, 528, 550, 589, 567, 986, 780, 668, 370, 266, 982, 758, 162, 242, 
-    534, 163, 875, 736, 613, 386, 540, 294, 890, 525, 124, 139, 792, 985, 676, 427, 
-    245, 868, 292, 686, 863, 598, 68, 517, 523, 151, 764, 947, 156, 365, 292, 567, 
-    417, 940, 421, 340, 729, 339, 554, 232, 705, 105, 370, 34, 964, 450, 185, 887, 
-    595, 53, 908, 61, 930, 542, 428, 405, 942, 814, 816, 260, 731, 386, 639, 343, 
-    529, 874, 551, 938, 894, 467, 435, 449, 264, 13, 950, 759, 515, 26, 776, 315, 
-    64, 163, 941, 399, 195, 763, 463, 938, 206, 881, 794, 73, 233, 28, 1009, 703, 
-    158, 709, 694, 995, 822, 74, 1002, 590, 485, 211, 862, 619, 339, 719, 642, 247, 
-    612, 922, 748, 649, 209, 98, 588, 322, 906, 492, 346, 403, 669, 267, 985, 809, 
-    102, 570, 425, 272, 471, 206, 714, 24, 178, 651, 668, 754, 687, 43, 1017, 306, 
-    826, 186, 483, 524, 950, 566, 532, 396, 196, 446, 254, 460, 948, 361, 1018, 797, 
-    901, 613, 103, 948, 292, 311, 449, 913, 592, 311, 27, 881, 955, 591, 352, 247, 
-    167, 666, 219, 386, 727, 585, 625, 379, 92, 958, 857, 945, 352, 354, 307, 710, 
-    776, 115, 806, 277, 530, 292, 139, 637, 479, 545, 455, 827, 675, 1020, 435, 319, 
-    186, 709, 305, 454, 406, 910, 371, 189, 943, 7, 517, 880, 270, 500, 563, 134, 
-    268, 345, 628, 836, 443, 18, 190, 693, 707, 152, 556, 91, 507, 390, 715, 753, 
-    366, 1000, 205, 229, 816, 372, 170, 491, 485, 160, 326, 48, 269, 672, 426, 274, 
-    521, 278, 802, 155, 448, 632, 776, 465, 504, 449, 492, 435, 280, 371, 589, 702, 
-    882, 343, 87, 801, 550, 583, 648, 247, 590, 778, 541, 43, 269, 336, 620, 115, 
-    350, 657, 159, 238, 893, 383, 237, 845, 882, 54, 506, 726, 582, 868, 121, 819, 
-    385, 1013, 896, 881, 1005, 92, 438, 532, 599, 287, 274, 783, 844, 864, 116, 735, 
-    809, 461, 114, 809, 981, 794, 102, 69, 258, 1, 618, 664, 565, 244, 198, 821, 
-    174, 890, 581, 219, 858, 945, 294, 508, 439, 538, 1001, 918, 982, 232, 126, 685, 
-    851, 213, 689, 860, 983, 794, 126, 594, 343, 886, 861, 317, 839, 573, 706, 632, 
-    927, 211, 70, 937, 112, 792, 478, 268, 668, 433, 323, 112, 140, 147, 709, 644, 
-    984, 617, 787, 402, 759, 987, 379, 3, 92, 116, 8, 205, 946, 210, 510, 489, 
-    1019, 945, 407, 440, 117, 945, 631, 332, 569, 237, 164, 74, 965, 643, 383, 792, 
-    69, 960, 920, 486, 88, 743, 63, 126, 159, 459, 107, 844, 894, 700, 811, 179, 
-    573, 157, 688, 1019, 23, 329, 457, 678, 865, 286, 619, 324, 158, 829, 230, 101, 
-    827, 21, 755, 459, 784, 862, 678, 595, 607, 331, 232, 358, 363, 103, 400, 127, 
-    885, 2, 176, 299, 496, 58, 136, 521, 315, 702, 91, 626, 819, 479, 831, 228, 
-    740, 369, 539, 606, 286, 966, 431, 230, 220, 376, 762, 975, 539, 220, 350, 289, 
-    8, 405, 935, 189, 537, 351, 236, 747, 381, 958, 831, 9, 876, 564, 82, 737, 
-    628, 958, 717, 62, 7, 166, 671, 946, 383, 912, 991, 239, 672, 620, 790, 445, 
-    128, 20, 203, 301, 727, 533, 506, 937, 635, 655, 599, 987, 617, 794, 311, 866, 
-    22, 878, 882, 494, 719, 794, 69, 184, 500, 877, 992, 947, 808, 400, 177, 319, 
-    140, 545, 361, 995, 824, 652, 12, 415, 767, 495, 766, 790, 698, 144, 748, 566, 
-    530, 796, 249, 616, 156, 579, 567, 150, 619, 742, 972, 835, 439, 405, 348, 584, 
-    125, 843, 1002, 732, 728, 240, 721, 55, 662, 175, 375, 666, 754, 37, 966, 167, 
-    23, 624, 512, 336, 902, 995, 83, 18, 945, 274, 341, 644, 776, 625, 828, 1011, 
-    129, 223, 636, 279, 421, 606, 187, 895, 1005, 990, 7, 907, 818, 760, 571, 536, 
-    361, 378, 409, 850, 827, 643, 1014, 188, 587, 744, 66, 919, 332, 573, 945, 387, 
-    987, 242, 446, 307, 984, 343, 491, 469, 740, 864, 499, 236, 485, 536, 116, 222, 
-    688, 880, 75, 491, 781, 464, 505, 739, 680, 252, 907, 858, 988, 181, 66, 587, 
-    445, 67, 673, 724, 624, 613, 733, 329, 329, 230, 941, 865, 502, 266, 743, 840, 
-    1012, 613, 778, 157, 705, 855, 784, 32, 234, 399, 817, 199, 529, 379, 409, 321, 
-    614, 967, 426, 338, 773, 565, 288, 599, 904, 345, 283, 70, 697, 109, 860, 585, 
-    699, 516, 62, 868, 541, 292, 729, 87, 257, 161, 930, 0, 722, 391, 442, 41, 
-    703, 824, 518, 188, 871, 893, 684, 93, 328, 740, 657, 361, 511, 752, 532, 828, 
-    615, 19, 255, 90, 259, 778, 450, 560, 824, 551, 1001, 211, 946, 106, 135, 638, 
-    498, 987, 753, 236, 665, 165, 29, 888, 165, 807, 86, 246, 183, 883, 397, 590, 
-    698, 343, 942, 753, 372, 172, 536, 215, 458, 679, 991, 12, 856, 693, 815, 487, 
-    809, 667, 559, 528, 119, 515, 309, 457, 942, 969, 607, 347, 819, 520, 243, 773, 
-    968, 812, 755, 898, 606, 544, 182, 500, 355, 686, 589, 628, 256, 639, 515, 599, 
-    789, 655, 688, 17, 918, 895, 316, 446, 938, 606, 308, 962, 927, 559, 461, 971, 
-    129, 578, 183, 96, 115, 946, 88, 642, 446, 45, 995, 661, 616, 734, 982, 884, 
-    365, 360, 581, 871, 173, 650, 404, 432, 846, 947, 730, 637, 608, 652, 190, 1002, 
-    465, 440, 716, 32, 357, 309, 219, 942, 551, 910, 181, 416, 798, 47, 998, 925, 
-    656, 593, 785, 162, 277, 68, 87, 760, 113, 525, 214, 354, 337, 164, 200, 385, 
-    100, 601, 208, 959, 866, 180, 685, 969, 85, 599, 156, 1022, 1005, 879, 458, 486, 
-    446, 936, 43, 114, 206, 918, 101, 174, 350, 470, 711, 397, 889, 359, 749, 9, 
-    475, 954, 767, 805, 596, 1016, 881, 36, 297, 46, 646, 674, 554, 22, 265, 218, 
-    314, 513, 720, 833, 797, 178, 688, 923, 500, 1023, 654, 824, 129, 961, 392, 668, 
-    214, 124, 255, 137, 155, 494, 477, 754, 601, 339, 437, 42, 291, 309, 69, 484, 
-    305, 483, 174, 798, 1021, 641, 122, 336, 852, 985, 144, 323, 118, 531, 405, 672, 
-    669, 624, 321, 404, 280, 105, 75, 687, 699, 926, 229, 364, 173, 900, 323, 444, 
-    609, 144, 878, 711, 409, 832, 830, 549, 81, 945, 737, 178, 14, 115, 720, 934, 
-    176, 450, 299, 125, 146, 504, 8, 488, 452, 852, 563, 649, 857, 251, 282, 837, 
-    173, 993, 269, 106, 468, 289, 426, 15, 507, 936, 2, 868, 781, 631, 6, 31, 
-    256, 878, 442, 790, 375, 725, 239, 287, 776, 103, 405, 282, 684, 505, 154, 231, 
-    428, 805, 501, 897, 256, 225, 543, 73, 426, 833, 954, 976, 543, 4, 355, 178, 
-    514, 674, 6, 646, 291, 45, 260, 529, 477, 834, 409, 301, 692, 72, 867, 333, 
-    15, 389, 733, 612, 158, 872, 791, 579, 870, 838, 796, 230, 660, 62, 922, 298, 
-    534, 610, 172, 843, 385, 371, 492, 43, 458, 257, 274, 449, 744, 417, 226, 377, 
-    1000, 865, 324, 925, 1002, 572, 21, 650, 844, 978, 22, 661, 472, 631, 86, 231, 
-    329, 785, 347, 488, 896, 648, 66, 595, 464, 1014, 140, 703, 847, 387, 626, 11, 
-    303, 774, 688, 1014, 507, 1015, 189, 832, 225, 760, 6, 255, 437, 832, 858, 140, 
-    315, 997, 707, 810, 591, 810, 644, 940, 688, 892, 944, 193, 920, 691, 703, 670, 
-    578, 894, 691, 624, 859, 963, 163, 39, 509, 642, 1018, 324, 484, 851, 418, 491, 
-    419, 907, 917, 218, 534, 718, 844, 156, 517, 537, 448, 623, 549, 49, 590, 72, 
-    565, 560, 903, 45, 536, 108, 982, 869, 690, 346, 68, 499, 231, 964, 679, 394, 
-    230, 420, 923, 489, 230, 262, 682, 862, 804, 551, 927, 294, 626, 410, 558, 481, 
-    51, 479, 264, 991, 765, 68, 440, 727, 583, 167, 793, 59, 5, 911, 81, 360, 
-    801, 78, 493, 376, 782, 859, 548, 48, 260, 136, 652, 578, 401, 282, 500, 592, 
-    411, 390, 99, 560, 322, 124, 993, 847, 826, 47, 485, 675, 678, 846, 614, 564, 
-    387, 76, 63, 763, 795, 214, 39, 650, 596, 972, 842, 648, 1007, 460, 971, 489, 
-    472, 51, 80, 775, 662, 600, 979, 195, 11, 751, 661, 172, 76, 475, 14, 812, 
-    654, 238, 348, 276, 264, 472, 208, 1020, 350, 895, 974, 133, 434, 222, 325, 6, 
-    606, 518, 619, 899, 654, 939, 300, 683, 630, 403, 167, 548, 946, 780, 803, 791, 
-    340, 70, 935, 51, 261, 310, 56, 849, 448, 20, 256, 555, 937, 23, 869, 941, 
-    669, 988, 972, 773, 62, 650, 454, 561, 290, 464, 525, 224, 816, 178, 702, 860, 
-    923, 85, 655, 476, 287, 73, 366, 992, 458, 665, 357, 541, 460, 697, 1015, 988, 
-    316, 200, 870, 560, 899, 1008, 35, 387, 508, 841, 583, 696, 917, 382, 722, 776, 
-    246, 525, 260, 23, 891, 679, 908, 962, 444, 542, 323, 711, 979, 696, 833, 915, 
-    895, 71, 786, 475, 976, 482, 50, 116, 219, 811, 240, 944, 404, 537, 397, 736, 
-    947, 684, 495, 808, 8, 928, 148, 776, 4, 167, 30, 333, 866, 799, 492, 399, 
-    423, 884, 450, 993, 722, 900, 157, 317, 856, 297, 849, 910, 141, 718, 159, 105, 
-    980, 12, 209, 172, 910, 313, 935, 1016, 40, 276, 21, 230, 867, 585, 160, 205, 
-    682, 314, 341, 336, 311, 247, 233, 232, 507, 700, 895, 204, 398, 560, 250, 627, 
-    280, 392, 424, 223, 502, 513, 260, 448, 139, 688, 551, 590, 249, 490, 160, 122, 
-    809, 406, 509, 328, 385, 408, 745, 488, 667, 623, 737, 867, 127, 997, 214, 49, 
-    903, 86, 110, 228, 862, 271, 2, 812, 52, 624, 104, 252, 407, 830, 730, 776, 
-    980, 773, 980, 282, 690, 892, 70, 521, 236, 816, 349, 31, 901, 764, 404, 1001, 
-    806, 287, 26, 936, 642, 447, 32, 106, 853, 472, 710, 833, 307, 314, 595, 737, 
-    44, 239, 519, 245, 434, 1019, 971, 734, 483, 816, 34, 568, 885, 416, 745, 12, 
-    272, 750, 256, 239, 238, 41, 541, 363, 659, 331, 868, 409, 217, 633, 406, 238, 
-    219, 18, 302, 768, 392, 381, 12, 340, 83, 464, 326, 945, 565, 312, 49, 37, 
-    765, 364, 273, 901, 756, 967, 426, 100, 414, 110, 480, 724, 1017, 782, 394, 195, 
-    425, 652, 82, 39, 25, 872, 185, 355, 961, 264, 824, 681, 707, 997, 626, 201, 
-    937, 632, 162, 365, 631, 102, 876, 127, 532, 201, 117, 395, 982, 552, 701, 948, 
-    250, 102, 436, 579, 451, 432, 799, 957, 375, 380, 776, 83, 833, 809, 227, 535, 
-    325, 555, 710, 49, 981, 990, 128, 373, 370, 770, 864, 279, 924, 36, 477, 607, 
-    669, 652, 499, 579, 812, 857, 739, 229, 81, 665, 717, 532, 871, 950, 80, 383, 
-    180, 120, 616, 745, 552, 755, 1004, 283, 718, 594, 1004, 332, 977, 46, 62, 119, 
-    338, 706, 514, 939, 226, 121, 530, 584, 562, 655, 266, 515, 79, 231, 703, 404, 
-    601, 420, 204, 285, 774, 474, 648, 254, 668, 481, 472, 419, 775, 101, 906, 795, 
-    387, 378, 444, 785, 798, 474, 705, 951, 426, 770, 23, 871, 122, 139, 334, 903, 
-    523, 605, 995, 550, 479, 445, 223, 699, 947, 278, 22, 631, 32, 909, 299, 51, 
-    222, 113, 615, 191, 852, 442, 749, 193, 203, 254, 12, 455, 565, 432, 683, 288, 
-    911, 835, 757, 778, 450, 604, 65, 307, 352, 146, 728, 114, 931, 894, 995, 552, 
-    653, 1016, 555, 473, 21, 58, 737, 525, 562, 7, 622, 949, 668, 699, 503, 26, 
-    70, 777, 42, 648, 933, 734, 829, 991, 437, 812, 823, 8, 494, 17, 755, 299, 
-    44, 631, 615, 980, 351, 679, 21, 308, 329, 838, 559, 406, 264, 607, 7, 881, 
-    577, 487, 321, 49, 792, 36, 500, 490, 519, 532, 307, 469, 455, 690, 318, 193, 
-    176, 6, 987, 126, 321, 241, 356, 233, 837, 393, 802, 381, 428, 725, 1013, 698, 
-    878, 489, 48, 579, 238, 799, 147, 568, 412, 514, 898, 882, 534, 756, 637, 611, 
-    649, 374, 616, 389, 183, 330, 243, 1023, 770, 744, 188, 895, 742, 408, 334, 363, 
-    176, 766, 790, 490, 849, 579, 950, 400, 373, 107, 122, 263, 324, 447, 245, 876, 
-    308, 215, 903, 450, 595, 957, 171, 945, 174, 959, 245, 506, 870, 323, 55, 630, 
-    587, 185, 177, 897, 665, 531, 705, 671, 735, 802, 679, 92, 386, 689, 237, 144, 
-    873, 746, 336, 82, 762, 729, 449, 214, 906, 963, 253, 617, 651, 51, 600, 605, 
-    391, 921, 698, 862, 891, 524, 93, 781, 582, 530, 976, 755, 424, 943, 634, 567, 
-    71, 846, 67, 439, 858, 349, 194, 873, 65, 363, 554, 214, 1018, 293, 895, 378, 
-    399, 227, 270, 879, 19, 735, 180, 377, 859, 858, 1017, 671, 304, 39, 574, 697, 
-    864, 988, 960, 626, 939, 763, 459, 103, 391, 166, 360, 671, 415, 797, 110, 974, 
-    213, 998, 516, 519, 873, 43, 278, 683, 979, 1000, 635, 784, 313, 412, 547, 955, 
-    208, 633, 730, 48, 604, 623, 186, 498, 258, 75, 605, 848, 302, 238, 53, 106, 
-    771, 742, 441, 123, 409, 504, 505, 330, 172, 973, 545, 757, 522, 894, 606, 597, 
-    1013, 207, 495, 50, 400, 333, 664, 389, 703, 326, 111, 901, 959, 856, 956, 1006, 
-    313, 868, 628, 510, 900, 824, 825, 79, 646, 94, 177, 295, 577, 250, 836, 71, 
-    926, 749, 204, 684, 548, 150, 438, 954, 193, 212, 597, 284, 798, 239, 138, 789, 
-    1, 913, 93, 10, 812, 476, 512, 29, 805, 459, 734, 94, 986, 248, 562, 132, 
-    7, 964, 532, 177, 472, 387, 584, 106, 346, 201, 243, 273, 484, 1002, 5, 768, 
-    927, 74, 676, 421, 6, 620, 222, 190, 32, 622, 710, 305, 414, 11, 526, 660, 
-    847, 430, 561, 279, 670, 79, 706, 335, 492, 675, 519, 270, 541, 647, 735, 191, 
-    90, 824, 293, 600, 70, 552, 919, 421, 407, 781, 830, 547, 805, 1023, 1000, 495, 
-    123, 426, 650, 555, 504, 463, 623, 395, 18, 469, 185, 726, 306, 22, 127, 516, 
-    969, 777, 619, 713, 980, 965, 290, 221, 471, 225, 735, 383, 381, 158, 166, 397, 
-    230, 856, 864, 846, 779, 823, 900, 131, 917, 402, 231, 504, 530, 255, 684, 55, 
-    446, 857, 372, 760, 45, 51, 435, 852, 446, 947, 148, 495, 64, 615, 1008, 85, 
-    804, 1023, 644, 439, 950, 371, 890, 259, 293, 426, 814, 528, 409, 568, 33, 460, 
-    737, 915, 495, 370, 749, 633, 948, 371, 862, 531, 893, 490, 365, 60, 123, 836, 
-    623, 944, 687, 21, 581, 849, 199, 230, 554, 116, 694, 126, 195, 424, 812, 930, 
-    399, 35, 910, 837, 720, 1009, 798, 971, 12, 105, 226, 208, 728, 789, 124, 548, 
-    799, 377, 287, 47, 647, 750, 47, 95, 635, 479, 449, 895, 335, 590, 417, 569, 
-    666, 603, 879, 33, 844, 985, 587, 132, 796, 1001, 597, 822, 253, 8, 955, 395, 
-    604, 500, 230, 710, 779, 341, 657, 650, 89, 279, 124, 820, 688, 191, 57, 905, 
-    83, 292, 878, 51, 830, 300, 484, 104, 722, 221, 113, 17, 239, 507, 721, 264, 
-    218, 628, 346, 1019, 499, 862, 812, 277, 858, 455, 413, 411, 898, 475, 834, 554, 
-    795, 153, 586, 1017, 671, 726, 583, 964, 185, 548, 833, 815, 784, 99, 860, 579, 
-    249, 974, 626, 738, 869, 22, 81, 836, 673, 640, 289, 919, 572, 1004, 474, 810, 
-    347, 218, 586, 35, 359, 712, 34, 752, 324, 291, 86, 205, 394, 418, 13, 937, 
-    975, 343, 512, 61, 73, 96, 894, 742, 465, 587, 61, 81, 427, 712, 374, 442, 
-    318, 108, 662, 816, 618, 14, 427, 990, 344, 463, 119, 43, 1021, 590, 427, 818, 
-    368, 584, 969, 587, 71, 158, 782, 45, 765, 48, 194, 939, 18, 766, 999, 83, 
-    859, 986, 228, 60, 519, 988, 342, 335, 301, 931, 94, 306, 394, 466, 109, 651, 
-    315, 898, 821, 821, 587, 551, 806, 520, 1000, 663, 650, 884, 73, 222, 964, 697, 
-    338, 436, 588, 469, 31, 136, 518, 510, 399, 995, 139, 497, 580, 606, 402, 872, 
-    4, 650, 712, 917, 653, 710, 867, 562, 584, 620, 688, 346, 218, 353, 83, 128, 
-    886, 843, 67, 584, 419, 624, 810, 201, 311, 240, 875, 936, 301, 449, 510, 563, 
-    763, 416, 241, 693, 753, 76, 833, 547, 201, 164, 363, 948, 488, 1008, 446, 13, 
-    341, 278, 438, 711, 727, 45, 144, 747, 90, 830, 704, 34, 427, 810, 325, 83, 
-    224, 149, 755, 710, 790, 881, 291, 596, 290, 499, 47, 638, 930, 746, 768, 935, 
-    322, 804, 380, 548, 509, 387, 869, 266, 156, 517, 822, 28, 442, 240, 819, 771, 
-    966, 771, 824, 120, 734, 54, 962, 197, 374, 526, 892, 34, 514, 252, 791, 664, 
-    131, 284, 927, 951, 537, 27, 215, 474, 840, 339, 823, 216, 786, 114, 492, 557, 
-    487, 128, 78, 852, 748, 491, 68, 566, 503, 1020, 403, 717, 365, 1019, 240, 96, 
-    782, 876, 402, 205, 243, 1, 458, 85, 939, 449, 386, 703, 669, 271, 581, 681, 
-    756, 26, 475, 136, 767, 776, 253, 986, 253, 905, 484, 366, 72, 362, 608, 362, 
-    666, 558, 228, 244, 327, 618, 601, 467, 273, 276, 1016, 661, 491, 643, 869, 249, 
-    142, 293, 642, 208, 673, 416, 867, 783, 1011, 865, 932, 494, 487, 371, 936, 61, 
-    1016, 391, 391, 630, 306, 652, 862, 940, 408, 400, 110, 476, 620, 488, 913, 412, 
-    134, 241, 654, 0, 7, 1022, 757, 871, 308, 162, 561, 439, 153, 326, 801, 771, 
-    459, 590, 963, 275, 431, 560, 118, 1008, 400, 516, 822, 987, 582, 114, 748, 850, 
-    945, 460, 858, 662, 358, 875, 703, 919, 112, 713, 210, 800, 562, 194, 112, 566, 
-    592, 277, 827, 644, 702, 951, 214, 431, 445, 189, 753, 266, 928, 434, 204, 387, 
-    556, 811, 711, 554, 475, 543, 269, 438, 593, 790, 313, 137, 890, 914, 941, 374, 
-    348, 942, 1021, 982, 103, 382, 627, 777, 644, 934, 34, 872, 8, 44, 204, 847, 
-    377, 474, 51, 335, 96, 445, 949, 763, 482, 239, 441, 620, 436, 261, 522, 873, 
-    902, 692, 680, 977, 468, 839, 515, 993, 499, 733, 81, 442, 744, 352, 727, 492, 
-    18, 193, 451, 928, 962, 576, 625, 912, 518, 220, 719, 825, 687, 542, 934, 310, 
-    313, 532, 388, 428, 723, 480, 961, 776, 503, 60, 986, 503, 511, 593, 327, 323, 
-    231, 150, 547, 745, 571, 111, 909, 195, 820, 580, 250, 342, 714, 843, 282, 478, 
-    68, 341, 786, 393, 661, 302, 436, 619, 947, 1010, 789, 563, 395, 72, 815, 13, 
-    493, 61, 50, 397, 544, 834, 1006, 783, 464, 243, 859, 677, 188, 501, 643, 46, 
-    579, 130, 37, 446, 609, 886, 532, 1022, 59, 664, 767, 999, 98, 302, 837, 947, 
-    758, 583, 40, 821, 463, 955, 826, 969, 806, 883, 998, 429, 17, 207, 929, 212, 
-    627, 879, 224, 54, 580, 789, 779, 323, 334, 698, 261, 829, 678, 628, 569, 419, 
-    522, 103, 960, 824, 51, 44, 424, 538, 647, 282, 619, 844, 829, 643, 409, 456, 
-    282, 903, 263, 333, 126, 18, 172, 214, 850, 538, 171, 706, 215, 629, 599, 49, 
-    438, 873, 432, 240, 667, 72, 151, 14, 444, 872, 600, 610, 688, 897, 66, 213, 
-    469, 202, 676, 399, 576, 551, 632, 182, 335, 24, 967, 693, 312, 304, 73, 770, 
-    544, 315, 416, 464, 925, 275, 327, 663, 808, 906, 36, 719, 733, 109, 240, 570, 
-    369, 518, 108, 354, 617, 688, 460, 566, 495, 20, 267, 319, 943, 282, 769, 679, 
-    488, 346, 33, 601, 56, 237, 501, 822, 123, 644, 566, 903, 1014, 35, 430, 386, 
-    388, 594, 593, 1010, 779, 292, 253, 996, 27, 458, 703, 455, 708, 152, 319, 128, 
-    674, 875, 581, 834, 328, 557, 975, 973, 47, 745, 266, 963, 639, 420, 319, 470, 
-    749, 863, 158, 640, 619, 920, 799, 6, 827, 89, 980, 11, 232, 555, 662, 196, 
-    641, 550, 971, 225, 375, 400, 168, 478, 437, 542, 532, 353, 367, 678, 990, 423, 
-    898, 258, 1006, 667, 220, 221, 121, 168, 376, 3, 837, 469, 198, 814, 346, 99, 
-    923, 804, 1018, 956, 567, 264, 514, 475, 164, 916, 245, 701, 573, 898, 346, 87, 
-    750, 5, 347, 450, 178, 459, 815, 89, 424, 593, 929, 10, 787, 648, 775, 736, 
-    695, 507, 765, 794, 222, 622, 796, 498, 966, 587, 32, 732, 707, 903, 195, 926, 
-    69, 76, 427, 714, 87, 115, 866, 393, 277, 496, 777, 378, 568, 106, 1005, 769, 
-    65, 1010, 433, 29, 98, 337, 686, 916, 903, 894, 626, 487, 37, 143, 864, 21, 
-    213, 670, 165, 832, 803, 388, 78, 735, 449, 963, 558, 702, 198, 700, 1011, 78, 
-    526, 66, 693, 357, 651, 374, 102, 221, 996, 652, 282, 267, 518, 582, 741, 254, 
-    984, 183, 700, 767, 174, 932, 252, 571, 100, 136, 677, 1007, 98, 756, 448, 905, 
-    362, 508, 299, 992, 802, 499, 244, 605, 1008, 610, 405, 663, 978, 122, 924, 579, 
-    250, 418, 41, 51, 756, 692, 714, 629, 441, 336, 824, 893, 807, 947, 857, 454, 
-    392, 202, 521, 54, 740, 272, 636, 497, 362, 560, 823, 734, 428, 703, 469, 607, 
-    284, 895, 877, 614, 328, 172, 789, 28, 208, 245, 448, 142, 428, 205, 804, 455, 
-    793, 726, 910, 947, 399, 611, 309, 941, 247, 888, 143, 767, 872, 730, 120, 347, 
-    673, 131, 331, 671, 469, 567, 236, 338, 901, 800, 426, 360, 926, 761, 887, 801, 
-    635, 46, 1021, 96, 760, 350, 62, 245, 608, 199, 803, 866, 285, 516, 79, 564, 
-    882, 77, 760, 915, 896, 562, 766, 82, 280, 750, 621, 227, 1023, 995, 780, 255, 
-    589, 619, 349, 197, 946, 307, 964, 243, 263, 256, 171, 62, 869, 327, 140, 85, 
-    1004, 73, 1006, 120, 266, 624, 290, 303, 847, 656, 195, 593, 858, 154, 798, 691, 
-    419, 487, 610, 910, 546, 118, 13, 458, 899, 899, 52, 790, 857, 772, 426, 205, 
-    373, 345, 977, 64, 852, 464, 155, 727, 785, 992, 997, 6, 769, 195, 329, 601, 
-    239, 507, 242, 736, 457, 480, 304, 423, 12, 845, 313, 289, 571, 763, 975, 815, 
-    119, 538, 964, 649, 857, 407, 359, 209, 970, 880, 453, 188, 597, 489, 399, 525, 
-    623, 674, 327, 511, 950, 149, 792, 611, 367, 470, 624, 449, 23, 560, 822, 569, 
-    408, 724, 687, 665, 78, 164, 565, 822, 64, 336, 752, 738, 237, 575, 831, 117, 
-    914, 887, 615, 802, 703, 798, 627, 171, 742, 200, 619, 883, 210, 486, 886, 240, 
-    960, 350, 81, 873, 810, 591, 162, 749, 649, 807, 657, 846, 40, 794, 850, 366, 
-    156, 29, 99, 312, 993, 882, 52, 384, 188, 785, 12, 821, 950, 853, 93, 771, 
-    485, 292, 438, 433, 483, 604, 581, 351, 425, 989, 810, 1018, 24, 51, 498, 806, 
-    222, 304, 1001, 303, 35, 332, 375, 599, 174, 62, 129, 707, 433, 741, 657, 638, 
-    140, 359, 928, 74, 288, 989, 542, 633, 395, 123, 624, 437, 775, 29, 1016, 304, 
-    148, 987, 513, 1001, 867, 1020, 673, 460, 235, 229, 958, 596, 690, 720, 675, 1007, 
-    279, 97, 621, 241, 907, 143, 923, 25, 526, 505, 892, 340, 904, 171, 209, 140, 
-    489, 911, 140, 1010, 777, 982, 33, 504, 225, 278, 842, 98, 41, 197, 689, 629, 
-    518, 752, 664, 769, 737, 68, 960, 231, 737, 890, 207, 325, 304, 40, 867, 76, 
-    295, 42, 918, 203, 948, 921, 1020, 874, 728, 422, 14, 571, 858, 98, 87, 781, 
-    622, 22, 379, 42, 193, 6, 862, 996, 406, 689, 734, 922, 322, 752, 225, 399, 
-    179, 867, 452, 830, 370, 1006, 360, 67, 525, 851, 730, 224, 990, 844, 281, 557, 
-    621, 228, 616, 861, 468, 565, 698, 310, 957, 888, 622, 72, 639, 124, 456, 725, 
-    169, 851, 820, 641, 942, 919, 889, 54, 983, 503, 291, 446, 775, 117, 564, 962, 
-    584, 483, 366, 465, 782, 928, 540, 312, 524, 938, 794, 777, 825, 819, 553, 342, 
-    42, 97, 161, 912, 508, 314, 690, 707, 23, 1016, 203, 214, 153, 934, 190, 580, 
-    528, 920, 924, 945, 82, 822, 20, 924, 876, 184, 416, 60, 96, 548, 732, 214, 
-    549, 704, 949, 903, 660, 863, 466, 311, 231, 717, 702, 25, 671, 897, 949, 783, 
-    247, 1021, 325, 552, 1008, 236, 340, 65, 821, 551, 224, 989, 186, 775, 910, 426, 
-    859, 528, 293, 883, 221, 925, 94, 928, 602, 316, 517, 964, 948, 661, 88, 964, 
-    313, 351, 423, 410, 902, 338, 540, 145, 949, 750, 884, 1005, 142, 900, 931, 296, 
-    576, 474, 960, 25, 864, 21, 516, 163, 330, 427, 850, 848, 197, 28, 41, 326, 
-    385, 822, 979, 798, 617, 814, 504, 526, 290, 462, 897, 241, 514, 594, 310, 135, 
-    387, 212, 599, 270, 179, 490, 215, 552, 101, 463, 989, 739, 516, 153, 382, 63, 
-    666, 513, 168, 413, 761, 416, 847, 952, 547, 438, 204, 604, 459, 82, 369, 266, 
-    397, 515, 809, 405, 997, 357, 357, 812, 78, 245, 303, 1012, 466, 660, 979, 676, 
-    702, 472, 651, 59, 904, 405, 994, 662, 355, 304, 912, 595, 157, 12, 987, 526, 
-    900, 1000, 142, 180, 147, 258, 180, 209, 261, 480, 721, 258, 319, 358, 642, 62, 
-    772, 542, 751, 477, 1022, 957, 521, 520, 798, 258, 937, 91, 572, 284, 670, 389, 
-    449, 47, 545, 744, 559, 123, 971, 770, 306, 277, 167, 887, 82, 935, 579, 839, 
-    821, 803, 1001, 814, 526, 194, 218, 230, 1019, 921, 868, 531, 18, 59, 2, 483, 
-    171, 789, 0, 339, 865, 225, 211, 983, 771, 476, 315, 847, 490, 932, 938, 978, 
-    907, 156, 386, 1001, 1014, 237, 222, 641, 159, 375, 582, 198, 824, 260, 937, 911, 
-    868, 313, 271, 23, 547, 145, 949, 336, 64, 962, 634, 127, 265, 592, 1011, 910, 
-    776, 80, 225, 303, 577, 904, 284, 103, 272, 390, 162, 210, 122, 6, 63, 262, 
-    267, 12, 632, 375, 411, 310, 188, 954, 13, 167, 122, 183, 807, 63, 333, 247, 
-    821, 57, 932, 561, 25, 860, 460, 534, 747, 92, 39, 353, 1021, 938, 66, 205, 
-    185, 970, 152, 91, 95, 437, 215, 562, 480, 88, 1016, 931, 38, 178, 668, 56, 
-    659, 369, 411, 485, 530, 988, 137, 807, 345, 480, 540, 887, 777, 776, 881, 838, 
-    399, 224, 637, 921, 419, 627, 1011, 701, 117, 459, 830, 54, 637, 935, 43, 216, 
-    860, 657, 8, 26, 162, 1, 168, 1018, 491, 459, 652, 492, 133, 541, 428, 983, 
-    197, 893, 754, 587, 802, 850, 654, 534, 609, 321, 878, 253, 606, 300, 291, 97, 
-    229, 977, 82, 63, 968, 723, 234, 84, 853, 250, 100, 193, 756, 605, 762, 651, 
-    928, 19, 765, 82, 183, 789, 979, 462, 653, 871, 200, 642, 952, 197, 150, 161, 
-    565, 948, 159, 180, 901, 113, 539, 434, 160, 399, 272, 266, 190, 419, 781, 710, 
-    217, 93, 427, 887, 70, 97, 436, 177, 632, 177, 753, 1005, 13, 717, 67, 442, 
-    884, 954, 825, 784, 338, 959, 190, 50, 958, 551, 975, 397, 819, 63, 311, 710, 
-    993, 228, 958, 92, 338, 19, 920, 246, 192, 433, 941, 858, 769, 393, 449, 746, 
-    268, 527, 44, 347, 186, 815, 891, 939, 266, 999, 143, 142, 477, 643, 368, 957, 
-    713, 716, 869, 271, 201, 124, 518, 7, 235, 28, 250, 637, 875, 566, 454, 260, 
-    1011, 500, 758, 529, 70, 259, 622, 17, 918, 574, 936, 22, 779, 783, 295, 519, 
-    541, 1018, 767, 891, 811, 750, 321, 676, 17, 366, 578, 711, 487, 782, 743, 367, 
-    318, 712, 420, 970, 76, 196, 634, 216, 579, 987, 411, 804, 442, 757, 120, 510, 
-    329, 85, 466, 253, 35, 192, 695, 547, 851, 281, 998, 549, 42, 193, 729, 696, 
-    803, 20, 448, 837, 422, 543, 706, 635, 491, 578, 424, 217, 107, 451, 663, 622, 
-    972, 44, 780, 695, 923, 769, 243, 902, 168, 850, 10, 30, 380, 644, 506, 80, 
-    786, 468, 213, 472, 973, 920, 432, 174, 180, 559, 894, 193, 27, 392, 35, 262, 
-    630, 1004, 183, 989, 704, 329, 130, 744, 994, 785, 411, 906, 753, 397, 850, 754, 
-    666, 262, 340, 540, 278, 362, 718, 986, 751, 226, 904, 192, 896, 211, 528, 151, 
-    980, 907, 460, 756, 200, 984, 508, 192, 915, 219, 267, 198, 747, 671, 822, 462, 
-    538, 764, 170, 141, 902, 665, 1014, 337, 763, 980, 789, 662, 504, 850, 604, 284, 
-    818, 171, 389, 4, 463, 1013, 130, 215, 424, 844, 955, 295, 288, 420, 839, 495, 
-    482, 348, 640, 59, 847, 478, 352, 241, 694, 966, 103, 716, 398, 80, 846, 719, 
-    618, 64, 608, 401, 991, 568, 492, 572, 11, 321, 259, 854, 849, 30, 373, 504, 
-    1016, 108, 965, 277, 389, 670, 165, 111, 971, 812, 865, 83, 608, 55, 466, 866, 
-    199, 51, 789, 315, 753, 107, 175, 19, 1018, 925, 370, 648, 363, 143, 813, 152, 
-    285, 294, 766, 121, 1002, 480, 360, 88, 10, 515, 462, 969, 66, 39, 285, 535, 
-    142, 185, 63, 596, 66, 397, 709, 994, 379, 958, 924, 269, 615, 595, 887, 453, 
-    932, 209, 509, 51, 744, 803, 177, 754, 309, 326, 879, 203, 999, 947, 163, 713, 
-    298, 1010, 200, 390, 831, 342, 383, 493, 9, 632, 872, 413, 458, 150, 705, 977, 
-    838, 987, 526, 298, 736, 949, 512, 645, 560, 728, 701, 142, 740, 625, 696, 540, 
-    37, 867, 482, 229, 28, 105, 85, 698, 561, 545, 218, 585, 1011, 298, 874, 187, 
-    515, 645, 89, 887, 842, 56, 872, 882, 614, 505, 602, 85, 343, 916, 47, 269, 
-    715, 329, 608, 805, 865, 320, 949, 606, 542, 225, 260, 568, 509, 95, 421, 683, 
-    243, 210, 685, 843, 104, 5, 97, 269, 379, 924, 28, 1023, 374, 784, 413, 903, 
-    760, 281, 946, 776, 824, 341, 75, 329, 3, 909, 368, 152, 407, 151, 63, 1, 
-    608, 123, 23, 598, 459, 941, 349, 21, 301, 370, 806, 116, 360, 179, 840, 885, 
-    932, 740, 566, 402, 603, 352, 456, 335, 976, 998, 371, 218, 616, 926, 877, 83, 
-    220, 94, 503, 35, 447, 478, 1009, 999, 254, 619, 819, 251, 461, 368, 873, 916, 
-    655, 913, 293, 537, 90, 872, 780, 864, 491, 768, 310, 272, 253, 140, 442, 923, 
-    406, 885, 854, 587, 586, 365, 899, 338, 403, 631, 806, 406, 182, 1008, 792, 549, 
-    362, 554, 120, 786, 340, 486, 650, 398, 104, 728, 240, 964, 273, 957, 590, 840, 
-    661, 198, 247, 174, 837, 846, 586, 414, 77, 854, 180, 491, 678, 77, 310, 177, 
-    374, 607, 1006, 266, 164, 637, 319, 821, 698, 18, 915, 499, 174, 715, 647, 887, 
-    965, 177, 367, 61, 467, 94, 787, 39, 225, 449, 153, 288, 509, 639, 794, 199, 
-    884, 16, 56, 108, 749, 746, 784, 733, 39, 752, 137, 803, 499, 172, 981, 582, 
-    1013, 58, 848, 798, 740, 381, 754, 86, 654, 161, 329, 422, 228, 41, 947, 447, 
-    626, 758, 594, 525, 594, 550, 175, 921, 794, 767, 699, 110, 834, 655, 749, 35, 
-    54, 927, 469, 357, 268, 140, 793, 830, 208, 910, 358, 78, 25, 17, 56, 255, 
-    531, 872, 612, 487, 598, 1020, 105, 247, 832, 743, 56, 781, 293, 515, 205, 838, 
-    1018, 841, 597, 916, 736, 679, 171, 402, 553, 687, 787, 288, 1016, 1001, 905, 901, 
-    685, 696, 84, 633, 151, 937, 823, 5, 761, 4, 880, 403, 22, 256, 628, 141, 
-    455, 808, 843, 457, 890, 211, 144, 114, 626, 370, 658, 33, 585, 822, 435, 846, 
-    353, 77, 466, 70, 417, 941, 394, 44, 680, 495, 790, 356, 792, 594, 654, 858, 
-    577, 861, 561, 556, 942, 70, 136, 248, 936, 476, 510, 38, 901, 428, 239, 481, 
-    631, 482, 655, 173, 462, 376, 940, 581, 103, 578, 333, 829, 735, 843, 335, 291, 
-    965, 441, 341, 239, 673, 833, 384, 974, 684, 328, 37, 777, 973, 547, 979, 650, 
-    601, 558, 148, 435, 660, 103, 416, 824, 703, 852, 20, 219, 510, 529, 832, 883, 
-    89, 738, 901, 887, 542, 903, 304, 774, 934, 249, 230, 598, 533, 522, 376, 617, 
-    158, 434, 507, 17, 290, 707, 949, 458, 772, 593, 124, 773, 397, 983, 55, 893, 
-    851, 869, 297, 911, 556, 900, 383, 749, 553, 771, 54, 58, 312, 495, 47, 115, 
-    952, 648, 574, 171, 590, 84, 280, 291, 112, 178, 405, 359, 312, 9, 812, 607, 
-    438, 663, 915, 260, 403, 552, 908, 259, 808, 947, 351, 215, 387, 291, 696, 135, 
-    152, 865, 953, 878, 615, 565, 522, 15, 241, 95, 821, 235, 788, 669, 380, 922, 
-    835, 518, 269, 522, 343, 99, 13, 62, 811, 6, 206, 144, 227, 347, 990, 409, 
-    571, 36, 752, 190, 681, 549, 798, 448, 766, 122, 644, 306, 955, 716, 428, 327, 
-    252, 218, 526, 667, 67, 257, 837, 1010, 142, 690, 391, 220, 640, 339, 689, 36, 
-    934, 762, 367, 923, 387, 59, 273, 984, 431, 148, 600, 78, 253, 24, 12, 748, 
-    592, 543, 400, 147, 495, 763, 843, 491, 20, 240, 953, 286, 717, 430, 288, 279, 
-    957, 315, 99, 106, 330, 467, 549, 455, 914, 985, 282, 765, 215, 518, 496, 552, 
-    158, 921, 259, 961, 182, 11, 164, 38, 188, 331, 538, 168, 979, 532, 788, 107, 
-    64, 128, 1018, 782, 9, 903, 686, 837, 481, 888, 351, 573, 696, 799, 517, 858, 
-    824, 907, 195, 75, 551, 716, 14, 465, 250, 879, 312, 58, 47, 166, 969, 511, 
-    852, 466, 795, 213, 141, 376, 636, 762, 48, 957, 744, 992, 531, 94, 403, 20, 
-    350, 679, 976, 169, 340, 26, 844, 325, 535, 487, 798, 465, 646, 840, 439, 766, 
-    569, 651, 416, 996, 476, 237, 121, 704, 434, 2, 585, 140, 675, 165, 748, 599, 
-    14, 382, 808, 405, 456, 359, 942, 729, 614, 883, 760, 508, 389, 891, 774, 317, 
-    682, 591, 895, 777, 305, 464, 265, 1021, 109, 403, 721, 239, 676, 36, 935, 827, 
-    923, 23, 917, 885, 382, 485, 737, 149, 420, 755, 479, 682, 534, 121, 908, 970, 
-    83, 21, 689, 1004, 875, 254, 342, 541, 472, 633, 693, 212, 529, 984, 862, 228, 
-    113, 689, 743, 673, 977, 14, 399, 966, 842, 822, 846, 77, 868, 204, 132, 285, 
-    308, 905, 625, 924, 666, 309, 443, 598, 920, 141, 801, 46, 352, 762, 887, 1018, 
-    268, 757, 214, 563, 116, 1017, 824, 504, 594, 984, 772, 325, 109, 201, 518, 27, 
-    763, 19, 671, 238, 1002, 900, 630, 81, 805, 970, 75, 122, 716, 164, 985, 680, 
-    441, 715, 970, 232, 50, 35, 404, 553, 290, 890, 416, 849, 1004, 117, 946, 866, 
-    92, 5, 286, 379, 495, 747, 582, 658, 364, 757, 168, 921, 230, 835, 627, 396, 
-    418, 998, 305, 6, 369, 792, 456, 613, 15, 741, 269, 277, 641, 582, 138, 912, 
-    595, 249, 863, 106, 527, 454, 633, 883, 816, 304, 258, 13, 291, 397, 900, 829, 
-    1010, 932, 368, 790, 929, 303, 815, 501, 90, 448, 582, 584, 1000, 179, 184, 160, 
-    312, 329, 860, 269, 957, 1007, 429, 72, 792, 399, 54, 551, 530, 208, 57, 274, 
-    941, 862, 530, 775, 1022, 634, 491, 263, 114, 316, 116, 483, 718, 954, 956, 508, 
-    285, 300, 740, 61, 202, 553, 511, 578, 82, 33, 608, 721, 538, 960, 997, 914, 
-    540, 492, 226, 350, 665, 231, 609, 464, 730, 731, 70, 471, 360, 484, 984, 759, 
-    77, 529, 287, 427, 921, 682, 99, 48, 859, 498, 972, 111, 600, 265, 402, 974, 
-    744, 827, 439, 516, 841, 871, 847, 909, 86, 660, 722, 922, 814, 419, 182, 605, 
-    498, 577, 282, 884, 618, 645, 160, 280, 959, 561, 994, 333, 29, 168, 428, 318, 
-    321, 82, 994, 525, 201, 238, 684, 661, 1022, 636, 414, 941, 972, 669, 735, 803, 
-    271, 529, 770, 861, 35, 824, 30, 545, 326, 299, 595, 248, 837, 888, 987, 742, 
-    730, 430, 857, 9, 541, 870, 614, 646, 358, 248, 884, 227, 715, 472, 236, 858, 
-    284, 562, 662, 45, 956, 170, 370, 282, 688, 17, 76, 98, 903, 85, 22, 622, 
-    668, 46, 187, 750, 368, 276, 761, 686, 295, 272, 719, 188, 518, 712, 912, 9, 
-    389, 318, 814, 125, 146, 920, 693, 370, 809, 239, 385, 820, 5, 281, 925, 917, 
-    98, 92, 110, 994, 514, 944, 370, 23, 858, 865, 669, 600, 785, 801, 1000, 387, 
-    134, 114, 1004, 98, 616, 848, 57, 205, 613, 697, 743, 386, 905, 148, 754, 561, 
-    367, 273, 895, 731, 257, 461, 36, 206, 564, 39, 893, 543, 1012, 512, 52, 786, 
-    264, 238, 109, 436, 380, 566, 136, 221, 933, 789, 452, 795, 881, 386, 188, 630, 
-    836, 440, 522, 742, 146, 511, 236, 199, 436, 412, 765, 593, 957, 313, 701, 493, 
-    698, 271, 568, 603, 977, 880, 453, 787, 562, 220, 620, 123, 628, 40, 742, 341, 
-    790, 966, 776, 486, 683, 761, 356, 916, 28, 692, 143, 544, 643, 46, 157, 541, 
-    708, 1007, 57, 991, 784, 612, 626, 199, 408, 129, 261, 226, 412, 530, 923, 332, 
-    426, 724, 869, 205, 868, 471, 88, 987, 204, 326, 756, 30, 695, 872, 196, 39, 
-    194, 522, 731, 592, 353, 165, 695, 898, 259, 652, 569, 80, 596, 578, 938, 131, 
-    444, 540, 703, 628, 698, 845, 520, 152, 925, 981, 525, 699, 890, 262, 768, 990, 
-    709, 806, 719, 934, 252, 421, 432, 180, 118, 861, 726, 101, 499, 1021, 202, 597, 
-    415, 241, 418, 994, 827, 667, 224, 398, 562, 615, 445, 851, 549, 298, 230, 516, 
-    994, 471, 186, 309, 1001, 780, 443, 157, 348, 375, 132, 210, 535, 738, 481, 970, 
-    100, 897, 197, 302, 791, 60, 76, 324, 259, 40, 822, 122, 843, 704, 405, 631, 
-    751, 729, 188, 101, 825, 547, 142, 264, 856, 152, 201, 588, 802, 617, 157, 286, 
-    264, 914, 1, 382, 119, 41, 252, 223, 270, 1000, 413, 623, 391, 77, 594, 653, 
-    979, 793, 733, 925, 589, 424, 567, 209, 780, 376, 559, 115, 487, 157, 913, 522, 
-    827, 966, 570, 817, 911, 421, 103, 354, 757, 436, 812, 10, 30, 594, 378, 854, 
-    508, 998, 410, 556, 724, 602, 523, 966, 660, 219, 844, 371, 801, 207, 38, 360, 
-    985, 229, 177, 687, 12, 772, 186, 770, 707, 240, 597, 268, 468, 635, 615, 314, 
-    633, 512, 565, 527, 622, 56, 307, 842, 401, 311, 484, 429, 369, 264, 237, 91, 
-    204, 30, 53, 843, 886, 467, 224, 75, 441, 752, 17, 553, 21, 183, 13, 444, 
-    65, 724, 617, 821, 328, 944, 226, 168, 400, 474, 523, 969, 981, 476, 517, 857, 
-    190, 266, 608, 485, 850, 56, 393, 108, 971, 781, 537, 768, 472, 8, 581, 414, 
-    98, 563, 364, 300, 387, 576, 766, 648, 826, 434, 390, 548, 899, 51, 360, 408, 
-    367, 421, 624, 790, 399, 521, 38, 597, 228, 311, 1020, 952, 274, 152, 151, 136, 
-    90, 738, 881, 577, 438, 817, 696, 218, 372, 852, 929, 689, 1011, 478, 670, 833, 
-    602, 57, 58, 1000, 823, 634, 273, 6, 105, 112, 623, 181, 555, 587, 238, 259, 
-    166, 216, 525, 471, 14, 653, 154, 57, 5, 12, 276, 736, 788, 15, 473, 801, 
-    344, 789, 428, 893, 819, 640, 634, 494, 405, 509, 1004, 68, 129, 777, 836, 207, 
-    1005, 738, 0, 39, 906, 1008, 288, 705, 355, 522, 712, 344, 435, 685, 586, 110, 
-    798, 451, 178, 578, 950, 972, 292, 231, 555, 298, 835, 760, 1001, 571, 1012, 437, 
-    54, 154, 423, 128, 465, 441, 292, 311, 317, 226, 262, 541, 404, 841, 1003, 332, 
-    280, 634, 98, 721, 50, 607, 737, 920, 208, 654, 45, 1017, 50, 612, 303, 10, 
-    808, 401, 34, 122, 63, 872, 344, 744, 360, 118, 503, 738, 192, 292, 886, 845, 
-    916, 162, 675, 492, 633, 522, 15, 967, 411, 393, 614, 608, 21, 588, 92, 327, 
-    111, 932, 612, 864, 510, 631, 466, 843, 707, 596, 263, 861, 354, 327, 250, 357, 
-    178, 802, 81, 385, 856, 907, 487, 508, 626, 377, 758, 963, 903, 345, 417, 189, 
-    438, 335, 589, 736, 924, 244, 513, 449, 1005, 669, 478, 883, 492, 1019, 733, 338, 
-    681, 176, 516, 104, 541, 116, 273, 917, 770, 170, 168, 367, 925, 95, 1010, 878, 
-    241, 975, 818, 412, 193, 740, 22, 9, 360, 938, 547, 943, 201, 203, 174, 376, 
-    155, 955, 545, 530, 391, 561, 471, 52, 324, 360, 502, 604, 900, 337, 624, 805, 
-    902, 323, 77, 265, 126, 1007, 676, 756, 226, 543, 283, 841, 91, 272, 158, 1012, 
-    636, 458, 121, 465, 674, 941, 74, 750, 735, 588, 54, 766, 537, 57, 693, 51, 
-    632, 58, 561, 583, 47, 626, 600, 122, 732, 239, 765, 432, 645, 379, 679, 527, 
-    677, 840, 761, 750, 691, 23, 906, 536, 317, 163, 130, 405, 64, 367, 430, 199, 
-    305, 692, 674, 750, 591, 595, 631, 273, 643, 669, 870, 6, 677, 990, 467, 253, 
-    140, 570, 328, 886, 734, 16, 646, 409, 269, 234, 492, 354, 290, 414, 946, 163, 
-    138, 267, 936, 593, 45, 249, 751, 513, 751, 43, 411, 355, 311, 769, 899, 415, 
-    353, 304, 731, 257, 452, 670, 465, 193, 636, 478, 357, 721, 105, 194, 175, 907, 
-    114, 534, 509, 858, 544, 229, 25, 546, 651, 491, 631, 668, 563, 627, 597, 848, 
-    533, 678, 743, 99, 28, 513, 406, 498, 478, 432, 894, 758, 908, 569, 582, 362, 
-    853, 750, 184, 139, 671, 749, 544, 461, 625, 688, 449, 480, 975, 629, 713, 758, 
-    453, 457, 227, 709, 851, 585, 918, 347, 481, 198, 685, 271, 266, 436, 340, 227, 
-    1019, 841, 386, 473, 19, 323, 47, 835, 326, 571, 530, 987, 484, 84, 291, 173, 
-    607, 138, 365, 528, 989, 232, 709, 406, 460, 486, 701, 312, 372, 483, 491, 998, 
-    794, 164, 1004, 187, 602, 555, 33, 27, 788, 224, 277, 266, 171, 1, 778, 1008, 
-    526, 582, 88, 320, 695, 540, 156, 474, 223, 433, 302, 124, 654, 717, 193, 659, 
-    451, 108, 749, 175, 204, 755, 732, 177, 200, 867, 910, 261, 905, 263, 447, 922, 
-    545, 781, 134, 956, 514, 764, 220, 179, 726, 941, 51, 758, 831, 228, 698, 140, 
-    213, 139, 763, 25, 688, 408, 440, 805, 933, 995, 555, 948, 412, 137, 35, 324, 
-    488, 272, 556, 462, 814, 732, 200, 713, 168, 1023, 317, 480, 440, 341, 288, 652, 
-    495, 456, 246, 374, 167, 977, 825, 467, 152, 329, 189, 453, 519, 245, 782, 965, 
-    406, 672, 323, 69, 15, 828, 237, 705, 146, 828, 293, 54, 786, 704, 498, 919, 
-    309, 629, 953, 881, 26, 274, 743, 108, 311, 769, 973, 256, 269, 804, 813, 90, 
-    596, 389, 814, 871, 698, 799, 402, 764, 548, 834, 139, 879, 580, 84, 505, 994, 
-    37, 859, 810, 339, 776, 879, 600, 640, 169, 579, 135, 889, 284, 179, 431, 561, 
-    882, 445, 136, 515, 786, 455, 950, 394, 23, 641, 640, 958, 73, 424, 841, 147, 
-    445, 239, 807, 874, 84, 472, 272, 931, 878, 156, 933, 52, 680, 562, 481, 163, 
-    467, 269, 917, 672, 165, 530, 528, 836, 302, 15, 991, 432, 8, 988, 913, 963, 
-    300, 520, 914, 358, 165, 464, 269, 995, 338, 974, 677, 932, 129, 322, 752, 912, 
-    615, 169, 404, 879, 875, 668, 474, 67, 664, 577, 152, 970, 744, 344, 123, 345, 
-    205, 445, 165, 299, 424, 929, 902, 814, 194, 701, 190, 922, 130, 527, 659, 797, 
-    777, 30, 152, 43, 1016, 168, 32, 561, 327, 897, 199, 298, 625, 162, 572, 341, 
-    149, 699, 231, 728, 396, 310, 230, 378, 465, 799, 30, 851, 776, 175, 419, 938, 
-    692, 33, 69, 555, 632, 407, 478, 467, 935, 170, 759, 583, 320, 71, 907, 792, 
-    865, 310, 206, 87, 599, 342, 677, 115, 224, 611, 364, 454, 1022, 157, 1010, 554, 
-    17, 840, 53, 794, 323, 693, 82, 525, 627, 494, 759, 720, 189, 506, 69, 277, 
-    1019, 989, 20, 567, 957, 666, 784, 86, 819, 390, 54, 812, 150, 721, 969, 609, 
-    550, 849, 905, 371, 88, 50, 473, 31, 916, 490, 440, 772, 531, 898, 14, 858, 
-    2, 234, 59, 285, 828, 795, 448, 409, 250, 168, 529, 170, 142, 461, 424, 306, 
-    517, 7, 299, 39, 637, 73, 157, 133, 415, 571, 777, 40, 713, 753, 306, 944, 
-    604, 115, 396, 492, 976, 169, 481, 242, 177, 618, 637, 729, 980, 625, 229, 277, 
-    454, 48, 158, 72, 942, 146, 370, 916, 676, 641, 980, 583, 293, 154, 997, 666, 
-    558, 594, 924, 202, 189, 348, 446, 892, 36, 1021, 418, 831, 971, 37, 411, 105, 
-    816, 21, 682, 494, 603, 227, 851, 493, 566, 365, 312, 228, 608, 711, 741, 334, 
-    766, 61, 532, 99, 178, 692, 874, 740, 96, 963, 488, 928, 322, 791, 864, 918, 
-    207, 627, 762, 771, 518, 827, 936, 209, 909, 994, 522, 770, 618, 760, 60, 710, 
-    879, 865, 828, 67, 728, 336, 483, 216, 150, 433, 781, 941, 295, 323, 724, 596, 
-    93, 511, 731, 465, 736, 936, 620, 71, 457, 418, 572, 787, 523, 515, 914, 262, 
-    871, 592, 611, 552, 883, 345, 56, 287, 407, 988, 128, 747, 1001, 625, 212, 454, 
-    53, 636, 721, 997, 774, 773, 751, 761, 115, 124, 346, 594, 631, 145, 480, 370, 
-    981, 121, 512, 165, 475, 995, 998, 392, 715, 299, 198, 262, 672, 786, 861, 81, 
-    179, 19, 110, 907, 138, 654, 660, 154, 830, 717, 749, 709, 263, 991, 261, 480, 
-    928, 588, 690, 593, 695, 46, 155, 31, 848, 677, 556, 68, 419, 687, 954, 365, 
-    452, 764, 662, 322, 289, 942, 696, 62, 600, 199, 69, 561, 355, 558, 145, 101, 
-    786, 535, 797, 837, 305, 15, 990, 456, 172, 165, 782, 641, 210, 797, 615, 194, 
-    563, 477, 816, 129, 87, 178, 306, 731, 579, 249, 430, 787, 813, 530, 540, 313, 
-    757, 262, 884, 838, 578, 714, 989, 164, 686, 675, 264, 544, 764, 885, 858, 561, 
-    966, 1021, 726, 543, 798, 13, 86, 709, 819, 615, 563, 761, 912, 106, 83, 745, 
-    479, 185, 100, 734, 737, 106, 176, 256, 774, 138, 113, 536, 822, 607, 240, 532, 
-    539, 265, 803, 716, 460, 580, 167, 426, 467, 1018, 793, 300, 177, 176, 614, 856, 
-    815, 879, 880, 847, 648, 816, 707, 959, 12, 155, 543, 970, 260, 631, 480, 789, 
-    798, 536, 128, 297, 444, 10, 336, 416, 269, 68, 65, 215, 952, 108, 466, 261, 
-    597, 247, 148, 569, 50, 132, 487, 971, 571, 505, 383, 889, 702, 338, 211, 801, 
-    921, 988, 875, 224, 674, 172, 520, 291, 728, 923, 538, 74, 469, 645, 399, 743, 
-    611, 770, 63, 486, 816, 411, 493, 1022, 259, 883, 673, 950, 390, 577, 927, 160, 
-    289, 554, 522, 668, 558, 875, 59, 1020, 648, 424, 628, 1021, 646, 503, 65, 852, 
-    398, 745, 163, 469, 676, 798, 204, 470, 963, 889, 962, 586, 910, 749, 745, 398, 
-    852, 418, 130, 945, 499, 421, 104, 267, 329, 994, 988, 15, 14, 527, 295, 280, 
-    71, 76, 884, 808, 364, 50, 352, 196, 697, 745, 943, 748, 516, 143, 765, 88, 
-    12, 147, 364, 312, 688, 900, 490, 127, 540, 167, 742, 867, 553, 462, 531, 179, 
-    981, 13, 443, 231, 317, 824, 478, 729, 780, 130, 623, 226, 545, 528, 335, 401, 
-    370, 184, 431, 862, 67, 1015, 540, 518, 234, 737, 779, 216, 647, 506, 488, 796, 
-    944, 309, 662, 95, 155, 862, 142, 968, 369, 718, 453, 655, 708, 210, 150, 403, 
-    23, 229, 50, 387, 732, 728, 720, 577, 195, 790, 448, 271, 364, 892, 199, 876, 
-    838, 771, 403, 342, 589, 320, 700, 647, 607, 206, 486, 241, 464, 923, 580, 72, 
-    385, 965, 998, 403, 100, 663, 393, 705, 370, 151, 550, 468, 49, 400, 892, 195, 
-    663, 747, 766, 984, 837, 381, 716, 817, 760, 297, 434, 774, 748, 577, 271, 705, 
-    211, 865, 503, 76, 455, 93, 121, 901, 1009, 709, 785, 562, 806, 81, 215, 246, 
-    1002, 442, 282, 541, 162, 322, 710, 269, 89, 415, 84, 204, 30, 185, 883, 863, 
-    151, 641, 451, 695, 748, 864, 828, 424, 137, 136, 573, 49, 754, 508, 343, 183, 
-    658, 599, 1015, 707, 758, 923, 296, 707, 796, 443, 611, 692, 907, 370, 293, 378, 
-    513, 625, 733, 16, 479, 26, 264, 657, 541, 136, 853, 835, 457, 864, 93, 442, 
-    851, 25, 1, 354, 208, 858, 255, 729, 170, 260, 44, 955, 105, 945, 820, 745, 
-    357, 875, 571, 862, 860, 376, 703, 915, 881, 743, 924, 923, 676, 890, 957, 523, 
-    183, 711, 790, 110, 22, 423, 630, 718, 989, 720, 413, 981, 283, 749, 929, 840, 
-    517, 298, 370, 860, 242, 600, 774, 636, 995, 223, 1010, 390, 978, 536, 792, 252, 
-    491, 939, 436, 959, 328, 5, 941, 348, 1017, 230, 305, 848, 992, 491, 905, 187, 
-    889, 256, 473, 834, 714, 445, 52, 342, 131, 46, 714, 788, 624, 402, 382, 80, 
-    639, 271, 212, 460, 333, 1000, 671, 519, 806, 120, 822, 172, 215, 665, 190, 819, 
-    511, 943, 144, 183, 956, 455, 343, 217, 435, 74, 798, 648, 479, 206, 47, 442, 
-    901, 354, 538, 252, 471, 899, 528, 899, 137, 720, 252, 185, 269, 975, 978, 985, 
-    338, 51, 808, 104, 119, 917, 350, 451, 16, 803, 673, 14, 449, 138, 178, 489, 
-    919, 702, 93, 613, 334, 732, 536, 588, 554, 321, 1019, 122, 109, 796, 319, 981, 
-    245, 582, 0, 851, 194, 197, 152, 53, 281, 1018, 315, 500, 208, 590, 801, 636, 
-    931, 1013, 857, 119, 487, 883, 517, 727, 974, 397, 176, 494, 586, 294, 986, 631, 
-    723, 535, 643, 245, 790, 132, 656, 1021, 671, 433, 737, 953, 960, 212, 436, 526, 
-    557, 578, 96, 755, 703, 818, 798, 559, 489, 390, 762, 25, 267, 793, 269, 43, 
-    379, 555, 856, 929, 614, 72, 19, 432, 887, 668, 811, 662, 712, 83, 753, 407, 
-    598, 60, 847, 1006, 125, 563, 979, 165, 272, 255, 334, 308, 984, 385, 751, 68, 
-    863, 810, 349, 616, 994, 923, 255, 228, 783, 1009, 519, 596, 871, 531, 39, 921, 
-    567, 21, 955, 704, 623, 219, 75, 958, 784, 170, 175, 457, 377, 332, 883, 552, 
-    75, 508, 324, 211, 697, 665, 6, 903, 175, 979, 71, 647, 591, 4, 469, 715, 
-    132, 564, 11, 639, 106, 771, 941, 654, 151, 796, 893, 146, 449, 579, 351, 746, 
-    759, 475, 202, 620, 583, 598, 33, 186, 579, 153, 759, 515, 139, 210, 948, 48, 
-    379, 28, 561, 912, 937, 149, 645, 910, 319, 415, 122, 66, 744, 691, 485, 1005, 
-    270, 624, 243, 571, 306, 128, 371, 598, 609, 236, 931, 663, 54, 987, 981, 863, 
-    109, 590, 782, 763, 348, 439, 295, 512, 710, 138, 647, 692, 373, 632, 516, 699, 
-    438, 540, 389, 52, 1018, 639, 355, 815, 510, 327, 866, 777, 697, 403, 593, 891, 
-    316, 615, 905, 977, 914, 298, 539, 271, 860, 613, 870, 394, 657, 446, 144, 577, 
-    741, 235, 45, 256, 46, 690, 883, 36, 810, 991, 874, 988, 271, 289, 591, 703, 
-    532, 350, 293, 802, 1001, 364, 140, 736, 235, 42, 818, 844, 473, 566, 293, 556, 
-    895, 472, 880, 60, 713, 604, 851, 809, 237, 674, 711, 100, 210, 406, 909, 786, 
-    717, 415, 78, 189, 614, 575, 275, 238, 713, 637, 84, 740, 623, 587, 792, 346, 
-    4, 916, 934, 426, 826, 492, 61, 363, 235, 58, 695, 682, 9, 350, 968, 245, 
-    104, 503, 39, 175, 794, 927, 962, 666, 666, 812, 703, 721, 476, 690, 32, 840, 
-    487, 543, 568, 324, 620, 548, 646, 267, 1014, 126, 121, 488, 958, 136, 73, 987, 
-    980, 180, 4, 318, 170, 455, 49, 1002, 533, 506, 907, 815, 276, 970, 686, 825, 
-    891, 115, 905, 798, 669, 162, 957, 251, 649, 268, 511, 834, 940, 166, 504, 1021, 
-    638, 449, 347, 284, 58, 812, 513, 927, 744, 708, 141, 300, 642, 928, 426, 413, 
-    851, 114, 370, 405, 545, 1022, 595, 1022, 592, 954, 247, 644, 131, 254, 264, 162, 
-    716, 934, 342, 85, 607, 112, 526, 71, 844, 1003, 374, 541, 540, 235, 940, 219, 
-    386, 784, 650, 822, 519, 70, 415, 315, 914, 407, 717, 52, 82, 124, 1011, 438, 
-    709, 558, 245, 115, 816, 812, 120, 293, 562, 230, 758, 59, 620, 434, 699, 899, 
-    1015, 126, 648, 982, 837, 909, 415, 380, 552, 601, 934, 322, 313, 622, 782, 222, 
-    462, 871, 626, 487, 296, 188, 159, 608, 30, 505, 54, 199, 596, 330, 16, 224, 
-    599, 563, 795, 919, 492, 980, 759, 679, 833, 351, 413, 353, 564, 113, 844, 173, 
-    89, 574, 493, 92, 917, 131, 495, 189, 705, 758, 698, 454, 420, 915, 565, 602, 
-    503, 351, 754, 871, 98, 637, 785, 499, 460, 251, 880, 131, 1023, 531, 701, 588, 
-    319, 444, 28, 805, 284, 383, 281, 859, 53, 587, 451, 481, 136, 240, 157, 412, 
-    868, 68, 472, 31, 93, 117, 336, 238, 849, 824, 1012, 621, 819, 749, 789, 539, 
-    423, 674, 237, 863, 194, 815, 555, 964, 639, 821, 998, 126, 955, 138, 7, 215, 
-    910, 715, 769, 220, 838, 914, 5, 122, 367, 913, 705, 196, 285, 886, 327, 775, 
-    205, 924, 347, 632, 972, 433, 88, 259, 771, 820, 501, 331, 510, 414, 563, 206, 
-    619, 40, 577, 966, 453, 781, 438, 596, 87, 171, 565, 115, 773, 918, 182, 463, 
-    562, 147, 930, 878, 294, 266, 335, 761, 152, 728, 78, 874, 603, 731, 122, 665, 
-    837, 71, 596, 248, 386, 925, 545, 959, 781, 685, 948, 324, 895, 278, 462, 561, 
-    75, 309, 141, 152, 1022, 621, 60, 974, 542, 942, 899, 471, 411, 500, 24, 2, 
-    437, 667, 125, 915, 675, 451, 576, 518, 46, 996, 726, 379, 501, 940, 532, 646, 
-    382, 711, 165, 230, 102, 381, 600, 726, 706, 977, 61, 471, 51, 216, 698, 57, 
-    283, 406, 843, 560, 302, 638, 0, 19, 382, 856, 568, 10, 793, 897, 774, 277, 
-    966, 34, 182, 304, 231, 184, 425, 115, 765, 342, 801, 135, 517, 368, 807, 691, 
-    759, 827, 918, 383, 841, 791, 595, 489, 704, 974, 934, 826, 730, 301, 810, 235, 
-    924, 347, 144, 753, 76, 583, 618, 155, 591, 1012, 118, 49, 16, 318, 620, 976, 
-    246, 587, 505, 499, 160, 209, 481, 413, 439, 776, 421, 599, 792, 346, 519, 955, 
-    94, 555, 889, 553, 502, 963, 721, 234, 66, 635, 242, 493, 44, 896, 753, 874, 
-    8, 740, 735, 961, 391, 623, 1003, 418, 984, 287, 182, 174, 285, 104, 243, 36, 
-    936, 802, 531, 968, 59, 778, 227, 191, 667, 908, 766, 935, 41, 690, 955, 963, 
-    119, 87, 67, 363, 106, 259, 930, 143, 837, 659, 314, 892, 300, 261, 614, 636, 
-    829, 78, 105, 958, 658, 530, 751, 780, 502, 13, 835, 988, 202, 687, 200, 950, 
-    940, 304, 528, 134, 108, 580, 647, 159, 44, 924, 238, 480, 458, 1012, 234, 141, 
-    358, 564, 903, 130, 359, 173, 1002, 959, 318, 28, 780, 55, 835, 189, 387, 459, 
-    540, 755, 494, 101, 275, 883, 506, 807, 292, 945, 781, 543, 698, 139, 867, 362, 
-    757, 237, 154, 63, 760, 958, 422, 999, 346, 369, 64, 893, 617, 581, 281, 781, 
-    622, 532, 96, 277, 80, 35, 227, 987, 299, 473, 696, 203, 585, 56, 672, 52, 
-    940, 195, 809, 282, 891, 129, 296, 730, 780, 725, 710, 921, 723, 803, 340, 195, 
-    486, 823, 321, 328, 149, 681, 647, 369, 423, 362, 102, 316, 80, 29, 257, 366, 
-    909, 680, 712, 353, 785, 196, 83, 45, 16, 13, 381, 793, 347, 740, 256, 595, 
-    948, 562, 865, 911, 919, 547, 833, 877, 530, 712, 454, 973, 358, 1006, 584, 367, 
-    282, 322, 926, 842, 863, 442, 271, 789, 643, 215, 472, 763, 774, 567, 848, 195, 
-    481, 997, 538, 339, 262, 988, 719, 674, 436, 901, 640, 549, 737, 844, 265, 182, 
-    835, 913, 155, 893, 279, 627, 522, 597, 893, 455, 362, 281, 191, 921, 674, 446, 
-    42, 170, 638, 734, 13, 711, 919, 730, 361, 169, 890, 157, 837, 664, 669, 351, 
-    184, 391, 1011, 458, 737, 802, 191, 407, 42, 517, 758, 534, 720, 747, 990, 775, 
-    571, 662, 318, 465, 214, 254, 984, 938, 84, 88, 656, 826, 920, 447, 788, 561, 
-    738, 374, 989, 495, 159, 240, 237, 733, 693, 125, 330, 480, 204, 736, 21, 243, 
-    53, 681, 724, 77, 82, 312, 862, 565, 586, 367, 611, 676, 84, 808, 172, 518, 
-    493, 920, 720, 121, 316, 701, 510, 672, 929, 257, 632, 294, 237, 333, 546, 704, 
-    389, 770, 978, 857, 832, 894, 686, 93, 29, 820, 504, 985, 343, 920, 33, 687, 
-    468, 627, 661, 672, 112, 963, 1020, 664, 442, 33, 1019, 186, 200, 997, 636, 113, 
-    551, 403, 724, 339, 150, 872, 603, 827, 380, 660, 511, 1015, 735, 662, 850, 385, 
-    52, 21, 690, 326, 718, 3, 979, 70, 735, 464, 238, 125, 356, 711, 147, 809, 
-    774, 517, 928, 351, 782, 629, 693, 573, 263, 982, 976, 236, 523, 506, 537, 879, 
-    700, 434, 435, 942, 50, 891, 334, 106, 779, 213, 770, 101, 70, 477, 935, 519, 
-    981, 341, 445, 256, 1003, 583, 993, 428, 188, 272, 970, 68, 1004, 984, 14, 974, 
-    545, 809, 972, 201, 387, 867, 644, 331, 736, 155, 920, 855, 545, 288, 523, 675, 
-    265, 591, 334, 395, 513, 13, 452, 16, 104, 626, 182, 730, 965, 736, 224, 118, 
-    280, 530, 968, 170, 997, 218, 620, 150, 867, 330, 610, 435, 464, 909, 13, 439, 
-    953, 400, 722, 362, 1010, 119, 320, 789, 934, 4, 481, 820, 743, 776, 404, 814, 
-    424, 122, 677, 575, 439, 477, 886, 978, 86, 541, 76, 834, 11, 275, 729, 907, 
-    761, 506, 199, 321, 341, 180, 1016, 651, 712, 110, 548, 660, 265, 840, 531, 17, 
-    182, 350, 124, 676, 263, 492, 1005, 869, 636, 345, 471, 333, 281, 506, 280, 873, 
-    292, 206, 555, 209, 11, 386, 860, 710, 3, 279, 370, 433, 726, 389, 919, 647, 
-    960, 674, 522, 934, 343, 593, 362, 724, 736, 766, 618, 150, 357, 25, 331, 548, 
-    59, 458, 155, 735, 720, 662, 37, 891, 468, 799, 787, 584, 575, 8, 1014, 360, 
-    781, 233, 431, 539, 223, 361, 566, 653, 450, 194, 385, 411, 272, 750, 316, 491, 
-    108, 179, 707, 25, 77, 595, 405, 418, 729, 34, 182, 929, 603, 443, 120, 729, 
-    577, 17, 727, 839, 405, 284, 335, 793, 28, 842, 536, 879, 714, 399, 64, 760, 
-    931, 971, 141, 953, 24, 18, 390, 726, 674, 566, 784, 201, 493, 167, 926, 283, 
-    65, 629, 375, 864, 783, 891, 596, 432, 125, 128, 931, 112, 201, 504, 1003, 281, 
-    782, 427, 735, 865, 877, 286, 425, 575, 731, 275, 121, 954, 559, 638, 41, 775, 
-    522, 590, 786, 963, 320, 588, 111, 859, 60, 100, 756, 421, 909, 138, 307, 891, 
-    658, 798, 563, 365, 514, 454, 541, 666, 950, 2, 424, 765, 827, 433, 765, 658, 
-    950, 851, 548, 236, 263, 33, 829, 697, 298, 515, 868, 493, 369, 553, 417, 75, 
-    737, 401, 640, 497, 358, 513, 384, 621, 144, 614, 804, 748, 370, 906, 653, 448, 
-    227, 851, 780, 2, 962, 149, 878, 912, 934, 925, 244, 958, 971, 1000, 1011, 840, 
-    242, 382, 932, 33, 213, 318, 810, 336, 707, 469, 973, 813, 226, 867, 870, 853, 
-    595, 543, 71, 876, 1005, 66, 175, 734, 576, 750, 41, 932, 476, 95, 1005, 568, 
-    501, 141, 490, 908, 764, 806, 940, 230, 604, 920, 309, 384, 601, 961, 2, 902, 
-    741, 162, 954, 532, 313, 910, 794, 626, 784, 406, 683, 267, 612, 404, 753, 350, 
-    205, 437, 299, 454, 344, 539, 999, 96, 58, 343, 342, 506, 449, 901, 347, 294, 
-    811, 846, 162, 15, 466, 911, 314, 1015, 156, 209, 953, 529, 126, 375, 276, 830, 
-    585, 431, 799, 819, 751, 325, 405, 382, 424, 22, 752, 589, 909, 335, 649, 554, 
-    762, 253, 871, 498, 987, 402, 227, 661, 460, 185, 162, 634, 444, 653, 595, 37, 
-    776, 586, 58, 231, 6, 624, 717, 437, 1003, 831, 365, 50, 900, 623, 68, 234, 
-    659, 376, 564, 763, 579, 949, 408, 138, 129, 629, 479, 574, 589, 120, 421, 437, 
-    136, 60, 649, 810, 94, 430, 187, 1017, 266, 444, 831, 425, 465, 390, 784, 260, 
-    702, 464, 861, 582, 247, 71, 918, 126, 555, 40, 593, 669, 181, 511, 6, 686, 
-    576, 997, 110, 57, 639, 25, 551, 541, 475, 534, 604, 1020, 903, 163, 426, 672, 
-    518, 32, 912, 626, 403, 443, 674, 344, 323, 48, 329, 275, 594, 245, 8, 128, 
-    509, 727, 746, 796, 887, 833, 223, 257, 505, 231, 265, 243, 84, 116, 934, 160, 
-    440, 1001, 317, 249, 880, 1009, 17, 154, 357, 239, 699, 169, 252, 641, 650, 195, 
-    779, 613, 55, 73, 993, 328, 599, 796, 838, 284, 723, 560, 195, 217, 194, 430, 
-    421, 321, 432, 789, 848, 385, 141, 25, 789, 416, 434, 357, 914, 558, 445, 407, 
-    403, 819, 51, 138, 316, 581, 374, 235, 723, 245, 805, 654, 711, 627, 157, 271, 
-    406, 794, 9, 472, 554, 602, 497, 284, 415, 883, 462, 767, 613, 335, 389, 1010, 
-    813, 440, 864, 345, 89, 700, 12, 661, 368, 332, 435, 253, 849, 759, 271, 536, 
-    710, 290, 892, 827, 702, 109, 444, 665, 266, 843, 529, 1023, 172, 155, 23, 583, 
-    816, 49, 278, 359, 690, 918, 365, 980, 1022, 501, 536, 712, 682, 617, 399, 392, 
-    720, 394, 892, 29, 18, 337, 695, 991, 816, 597, 737, 981, 272, 102, 180, 381, 
-    887, 272, 587, 110, 346, 62, 670, 585, 498, 222, 564, 23, 952, 71, 788, 1004, 
-    765, 320, 754, 356, 869, 768, 429, 48, 214, 864, 907, 926, 379, 340, 688, 82, 
-    430, 859, 84, 215, 884, 845, 587, 53, 392, 44, 414, 278, 504, 1000, 604, 76, 
-    159, 167, 159, 916, 144, 214, 548, 778, 394, 626, 54, 445, 266, 512, 1013, 264, 
-    813, 413, 751, 343, 1, 225, 723, 902, 982, 16, 822, 124, 375, 760, 125, 507, 
-    220, 742, 707, 503, 495, 557, 54, 860, 356, 311, 1000, 371, 610, 444, 707, 552, 
-    605, 811, 734, 77, 580, 513, 507, 886, 22, 1009, 231, 920, 478, 581, 857, 525, 
-    440, 279, 236, 541, 382, 98, 455, 936, 359, 591, 128, 127, 494, 800, 499, 649, 
-    307, 1001, 995, 163, 102, 306, 731, 932, 990, 479, 276, 62, 559, 578, 481, 314, 
-    155, 473, 868, 697, 628, 732, 601, 452, 542, 706, 196, 703, 814, 14, 487, 1012, 
-    461, 660, 815, 687, 398, 591, 10, 386, 815, 264, 909, 279, 13, 403, 546, 171, 
-    536, 707, 717, 681, 594, 975, 264, 12, 687, 448, 148, 483, 835, 213, 9, 308, 
-    817, 229, 849, 241, 762, 37, 216, 280, 161, 738, 532, 950, 518, 878, 704, 224, 
-    715, 537, 728, 192, 586, 513, 881, 944, 144, 893, 780, 210, 1, 969, 772, 922, 
-    18, 538, 851, 670, 951, 388, 301, 829, 935, 811, 672, 527, 763, 53, 76, 271, 
-    882, 597, 919, 380, 353, 416, 482, 971, 959, 287, 828, 411, 942, 585, 975, 198, 
-    301, 788, 180, 19, 934, 0, 461, 427, 194, 241, 613, 600, 382, 575, 64, 19, 
-    30, 87, 623, 238, 793, 599, 241, 1009, 849, 130, 364, 10, 620, 871, 377, 977, 
-    386, 178, 456, 158, 173, 610, 1009, 408, 726, 292, 559, 323, 409, 531, 614, 121, 
-    1008, 624, 747, 826, 47, 670, 148, 520, 79, 575, 204, 325, 885, 166, 801, 750, 
-    456, 991, 9, 602, 398, 970, 235, 451, 941, 787, 461, 959, 298, 220, 487, 687, 
-    992, 695, 915, 580, 483, 253, 278, 564, 30, 214, 933, 925, 483, 127, 80, 484, 
-    17, 673, 770, 136, 139, 791, 53, 396, 243, 982, 408, 798, 453, 984, 471, 281, 
-    250, 679, 308, 388, 196, 1005, 49, 294, 970, 633, 407, 193, 128, 723, 743, 997, 
-    460, 955, 523, 624, 666, 168, 644, 904, 959, 236, 624, 994, 845, 794, 383, 9, 
-    666, 302, 245, 969, 904, 711, 12, 494, 396, 344, 43, 953, 505, 273, 711, 424, 
-    928, 255, 332, 309, 899, 404, 146, 176, 86, 80, 169, 935, 234, 777, 509, 920, 
-    376, 898, 84, 848, 419, 952, 297, 322, 996, 188, 143, 198, 125, 519, 156, 168, 
-    330, 363, 937, 853, 78, 861, 302, 78, 297, 630, 126, 881, 460, 773, 664, 216, 
-    317, 458, 750, 896, 115, 816, 65, 395, 331, 745, 104, 1004, 855, 806, 481, 15, 
-    211, 304, 684, 788, 421, 215, 58, 338, 886, 627, 746, 271, 131, 990, 398, 238, 
-    1014, 411, 1023, 895, 660, 594, 127, 948, 319, 956, 451, 698, 750, 878, 229, 946, 
-    999, 204, 186, 886, 796, 589, 873, 778, 99, 83, 441, 825, 230, 657, 313, 570, 
-    906, 393, 794, 951, 359, 561, 578, 257, 503, 515, 621, 327, 457, 561, 554, 256, 
-    865, 498, 824, 388, 187, 533, 179, 75, 1000, 249, 255, 850, 872, 36, 458, 95, 
-    1017, 624, 485, 188, 126, 553, 913, 508, 374, 394, 1012, 61, 474, 230, 680, 866, 
-    577, 778, 699, 588, 299, 208, 297, 433, 143, 514, 556, 330, 945, 245, 310, 797, 
-    125, 577, 909, 880, 193, 707, 147, 594, 515, 113, 485, 661, 317, 322, 148, 828, 
-    382, 613, 144, 808, 665, 771, 838, 802, 578, 879, 562, 895, 766, 827, 485, 1019, 
-    49, 337, 718, 839, 593, 1006, 840, 419, 777, 515, 461, 206, 30, 328, 224, 946, 
-    803, 388, 254, 318, 920, 876, 413, 622, 489, 869, 802, 389, 336, 832, 396, 808, 
-    568, 555, 543, 403, 821, 207, 78, 739, 87, 672, 408, 287, 543, 918, 751, 904, 
-    677, 421, 323, 402, 846, 405, 466, 651, 685, 213, 255, 696, 677, 612, 375, 561, 
-    312, 290, 821, 911, 680, 622, 34, 159, 714, 942, 547, 913, 67, 441, 322, 550, 
-    724, 354, 4, 127, 480, 391, 180, 844, 842, 159, 686, 94, 22, 786, 980, 450, 
-    355, 99, 635, 390, 65, 511, 802, 346, 274, 14, 110, 667, 1008, 377, 998, 141, 
-    777, 775, 464, 300, 625, 315, 640, 127, 1017, 376, 609, 988, 63, 582, 991, 735, 
-    715, 982, 718, 154, 455, 600, 283, 139, 719, 123, 283, 1014, 114, 349, 682, 676, 
-    906, 267, 791, 892, 464, 844, 203, 837, 2, 694, 845, 729, 398, 11, 212, 151, 
-    620, 939, 668, 265, 900, 687, 416, 609, 322, 562, 971, 445, 591, 661, 404, 889, 
-    741, 12, 474, 626, 123, 18, 86, 593, 830, 893, 862, 583, 952, 494, 891, 720, 
-    14, 267, 986, 158, 897, 379, 280, 694, 917, 11, 460, 179, 294, 369, 777, 484, 
-    470, 271, 171, 819, 811, 236, 435, 960, 732, 95, 955, 387, 192, 594, 641, 441, 
-    788, 118, 967, 88, 178, 399, 673, 575, 429, 82, 734, 915, 790, 601, 235, 648, 
-    82, 258, 650, 272, 984, 730, 362, 286, 11, 806, 1004, 76, 478, 39, 515, 714, 
-    808, 744, 669, 999, 257, 467, 73, 942, 1020, 405, 25, 893, 323, 877, 871, 705, 
-    926, 894, 860, 821, 569, 770, 937, 414, 92, 958, 598, 239, 352, 521, 796, 153, 
-    556, 393, 165, 942, 164, 405, 152, 745, 1012, 17, 925, 351, 881, 982, 573, 136, 
-    588, 497, 22, 474, 540, 526, 920, 155, 871, 204, 361, 43, 153, 235, 826, 490, 
-    512, 722, 118, 549, 532, 979, 183, 547, 858, 686, 550, 193, 134, 122, 652, 169, 
-    663, 72, 969, 421, 637, 182, 615, 595, 31, 1003, 596, 642, 277, 331, 487, 787, 
-    866, 949, 765, 876, 526, 675, 216, 241, 652, 609, 926, 938, 468, 478, 175, 179, 
-    850, 145, 840, 693, 294, 781, 676, 63, 970, 991, 244, 271, 639, 241, 787, 144, 
-    1004, 488, 454, 249, 780, 710, 523, 430, 68, 943, 320, 1019, 646, 331, 164, 826, 
-    903, 604, 194, 243, 554, 911, 623, 175, 454, 851, 855, 702, 878, 640, 375, 290, 
-    924, 740, 210, 207, 146, 410, 84, 733, 659, 772, 200, 270, 65, 553, 544, 296, 
-    529, 850, 876, 952, 879, 407, 160, 965, 989, 275, 976, 978, 771, 800, 586, 15, 
-    445, 646, 843, 205, 421, 983, 67, 422, 798, 563, 700, 563, 879, 326, 216, 410, 
-    833, 654, 384, 349, 230, 753, 19, 113, 265, 625, 65, 68, 448, 1020, 456, 193, 
-    114, 280, 6, 258, 94, 802, 979, 706, 112, 914, 985, 405, 874, 575, 119, 550, 
-    857, 562, 455, 947, 1011, 462, 428, 609, 347, 448, 72, 183, 994, 566, 474, 395, 
-    622, 484, 712, 694, 683, 755, 189, 305, 325, 873, 884, 441, 998, 784, 358, 351, 
-    534, 722, 790, 993, 1, 848, 745, 932, 488, 660, 381, 433, 833, 144, 249, 988, 
-    297, 183, 18, 774, 267, 499, 980, 548, 111, 710, 327, 385, 226, 404, 920, 945, 
-    590, 65, 233, 610, 738, 936, 472, 169, 353, 830, 146, 768, 792, 449, 95, 397, 
-    36, 956, 768, 599, 656, 189, 196, 528, 589, 697, 348, 325, 946, 368, 261, 726, 
-    636, 292, 756, 735, 50, 445, 877, 730, 199, 1013, 643, 888, 152, 711, 603, 157, 
-    548, 198, 758, 298, 981, 832, 228, 208, 961, 52, 833, 12, 87, 733, 1006, 594, 
-    52, 667, 339, 200, 110, 547, 5, 69, 283, 1007, 398, 604, 600, 342, 656, 159, 
-    676, 736, 269, 465, 853, 532, 857, 711, 201, 47, 853, 96, 487, 167, 331, 100, 
-    1013, 915, 382, 30, 337, 407, 891, 518, 327, 723, 454, 1020, 222, 367, 966, 629, 
-    679, 484, 451, 439, 108, 552, 892, 835, 473, 527, 467, 199, 881, 17, 350, 270, 
-    150, 973, 326, 862, 674, 342, 37, 518, 623, 681, 89, 175, 1018, 585, 1006, 241, 
-    612, 944, 119, 403, 810, 927, 181, 117, 31, 326, 880, 342, 487, 966, 34, 646, 
-    832, 521, 994, 889, 244, 352, 47, 581, 598, 33, 856, 674, 944, 959, 22, 90, 
-    191, 925, 880, 569, 248, 902, 660, 311, 480, 342, 371, 776, 36, 920, 203, 1000, 
-    78, 223, 143, 398, 729, 33, 665, 502, 991, 956, 303, 203, 224, 1003, 24, 403, 
-    252, 61, 285, 90, 32, 950, 141, 760, 687, 948, 214, 541, 207, 69, 837, 461, 
-    832, 451, 340, 976, 994, 431, 1017, 390, 886, 160, 358, 423, 735, 576, 358, 298, 
-    496, 881, 911, 546, 985, 928, 382, 164, 980, 609, 363, 117, 979, 6, 663, 195, 
-    747, 423, 285, 163, 379, 81, 150, 841, 477, 936, 179, 800, 50, 264, 739, 300, 
-    418, 293, 144, 972, 431, 922, 797, 944, 573, 797, 57, 760, 298, 25, 21, 286, 
-    544, 769, 157, 979, 184, 408, 554, 159, 948, 198, 511, 186, 410, 694, 64, 1019, 
-    305, 692, 876, 192, 879, 716, 9, 1016, 277, 842, 716, 828, 285, 86, 22, 206, 
-    334, 442, 609, 67, 856, 406, 796, 49, 61, 125, 201, 327, 743, 565, 445, 320, 
-    25, 941, 199, 679, 151, 228, 207, 796, 365, 670, 47, 45, 39, 601, 681, 992, 
-    205, 341, 564, 702, 889, 126, 147, 84, 558, 212, 237, 576, 794, 126, 222, 853, 
-    349, 277, 912, 917, 886, 539, 472, 560, 825, 283, 134, 775, 119, 787, 936, 998, 
-    575, 276, 632, 477, 134, 427, 710, 914, 40, 1016, 989, 719, 674, 602, 1010, 844, 
-    291, 289, 885, 509, 405, 607, 656, 469, 467, 934, 565, 578, 300, 148, 328, 624, 
-    736, 915, 314, 930, 565, 122, 46, 43, 38, 283, 973, 521, 841, 809, 662, 160, 
-    418, 722, 457, 257, 45, 981, 745, 822, 482, 811, 98, 426, 86, 788, 265, 639, 
-    148, 257, 590, 8, 47, 946, 724, 422, 821, 817, 873, 767, 884, 335, 407, 250, 
-    484, 816, 135, 809, 902, 91, 76, 464, 526, 891, 291, 762, 992, 877, 716, 233, 
-    45, 343, 930, 731, 992, 18, 338, 520, 501, 582, 979, 962, 13, 558, 195, 497, 
-    21, 685, 47, 184, 362, 898, 248, 918, 900, 722, 157, 1013, 75, 238, 1012, 619, 
-    299, 97, 11, 606, 63, 1001, 725, 296, 517, 811, 874, 283, 911, 531, 769, 562, 
-    114, 926, 72, 743, 802, 756, 728, 1022, 717, 756, 107, 668, 942, 705, 172, 813, 
-    788, 357, 370, 399, 845, 603, 148, 84, 110, 985, 331, 568, 890, 436, 602, 694, 
-    35, 97, 780, 666, 165, 976, 353, 993, 59, 170, 25, 701, 530, 828, 1008, 793, 
-    747, 46, 988, 606, 998, 197, 952, 550, 916, 780, 103, 409, 87, 136, 50, 582, 
-    156, 55, 410, 482, 209, 187, 792, 621, 932, 624, 436, 388, 966, 1021, 203, 1014, 
-    971, 272, 107, 400, 686, 390, 778, 446, 589, 321, 548, 843, 134, 673, 776, 539, 
-    189, 53, 433, 289, 307, 460, 296, 713, 980, 741, 134, 484, 597, 556, 75, 607, 
-    586, 771, 84, 360, 80, 903, 149, 855, 321, 458, 699, 890, 291, 235, 552, 389, 
-    103, 888, 434, 143, 426, 446, 205, 69, 1000, 762, 561, 932, 184, 411, 224, 826, 
-    369, 350, 764, 723, 606, 302, 438, 238, 304, 410, 961, 645, 926, 841, 261, 394, 
-    128, 830, 981, 506, 17, 910, 988, 641, 466, 550, 382, 907, 979, 870, 837, 602, 
-    230, 224, 323, 755, 477, 270, 366, 269, 264, 55, 656, 910, 781, 905, 969, 303, 
-    157, 91, 517, 907, 33, 606, 431, 930, 391, 8, 473, 711, 39, 75, 292, 781, 
-    121, 4, 965, 840, 472, 1020, 348, 299, 175, 194, 640, 674, 889, 845, 31, 251, 
-    806, 407, 101, 359, 793, 670, 18, 155, 742, 342, 410, 749, 414, 819, 262, 275, 
-    143, 586, 605, 291, 385, 407, 762, 441, 916, 512, 929, 5, 249, 776, 420, 87, 
-    296, 327, 19, 438, 408, 810, 357, 404, 83, 818, 489, 44, 720, 950, 477, 678, 
-    907, 179, 819, 568, 805, 995, 126, 91, 593, 901, 445, 604, 938, 170, 947, 579, 
-    607, 736, 928, 910, 138, 251, 374, 351, 875, 721, 681, 536, 866, 145, 442, 137, 
-    109, 413, 379, 360, 752, 314, 322, 46, 195, 834, 1003, 394, 750, 903, 13, 745, 
-    700, 577, 632, 903, 811, 770, 59, 1019, 219, 785, 1007, 157, 158, 319, 151, 823, 
-    529, 364, 277, 607, 609, 186, 840, 290, 340, 109, 256, 131, 758, 537, 96, 586, 
-    662, 963, 79, 567, 957, 18, 784, 970, 828, 882, 13, 408, 680, 132, 976, 808, 
-    422, 386, 322, 266, 615, 99, 792, 642, 872, 918, 671, 434, 439, 470, 427, 302, 
-    826, 8, 874, 429, 207, 547, 181, 643, 316, 917, 376, 873, 568, 699, 288, 426, 
-    573, 854, 74, 989, 197, 987, 995, 786, 460, 916, 767, 169, 864, 163, 89, 689, 
-    675, 577, 748, 770, 75, 656, 140, 738, 293, 838, 754, 659, 940, 754, 701, 441, 
-    782, 389, 192, 436, 738, 998, 243, 829, 649, 52, 879, 650, 303, 802, 685, 499, 
-    1006, 734, 129, 905, 505, 1023, 491, 384, 494, 123, 705, 765, 398, 746, 873, 917, 
-    261, 566, 676, 711, 983, 425, 780, 92, 596, 97, 717, 864, 829, 406, 359, 703, 
-    232, 161, 279, 311, 882, 203, 30, 118, 232, 948, 386, 880, 33, 286, 385, 360, 
-    120, 674, 644, 574, 691, 295, 143, 319, 103, 358, 509, 336, 974, 30, 767, 1014, 
-    693, 969, 619, 787, 668, 291, 645, 703, 194, 347, 999, 136, 821, 826, 895, 635, 
-    958, 232, 437, 850, 248, 849, 282, 392, 449, 143, 316, 790, 35, 360, 742, 418, 
-    845, 18, 783, 776, 333, 359, 589, 648, 15, 860, 18, 175, 106, 494, 373, 376, 
-    497, 430, 333, 430, 713, 147, 929, 830, 277, 926, 598, 203, 684, 858, 239, 668, 
-    105, 690, 335, 882, 567, 873, 918, 180, 438, 802, 317, 1020, 117, 567, 482, 831, 
-    624, 317, 505, 401, 168, 697, 894, 1019, 360, 574, 51, 456, 1005, 219, 446, 565, 
-    229, 113, 684, 714, 496, 351, 980, 779, 747, 648, 458, 492, 85, 509, 220, 575, 
-    243, 396, 816, 2, 387, 127, 967, 757, 54, 604, 819, 122, 151, 274, 778, 768, 
-    709, 562, 563, 236, 572, 41, 547, 236, 218, 905, 978, 365, 95, 761, 40, 371, 
-    202, 3, 695, 80, 346, 272, 811, 229, 748, 601, 829, 369, 143, 703, 476, 543, 
-    571, 640, 916, 94, 757, 909, 11, 805, 275, 1006, 804, 694, 931, 286, 785, 82, 
-    329, 548, 957, 494, 195, 655, 538, 500, 334, 176, 5, 709, 437, 972, 870, 104, 
-    599, 854, 468, 993, 883, 953, 284, 961, 452, 153, 429, 942, 426, 571, 144, 794, 
-    967, 811, 488, 581, 905, 633, 788, 118, 191, 304, 832, 412, 525, 977, 0, 11, 
-    198, 549, 868, 2, 884, 174, 70, 851, 305, 250, 422, 595, 938, 832, 552, 89, 
-    832, 837, 529, 245, 624, 274, 235, 279, 740, 228, 398, 492, 446, 30, 976, 938, 
-    373, 424, 526, 515, 679, 260, 491, 535, 659, 580, 529, 539, 357, 908, 768, 755, 
-    441, 878, 43, 537, 466, 864, 907, 926, 477, 761, 193, 152, 747, 849, 1002, 272, 
-    422, 1013, 154, 826, 675, 204, 681, 807, 607, 729, 871, 283, 643, 531, 928, 45, 
-    958, 308, 479, 116, 526, 1003, 739, 54, 773, 612, 760, 178, 976, 111, 190, 879, 
-    338, 229, 427, 974, 218, 442, 32, 1010, 512, 433, 238, 65, 955, 778, 693, 823, 
-    196, 701, 249, 412, 126, 596, 180, 385, 547, 503, 964, 325, 73, 917, 644, 1008, 
-    658, 956, 927, 655, 473, 293, 920, 170, 291, 593, 1017, 21, 18, 153, 418, 13, 
-    1, 322, 244, 367, 772, 929, 258, 535, 379, 916, 890, 424, 693, 677, 753, 414, 
-    570, 384, 727, 364, 743, 271, 236, 1015, 771, 807, 206, 752, 643, 976, 555, 209, 
-    779, 772, 58, 331, 575, 286, 617, 129, 348, 575, 334, 526, 536, 713, 187, 152, 
-    732, 602, 145, 570, 293, 704, 664, 119, 353, 426, 915, 305, 557, 410, 749, 762, 
-    37, 636, 1013, 1003, 414, 40, 328, 701, 652, 644, 107, 215, 777, 528, 309, 706, 
-    851, 303, 809, 60, 669, 799, 94, 403, 648, 990, 956, 23, 329, 459, 874, 861, 
-    627, 141, 243, 861, 755, 1012, 662, 153, 808, 418, 426, 241, 452, 357, 702, 153, 
-    411, 6, 770, 462, 419, 342, 408, 403, 999, 471, 236, 337, 645, 645, 160, 10, 
-    273, 524, 772, 322, 426, 256, 758, 342, 693, 248, 713, 241, 623, 508, 299, 249, 
-    117, 468, 194, 52, 114, 902, 1008, 920, 614, 909, 927, 780, 752, 539, 723, 312, 
-    665, 360, 665, 206, 605, 458, 323, 696, 168, 721, 925, 489, 6, 343, 359, 660, 
-    905, 283, 702, 552, 43, 312, 334, 980, 556, 150, 357, 357, 679, 372, 1020, 382, 
-    368, 705, 396, 186, 936, 884, 960, 636, 263, 22, 384, 739, 751, 185, 100, 172, 
-    522, 524, 624, 439, 833, 1021, 484, 306, 32, 760, 35, 164, 16, 319, 691, 316, 
-    649, 248, 482, 639, 720, 933, 377, 145, 319, 978, 992, 55, 917, 234, 667, 724, 
-    417, 213, 873, 807, 232, 278, 935, 60, 817, 855, 355, 147, 78, 818, 1016, 235, 
-    727, 724, 343, 864, 5, 562, 84, 220, 930, 932, 53, 293, 369, 1009, 794, 418, 
-    369, 133, 694, 651, 892, 251, 307, 495, 50, 875, 458, 29, 116, 897, 959, 128, 
-    589, 297, 88, 989, 764, 135, 295, 658, 611, 692, 833, 876, 166, 741, 790, 904, 
-    896, 979, 235, 772, 827, 457, 605, 464, 715, 779, 791, 102, 704, 791, 603, 431, 
-    1005, 755, 20, 259, 390, 591, 249, 905, 669, 827, 364, 203, 428, 693, 155, 660, 
-    537, 716, 844, 592, 242, 436, 1010, 143, 448, 729, 28, 766, 444, 836, 816, 466, 
-    427, 947, 561, 94, 745, 351, 843, 407, 921, 495, 281, 677, 633, 677, 684, 229, 
-    183, 656, 12, 953, 434, 92, 66, 796, 321, 552, 299, 491, 472, 319, 733, 654, 
-    778, 904, 924, 389, 991, 313, 814, 511, 529, 190, 853, 9, 678, 675, 821, 472, 
-    503, 421, 222, 872, 786, 779, 253, 606, 487, 580, 424, 330, 313, 607, 451, 614, 
-    435, 639, 188, 350, 694, 918, 508, 184, 130, 667, 917, 876, 365, 866, 915, 83, 
-    735, 286, 977, 477, 965, 437, 788, 744, 580, 702, 351, 681, 329, 99, 63, 462, 
-    651, 32, 368, 179, 219, 849, 480, 535, 959, 710, 595, 1012, 816, 868, 608, 694, 
-    849, 109, 226, 204, 862, 794, 926, 107, 902, 680, 601, 666, 876, 68, 564, 966, 
-    712, 64, 332, 866, 461, 91, 604, 475, 491, 518, 203, 474, 658, 854, 527, 605, 
-    608, 777, 752, 622, 565, 276, 345, 827, 289, 662, 510, 65, 561, 821, 989, 280, 
-    116, 616, 520, 975, 970, 48, 397, 955, 1023, 813, 374, 606, 411, 516, 304, 174, 
-    448, 353, 772, 565, 861, 98, 65, 753, 335, 678, 234, 312, 163, 450, 688, 7, 
-    899, 97, 407, 700, 157, 797, 125, 296, 667, 964, 676, 678, 720, 637, 157, 754, 
-    727, 780, 704, 496, 455, 766, 816, 1008, 425, 527, 679, 877, 38, 116, 713, 770, 
-    214, 432, 415, 185, 439, 632, 963, 688, 167, 231, 681, 896, 892, 935, 677, 172, 
-    569, 834, 964, 24, 809, 659, 402, 40, 431, 364, 1009, 303, 327, 561, 321, 740, 
-    297, 88, 836, 747, 310, 958, 624, 678, 836, 107, 146, 87, 723, 865, 313, 319, 
-    238, 475, 390, 203, 734, 813, 542, 23, 254, 822, 792, 916, 319, 58, 388, 680, 
-    245, 961, 445, 584, 481, 895, 874, 286, 450, 358, 89, 917, 558, 995, 745, 99, 
-    776, 922, 554, 152, 866, 930, 645, 365, 63, 480, 452, 106, 307, 536, 243, 67, 
-    984, 708, 683, 18, 605, 407, 897, 484, 371, 756, 1013, 503, 124, 520, 177, 90, 
-    923, 275, 287, 544, 82, 583, 400, 329, 310, 365, 331, 972, 59, 449, 102, 641, 
-    147, 223, 924, 876, 174, 747, 950, 289, 781, 658, 915, 860, 836, 435, 447, 872, 
-    250, 334, 18, 412, 257, 1007, 899, 215, 132, 908, 525, 674, 595, 911, 864, 254, 
-    373, 520, 908, 50, 315, 525, 675, 725, 650, 497, 173, 144, 965, 117, 862, 549, 
-    510, 550, 1009, 338, 327, 255, 957, 28, 622, 927, 934, 952, 297, 504, 502, 327, 
-    724, 74, 30, 397, 388, 125, 571, 734, 410, 1017, 882, 757, 251, 537, 734, 836, 
-    258, 232, 441, 655, 896, 151, 990, 354, 631, 497, 381, 677, 307, 580, 686, 705, 
-    217, 468, 604, 25, 135, 557, 676, 1008, 270, 100, 868, 22, 941, 496, 220, 495, 
-    101, 75, 305, 363, 116, 541, 528, 129, 828, 714, 132, 422, 703, 500, 641, 808, 
-    966, 821, 136, 889, 532, 150, 5, 345, 949, 722, 291, 106, 343, 591, 789, 544, 
-    583, 9, 141, 516, 759, 11, 924, 623, 570, 960, 525, 835, 661, 510, 790, 674, 
-    428, 326, 918, 151, 580, 456, 721, 958, 972, 266, 264, 334, 555, 340, 896, 599, 
-    314, 355, 390, 1005, 348, 712, 984, 291, 537, 252, 283, 630, 614, 127, 702, 518, 
-    353, 776, 194, 832, 976, 177, 148, 363, 611, 424, 550, 507, 438, 220, 388, 873, 
-    24, 540, 537, 410, 9, 903, 969, 988, 288, 287, 70, 150, 745, 782, 990, 697, 
-    386, 445, 372, 359, 185, 849, 849, 358, 45, 541, 1014, 105, 850, 899, 811, 814, 
-    431, 648, 982, 528, 144, 271, 79, 204, 527, 723, 765, 905, 515, 424, 741, 802, 
-    317, 904, 854, 418, 792, 415, 174, 488, 753, 388, 162, 458, 639, 749, 196, 383, 
-    294, 602, 514, 385, 1000, 142, 512, 684, 873, 968, 856, 528, 978, 650, 262, 804, 
-    96, 690, 612, 183, 547, 764, 221, 606, 650, 427, 704, 606, 57, 740, 836, 115, 
-    358, 69, 311, 112, 1003, 385, 379, 754, 506, 211, 63, 529, 692, 569, 402, 532, 
-    16, 506, 961, 291, 718, 438, 529, 720, 534, 584, 501, 372, 992, 818, 164, 143, 
-    400, 757, 915, 365, 259, 634, 917, 458, 646, 523, 287, 566, 598, 950, 361, 354, 
-    118, 782, 670, 209, 522, 566, 103, 1004, 727, 135, 200, 317, 807, 528, 240, 138, 
-    902, 213, 421, 831, 741, 631, 882, 861, 493, 480, 710, 776, 32, 166, 690, 339, 
-    443, 649, 4, 508, 395, 547, 711, 803, 63, 925, 615, 729, 138, 627, 818, 826, 
-    46, 300, 135, 1, 226, 467, 29, 893, 80, 637, 103, 443, 539, 853, 79, 588, 
-    266, 906, 194, 57, 520, 328, 902, 943, 401, 283, 292, 167, 558, 748, 754, 832, 
-    186, 376, 922, 939, 747, 282, 625, 959, 785, 311, 552, 561, 669, 299, 387, 812, 
-    503, 959, 766, 593, 203, 595, 552, 202, 799, 686, 67, 68, 576, 609, 736, 475, 
-    956, 642, 569, 715, 256, 366, 465, 806, 923, 678, 352, 1002, 573, 350, 632, 197, 
-    703, 763, 1022, 188, 30, 236, 114, 601, 261, 102, 612, 742, 626, 712, 533, 658, 
-    656, 18, 741, 355, 752, 392, 426, 295, 385, 682, 963, 46, 118, 317, 194, 94, 
-    54, 456, 440, 8, 822, 258, 71, 951, 795, 467, 685, 313, 616, 684, 980, 902, 
-    29, 709, 258, 43, 302, 95, 714, 297, 52, 43, 1007, 49, 453, 584, 629, 352, 
-    931, 184, 311, 746, 77, 85, 745, 239, 411, 932, 57, 243, 119, 804, 767, 362, 
-    936, 981, 805, 303, 646, 275, 170, 539, 309, 515, 105, 564, 6, 312, 985, 463, 
-    442, 693, 258, 338, 19, 946, 392, 445, 405, 0, 609, 161, 997, 673, 555, 355, 
-    976, 784, 858, 864, 1016, 793, 400, 149, 282, 748, 110, 89, 152, 400, 395, 802, 
-    117, 598, 179, 182, 316, 932, 168, 39, 581, 94, 219, 471, 214, 147, 200, 1, 
-    670, 776, 357, 414, 332, 481, 130, 190, 941, 896, 635, 499, 665, 373, 816, 921, 
-    703, 624, 754, 786, 799, 895, 428, 400, 890, 41, 916, 1010, 74, 336, 568, 212, 
-    625, 1004, 987, 324, 1002, 261, 457, 960, 340, 532, 626, 347, 605, 228, 357, 821, 
-    401, 657, 402, 147, 397, 1005, 951, 711, 543, 705, 70, 993, 825, 815, 963, 954, 
-    867, 53, 89, 1013, 958, 711, 787, 550, 788, 885, 757, 939, 55, 950, 910, 417, 
-    900, 797, 988, 517, 432, 656, 931, 334, 349, 1004, 624, 910, 361, 381, 458, 469, 
-    330, 277, 72, 623, 880, 302, 1007, 405, 869, 333, 991, 628, 942, 374, 17, 524, 
-    912, 97, 536, 601, 408, 607, 297, 488, 114, 126, 796, 671, 626, 277, 486, 242, 
-    104, 970, 851, 452, 499, 239, 519, 854, 65, 942, 781, 216, 774, 1014, 667, 396, 
-    404, 928, 603, 950, 237, 444, 506, 376, 666, 221, 854, 140, 74, 116, 571, 306, 
-    10, 157, 585, 112, 731, 845, 672, 266, 1020, 957, 800, 606, 300, 624, 93, 267, 
-    461, 262, 231, 13, 208, 562, 925, 700, 364, 270, 875, 134, 328, 229, 226, 872, 
-    112, 739, 1008, 432, 663, 974, 203, 370, 373, 193, 249, 518, 748, 444, 406, 310, 
-    449, 138, 188, 568, 270, 495, 91, 957, 211, 330, 388, 604, 860, 489, 555, 985, 
-    264, 273, 872, 26, 544, 197, 299, 1014, 693, 702, 891, 258, 27, 916, 409, 320, 
-    723, 849, 465, 672, 375, 1020, 201, 664, 57, 314, 373, 468, 130, 868, 959, 580, 
-    287, 350, 619, 411, 400, 463, 698, 220, 350, 713, 945, 702, 651, 736, 378, 644, 
-    683, 102, 224, 165, 205, 875, 569, 448, 455, 140, 156, 790, 1001, 438, 513, 1021, 
-    407, 731, 597, 955, 699, 951, 205, 968, 439, 219, 306, 84, 244, 307, 543, 109, 
-    480, 645, 878, 765, 167, 35, 354, 832, 993, 511, 402, 518, 733, 947, 65, 382, 
-    737, 432, 380, 163, 653, 325, 336, 129, 267, 941, 281, 740, 855, 153, 14, 843, 
-    556, 949, 82, 366, 211, 659, 609, 915, 433, 296, 543, 490, 250, 974, 213, 542, 
-    723, 72, 535, 70, 592, 779, 912, 909, 682, 423, 388, 602, 315, 699, 13, 145, 
-    345, 50, 679, 562, 978, 129, 81, 377, 577, 192, 435, 212, 400, 471, 1009, 73, 
-    772, 346, 858, 405, 121, 17, 342, 561, 781, 760, 429, 457, 588, 29, 7, 481, 
-    108, 988, 955, 544, 231, 766, 900, 228, 428, 509, 662, 946, 352, 92, 399, 213, 
-    910, 999, 851, 445, 807, 410, 801, 910, 335, 9, 153, 736, 496, 546, 893, 80, 
-    7, 654, 861, 685, 207, 679, 283, 209, 533, 131, 441, 790, 455, 467, 569, 888, 
-    593, 397, 680, 174, 72, 666, 428, 424, 743, 394, 335, 587, 508, 155, 273, 238, 
-    497, 632, 444, 873, 151, 959, 344, 530, 992, 338, 1022, 24, 857, 905, 490, 777, 
-    187, 428, 467, 1004, 885, 848, 663, 933, 7, 284, 3, 142, 554, 181, 66, 814, 
-    662, 947, 263, 128, 114, 41, 672, 258, 569, 261, 601, 615, 49, 897, 613, 587, 
-    173, 12, 585, 628, 507, 652, 968, 15, 128, 995, 212, 798, 877, 193, 441, 259, 
-    421, 751, 681, 8, 720, 242, 659, 363, 441, 846, 167, 344, 776, 738, 42, 155, 
-    386, 355, 345, 359, 870, 886, 895, 257, 461, 251, 584, 360, 27, 46, 31, 779, 
-    38, 561, 1020, 438, 287, 404, 872, 812, 865, 187, 527, 486, 818, 623, 869, 800, 
-    208, 254, 779, 812, 962, 754, 592, 363, 78, 328, 577, 605, 95, 624, 860, 443, 
-    546, 259, 966, 881, 358, 480, 106, 743, 106, 831, 648, 152, 195, 169, 870, 366, 
-    144, 225, 448, 197, 482, 517, 1008, 451, 727, 960, 199, 174, 671, 727, 28, 886, 
-    330, 705, 508, 813, 932, 786, 89, 339, 449, 637, 306, 83, 888, 751, 24, 778, 
-    647, 640, 744, 613, 999, 870, 881, 1018, 909, 690, 638, 937, 929, 723, 461, 495, 
-    349, 607, 234, 970, 202, 19, 532, 308, 909, 740, 1018, 678, 685, 171, 710, 221, 
-    586, 292, 842, 30, 439, 911, 481, 212, 361, 871, 135, 729, 893, 123, 986, 131, 
-    299, 844, 863, 803, 617, 617, 303, 949, 873, 781, 5, 2, 889, 83, 757, 715, 
-    211, 738, 423, 423, 867, 242, 198, 726, 831, 718, 389, 169, 255, 924, 458, 376, 
-    800, 558, 422, 461, 765, 18, 543, 410, 250, 162, 473, 755, 946, 933, 24, 896, 
-    620, 462, 327, 86, 948, 435, 548, 248, 567, 753, 953, 879, 879, 770, 900, 342, 
-    886, 253, 893, 388, 921, 383, 79, 234, 900, 205, 952, 423, 124, 476, 771, 635, 
-    639, 905, 976, 789, 688, 987, 104, 727, 325, 653, 217, 465, 514, 738, 553, 157, 
-    124, 547, 508, 301, 859, 113, 164, 530, 157, 237, 928, 355, 555, 606, 318, 187, 
-    5, 753, 928, 677, 135, 763, 822, 819, 793, 182, 453, 832, 372, 823, 829, 884, 
-    191, 578, 505, 637, 829, 764, 429, 423, 591, 474, 604, 373, 548, 76, 366, 644, 
-    513, 611, 638, 796, 551, 93, 255, 727, 707, 229, 158, 668, 756, 515, 91, 394, 
-    679, 596, 743, 307, 999, 1, 990, 157, 609, 124, 6, 213, 542, 438, 859, 758, 
-    462, 258, 858, 306, 480, 937, 969, 411, 662, 663, 1004, 300, 874, 222, 483, 296, 
-    147, 721, 495, 270, 688, 71, 685, 238, 222, 985, 931, 1006, 868, 572, 1001, 922, 
-    110, 527, 581, 671, 353, 908, 944, 26, 73, 493, 83, 847, 980, 972, 711, 758, 
-    309, 693, 923, 31, 558, 957, 432, 995, 1004, 53, 503, 653, 881, 46, 60, 769, 
-    148, 625, 524, 212, 115, 257, 112, 1023, 465, 900, 328, 542, 735, 173, 158, 514, 
-    70, 927, 593, 749, 342, 407, 631, 423, 688, 933, 909, 138, 759, 260, 377, 544, 
-    673, 365, 540, 315, 652, 9, 274, 343, 94, 975, 916, 972, 182, 246, 645, 585, 
-    825, 131, 598, 195, 356, 688, 692, 1005, 389, 318, 932, 287, 241, 869, 505, 887, 
-    519, 946, 8, 41, 814, 595, 417, 42, 450, 312, 768, 14, 739, 146, 815, 682, 
-    475, 403, 784, 122, 399, 222, 710, 250, 819, 311, 879, 723, 843, 116, 641, 238, 
-    67, 937, 871, 855, 71, 211, 352, 301, 611, 992, 239, 460, 244, 1018, 814, 865, 
-    801, 300, 991, 1009, 208, 700, 449, 254, 439, 759, 70, 922, 378, 544, 906, 571, 
-    199, 477, 738, 543, 400, 759, 407, 293, 801, 242, 1009, 696, 585, 44, 159, 537, 
-    925, 126, 333, 87, 355, 103, 638, 1007, 663, 740, 303, 491, 5, 492, 938, 743, 
-    553, 944, 988, 42, 761, 843, 121, 629, 111, 687, 540, 858, 206, 402, 698, 949, 
-    381, 902, 160, 570, 974, 37, 423, 537, 158, 163, 956, 664, 119, 667, 473, 800, 
-    267, 484, 237, 151, 231, 965, 150, 519, 533, 538, 418, 161, 686, 998, 837, 896, 
-    146, 887, 655, 687, 827, 842, 264, 669, 883, 588, 647, 308, 394, 510, 221, 360, 
-    692, 945, 970, 428, 1019, 900, 513, 617, 21, 884, 158, 773, 1011, 713, 65, 620, 
-    1011, 323, 246, 193, 470, 218, 313, 419, 386, 912, 990, 299, 144, 1015, 809, 179, 
-    151, 7, 146, 69, 774, 679, 87, 349, 347, 512, 83, 555, 333, 112, 130, 413, 
-    348, 305, 889, 974, 487, 558, 200, 563, 167, 983, 164, 515, 612, 841, 394, 774, 
-    740, 999, 673, 700, 752, 253, 1014, 967, 566, 947, 866, 59, 555, 401, 687, 998, 
-    220, 282, 1000, 282, 495, 794, 296, 872, 968, 609, 680, 275, 47, 890, 247, 679, 
-    892, 162, 631, 804, 656, 342, 517, 263, 390, 667, 15, 112, 308, 300, 713, 46, 
-    478, 462, 528, 418, 738, 734, 131, 637, 105, 845, 890, 962, 119, 341, 75, 459, 
-    662, 27, 771, 310, 422, 789, 937, 419, 46, 663, 98, 441, 398, 954, 745, 687, 
-    140, 891, 59, 274, 704, 950, 397, 544, 420, 583, 525, 594, 1009, 985, 301, 20, 
-    309, 885, 663, 812, 615, 728, 907, 514, 460, 671, 743, 179, 1022, 137, 689, 953, 
-    435, 415, 226, 972, 601, 159, 126, 801, 312, 738, 121, 134, 1015, 173, 722, 631, 
-    642, 20, 911, 84, 904, 136, 733, 22, 105, 834, 605, 262, 16, 889, 244, 993, 
-    535, 395, 821, 916, 61, 2, 754, 479, 224, 701, 1020, 947, 673, 776, 542, 348, 
-    42, 632, 689, 172, 625, 841, 299, 213, 754, 1012, 714, 57, 820, 825, 416, 827, 
-    940, 465, 670, 289, 28, 980, 773, 630, 913, 82, 916, 873, 607, 755, 378, 47, 
-    296, 363, 901, 212, 340, 566, 321, 774, 972, 975, 1004, 723, 619, 597, 583, 490, 
-    263, 432, 526, 767, 272, 90, 641, 457, 516, 790, 919, 283, 64, 947, 864, 594, 
-    896, 403, 274, 713, 369, 781, 339, 382, 156, 876, 372, 297, 966, 393, 906, 402, 
-    353, 104, 832, 142, 293, 65, 1008, 41, 218, 493, 407, 457, 6, 676, 352, 204, 
-    862, 936, 514, 528, 601, 419, 840, 694, 895, 953, 838, 924, 333, 174, 216, 713, 
-    587, 53, 232, 888, 364, 711, 537, 307, 453, 617, 479, 470, 592, 436, 241, 913, 
-    1010, 401, 893, 153, 447, 305, 897, 348, 448, 373, 9, 154, 391, 867, 547, 822, 
-    181, 729, 697, 259, 743, 166, 259, 351, 976, 390, 882, 593, 542, 1016, 401, 734, 
-    84, 74, 406, 371, 794, 884, 213, 420, 546, 92, 884, 183, 86, 125, 640, 608, 
-    910, 482, 669, 538, 785, 90, 246, 480, 484, 314, 7, 820, 297, 685, 140, 66, 
-    421, 203, 261, 815, 420, 895, 92, 100, 262, 43, 74, 353, 747, 574, 679, 188, 
-    361, 142, 799, 542, 420, 188, 941, 706, 832, 406, 163, 917, 652, 256, 757, 125, 
-    767, 594, 932, 583, 393, 734, 450, 827, 929, 763, 635, 154, 192, 465, 747, 820, 
-    28, 276, 480, 334, 995, 59, 7, 91, 804, 150, 365, 340, 810, 857, 687, 555, 
-    1015, 156, 701, 920, 461, 914, 238, 860, 56, 762, 649, 229, 994, 728, 80, 736, 
-    423, 967, 166, 439, 42, 839, 344, 33, 427, 284, 983, 499, 49, 535, 919, 1011, 
-    178, 488, 665, 155, 507, 276, 592, 931, 820, 353, 749, 374, 555, 574, 984, 134, 
-    697, 622, 524, 352, 3, 536, 532, 384, 481, 915, 317, 756, 449, 396, 738, 615, 
-    347, 764, 752, 487, 952, 405, 3, 490, 684, 846, 250, 292, 594, 60, 915, 652, 
-    475, 520, 453, 132, 799, 197, 829, 939, 261, 954, 400, 350, 374, 381, 532, 718, 
-    295, 886, 844, 369, 667, 387, 465, 648, 622, 96, 452, 812, 816, 264, 831, 979, 
-    908, 190, 118, 271, 975, 95, 675, 69, 924, 982, 978, 887, 122, 565, 771, 141, 
-    715, 801, 818, 165, 835, 757, 597, 614, 26, 725, 142, 946, 946, 304, 556, 215, 
-    782, 651, 558, 923, 811, 672, 67, 496, 244, 526, 743, 991, 67, 871, 115, 665, 
-    411, 155, 789, 871, 280, 67, 858, 632, 541, 250, 272, 885, 259, 959, 892, 224, 
-    48, 929, 878, 573, 407, 490, 625, 679, 404, 588, 650, 438, 187, 804, 538, 989, 
-    338, 425, 4, 151, 468, 88, 62, 295, 133, 505, 14, 336, 673, 517, 853, 353, 
-    264, 392, 400, 241, 1006, 724, 311, 193, 405, 804, 232, 689, 406, 663, 65, 408, 
-    912, 891, 410, 364, 786, 792, 548, 74, 257, 677, 484, 902, 736, 974, 1005, 193, 
-    184, 368, 604, 946, 2, 947, 179, 32, 468, 953, 177, 350, 476, 851, 166, 972, 
-    313, 638, 238, 74, 956, 280, 119, 292, 20, 543, 254, 1005, 218, 253, 282, 801, 
-    420, 524, 518, 67, 774, 561, 957, 725, 56, 754, 31, 273, 737, 143, 1000, 747, 
-    759, 550, 808, 930, 999, 639, 697, 330, 465, 816, 802, 602, 822, 900, 830, 1016, 
-    587, 510, 34, 819, 905, 573, 206, 552, 547, 159, 357, 43, 655, 998, 513, 793, 
-    127, 457, 564, 486, 299, 594, 588, 955, 811, 96, 784, 676, 943, 271, 462, 1019, 
-    229, 490, 292, 665, 935, 847, 1021, 730, 229, 234, 805, 563, 878, 362, 460, 761, 
-    467, 472, 90, 6, 694, 187, 452, 824, 756, 673, 969, 148, 712, 792, 102, 149, 
-    369, 483, 872, 758, 298, 736, 566, 574, 978, 371, 108, 320, 509, 864, 533, 487, 
-    220, 173, 968, 809, 455, 176, 488, 934, 401, 372, 169, 587, 353, 60, 21, 623, 
-    1021, 169, 684, 868, 476, 182, 466, 370, 454, 475, 378, 123, 160, 932, 230, 671, 
-    905, 341, 470, 872, 905, 565, 831, 724, 433, 73, 118, 413, 21, 293, 691, 568, 
-    367, 13, 723, 839, 50, 376, 5, 915, 858, 39, 794, 957, 141, 46, 357, 24, 
-    354, 572, 1006, 819, 662, 839, 393, 562, 671, 807, 300, 118, 208, 1020, 634, 753, 
-    891, 674, 19, 786, 743, 574, 863, 726, 1001, 629, 829, 707, 1001, 88, 1015, 195, 
-    557, 834, 940, 476, 654, 296, 32, 944, 348, 560, 589, 520, 298, 261, 459, 899, 
-    993, 51, 585, 230, 216, 604, 546, 698, 795, 740, 574, 688, 344, 998, 891, 848, 
-    970, 266, 656, 71, 470, 128, 50, 905, 594, 232, 734, 956, 433, 440, 633, 687, 
-    301, 292, 34, 388, 716, 131, 76, 91, 639, 632, 345, 682, 376, 1004, 523, 361, 
-    705, 642, 1020, 998, 781, 899, 1011, 860, 972, 359, 547, 384, 646, 1022, 576, 42, 
-    796, 146, 213, 362, 336, 597, 383, 986, 989, 431, 389, 640, 203, 829, 761, 263, 
-    250, 845, 263, 125, 731, 845, 988, 608, 651, 988, 580, 66, 52, 870, 903, 968, 
-    945, 388, 892, 589, 192, 1016, 913, 21, 433, 853, 666, 430, 768, 69, 363, 980, 
-    962, 454, 81, 378, 49, 407, 473, 628, 364, 812, 1017, 917, 129, 466, 26, 999, 
-    705, 138, 269, 978, 644, 595, 128, 694, 562, 541, 722, 232, 868, 513, 623, 573, 
-    964, 123, 737, 948, 461, 795, 245, 308, 953, 476, 237, 83, 460, 463, 902, 990, 
-    372, 1007, 85, 85, 971, 723, 687, 490, 143, 746, 11, 852, 913, 147, 111, 28, 
-    237, 884, 306, 895, 673, 566, 930, 513, 989, 442, 324, 98, 816, 865, 632, 89, 
-    275, 219, 322, 292, 453, 976, 390, 62, 932, 554, 289, 537, 988, 716, 969, 248, 
-    574, 539, 874, 380, 962, 14, 602, 550, 202, 55, 151, 12, 614, 568, 610, 230, 
-    844, 298, 68, 270, 915, 351, 149, 648, 655, 924, 379, 749, 498, 966, 915, 170, 
-    869, 855, 482, 893, 858, 299, 52, 63, 196, 918, 594, 896, 455, 817, 324, 25, 
-    104, 320, 154, 414, 826, 425, 569, 703, 880, 862, 408, 47, 220, 539, 836, 758, 
-    226, 624, 832, 85, 784, 238, 65, 88, 294, 222, 151, 591, 183, 1, 1, 511, 
-    290, 533, 957, 301, 120, 786, 613, 502, 391, 283, 269, 758, 920, 932, 476, 768, 
-    628, 634, 622, 354, 560, 135, 785, 669, 559, 823, 118, 133, 803, 879, 150, 670, 
-    531, 5, 713, 782, 516, 931, 156, 227, 9, 830, 956, 87, 663, 107, 650, 298, 
-    905, 355, 751, 1022, 98, 458, 284, 735, 95, 59, 749, 243, 250, 721, 239, 617, 
-    94, 923, 520, 640, 688, 287, 363, 140, 555, 238, 541, 990, 8, 469, 754, 910, 
-    912, 643, 680, 776, 655, 494, 171, 571, 667, 157, 841, 485, 54, 95, 258, 167, 
-    444, 8, 103, 838, 401, 110, 977, 11, 501, 178, 943, 42, 846, 783, 283, 865, 
-    657, 740, 400, 244, 936, 446, 709, 65, 881, 915, 987, 802, 193, 182, 299, 313, 
-    12, 905, 803, 387, 651, 827, 67, 892, 972, 133, 624, 149, 930, 679, 88, 75, 
-    923, 203, 225, 696, 548, 425, 81, 497, 385, 259, 702, 157, 946, 635, 809, 66, 
-    163, 943, 775, 285, 938, 32, 557, 768, 499, 407, 55, 327, 936, 596, 484, 325, 
-    929, 934, 562, 866, 287, 252, 803, 616, 245, 428, 158, 171, 692, 919, 587, 967, 
-    542, 250, 289, 944, 552, 514, 419, 656, 723, 243, 956, 240, 266, 568, 276, 162, 
-    266, 870, 129, 794, 26, 633, 278, 26, 416, 722, 953, 61, 73, 243, 125, 75, 
-    183, 894, 871, 876, 563, 442, 912, 87, 630, 369, 719, 687, 1020, 207, 497, 67, 
-    161, 873, 19, 186, 580, 362, 933, 834, 523, 378, 470, 859, 103, 208, 387, 270, 
-    41, 455, 667, 943, 338, 656, 722, 1009, 520, 297, 191, 806, 447, 57, 940, 105, 
-    679, 228, 527, 156, 251, 181, 75, 818, 403, 150, 890, 124, 944, 555, 26, 74, 
-    127, 670, 607, 293, 119, 495, 930, 87, 80, 84, 463, 559, 173, 65, 234, 91, 
-    296, 256, 904, 239, 485, 299, 755, 690, 316, 339, 124, 833, 456, 872, 448, 357, 
-    76, 172, 669, 969, 966, 597, 388, 526, 792, 46, 685, 387, 1, 738, 449, 909, 
-    580, 914, 533, 658, 102, 437, 30, 727, 689, 861, 895, 644, 363, 624, 963, 541, 
-    269, 475, 833, 528, 461, 189, 202, 486, 70, 124, 30, 113, 701, 597, 523, 958, 
-    714, 14, 716, 473, 810, 452, 287, 798, 105, 779, 381, 730, 918, 374, 649, 595, 
-    690, 725, 422, 739, 883, 508, 43, 703, 631, 172, 600, 781, 336, 74, 542, 1, 
-    658, 356, 265, 89, 641, 657, 334, 54, 753, 1022, 593, 604, 858, 454, 692, 227, 
-    312, 0, 266, 570, 780, 75, 173, 131, 545, 802, 29, 909, 21, 562, 196, 549, 
-    401, 88, 420, 266, 197, 362, 160, 567, 207, 269, 2, 835, 115, 167, 589, 540, 
-    788, 652, 301, 781, 221, 901, 157, 687, 276, 78, 757, 86, 476, 602, 430, 148, 
-    242, 502, 978, 113, 530, 230, 973, 187, 672, 115, 586, 831, 619, 876, 163, 755, 
-    734, 546, 322, 815, 591, 510, 527, 511, 227, 407, 287, 815, 359, 161, 278, 121, 
-    540, 348, 609, 662, 982, 799, 822, 80, 439, 395, 762, 960, 513, 904, 356, 815, 
-    620, 356, 327, 1011, 734, 8, 652, 115, 878, 656, 105, 305, 783, 318, 788, 947, 
-    951, 559, 266, 892, 758, 228, 758, 427, 309, 93, 808, 895, 111, 296, 759, 333, 
-    405, 545, 538, 787, 967, 79, 904, 782, 772, 699, 102, 34, 276, 578, 920, 102, 
-    244, 307, 96, 551, 504, 764, 835, 62, 982, 57, 808, 296, 486, 364, 293, 874, 
-    676, 336, 535, 895, 673, 972, 632, 43, 281, 65, 694, 661, 951, 246, 363, 334, 
-    553, 777, 838, 618, 525, 1022, 425, 367, 193, 707, 779, 398, 25, 497, 55, 472, 
-    741, 651, 188, 309, 366, 405, 968, 432, 814, 458, 356, 969, 184, 720, 806, 861, 
-    602, 705, 539, 85, 870, 935, 182, 913, 535, 215, 884, 299, 952, 951, 390, 37, 
-    626, 610, 127, 955, 60, 614, 439, 822, 781, 894, 973, 156, 388, 1012, 338, 532, 
-    123, 805, 857, 215, 723, 451, 294, 577, 600, 523, 698, 487, 878, 326, 474, 316, 
-    632, 785, 829, 750, 914, 3, 368, 951, 518, 257, 161, 196, 193, 350, 304, 950, 
-    399, 653, 940, 319, 586, 363, 128, 1006, 385, 44, 158, 369, 946, 300, 680, 287, 
-    118, 877, 263, 171, 529, 264, 685, 153, 477, 180, 871, 871, 1014, 869, 43, 552, 
-    677, 737, 627, 896, 788, 1003, 211, 1012, 308, 1020, 583, 398, 504, 190, 191, 885, 
-    664, 1023, 256, 1017, 804, 552, 389, 920, 409, 45, 39, 391, 998, 206, 677, 729, 
-    14, 452, 304, 640, 347, 846, 319, 730, 70, 16, 789, 689, 126, 789, 101, 458, 
-    701, 810, 272, 55, 813, 257, 230, 401, 15, 204, 384, 612, 766, 166, 394, 48, 
-    760, 629, 1016, 821, 880, 697, 193, 450, 443, 693, 719, 518, 854, 182, 281, 646, 
-    411, 694, 937, 457, 750, 294, 768, 421, 24, 240, 60, 398, 467, 212, 552, 372, 
-    154, 516, 170, 707, 757, 224, 740, 961, 228, 838, 843, 765, 829, 957, 83, 939, 
-    947, 738, 144, 337, 662, 97, 654, 630, 307, 46, 249, 54, 238, 693, 319, 34, 
-    774, 156, 946, 360, 760, 995, 557, 353, 828, 347, 921, 803, 212, 79, 441, 761, 
-    174, 772, 398, 51, 456, 8, 233, 447, 819, 764, 169, 699, 198, 882, 70, 994, 
-    263, 897, 84, 238, 514, 974, 531, 733, 659, 524, 108, 353, 744, 654, 872, 940, 
-    463, 400, 230, 943, 660, 376, 906, 645, 824, 763, 474, 336, 535, 453, 894, 7, 
-    957, 193, 924, 475, 912, 118, 587, 502, 576, 1018, 923, 551, 101, 436, 175, 887, 
-    954, 783, 448, 858, 514, 723, 34, 415, 547, 282, 214, 494, 257, 671, 749, 129, 
-    531, 848, 433, 123, 762, 582, 945, 761, 747, 45, 821, 597, 685, 379, 400, 152, 
-    1000, 81, 279, 179, 510, 140, 753, 280, 222, 437, 257, 398, 660, 537, 823, 804, 
-    941, 296, 572, 325, 577, 841, 946, 160, 143, 589, 749, 557, 699, 105, 535, 655, 
-    171, 673, 194, 72, 817, 310, 186, 926, 152, 752, 968, 635, 567, 335, 429, 481, 
-    24, 268, 348, 540, 283, 88, 486, 572, 544, 322, 315, 519, 819, 963, 181, 969, 
-    195, 510, 501, 923, 831, 735, 590, 417, 464, 459, 741, 169, 821, 796, 695, 440, 
-    378, 931, 638, 366, 406, 789, 690, 532, 625, 322, 295, 825, 425, 797, 441, 823, 
-    99, 381, 280, 859, 623, 975, 663, 111, 643, 595, 135, 740, 491, 465, 445, 61, 
-    177, 538, 959, 413, 581, 191, 606, 837, 436, 222, 976, 452, 175, 595, 663, 338, 
-    710, 442, 556, 638, 479, 597, 104, 460, 261, 153, 319, 315, 921, 313, 720, 156, 
-    81, 662, 753, 301, 821, 675, 490, 605, 607, 660, 525, 838, 18, 996, 518, 93, 
-    334, 746, 813, 685, 428, 51, 895, 447, 93, 996, 253, 946, 770, 658, 754, 942, 
-    526, 983, 590, 270, 927, 984, 740, 947, 278, 487, 974, 550, 555, 411, 186, 136, 
-    245, 691, 568, 373, 393, 568, 333, 155, 996, 532, 780, 117, 668, 603, 617, 880, 
-    124, 753, 1018, 162, 495, 419, 946, 44, 173, 319, 821, 271, 22, 177, 68, 788, 
-    990, 397, 846, 665, 750, 431, 659, 335, 17, 104, 776, 533, 852, 576, 632, 618, 
-    127, 955, 791, 826, 139, 742, 194, 420, 293, 785, 975, 576, 274, 1008, 537, 546, 
-    448, 329, 513, 165, 21, 599, 280, 617, 672, 212, 982, 461, 90, 958, 991, 769, 
-    756, 383, 988, 417, 110, 391, 445, 202, 855, 629, 141, 467, 826, 455, 358, 842, 
-    822, 190, 469, 779, 359, 88, 415, 541, 787, 550, 958, 942, 647, 368, 450, 489, 
-    137, 275, 23, 122, 286, 781, 79, 651, 383, 341, 592, 994, 863, 991, 203, 40, 
-    272, 140, 855, 318, 208, 843, 620, 741, 337, 28, 867, 680, 26, 501, 591, 606, 
-    287, 131, 184, 961, 354, 248, 467, 461, 233, 68, 516, 769, 529, 347, 947, 72, 
-    44, 55, 303, 449, 277, 465, 968, 824, 768, 414, 879, 575, 702, 918, 915, 648, 
-    558, 824, 868, 880, 267, 910, 150, 159, 459, 360, 179, 268, 171, 237, 621, 22, 
-    589, 241, 428, 653, 77, 6, 197, 355, 854, 402, 571, 100, 141, 955, 677, 73, 
-    913, 839, 749, 207, 573, 213, 53, 314, 427, 392, 899, 972, 492, 487, 474, 818, 
-    371, 753, 961, 853, 940, 827, 451, 341, 121, 456, 250, 125, 781, 534, 239, 494, 
-    859, 812, 536, 408, 7, 691, 20, 103, 903, 619, 545, 532, 777, 741, 896, 263, 
-    1003, 690, 35, 768, 837, 900, 72, 702, 455, 189, 666, 321, 217, 648, 43, 866, 
-    625, 517, 853, 766, 1014, 69, 53, 830, 806, 787, 288, 610, 113, 699, 728, 906, 
-    494, 911, 737, 228, 660, 276, 689, 974, 607, 305, 379, 981, 570, 492, 829, 858, 
-    35, 386, 774, 574, 322, 758, 483, 610, 642, 481, 459, 767, 761, 99, 496, 938, 
-    606, 632, 531, 396, 53, 303, 623, 994, 270, 421, 562, 789, 474, 359, 842, 838, 
-    317, 904, 52, 758, 462, 789, 725, 754, 860, 855, 41, 857, 68, 974, 400, 716, 
-    380, 383, 544, 1014, 282, 869, 43, 513, 856, 540, 926, 293, 238, 972, 667, 766, 
-    102, 2, 786, 247, 173, 108, 819, 998, 243, 701, 241, 258, 553, 227, 401, 507, 
-    7, 754, 625, 344, 402, 583, 688, 622, 488, 853, 421, 398, 961, 915, 563, 598, 
-    941, 386, 606, 570, 968, 939, 663, 308, 604, 303, 812, 74, 144, 639, 535, 323, 
-    771, 628, 656, 724, 877, 348, 933, 643, 674, 892, 906, 370, 1007, 73, 319, 563, 
-    274, 239, 219, 974, 806, 163, 505, 145, 533, 390, 317, 497, 1008, 70, 190, 893, 
-    1012, 497, 760, 777, 659, 552, 391, 634, 841, 826, 676, 200, 480, 177, 505, 201, 
-    563, 328, 345, 487, 38, 443, 13, 331, 587, 517, 21, 990, 439, 141, 89, 693, 
-    688, 199, 694, 428, 964, 822, 823, 653, 583, 490, 957, 792, 759, 254, 321, 357, 
-    859, 776, 464, 208, 10, 581, 565, 792, 655, 743, 571, 211, 939, 1008, 304, 71, 
-    750, 962, 530, 10, 729, 323, 334, 466, 789, 731, 648, 166, 592, 209, 955, 597, 
-    599, 689, 830, 44, 913, 98, 941, 954, 265, 446, 575, 503, 684, 717, 931, 519, 
-    300, 554, 870, 994, 171, 53, 180, 911, 654, 185, 667, 252, 618, 443, 649, 194, 
-    584, 608, 309, 762, 160, 289, 832, 1023, 227, 497, 863, 102, 457, 601, 927, 735, 
-    988, 787, 74, 546, 872, 557, 69, 11, 590, 571, 527, 381, 621, 51, 520, 358, 
-    153, 630, 1008, 223, 532, 799, 139, 985, 844, 952, 562, 479, 96, 505, 166, 495, 
-    915, 20, 159, 773, 583, 578, 893, 866, 712, 313, 107, 834, 76, 299, 826, 359, 
-    256, 532, 553, 710, 439, 146, 945, 3, 824, 521, 98, 663, 666, 355, 532, 271, 
-    991, 103, 125, 705, 355, 15, 239, 657, 756, 67, 352, 907, 531, 331, 530, 186, 
-    687, 52, 292, 836, 567, 375, 204, 710, 308, 419, 215, 288, 855, 845, 450, 126, 
-    980, 992, 279, 689, 278, 559, 144, 711, 967, 665, 198, 333, 350, 829, 859, 909, 
-    358, 998, 787, 461, 885, 54, 82, 730, 968, 516, 93, 77, 210, 995, 631, 0, 
-    791, 73, 776, 442, 936, 590, 348, 605, 1006, 76, 501, 161, 780, 958, 75, 0, 
-    909, 370, 780, 585, 352, 571, 196, 1016, 204, 235, 332, 92, 133, 418, 618, 721, 
-    417, 406, 740, 131, 195, 603, 117, 959, 316, 883, 95, 921, 103, 615, 715, 1018, 
-    192, 553, 321, 98, 404, 660, 417, 343, 275, 309, 832, 977, 403, 178, 891, 603, 
-    372, 332, 364, 452, 602, 254, 660, 432, 632, 468, 739, 495, 987, 128, 980, 164, 
-    91, 676, 936, 669, 976, 450, 268, 916, 831, 993, 972, 402, 1016, 386, 88, 279, 
-    1023, 535, 289, 444, 306, 697, 554, 272, 850, 165, 824, 175, 221, 225, 712, 503, 
-    118, 749, 150, 939, 807, 136, 597, 1006, 5, 139, 171, 339, 401, 233, 70, 180, 
-    27, 908, 37, 223, 416, 610, 463, 148, 713, 275, 256, 193, 791, 730, 357, 756, 
-    85, 460, 308, 425, 93, 822, 364, 770, 782, 261, 824, 415, 166, 163, 426, 633, 
-    481, 576, 448, 124, 177, 674, 816, 551, 183, 1006, 109, 902, 3, 673, 500, 95, 
-    372, 810, 400, 466, 827, 175, 438, 720, 212, 846, 946, 838, 93, 781, 382, 531, 
-    975, 636, 530, 499, 570, 932, 428, 940, 184, 963, 353, 738, 889, 147, 152, 419, 
-    652, 212, 702, 229, 292, 967, 522, 927, 768, 507, 487, 79, 996, 389, 280, 749, 
-    916, 303, 844, 958, 140, 904, 576, 728, 572, 331, 933, 400, 126, 505, 355, 247, 
-    971, 1008, 381, 873, 1001, 833, 116, 242, 366, 729, 517, 1018, 320, 744, 825, 965, 
-    393, 810, 330, 811, 570, 345, 599, 985, 388, 75, 616, 145, 335, 871, 245, 513, 
-    801, 845, 174, 788, 929, 762, 622, 629, 512, 2, 784, 437, 435, 255, 74, 426, 
-    750, 517, 327, 79, 568, 794, 466, 765, 571, 942, 84, 957, 259, 1005, 525, 325, 
-    606, 756, 193, 395, 623, 57, 55, 787, 870, 518, 79, 868, 637, 559, 370, 53, 
-    544, 814, 24, 215, 866, 895, 149, 220, 504, 369, 180, 29, 258, 449, 721, 147, 
-    126, 815, 619, 7, 361, 442, 963, 304, 192, 765, 121, 302, 412, 303, 952, 852, 
-    515, 329, 278, 290, 1012, 664, 787, 924, 503, 178, 352, 302, 759, 620, 293, 567, 
-    856, 562, 988, 794, 198, 646, 663, 281, 699, 354, 900, 1017, 72, 1015, 310, 172, 
-    81, 213, 608, 963, 50, 167, 369, 276, 655, 79, 671, 620, 428, 494, 338, 605, 
-    1008, 499, 147, 291, 844, 878, 289, 454, 443, 213, 943, 132, 546, 615, 334, 778, 
-    563, 675, 335, 573, 189, 713, 211, 302, 682, 220, 1018, 842, 959, 238, 616, 899, 
-    242, 146, 714, 861, 369, 51, 382, 82, 376, 672, 326, 660, 717, 938, 559, 418, 
-    269, 149, 1022, 186, 991, 912, 550, 940, 556, 1000, 682, 684, 381, 923, 310, 343, 
-    666, 388, 231, 887, 628, 163, 741, 629, 686, 708, 824, 863, 913, 90, 1002, 33, 
-    829, 357, 322, 532, 622, 514, 418, 34, 613, 601, 812, 575, 530, 504, 532, 675, 
-    299, 971, 554, 444, 500, 637, 512, 348, 558, 64, 547, 663, 543, 305, 505, 599, 
-    664, 459, 102, 417, 100, 803, 405, 194, 584, 991, 225, 308, 5, 987, 180, 600, 
-    132, 637, 290, 692, 564, 383, 636, 818, 538, 563, 928, 519, 37, 350, 283, 345, 
-    37, 423, 790, 530, 986, 730, 231, 595, 535, 744, 432, 315, 45, 666, 705, 991, 
-    392, 647, 79, 990, 1007, 806, 624, 768, 612, 220, 145, 654, 686, 979, 40, 184, 
-    993, 846, 56, 15, 1015, 758, 686, 811, 195, 722, 25, 978, 376, 6, 532, 56, 
-    862, 735, 942, 975, 106, 198, 59, 556, 610, 113, 135, 266, 845, 390, 399, 304, 
-    36, 468, 177, 303, 286, 598, 73, 622, 1004, 335, 771, 86, 578, 911, 525, 422, 
-    819, 269, 288, 855, 837, 246, 61, 278, 719, 577, 493, 80, 272, 574, 173, 553, 
-    667, 616, 992, 345, 638, 756, 745, 396, 471, 821, 423, 485, 351, 184, 670, 479, 
-    447, 561, 632, 35, 391, 783, 818, 921, 458, 652, 798, 667, 764, 880, 202, 40, 
-    922, 466, 574, 46, 417, 400, 663, 579, 573, 799, 114, 182, 280, 738, 883, 555, 
-    553, 14, 825, 403, 353, 1020, 4, 565, 664, 161, 130, 817, 1008, 801, 302, 391, 
-    575, 701, 431, 202, 799, 640, 814, 279, 456, 40, 835, 27, 412, 543, 113, 448, 
-    328, 957, 882, 901, 373, 652, 238, 551, 973, 829, 1009, 831, 695, 636, 322, 103, 
-    994, 97, 477, 439, 821, 629, 710, 1008, 737, 81, 73, 969, 834, 413, 286, 546, 
-    585, 685, 830, 102, 585, 801, 529, 600, 561, 372, 232, 704, 970, 730, 197, 776, 
-    791, 1004, 604, 344, 218, 872, 940, 69, 460, 555, 137, 268, 135, 80, 782, 862, 
-    540, 384, 40, 823, 397, 55, 84, 72, 46, 847, 700, 945, 383, 601, 464, 533, 
-    27, 369, 917, 568, 981, 82, 420, 442, 441, 630, 483, 264, 469, 319, 578, 836, 
-    930, 663, 968, 154, 542, 187, 114, 22, 732, 749, 167, 580, 847, 849, 346, 991, 
-    919, 138, 184, 201, 428, 645, 894, 253, 151, 30, 163, 269, 658, 1, 557, 385, 
-    32, 887, 960, 562, 156, 621, 842, 876, 347, 556, 937, 229, 967, 778, 256, 211, 
-    142, 724, 846, 693, 966, 866, 956, 560, 64, 186, 254, 192, 165, 1014, 839, 503, 
-    134, 98, 875, 840, 117, 55, 602, 5, 333, 664, 946, 108, 364, 591, 324, 332, 
-    457, 470, 306, 250, 555, 271, 872, 151, 976, 7, 829, 619, 362, 635, 569, 604, 
-    579, 467, 255, 637, 834, 987, 958, 820, 646, 459, 706, 49, 589, 296, 324, 748, 
-    704, 744, 525, 510, 864, 809, 949, 903, 939, 616, 604, 519, 801, 657, 707, 907, 
-    259, 130, 365, 606, 906, 817, 925, 387, 821, 64, 91, 35, 337, 474, 123, 936, 
-    863, 39, 803, 295, 768, 228, 608, 180, 80, 203, 686, 876, 494, 229, 457, 649, 
-    566, 756, 276, 641, 696, 132, 825, 242, 993, 362, 134, 704, 177, 507, 521, 810, 
-    635, 913, 668, 704, 586, 214, 870, 17, 480, 390, 342, 633, 322, 602, 180, 518, 
-    182, 411, 428, 965, 963, 791, 209, 780, 877, 284, 808, 488, 294, 342, 753, 435, 
-    907, 393, 469, 507, 155, 405, 547, 451, 982, 325, 756, 232, 375, 720, 539, 823, 
-    519, 796, 111, 3, 200, 663, 450, 193, 421, 40, 798, 805, 44, 865, 549, 245, 
-    421, 151, 807, 948, 371, 151, 255, 614, 730, 197, 488, 367, 471, 238, 481, 861, 
-    75, 465, 790, 361, 189, 886, 534, 694, 294, 253, 301, 785, 675, 24, 210, 94, 
-    615, 521, 45, 962, 0, 611, 601, 746, 236, 260, 868, 474, 278, 665, 683, 881, 
-    17, 186, 861, 583, 574, 534, 264, 838, 148, 135, 521, 209, 218, 186, 171, 20, 
-    937, 3, 681, 267, 319, 784, 388, 747, 533, 285, 506, 614, 832, 350, 272, 133, 
-    688, 196, 588, 51, 312, 59, 347, 71, 71, 484, 12, 100, 283, 556, 174, 178, 
-    603, 668, 558, 757, 222, 305, 733, 160, 599, 65, 419, 377, 580, 931, 562, 745, 
-    69, 752, 662, 812, 748, 1021, 1010, 375, 119, 322, 780, 250, 972, 1004, 917, 467, 
-    920, 891, 918, 882, 369, 559, 549, 181, 199, 250, 547, 808, 901, 956, 263, 881, 
-    37, 402, 807, 918, 610, 643, 386, 183, 758, 795, 567, 867, 567, 807, 266, 736, 
-    535, 699, 485, 665, 525, 715, 623, 77, 874, 424, 253, 165, 810, 519, 275, 310, 
-    895, 413, 903, 272, 458, 252, 61, 288, 980, 339, 850, 223, 562, 657, 211, 907, 
-    350, 828, 40, 663, 48, 901, 33, 94, 680, 688, 1001, 60, 629, 558, 294, 18, 
-    604, 106, 443, 95, 967, 806, 811, 1003, 104, 24, 444, 299, 795, 482, 736, 914, 
-    810, 149, 238, 720, 386, 26, 834, 94, 809, 496, 683, 674, 569, 1005, 362, 896, 
-    87, 304, 160, 596, 607, 493, 27, 313, 1019, 166, 302, 164, 69, 389, 257, 417, 
-    881, 565, 829, 187, 688, 201, 442, 498, 716, 537, 867, 656, 527, 989, 479, 986, 
-    57, 453, 907, 620, 589, 793, 689, 377, 733, 110, 848, 858, 218, 489, 813, 817, 
-    227, 940, 270, 27, 537, 66, 439, 536, 77, 436, 452, 965, 182, 603, 705, 346, 
-    364, 470, 886, 464, 226, 811, 802, 534, 669, 89, 223, 740, 382, 191, 637, 407, 
-    905, 31, 418, 394, 569, 889, 314, 451, 838, 189, 988, 74, 728, 470, 389, 779, 
-    474, 91, 305, 109, 352, 467, 347, 292, 390, 983, 723, 415, 897, 181, 972, 692, 
-    522, 741, 169, 201, 588, 1020, 839, 294, 77, 561, 855, 17, 667, 731, 486, 110, 
-    982, 528, 633, 67, 17, 139, 485, 812, 25, 921, 949, 923, 565, 799, 659, 340, 
-    106, 453, 143, 876, 684, 204, 1009, 807, 462, 610, 614, 1000, 1004, 700, 822, 308, 
-    106, 921, 328, 648, 468, 398, 596, 886, 979, 642, 157, 336, 693, 931, 766, 28, 
-    940, 155, 685, 570, 1002, 34, 763, 157, 134, 87, 199, 324, 518, 318, 760, 1014, 
-    728, 745, 912, 858, 429, 91, 402, 495, 55, 422, 664, 928, 570, 466, 58, 635, 
-    935, 76, 482, 369, 312, 178, 359, 966, 17, 357, 238, 577, 632, 112, 577, 773, 
-    340, 797, 893, 106, 654, 331, 20, 681, 892, 486, 475, 942, 539, 696, 192, 138, 
-    435, 891, 829, 990, 230, 545, 395, 219, 789, 1023, 256, 70, 411, 754, 811, 696, 
-    749, 248, 950, 529, 377, 326, 572, 688, 328, 339, 6, 546, 504, 952, 410, 657, 
-    205, 306, 51, 443, 970, 498, 650, 516, 650, 932, 483, 22, 952, 788, 895, 994, 
-    363, 816, 975, 912, 309, 59, 913, 848, 79, 780, 463, 769, 519, 779, 704, 774, 
-    323, 522, 372, 233, 767, 378, 916, 547, 25, 725, 490, 758, 169, 335, 722, 59, 
-    597, 21, 394, 607, 92, 726, 777, 796, 699, 228, 483, 404, 488, 707, 475, 724, 
-    220, 260, 33, 808, 209, 325, 404, 322, 848, 467, 115, 96, 510, 299, 598, 37, 
-    808, 748, 691, 246, 685, 890, 723, 735, 1009, 1001, 906, 360, 474, 214, 530, 602, 
-    505, 859, 63, 275, 722, 789, 123, 492, 418, 513, 328, 624, 418, 913, 793, 362, 
-    1019, 374, 585, 1006, 60, 239, 523, 216, 709, 112, 453, 909, 319, 718, 17, 386, 
-    702, 679, 797, 66, 741, 320, 977, 888, 904, 918, 204, 515, 539, 600, 928, 796, 
-    687, 66, 514, 77, 563, 545, 263, 108, 790, 434, 830, 970, 132, 62, 387, 467, 
-    886, 718, 580, 125, 281, 774, 192, 239, 321, 1001, 737, 972, 722, 835, 412, 374, 
-    210, 513, 937, 217, 181, 22, 432, 642, 977, 87, 588, 637, 135, 613, 190, 855, 
-    258, 329, 255, 383, 814, 719, 537, 801, 78, 607, 159, 599, 977, 661, 866, 879, 
-    582, 621, 470, 643, 732, 254, 690, 458, 73, 727, 104, 252, 465, 245, 166, 537, 
-    6, 744, 832, 304, 435, 627, 602, 335, 878, 796, 939, 465, 956, 619, 429, 982, 
-    350, 887, 112, 5, 601, 378, 527, 786, 297, 994, 448, 668, 905, 263, 854, 960, 
-    877, 247, 124, 131, 439, 385, 67, 185, 823, 85, 939, 475, 99, 729, 912, 516, 
-    822, 265, 358, 285, 749, 634, 879, 1021, 399, 275, 338, 338, 619, 189, 183, 561, 
-    511, 182, 704, 615, 716, 419, 813, 758, 719, 78, 377, 456, 705, 12, 648, 349, 
-    382, 811, 280, 1005, 151, 763, 682, 668, 418, 283, 909, 104, 698, 86, 816, 769, 
-    197, 21, 12, 228, 937, 676, 732, 700, 537, 628, 343, 525, 88, 12, 533, 824, 
-    645, 117, 403, 309, 794, 990, 141, 277, 943, 797, 696, 954, 245, 787, 205, 45, 
-    499, 348, 420, 324, 783, 373, 463, 967, 123, 366, 387, 185, 739, 622, 1020, 551, 
-    662, 940, 748, 604, 474, 328, 546, 131, 315, 637, 167, 198, 920, 831, 765, 12, 
-    1014, 631, 593, 594, 631, 664, 162, 214, 279, 723, 239, 343, 534, 40, 503, 927, 
-    180, 890, 736, 670, 974, 257, 256, 605, 386, 927, 132, 380, 699, 121, 633, 1019, 
-    330, 213, 182, 71, 691, 954, 838, 596, 578, 832, 214, 189, 340, 528, 386, 690, 
-    332, 662, 640, 855, 663, 206, 929, 938, 541, 1005, 85, 46, 932, 582, 451, 397, 
-    446, 18, 555, 487, 327, 496, 322, 82, 796, 369, 765, 887, 338, 665, 58, 36, 
-    482, 649, 100, 763, 800, 653, 424, 857, 277, 1023, 297, 923, 738, 196, 483, 770, 
-    766, 845, 478, 470, 299, 96, 493, 986, 382, 447, 304, 455, 314, 283, 517, 982, 
-    245, 732, 503, 12, 744, 800, 939, 966, 45, 563, 278, 294, 81, 367, 696, 881, 
-    854, 302, 835, 689, 57, 772, 21, 630, 592, 300, 70, 375, 346, 296, 495, 99, 
-    919, 367, 718, 469, 398, 819, 569, 613, 792, 362, 986, 548, 132, 209, 198, 826, 
-    968, 240, 529, 634, 161, 550, 915, 481, 449, 817, 700, 670, 541, 85, 668, 335, 
-    335, 211, 877, 156, 395, 807, 537, 1016, 918, 680, 63, 861, 643, 21, 316, 904, 
-    808, 468, 836, 352, 605, 640, 744, 1014, 127, 357, 1022, 965, 265, 674, 571, 516, 
-    595, 955, 445, 533, 396, 292, 551, 452, 205, 260, 876, 504, 397, 157, 377, 903, 
-    611, 946, 665, 866, 113, 92, 411, 184, 267, 185, 985, 158, 245, 464, 731, 588, 
-    196, 10, 832, 677, 213, 62, 476, 785, 521, 282, 831, 298, 654, 382, 655, 664, 
-    628, 522, 84, 553, 716, 63, 230, 113, 893, 681, 575, 295, 582, 758, 489, 484, 
-    821, 169, 36, 730, 423, 897, 934, 875, 402, 296, 468, 703, 18, 392, 519, 623, 
-    565, 836, 675, 784, 758, 473, 127, 786, 278, 795, 433, 761, 221, 301, 100, 864, 
-    2, 315, 653, 482, 712, 924, 447, 22, 621, 729, 443, 89, 787, 90, 586, 309, 
-    315, 618, 264, 368, 83, 79, 473, 130, 737, 315, 388, 272, 159, 186, 971, 476, 
-    693, 660, 805, 493, 131, 17, 1011, 955, 70, 684, 447, 463, 881, 551, 348, 158, 
-    297, 513, 86, 411, 41, 382, 308, 410, 959, 283, 352, 553, 513, 168, 954, 24, 
-    386, 403, 130, 335, 808, 799, 812, 714, 651, 76, 245, 418, 557, 729, 620, 406, 
-    1015, 994, 483, 337, 238, 372, 281, 681, 669, 148, 383, 625, 699, 460, 66, 1014, 
-    415, 196, 1003, 1000, 66, 481, 402, 1023, 72, 865, 214, 478, 377, 699, 35, 212, 
-    185, 761, 704, 492, 880, 78, 519, 130, 139, 914, 957, 301, 1009, 418, 950, 562, 
-    526, 364, 978, 791, 780, 860, 653, 273, 143, 907, 64, 439, 761, 890, 701, 736, 
-    770, 70, 69, 604, 322, 1000, 651, 122, 814, 262, 942, 411, 339, 1, 632, 457, 
-    454, 216, 882, 589, 532, 199, 215, 270, 855, 43, 170, 667, 157, 1014, 736, 76, 
-    573, 381, 830, 312, 1002, 687, 920, 375, 82, 716, 263, 783, 787, 88, 934, 88, 
-    256, 233, 352, 64, 598, 408, 122, 675, 687, 436, 283, 699, 57, 295, 867, 541, 
-    907, 678, 363, 937, 667, 842, 373, 473, 687, 452, 131, 248, 284, 272, 684, 81, 
-    320, 395, 698, 264, 321, 905, 718, 745, 896, 807, 903, 189, 314, 908, 14, 435, 
-    265, 500, 167, 496, 413, 496, 740, 523, 35, 657, 500, 829, 141, 202, 912, 266, 
-    721, 854, 785, 787, 367, 433, 822, 257, 793, 483, 53, 755, 608, 750, 932, 208, 
-    690, 355, 56, 864, 409, 497, 381, 22, 787, 227, 721, 72, 767, 537, 48, 474, 
-    531, 659, 909, 240, 58, 220, 148, 462, 191, 221, 264, 843, 541, 956, 811, 256, 
-    579, 758, 376, 346, 1010, 322, 298, 245, 220, 498, 484, 108, 597, 554, 993, 449, 
-    966, 443, 958, 388, 260, 784, 373, 315, 152, 807, 586, 96, 634, 684, 764, 363, 
-    987, 816, 925, 698, 41, 261, 824, 976, 198, 447, 776, 974, 309, 681, 677, 300, 
-    224, 670, 561, 61, 864, 812, 723, 490, 18, 303, 382, 896, 200, 590, 804, 657, 
-    99, 346, 996, 134, 25, 112, 602, 106, 30, 861, 191, 808, 52, 363, 117, 108, 
-    167, 965, 663, 210, 942, 210, 841, 162, 795, 369, 251, 227, 107, 858, 72, 427, 
-    415, 145, 572, 91, 567, 519, 195, 762, 548, 346, 1005, 634, 8, 760, 462, 786, 
-    885, 745, 552, 757, 694, 539, 726, 376, 629, 432, 870, 201, 973, 395, 172, 78, 
-    97, 373, 565, 6, 666, 269, 559, 196, 249, 197, 651, 38, 815, 947, 452, 798, 
-    158, 889, 544, 73, 111, 525, 84, 292, 98, 13, 686, 230, 956, 297, 552, 272, 
-    301, 963, 128, 348, 443, 732, 236, 838, 455, 686, 467, 349, 185, 417, 499, 760, 
-    119, 739, 842, 790, 936, 511, 99, 232, 426, 405, 491, 595, 514, 23, 837, 94, 
-    4, 469, 831, 399, 422, 547, 865, 655, 6, 381, 657, 204, 913, 619, 25, 499, 
-    425, 819, 11, 80, 556, 143, 145, 143, 377, 480, 161, 428, 706, 390, 326, 502, 
-    857, 951, 306, 863, 0, 670, 283, 737, 808, 981, 651, 488, 177, 273, 97, 404, 
-    544, 570, 901, 550, 162, 333, 917, 723, 451, 3, 586, 558, 412, 806, 756, 861, 
-    320, 231, 36, 347, 512, 814, 339, 502, 109, 599, 773, 550, 214, 979, 132, 649, 
-    514, 540, 993, 155, 943, 878, 677, 604, 318, 966, 228, 41, 988, 313, 255, 10, 
-    969, 397, 747, 92, 234, 787, 744, 555, 530, 436, 239, 100, 968, 255, 123, 687, 
-    866, 638, 121, 260, 668, 219, 964, 725, 416, 820, 313, 963, 663, 479, 703, 365, 
-    699, 806, 873, 661, 828, 496, 261, 414, 79, 433, 52, 305, 243, 355, 921, 254, 
-    482, 650, 892, 1015, 211, 967, 747, 458, 642, 404, 723, 691, 762, 608, 48, 623, 
-    832, 693, 655, 53, 495, 245, 595, 195, 48, 700, 24, 730, 481, 592, 364, 545, 
-    905, 790, 55, 840, 635, 723, 608, 414, 833, 822, 458, 201, 533, 785, 392, 562, 
-    325, 818, 991, 971, 132, 688, 856, 514, 201, 501, 946, 516, 685, 962, 408, 522, 
-    158, 307, 789, 404, 126, 200, 694, 77, 1002, 469, 86, 908, 905, 411, 838, 933, 
-    833, 1022, 212, 112, 358, 728, 313, 919, 739, 667, 551, 696, 648, 449, 686, 262, 
-    494, 645, 788, 95, 297, 750, 342, 503, 271, 938, 164, 781, 310, 182, 345, 282, 
-    946, 350, 605, 240, 162, 143, 110, 1015, 922, 337, 669, 483, 591, 9, 174, 461, 
-    746, 54, 98, 508, 768, 310, 785, 373, 643, 169, 382, 214, 5, 655, 942, 65, 
-    211, 838, 105, 539, 228, 852, 9, 92, 106, 161, 865, 718, 87, 422, 81, 143, 
-    421, 401, 375, 740, 636, 533, 31, 296, 754, 773, 345, 561, 780, 46, 881, 852, 
-    819, 998, 908, 542, 686, 968, 532, 103, 19, 186, 645, 868, 607, 834, 371, 864, 
-    443, 768, 709, 790, 525, 524, 1022, 503, 541, 269, 577, 387, 248, 108, 588, 782, 
-    614, 93, 978, 969, 748, 470, 727, 783, 74, 965, 155, 791, 363, 864, 486, 37, 
-    186, 424, 719, 460, 424, 252, 582, 742, 461, 346, 922, 738, 683, 30, 172, 765, 
-    667, 1013, 622, 607, 354, 350, 876, 931, 323, 9, 380, 29, 591, 996, 605, 291, 
-    98, 299, 476, 74, 87, 645, 684, 924, 310, 150, 707, 359, 826, 808, 819, 896, 
-    214, 655, 497, 308, 1, 751, 881, 305, 995, 801, 449, 1011, 767, 917, 596, 875, 
-    842, 906, 195, 729, 636, 55, 987, 734, 262, 276, 179, 207, 281, 465, 524, 723, 
-    740, 95, 837, 986, 898, 260, 561, 215, 352, 767, 202, 490, 680, 504, 191, 1021, 
-    989, 622, 459, 634, 872, 342, 763, 618, 175, 724, 216, 976, 222, 69, 530, 434, 
-    875, 66, 882, 833, 637, 877, 640, 207, 732, 78, 723, 470, 747, 816, 670, 264, 
-    789, 491, 920, 749, 185, 364, 253, 318, 115, 584, 670, 526, 871, 721, 274, 354, 
-    938, 488, 91, 612, 830, 719, 723, 755, 159, 397, 528, 818, 116, 521, 474, 488, 
-    896, 614, 196, 981, 945, 718, 698, 944, 292, 930, 399, 850, 91, 634, 501, 798, 
-    129, 716, 332, 1016, 592, 657, 979, 912, 871, 979, 987, 375, 643, 837, 719, 406, 
-    940, 620, 158, 541, 423, 565, 930, 124, 86, 949, 362, 473, 689, 866, 375, 599, 
-    182, 907, 94, 505, 312, 115, 435, 269, 642, 850, 206, 639, 37, 1012, 879, 91, 
-    47, 129, 986, 92, 100, 953, 97, 589, 353, 621, 178, 161, 861, 1012, 85, 519, 
-    219, 904, 180, 391, 731, 399, 405, 894, 32, 472, 816, 355, 311, 199, 847, 364, 
-    346, 685, 448, 900, 914, 758, 355, 1012, 15, 271, 703, 854, 407, 734, 718, 215, 
-    108, 333, 223, 885, 378, 826, 128, 313, 759, 175, 868, 199, 739, 237, 347, 170, 
-    849, 358, 995, 836, 484, 508, 169, 120, 332, 212, 524, 739, 578, 56, 34, 77, 
-    932, 821, 249, 898, 878, 67, 448, 638, 51, 177, 793, 515, 468, 431, 328, 678, 
-    732, 214, 340, 719, 812, 501, 816, 945, 352, 918, 787, 494, 99, 861, 484, 502, 
-    110, 340, 1, 323, 556, 933, 792, 472, 46, 416, 928, 260, 332, 829, 867, 414, 
-    785, 751, 753, 180, 958, 52, 845, 724, 254, 778, 958, 436, 728, 288, 117, 147, 
-    318, 441, 33, 823, 308, 346, 31, 960, 281, 208, 724, 269, 892, 156, 658, 199, 
-    212, 527, 1022, 676, 7, 909, 853, 512, 311, 367, 461, 329, 573, 847, 752, 276, 
-    493, 976, 409, 689, 601, 986, 474, 146, 646, 1007, 696, 243, 968, 445, 903, 400, 
-    656, 586, 464, 562, 789, 931, 212, 428, 103, 82, 207, 966, 578, 450, 456, 200, 
-    126, 338, 949, 529, 33, 235, 398, 770, 109, 348, 998, 25, 676, 636, 27, 729, 
-    449, 110, 677, 943, 159, 603, 169, 377, 371, 508, 543, 921, 817, 24, 284, 159, 
-    175, 374, 75, 512, 726, 454, 851, 726, 222, 971, 11, 593, 304, 822, 974, 385, 
-    175, 252, 982, 9, 707, 11, 711, 805, 574, 287, 515, 487, 539, 196, 258, 173, 
-    801, 728, 139, 279, 183, 968, 595, 149, 430, 859, 57, 315, 572, 102, 308, 263, 
-    584, 923, 808, 981, 726, 531, 186, 676, 1023, 101, 839, 554, 473, 656, 533, 985, 
-    912, 582, 516, 240, 310, 467, 245, 513, 36, 939, 840, 380, 433, 1002, 475, 50, 
-    227, 419, 19, 871, 277, 138, 901, 344, 626, 24, 821, 625, 314, 87, 43, 886, 
-    660, 195, 416, 599, 75, 890, 506, 232, 942, 64, 947, 231, 932, 577, 375, 272, 
-    288, 938, 761, 48, 858, 971, 308, 418, 991, 215, 381, 293, 1017, 428, 136, 33, 
-    903, 691, 736, 472, 846, 160, 220, 135, 304, 946, 851, 699, 338, 718, 167, 709, 
-    691, 728, 26, 114, 822, 860, 840, 694, 876, 820, 747, 758, 59, 112, 993, 203, 
-    162, 301, 964, 5, 565, 851, 558, 435, 822, 733, 161, 997, 145, 769, 70, 963, 
-    382, 870, 247, 180, 993, 291, 705, 390, 215, 586, 776, 397, 568, 702, 726, 325, 
-    482, 1005, 213, 340, 383, 220, 486, 590, 265, 425, 541, 508, 551, 303, 960, 352, 
-    879, 844, 579, 939, 840, 319, 801, 147, 876, 508, 956, 833, 551, 905, 510, 579, 
-    610, 331, 625, 967, 396, 427, 52, 808, 442, 706, 666, 736, 388, 621, 660, 327, 
-    1023, 591, 756, 37, 211, 839, 143, 369, 331, 32, 301, 996, 159, 500, 645, 573, 
-    458, 419, 131, 570, 350, 564, 17, 804, 689, 913, 75, 893, 796, 365, 863, 662, 
-    319, 585, 808, 32, 254, 130, 380, 807, 674, 730, 392, 665, 728, 974, 384, 825, 
-    6, 883, 130, 69, 809, 985, 877, 993, 1021, 698, 7, 879, 276, 206, 418, 772, 
-    529, 960, 69, 110, 215, 706, 373, 334, 218, 686, 895, 203, 577, 112, 383, 639, 
-    244, 568, 816, 683, 933, 81, 824, 490, 325, 744, 255, 231, 726, 1018, 912, 928, 
-    221, 562, 332, 861, 181, 277, 997, 993, 167, 357, 764, 305, 623, 882, 291, 748, 
-    277, 800, 962, 342, 860, 178, 409, 11, 1011, 293, 113, 965, 105, 74, 657, 219, 
-    715, 139, 278, 497, 10, 19, 247, 264, 506, 140, 52, 949, 607, 965, 884, 658, 
-    607, 936, 101, 875, 572, 406, 170, 77, 931, 490, 456, 319, 406, 401, 377, 159, 
-    243, 129, 585, 187, 411, 191, 914, 474, 623, 463, 525, 838, 94, 782, 647, 341, 
-    519, 930, 812, 365, 826, 285, 788, 771, 387, 507, 605, 756, 43, 302, 214, 484, 
-    646, 957, 393, 175, 624, 1, 15, 440, 596, 228, 301, 60, 393, 66, 758, 3, 
-    334, 692, 82, 738, 964, 568, 388, 34, 609, 377, 1002, 415, 532, 325, 1000, 569, 
-    376, 422, 501, 23, 213, 924, 246, 98, 203, 868, 807, 747, 172, 258, 273, 281, 
-    966, 30, 886, 420, 940, 295, 451, 220, 206, 165, 645, 158, 668, 1017, 843, 392, 
-    317, 641, 681, 701, 559, 65, 899, 322, 160, 676, 242, 402, 137, 574, 1003, 802, 
-    962, 589, 709, 393, 350, 458, 693, 958, 848, 868, 630, 455, 805, 462, 408, 1000, 
-    879, 522, 246, 155, 237, 332, 823, 351, 80, 161, 51, 647, 325, 924, 228, 980, 
-    245, 181, 523, 857, 906, 1011, 354, 951, 520, 213, 560, 815, 375, 832, 110, 888, 
-    729, 176, 386, 739, 101, 721, 94, 426, 949, 343, 607, 177, 342, 241, 772, 842, 
-    265, 84, 1008, 981, 362, 505, 772, 772, 18, 988, 573, 10, 683, 22, 112, 720, 
-    978, 966, 246, 445, 370, 649, 735, 874, 727, 52, 346, 581, 203, 1001, 539, 141, 
-    183, 594, 332, 382, 291, 606, 419, 975, 297, 165, 156, 716, 844, 192, 888, 413, 
-    728, 660, 191, 480, 467, 883, 7, 997, 161, 451, 659, 94, 249, 362, 13, 751, 
-    83, 0, 267, 283, 436, 731, 536, 969, 242, 4, 360, 13, 397, 1001, 148, 491, 
-    32, 289, 586, 674, 955, 895, 810, 724, 270, 44, 674, 41, 633, 41, 34, 124, 
-    399, 83, 165, 858, 729, 635, 451, 67, 78, 221, 261, 561, 196, 123, 676, 346, 
-    835, 813, 159, 903, 168, 924, 492, 992, 790, 559, 23, 416, 990, 914, 394, 187, 
-    92, 905, 667, 735, 203, 386, 166, 753, 672, 957, 595, 532, 648, 957, 566, 213, 
-    468, 376, 557, 452, 446, 347, 1000, 562, 374, 608, 328, 780, 121, 715, 920, 834, 
-    790, 391, 892, 205, 339, 99, 509, 665, 359, 1002, 763, 40, 955, 127, 763, 456, 
-    626, 557, 752, 452, 714, 13, 727, 1008, 634, 438, 64, 732, 458, 421, 994, 144, 
-    382, 207, 846, 786, 786, 534, 886, 129, 795, 614, 881, 151, 615, 993, 459, 470, 
-    809, 379, 96, 513, 497, 336, 190, 1014, 597, 107, 118, 914, 514, 551, 175, 230, 
-    496, 514, 456, 733, 592, 23, 683, 207, 948, 436, 504, 142, 998, 99, 915, 383, 
-    340, 844, 823, 636, 424, 869, 43, 842, 3, 42, 131, 784, 756, 299, 741, 520, 
-    976, 401, 573, 246, 751, 22, 953, 676, 286, 350, 789, 849, 96, 542, 594, 878, 
-    949, 640, 494, 286, 266, 719, 869, 797, 18, 359, 932, 649, 768, 172, 239, 465, 
-    78, 76, 641, 897, 29, 884, 453, 340, 154, 268, 347, 506, 468, 405, 91, 344, 
-    303, 511, 633, 635, 677, 580, 185, 515, 705, 271, 942, 685, 71, 313, 479, 571, 
-    318, 210, 238, 544, 325, 200, 700, 1012, 80, 379, 951, 432, 716, 261, 508, 453, 
-    808, 913, 988, 202, 874, 925, 1001, 760, 7, 36, 974, 207, 534, 400, 839, 892, 
-    697, 94, 802, 717, 99, 358, 7, 616, 992, 36, 273, 409, 839, 121, 159, 797, 
-    359, 343, 718, 633, 169, 724, 218, 84, 170, 1007, 792, 735, 420, 843, 983, 792, 
-    664, 466, 659, 892, 656, 218, 958, 148, 567, 473, 260, 29, 225, 67, 376, 286, 
-    200, 377, 456, 600, 500, 861, 369, 681, 137, 186, 48, 107, 72, 327, 292, 70, 
-    318, 836, 359, 405, 827, 965, 83, 134, 389, 814, 560, 840, 842, 959, 225, 689, 
-    412, 443, 378, 459, 551, 892, 336, 359, 588, 1010, 811, 521, 176, 134, 488, 644, 
-    854, 489, 380, 277, 872, 562, 868, 728, 509, 440, 191, 200, 174, 289, 602, 615, 
-    999, 204, 632, 770, 97, 633, 1015, 56, 38, 435, 143, 943, 503, 807, 83, 297, 
-    752, 643, 210, 822, 909, 583, 927, 382, 777, 414, 639, 506, 264, 230, 537, 421, 
-    513, 716, 136, 327, 333, 457, 919, 165, 471, 750, 169, 651, 359, 788, 226, 371, 
-    987, 570, 422, 260, 990, 337, 211, 5, 594, 856, 680, 901, 343, 241, 955, 5, 
-    130, 703, 756, 355, 326, 705, 750, 74, 71, 3, 403, 250, 362, 155, 746, 862, 
-    484, 300, 1015, 54, 204, 608, 971, 139, 668, 169, 962, 366, 539, 315, 950, 794, 
-    66, 438, 966, 114, 557, 362, 18, 148, 520, 765, 475, 44, 63, 593, 812, 638, 
-    50, 292, 716, 147, 728, 505, 139, 135, 925, 504, 118, 722, 642, 757, 838, 709, 
-    888, 19, 893, 595, 387, 313, 313, 739, 935, 545, 911, 418, 919, 236, 625, 347, 
-    207, 216, 717, 274, 260, 142, 499, 300, 928, 508, 371, 638, 836, 812, 108, 548, 
-    254, 154, 740, 124, 4, 948, 930, 328, 1016, 112, 1021, 797, 856, 414, 387, 25, 
-    47, 131, 521, 674, 759, 386, 1013, 62, 616, 829, 131, 61, 457, 353, 0, 790, 
-    269, 7, 320, 757, 155, 534, 144, 430, 211, 534, 421, 335, 928, 368, 1018, 870, 
-    612, 371, 705, 163, 276, 343, 507, 985, 555, 715, 359, 242, 713, 951, 631, 465, 
-    33, 800, 59, 262, 994, 643, 802, 660, 771, 308, 570, 257, 61, 606, 736, 52, 
-    476, 824, 690, 157, 646, 836, 163, 1010, 652, 690, 852, 354, 137, 382, 338, 560, 
-    666, 197, 259, 667, 566, 351, 433, 164, 354, 292, 274, 207, 693, 360, 938, 773, 
-    311, 499, 164, 243, 899, 410, 45, 820, 862, 508, 511, 77, 372, 137, 699, 47, 
-    156, 769, 848, 963, 105, 687, 579, 111, 533, 360, 283, 442, 263, 16, 746, 669, 
-    1023, 281, 342, 527, 104, 933, 278, 124, 537, 741, 538, 735, 937, 186, 414, 774, 
-    108, 687, 487, 513, 89, 398, 516, 735, 17, 771, 88, 113, 428, 638, 182, 859, 
-    900, 339, 78, 508, 389, 432, 746, 516, 919, 139, 74, 528, 740, 145, 363, 439, 
-    526, 1022, 770, 196, 144, 659, 143, 352, 451, 885, 312, 936, 984, 139, 342, 959, 
-    577, 606, 94, 899, 752, 769, 315, 187, 640, 871, 762, 681, 437, 261, 463, 330, 
-    786, 663, 646, 749, 57, 733, 691, 543, 873, 208, 994, 159, 207, 643, 110, 346, 
-    772, 28, 523, 556, 272, 123, 990, 970, 1001, 651, 303, 623, 636, 131, 268, 619, 
-    8, 562, 309, 996, 108, 206, 422, 304, 1000, 554, 154, 696, 946, 43, 48, 235, 
-    785, 177, 285, 843, 221, 426, 875, 679, 930, 657, 86, 540, 871, 756, 576, 654, 
-    354, 349, 96, 185, 722, 938, 42, 772, 501, 95, 831, 877, 201, 1020, 843, 948, 
-    924, 0, 467, 806, 895, 241, 626, 842, 43, 994, 277, 1022, 954, 676, 27, 24, 
-    835, 158, 305, 378, 495, 669, 96, 566, 198, 518, 354, 217, 236, 216, 112, 309, 
-    36, 791, 654, 642, 116, 271, 128, 854, 439, 929, 431, 1019, 344, 355, 516, 195, 
-    658, 111, 722, 500, 536, 733, 541, 110, 439, 701, 728, 530, 442, 360, 995, 634, 
-    777, 514, 654, 1020, 573, 5, 381, 230, 404, 804, 994, 327, 147, 928, 291, 565, 
-    903, 490, 735, 999, 889, 80, 917, 235, 786, 78, 617, 30, 715, 520, 397, 683, 
-    606, 348, 17, 111, 384, 220, 897, 663, 272, 512, 975, 713, 507, 360, 85, 151, 
-    346, 832, 768, 305, 650, 568, 524, 687, 1009, 224, 214, 424, 749, 447, 84, 117, 
-    521, 358, 151, 642, 760, 532, 74, 313, 202, 828, 340, 643, 885, 275, 370, 5, 
-    337, 752, 362, 915, 535, 113, 631, 117, 831, 652, 953, 187, 864, 569, 434, 61, 
-    68, 279, 858, 939, 571, 386, 623, 574, 551, 751, 825, 899, 811, 463, 334, 437, 
-    58, 747, 638, 318, 378, 139, 962, 893, 595, 482, 651, 748, 123, 758, 359, 398, 
-    211, 684, 544, 168, 712, 917, 207, 150, 467, 91, 181, 327, 398, 540, 904, 251, 
-    599, 470, 108, 156, 190, 692, 900, 723, 132, 875, 395, 632, 155, 224, 294, 583, 
-    892, 817, 886, 185, 982, 927, 422, 11, 749, 28, 499, 539, 797, 711, 620, 266, 
-    659, 233, 1001, 824, 142, 765, 697, 185, 227, 743, 872, 421, 315, 789, 843, 781, 
-    734, 655, 574, 525, 783, 1005, 895, 758, 64, 573, 1019, 317, 620, 242, 892, 777, 
-    330, 936, 17, 1022, 896, 887, 155, 819, 551, 713, 483, 39, 441, 1001, 589, 326, 
-    962, 115, 890, 358, 710, 872, 202, 234, 13, 724, 302, 45, 534, 601, 525, 931, 
-    201, 444, 509, 736, 756, 933, 802, 409, 511, 693, 919, 155, 161, 195, 1014, 772, 
-    129, 107, 106, 321, 308, 858, 891, 339, 362, 564, 732, 157, 692, 200, 830, 688, 
-    206, 89, 33, 67, 890, 889, 271, 490, 1015, 405, 277, 330, 441, 916, 122, 113, 
-    813, 891, 482, 895, 77, 827, 585, 186, 277, 108, 107, 795, 835, 306, 864, 697, 
-    624, 389, 513, 424, 81, 482, 532, 1009, 945, 245, 197, 860, 977, 529, 552, 430, 
-    1009, 130, 64, 924, 545, 702, 232, 603, 272, 222, 285, 535, 438, 231, 155, 988, 
-    926, 920, 712, 730, 595, 231, 19, 754, 591, 441, 274, 206, 984, 479, 855, 830, 
-    110, 696, 866, 471, 703, 887, 565, 527, 1001, 954, 342, 86, 237, 96, 766, 16, 
-    644, 895, 662, 399, 874, 252, 436, 733, 497, 400, 820, 465, 397, 713, 474, 773, 
-    522, 827, 875, 488, 532, 730, 437, 264, 532, 132, 395, 394, 514, 416, 384, 625, 
-    259, 908, 864, 284, 88, 840, 980, 540, 37, 65, 293, 528, 86, 153, 925, 931, 
-    756, 403, 439, 297, 658, 15, 562, 923, 543, 666, 152, 852, 869, 935, 772, 924, 
-    1022, 497, 139, 792, 180, 88, 381, 518, 207, 289, 204, 829, 48, 220, 640, 31, 
-    681, 460, 36, 398, 967, 728, 185, 736, 738, 927, 826, 593, 627, 448, 644, 42, 
-    526, 675, 242, 353, 807, 992, 895, 316, 963, 399, 352, 518, 852, 565, 1018, 375, 
-    581, 199, 85, 551, 708, 68, 44, 150, 851, 375, 361, 496, 148, 578, 868, 251, 
-    13, 262, 670, 54, 243, 820, 491, 770, 227, 439, 598, 41, 853, 587, 346, 936, 
-    741, 460, 773, 163, 1021, 746, 876, 488, 930, 538, 21, 390, 748, 902, 880, 184, 
-    823, 672, 679, 171, 192, 573, 576, 984, 713, 572, 260, 677, 386, 940, 43, 448, 
-    942, 320, 390, 415, 485, 187, 732, 765, 773, 409, 130, 490, 777, 581, 693, 723, 
-    342, 39, 29, 334, 682, 209, 443, 913, 203, 717, 397, 378, 687, 424, 160, 612, 
-    507, 508, 881, 568, 459, 77, 1008, 535, 635, 712, 1021, 739, 820, 751, 887, 905, 
-    633, 318, 918, 1018, 140, 429, 49, 8, 139, 999, 56, 686, 919, 307, 322, 647, 
-    869, 481, 300, 150, 368, 775, 637, 761, 973, 369, 22, 255, 888, 765, 25, 495, 
-    433, 513, 398, 595, 561, 486, 990, 1018, 811, 387, 664, 613, 23, 474, 125, 438, 
-    196, 734, 314, 108, 849, 402, 958, 636, 35, 629, 898, 646, 193, 996, 457, 141, 
-    718, 136, 683, 242, 1009, 228, 406, 792, 868, 284, 896, 452, 567, 177, 397, 127, 
-    737, 1017, 375, 163, 654, 803, 550, 54, 91, 866, 199, 12, 383, 1014, 321, 216, 
-    639, 1022, 175, 91, 152, 410, 631, 934, 783, 165, 841, 580, 590, 52, 628, 679, 
-    863, 404, 243, 443, 911, 215, 917, 952, 95, 641, 750, 673, 60, 406, 91, 968, 
-    970, 947, 377, 60, 637, 778, 958, 295, 829, 128, 416, 895, 721, 834, 553, 235, 
-    881, 918, 21, 666, 116, 162, 500, 758, 685, 553, 8, 696, 882, 559, 553, 127, 
-    638, 551, 263, 508, 679, 833, 508, 142, 75, 391, 45, 107, 121, 886, 493, 133, 
-    361, 598, 353, 923, 999, 812, 654, 855, 964, 657, 662, 855, 146, 572, 289, 866, 
-    143, 158, 235, 477, 491, 743, 841, 72, 609, 939, 802, 986, 993, 312, 726, 590, 
-    486, 406, 80, 267, 177, 668, 395, 1008, 231, 467, 44, 818, 572, 448, 239, 65, 
-    601, 936, 615, 1022, 625, 850, 244, 765, 863, 874, 990, 821, 535, 917, 287, 953, 
-    536, 407, 608, 739, 950, 389, 67, 947, 592, 911, 1022, 832, 359, 200, 591, 972, 
-    156, 7, 421, 518, 932, 693, 24, 328, 894, 272, 281, 837, 479, 323, 170, 299, 
-    507, 390, 777, 934, 124, 101, 55, 950, 69, 1007, 937, 573, 700, 506, 465, 827, 
-    284, 911, 351, 171, 0, 879, 788, 327, 631, 362, 452, 982, 25, 146, 554, 470, 
-    895, 179, 388, 653, 351, 969, 756, 855, 948, 518, 193, 429, 752, 526, 278, 817, 
-    14, 519, 388, 875, 519, 943, 15, 13, 293, 148, 704, 635, 665, 254, 890, 580, 
-    887, 935, 442, 72, 118, 854, 118, 310, 263, 765, 505, 420, 156, 358, 730, 66, 
-    977, 920, 308, 1005, 725, 58, 331, 681, 890, 688, 25, 865, 160, 435, 679, 663, 
-    536, 882, 977, 918, 59, 1012, 506, 285, 414, 515, 385, 702, 373, 746, 184, 413, 
-    702, 380, 30, 859, 638, 337, 134, 314, 474, 407, 646, 741, 238, 87, 861, 974, 
-    565, 919, 290, 611, 188, 792, 57, 330, 175, 271, 407, 726, 907, 657, 790, 889, 
-    863, 824, 245, 742, 110, 393, 674, 312, 323, 956, 649, 18, 126, 696, 76, 766, 
-    559, 857, 339, 960, 473, 295, 883, 339, 72, 746, 9, 467, 66, 158, 144, 763, 
-    697, 8, 837, 139, 344, 691, 983, 474, 205, 834, 399, 437, 719, 351, 717, 466, 
-    999, 950, 890, 606, 423, 156, 633, 281, 845, 598, 592, 905, 491, 980, 193, 290, 
-    109, 374, 668, 520, 763, 805, 834, 991, 22, 693, 543, 745, 99, 509, 420, 272, 
-    847, 429, 883, 29, 612, 287, 163, 953, 77, 911, 444, 248, 699, 642, 303, 717, 
-    637, 867, 710, 957, 784, 772, 165, 201, 354, 864, 655, 677, 88, 928, 50, 307, 
-    619, 216, 803, 524, 702, 166, 290, 429, 655, 249, 642, 599, 815, 912, 768, 800, 
-    727, 257, 372, 945, 769, 255, 657, 502, 623, 321, 745, 307, 418, 566, 123, 148, 
-    882, 62, 164, 809, 541, 564, 578, 499, 868, 17, 408, 53, 473, 977, 578, 368, 
-    119, 87, 186, 819, 362, 161, 720, 101, 760, 356, 145, 505, 769, 900, 800, 427, 
-    44, 524, 446, 446, 250, 886, 120, 812, 252, 819, 839, 864, 633, 398, 28, 652, 
-    91, 587, 648, 761, 833, 779, 8, 811, 941, 799, 933, 1002, 696, 656, 878, 411, 
-    129, 426, 74, 74, 141, 528, 338, 814, 469, 598, 236, 378, 654, 897, 536, 925, 
-    652, 351, 577, 555, 329, 522, 902, 907, 588, 677, 5, 920, 807, 79, 288, 730, 
-    57, 359, 515, 918, 571, 1017, 514, 842, 309, 923, 931, 284, 770, 230, 597, 441, 
-    118, 593, 708, 110, 949, 551, 748, 783, 891, 397, 162, 674, 657, 294, 3, 837, 
-    549, 502, 571, 376, 414, 739, 929, 812, 316, 143, 422, 429, 277, 351, 765, 135, 
-    850, 196, 499, 219, 567, 478, 202, 60, 228, 214, 89, 176, 470, 418, 1021, 679, 
-    860, 787, 807, 293, 974, 954, 387, 130, 693, 312, 86, 232, 990, 444, 814, 52, 
-    382, 315, 81, 904, 232, 255, 341, 709, 351, 899, 744, 671, 89, 1012, 600, 163, 
-    774, 102, 543, 932, 588, 1007, 215, 593, 463, 591, 959, 715, 250, 694, 435, 40, 
-    912, 198, 674, 767, 847, 854, 163, 42, 811, 316, 74, 244, 329, 107, 800, 77, 
-    128, 304, 852, 424, 895, 410, 882, 890, 646, 142, 518, 292, 702, 934, 116, 884, 
-    369, 551, 843, 176, 141, 678, 268, 920, 400, 886, 642, 523, 231, 2, 817, 537, 
-    862, 344, 653, 996, 1006, 210, 959, 896, 830, 222, 871, 537, 442, 600, 110, 452, 
-    619, 723, 296, 80, 805, 177, 336, 601, 132, 811, 247, 882, 2, 414, 964, 368, 
-    885, 382, 331, 228, 729, 781, 611, 363, 665, 686, 107, 5, 254, 753, 677, 523, 
-    841, 59, 154, 113, 791, 762, 181, 800, 509, 531, 515, 147, 350, 260, 102, 680, 
-    630, 712, 311, 803, 512, 586, 429, 751, 19, 711, 707, 779, 993, 490, 491, 401, 
-    372, 3, 140, 477, 690, 29, 743, 517, 871, 624, 836, 660, 539, 602, 329, 745, 
-    382, 693, 28, 497, 356, 934, 210, 128, 393, 361, 616, 956, 487, 808, 177, 827, 
-    681, 73, 395, 641, 743, 577, 128, 740, 597, 492, 346, 814, 175, 923, 913, 915, 
-    207, 535, 1000, 327, 187, 755, 542, 924, 131, 973, 444, 84, 96, 463, 305, 778, 
-    154, 900, 10, 164, 26, 854, 365, 1018, 4, 920, 228, 242, 556, 901, 643, 378, 
-    955, 412, 78, 49, 37, 872, 1013, 154, 493, 916, 403, 336, 845, 527, 807, 530, 
-    339, 944, 720, 35, 914, 994, 470, 677, 802, 192, 974, 256, 246, 968, 130, 174, 
-    399, 569, 921, 288, 606, 528, 582, 45, 69, 801, 830, 796, 107, 933, 243, 645, 
-    325, 78, 849, 671, 111, 175, 614, 689, 386, 793, 902, 385, 531, 592, 932, 441, 
-    599, 691, 307, 655, 347, 647, 538, 330, 437, 815, 427, 359, 191, 211, 424, 645, 
-    252, 546, 467, 991, 752, 445, 464, 1009, 571, 792, 385, 494, 363, 167, 453, 309, 
-    18, 269, 860, 1012, 473, 374, 478, 384, 65, 329, 438, 692, 519, 473, 843, 860, 
-    598, 887, 760, 12, 588, 534, 584, 77, 186, 604, 734, 774, 747, 936, 931, 591, 
-    559, 618, 759, 944, 559, 238, 196, 524, 249, 301, 213, 236, 193, 642, 817, 722, 
-    964, 469, 986, 411, 101, 88, 426, 231, 233, 96, 703, 221, 789, 287, 699, 578, 
-    43, 624, 185, 40, 773, 682, 373, 902, 439, 282, 1011, 655, 775, 556, 198, 307, 
-    812, 202, 121, 21, 831, 303, 186, 132, 457, 584, 487, 547, 612, 544, 893, 288, 
-    55, 202, 512, 700, 860, 132, 198, 565, 88, 287, 118, 492, 120, 483, 867, 1000, 
-    112, 603, 775, 669, 333, 606, 507, 970, 285, 650, 379, 626, 311, 725, 357, 242, 
-    820, 160, 35, 21, 444, 76, 444, 204, 574, 878, 682, 769, 856, 930, 78, 205, 
-    519, 31, 963, 303, 747, 159, 576, 818, 1019, 845, 399, 292, 533, 337, 312, 56, 
-    947, 151, 340, 692, 899, 482, 667, 1002, 515, 324, 1013, 810, 153, 159, 252, 560, 
-    547, 702, 945, 678, 265, 365, 894, 470, 33, 912, 39, 950, 464, 343, 396, 17, 
-    570, 1023, 19, 138, 512, 272, 538, 75, 608, 295, 205, 793, 13, 739, 309, 18, 
-    357, 730, 995, 663, 152, 436, 797, 451, 210, 827, 220, 933, 952, 1014, 690, 978, 
-    662, 106, 93, 597, 853, 11, 988, 301, 350, 664, 837, 939, 37, 791, 72, 11, 
-    423, 721, 183, 482, 249, 715, 514, 392, 149, 767, 21, 989, 801, 299, 13, 592, 
-    236, 900, 42, 953, 136, 572, 335, 267, 599, 76, 999, 253, 89, 533, 781, 740, 
-    104, 468, 873, 498, 84, 337, 60, 625, 27, 107, 607, 240, 975, 818, 584, 992, 
-    901, 547, 793, 922, 856, 655, 715, 1002, 179, 598, 650, 402, 83, 673, 688, 883, 
-    258, 820, 678, 20, 506, 35, 879, 493, 493, 542, 643, 506, 141, 452, 502, 757, 
-    562, 334, 69, 527, 233, 433, 889, 440, 377, 925, 1001, 866, 705, 846, 292, 55, 
-    220, 700, 555, 807, 725, 587, 163, 122, 75, 554, 951, 436, 871, 226, 161, 227, 
-    817, 158, 237, 365, 731, 563, 306, 881, 201, 173, 89, 329, 997, 925, 380, 147, 
-    264, 64, 147, 813, 998, 177, 110, 951, 680, 147, 808, 641, 617, 327, 805, 920, 
-    271, 441, 577, 182, 971, 84, 280, 385, 840, 217, 746, 435, 666, 274, 451, 56, 
-    312, 183, 810, 386, 170, 11, 589, 256, 158, 199, 108, 718, 981, 783, 411, 612, 
-    519, 505, 105, 441, 1015, 176, 582, 800, 263, 878, 676, 685, 735, 757, 926, 656, 
-    529, 898, 671, 914, 256, 251, 458, 302, 675, 42, 784, 824, 638, 212, 327, 560, 
-    699, 825, 32, 531, 56, 5, 36, 2, 700, 312, 652, 991, 448, 339, 363, 194, 
-    634, 407, 749, 196, 765, 260, 695, 753, 157, 58, 26, 479, 840, 25, 345, 985, 
-    992, 770, 641, 65, 387, 746, 747, 155, 54, 421, 472, 560, 962, 942, 687, 4, 
-    435, 803, 433, 854, 285, 1011, 324, 423, 979, 681, 340, 193, 912, 855, 452, 710, 
-    509, 639, 494, 447, 90, 692, 280, 970, 966, 350, 734, 437, 218, 728, 375, 254, 
-    633, 923, 73, 504, 552, 150, 230, 151, 1005, 610, 983, 566, 343, 575, 51, 217, 
-    276, 838, 186, 178, 609, 630, 46, 765, 664, 537, 583, 252, 995, 616, 384, 579, 
-    528, 437, 103, 689, 84, 782, 349, 492, 751, 916, 161, 619, 368, 914, 953, 450, 
-    107, 901, 978, 555, 191, 294, 544, 540, 977, 301, 512, 35, 685, 781, 618, 883, 
-    999, 564, 804, 621, 628, 100, 776, 259, 642, 900, 18, 303, 613, 263, 811, 11, 
-    333, 293, 180, 886, 519, 876, 964, 771, 601, 853, 890, 373, 515, 462, 982, 460, 
-    1012, 958, 1006, 38, 67, 578, 710, 911, 644, 255, 878, 26, 847, 632, 606, 460, 
-    16, 521, 706, 106, 18, 536, 741, 945, 212, 133, 88, 506, 382, 172, 423, 960, 
-    538, 943, 903, 823, 936, 603, 927, 109, 542, 357, 13, 515, 745, 714, 582, 893, 
-    714, 840, 994, 891, 437, 415, 1020, 604, 399, 710, 408, 214, 833, 932, 43, 234, 
-    671, 961, 687, 997, 1000, 605, 98, 334, 207, 702, 924, 27, 296, 639, 154, 969, 
-    666, 592, 18, 816, 723, 83, 425, 889, 291, 48, 365, 152, 907, 695, 185, 669, 
-    647, 518, 212, 468, 173, 888, 763, 892, 724, 649, 413, 323, 274, 785, 644, 860, 
-    942, 134, 122, 177, 839, 28, 931, 962, 368, 566, 77, 248, 978, 23, 514, 699, 
-    764, 11, 973, 595, 70, 34, 34, 610, 884, 494, 686, 916, 182, 604, 611, 736, 
-    628, 738, 177, 1015, 111, 175, 482, 424, 608, 349, 81, 589, 215, 598, 337, 952, 
-    8, 265, 56, 804, 82, 821, 738, 4, 125, 920, 654, 594, 600, 928, 13, 642, 
-    578, 795, 430, 583, 921, 367, 420, 718, 341, 218, 38, 354, 339, 375, 634, 47, 
-    50, 144, 810, 308, 70, 989, 679, 319, 943, 257, 68, 544, 430, 970, 543, 13, 
-    694, 1023, 772, 848, 377, 243, 794, 43, 983, 699, 267, 832, 343, 672, 800, 591, 
-    84, 706, 940, 296, 160, 14, 241, 249, 592, 791, 635, 891, 124, 873, 490, 389, 
-    645, 687, 953, 453, 7, 496, 248, 701, 25, 685, 753, 440, 508, 703, 139, 488, 
-    309, 388, 312, 675, 933, 24, 412, 303, 387, 989, 258, 234, 570, 541, 429, 261, 
-    246, 920, 346, 675, 331, 718, 753, 877, 917, 177, 884, 163, 70, 732, 968, 305, 
-    17, 723, 692, 466, 459, 40, 283, 631, 117, 333, 117, 701, 8, 876, 683, 489, 
-    1004, 140, 695, 170, 545, 636, 513, 729, 843, 633, 744, 255, 769, 179, 596, 129, 
-    503, 732, 919, 716, 689, 644, 647, 837, 973, 227, 92, 277, 676, 720, 143, 992, 
-    825, 885, 459, 348, 807, 139, 652, 292, 767, 946, 577, 751, 467, 56, 506, 901, 
-    182, 286, 145, 569, 763, 38, 896, 674, 390, 274, 374, 727, 282, 194, 739, 676, 
-    563, 594, 888, 143, 495, 418, 668, 948, 779, 348, 710, 185, 409, 719, 942, 805, 
-    193, 1019, 814, 522, 707, 474, 442, 897, 736, 321, 67, 432, 143, 87, 707, 563, 
-    928, 918, 272, 339, 530, 660, 988, 251, 3, 871, 410, 730, 1006, 165, 52, 516, 
-    248, 168, 959, 560, 788, 323, 943, 889, 906, 672, 854, 655, 334, 281, 221, 286, 
-    258, 728, 84, 306, 113, 238, 986, 765, 635, 529, 830, 281, 990, 865, 293, 911, 
-    244, 511, 33, 672, 650, 754, 334, 534, 79, 294, 53, 452, 631, 483, 11, 312, 
-    660, 542, 261, 325, 116, 75, 602, 990, 730, 248, 788, 718, 347, 68, 628, 456, 
-    1000, 807, 79, 256, 939, 233, 627, 372, 494, 208, 249, 1022, 644, 969, 956, 957, 
-    210, 865, 3, 612, 82, 979, 94, 438, 857, 348, 807, 371, 816, 709, 418, 366, 
-    654, 562, 35, 671, 579, 146, 964, 281, 964, 103, 459, 906, 133, 30, 318, 791, 
-    1012, 76, 861, 982, 565, 305, 486, 860, 489, 713, 183, 889, 730, 52, 829, 544, 
-    840, 453, 86, 210, 102, 726, 677, 290, 658, 981, 798, 831, 147, 429, 343, 866, 
-    122, 808, 726, 652, 50, 688, 308, 518, 762, 246, 528, 768, 141, 687, 45, 338, 
-    622, 871, 865, 24, 506, 463, 594, 508, 271, 545, 542, 925, 407, 854, 992, 787, 
-    511, 513, 435, 429, 905, 274, 711, 568, 201, 140, 804, 805, 264, 679, 1019, 140, 
-    399, 646, 301, 353, 733, 981, 103, 544, 654, 856, 7, 981, 251, 968, 622, 296, 
-    467, 428, 845, 26, 694, 162, 323, 525, 216, 132, 599, 854, 396, 478, 424, 659, 
-    169, 593, 824, 273, 224, 871, 927, 292, 61, 69, 551, 81, 369, 371, 222, 44, 
-    51, 369, 362, 219, 740, 256, 922, 956, 925, 223, 559, 814, 172, 887, 685, 919, 
-    481, 111, 716, 281, 97, 426, 28, 398, 198, 79, 727, 449, 605, 548, 158, 289, 
-    996, 643, 340, 281, 145, 332, 625, 233, 855, 735, 681, 861, 255, 89, 914, 27, 
-    86, 1001, 149, 331, 673, 993, 841, 716, 903, 683, 685, 632, 53, 267, 738, 952, 
-    727, 661, 927, 169, 974, 495, 597, 744, 180, 1004, 281, 1005, 374, 466, 838, 465, 
-    459, 783, 216, 842, 216, 648, 1014, 1008, 648, 255, 755, 0, 507, 252, 47, 668, 
-    120, 943, 225, 262, 363, 186, 468, 294, 52, 184, 619, 607, 866, 433, 926, 477, 
-    71, 276, 16, 462, 912, 911, 858, 280, 179, 384, 165, 674, 86, 561, 180, 981, 
-    787, 538, 962, 927, 770, 87, 1011, 738, 636, 418, 277, 199, 436, 231, 644, 124, 
-    364, 438, 1017, 906, 112, 417, 139, 611, 149, 544, 734, 27, 312, 342, 438, 334, 
-    911, 849, 483, 657, 495, 401, 138, 256, 387, 259, 948, 139, 158, 821, 524, 719, 
-    811, 684, 161, 772, 926, 513, 142, 308, 569, 334, 643, 140, 812, 286, 273, 397, 
-    745, 346, 917, 284, 515, 967, 481, 977, 436, 850, 767, 133, 310, 820, 182, 44, 
-    69, 292, 1001, 474, 912, 344, 216, 462, 969, 872, 408, 467, 608, 1018, 857, 424, 
-    711, 234, 123, 996, 364, 371, 519, 853, 586, 530, 832, 223, 54, 781, 417, 591, 
-    121, 759, 712, 583, 250, 905, 61, 324, 1011, 470, 313, 505, 456, 633, 844, 261, 
-    750, 83, 626, 323, 488, 454, 575, 171, 631, 983, 227, 424, 728, 963, 302, 627, 
-    705, 573, 301, 565, 290, 836, 937, 52, 871, 77, 738, 852, 709, 420, 28, 753, 
-    89, 16, 307, 157, 351, 834, 896, 814, 261, 1016, 131, 373, 152, 290, 354, 436, 
-    871, 755, 77, 289, 725, 268, 841, 658, 493, 484, 888, 526, 140, 65, 310, 621, 
-    251, 839, 93, 103, 223, 1022, 371, 345, 721, 20, 1015, 725, 741, 371, 983, 541, 
-    619, 650, 771, 937, 361, 229, 849, 441, 368, 578, 285, 925, 68, 464, 337, 744, 
-    976, 512, 473, 975, 502, 447, 492, 769, 560, 819, 39, 878, 552, 322, 330, 104, 
-    496, 719, 105, 147, 994, 74, 298, 921, 404, 986, 280, 937, 767, 328, 253, 585, 
-    231, 793, 812, 28, 857, 288, 710, 457, 910, 430, 765, 131, 545, 744, 849, 525, 
-    290, 904, 871, 737, 630, 400, 914, 577, 754, 506, 843, 737, 848, 186, 251, 754, 
-    419, 446, 182, 478, 748, 148, 163, 806, 195, 403, 507, 654, 697, 272, 262, 475, 
-    440, 669, 12, 672, 224, 778, 75, 128, 523, 296, 606, 770, 907, 788, 965, 143, 
-    520, 133, 749, 960, 562, 967, 299, 93, 954, 850, 792, 630, 979, 136, 32, 619, 
-    415, 989, 1000, 606, 751, 629, 345, 990, 566, 908, 347, 898, 871, 816, 900, 126, 
-    554, 602, 30, 641, 606, 63, 178, 100, 801, 529, 141, 170, 832, 888, 293, 597, 
-    494, 889, 322, 221, 398, 524, 286, 488, 416, 595, 728, 816, 878, 220, 919, 561, 
-    963, 95, 118, 410, 956, 841, 139, 433, 873, 731, 990, 125, 843, 826, 1012, 839, 
-    947, 629, 627, 173, 82, 602, 205, 673, 47, 481, 251, 807, 759, 964, 607, 199, 
-    139, 498, 203, 548, 532, 42, 732, 521, 228, 642, 473, 518, 373, 688, 430, 133, 
-    716, 175, 8, 431, 928, 199, 754, 841, 490, 766, 664, 125, 85, 648, 982, 698, 
-    623, 494, 1005, 489, 531, 577, 697, 308, 661, 318, 791, 378, 527, 548, 251, 115, 
-    640, 951, 187, 639, 165, 737, 914, 549, 234, 984, 591, 268, 129, 532, 331, 499, 
-    667, 415, 731, 588, 816, 225, 271, 332, 642, 9, 850, 315, 696, 554, 63, 565, 
-    204, 284, 84, 186, 150, 359, 370, 210, 594, 551, 811, 296, 979, 81, 770, 98, 
-    350, 329, 357, 503, 601, 208, 279, 245, 880, 767, 322, 521, 801, 381, 808, 213, 
-    122, 371, 516, 524, 880, 47, 718, 822, 110, 882, 419, 580, 902, 937, 749, 880, 
-    822, 279, 646, 35, 143, 34, 384, 414, 466, 88, 531, 497, 365, 953, 460, 76, 
-    113, 852, 341, 850, 87, 259, 959, 249, 309, 622, 727, 867, 327, 894, 958, 125, 
-    336, 947, 599, 329, 83, 14, 79, 493, 343, 578, 78, 608, 800, 113, 215, 119, 
-    693, 617, 573, 240, 692, 781, 95, 430, 639, 1021, 820, 676, 467, 985, 15, 228, 
-    349, 44, 113, 5, 296, 790, 724, 967, 706, 137, 65, 755, 893, 605, 297, 879, 
-    616, 403, 795, 552, 281, 210, 687, 182, 446, 665, 930, 793, 478, 633, 828, 431, 
-    1006, 655, 244, 754, 1012, 247, 616, 862, 522, 784, 90, 127, 770, 292, 824, 444, 
-    197, 191, 199, 932, 181, 117, 839, 642, 782, 610, 269, 620, 847, 934, 789, 1017, 
-    900, 121, 368, 763, 429, 119, 699, 422, 636, 961, 585, 415, 24, 411, 701, 621, 
-    8, 325, 882, 754, 240, 340, 903, 808, 634, 5, 588, 579, 218, 54, 957, 676, 
-    354, 536, 912, 32, 616, 909, 568, 962, 385, 518, 294, 197, 647, 966, 115, 755, 
-    250, 887, 605, 498, 538, 34, 434, 169, 353, 632, 83, 638, 384, 910, 25, 586, 
-    199, 808, 562, 493, 686, 853, 812, 5, 69, 545, 740, 911, 145, 305, 62, 714, 
-    28, 198, 72, 144, 968, 546, 108, 973, 214, 93, 882, 642, 408, 521, 1017, 404, 
-    469, 309, 161, 743, 491, 731, 1007, 416, 544, 903, 250, 180, 382, 55, 816, 736, 
-    361, 783, 223, 306, 1021, 799, 634, 123, 601, 102, 508, 988, 349, 659, 991, 622, 
-    190, 81, 478, 352, 13, 387, 949, 124, 922, 81, 184, 969, 706, 103, 365, 821, 
-    121, 309, 88, 732, 724, 581, 257, 447, 53, 68, 117, 444, 23, 20, 534, 570, 
-    782, 341, 145, 816, 155, 688, 421, 550, 484, 809, 62, 485, 473, 315, 728, 196, 
-    382, 265, 563, 1003, 341, 271, 395, 88, 673, 683, 147, 924, 501, 276, 857, 269, 
-    386, 151, 495, 283, 894, 640, 523, 892, 374, 928, 12, 80, 403, 603, 592, 997, 
-    720, 918, 595, 116, 763, 942, 799, 159, 10, 933, 30, 730, 674, 976, 211, 192, 
-    151, 555, 140, 910, 279, 952, 343, 522, 432, 127, 158, 960, 1011, 609, 221, 545, 
-    979, 220, 19, 911, 87, 439, 543, 645, 418, 311, 385, 127, 1002, 150, 607, 473, 
-    221, 337, 371, 749, 484, 842, 191, 996, 853, 138, 751, 439, 642, 166, 320, 40, 
-    434, 746, 826, 200, 569, 1019, 770, 942, 758, 492, 100, 927, 292, 694, 353, 896, 
-    122, 927, 414, 251, 679, 251, 859, 380, 30, 803, 932, 905, 844, 194, 188, 249, 
-    288, 987, 890, 1011, 565, 42, 505, 148, 794, 960, 665, 315, 111, 406, 101, 850, 
-    4, 100, 120, 450, 363, 247, 500, 240, 641, 280, 498, 110, 2, 837, 849, 651, 
-    346, 991, 997, 425, 806, 716, 860, 155, 575, 962, 647, 277, 183, 724, 49, 1012, 
-    301, 633, 361, 698, 427, 622, 220, 124, 610, 654, 936, 252, 918, 152, 723, 82, 
-    854, 672, 249, 795, 696, 436, 218, 869, 355, 513, 830, 929, 348, 203, 40, 176, 
-    1002, 1017, 362, 742, 93, 657, 822, 370, 832, 777, 310, 997, 518, 566, 93, 359, 
-    958, 351, 536, 1005, 368, 901, 639, 966, 251, 566, 329, 398, 715, 151, 899, 206, 
-    125, 107, 552, 840, 479, 895, 509, 322, 559, 383, 585, 550, 1021, 817, 158, 96, 
-    604, 567, 766, 660, 176, 48, 514, 535, 508, 294, 18, 609, 235, 361, 369, 242, 
-    361, 472, 218, 592, 749, 503, 472, 468, 978, 556, 328, 1, 696, 901, 686, 287, 
-    191, 158, 822, 242, 140, 700, 187, 34, 62, 941, 117, 746, 245, 491, 914, 25, 
-    754, 211, 175, 926, 908, 924, 859, 459, 632, 674, 308, 644, 520, 883, 435, 536, 
-    614, 903, 140, 513, 153, 980, 354, 179, 399, 839, 679, 637, 3, 813, 42, 320, 
-    502, 261, 323, 676, 206, 403, 652, 910, 926, 911, 944, 970, 271, 468, 522, 413, 
-    614, 731, 567, 404, 864, 407, 756, 766, 170, 236, 353, 892, 268, 126, 105, 746, 
-    501, 726, 625, 309, 795, 990, 706, 3, 560, 595, 184, 749, 486, 366, 231, 801, 
-    170, 790, 1011, 479, 340, 618, 702, 849, 126, 737, 165, 574, 499, 328, 26, 162, 
-    982, 744, 958, 910, 829, 242, 713, 75, 800, 234, 892, 49, 277, 874, 499, 150, 
-    632, 104, 948, 929, 395, 85, 47, 958, 485, 919, 614, 10, 22, 554, 360, 773, 
-    310, 798, 733, 336, 791, 130, 589, 364, 734, 684, 125, 659, 558, 33, 34, 462, 
-    628, 302, 394, 120, 638, 483, 953, 1009, 504, 957, 799, 251, 638, 101, 282, 992, 
-    421, 767, 760, 24, 272, 232, 331, 571, 468, 24, 629, 473, 581, 120, 304, 524, 
-    365, 197, 706, 220, 248, 743, 994, 72, 885, 299, 416, 821, 715, 418, 377, 817, 
-    920, 506, 924, 336, 1009, 946, 962, 126, 484, 688, 648, 437, 563, 983, 196, 468, 
-    507, 210, 621, 55, 731, 524, 210, 965, 329, 275, 77, 281, 228, 737, 729, 17, 
-    812, 563, 665, 740, 530, 987, 835, 936, 684, 807, 367, 627, 132, 156, 410, 121, 
-    58, 170, 829, 153, 546, 281, 458, 622, 998, 522, 112, 842, 482, 715, 641, 566, 
-    475, 212, 266, 757, 236, 296, 174, 680, 866, 378, 815, 944, 429, 815, 783, 155, 
-    128, 800, 596, 860, 145, 966, 383, 405, 36, 220, 287, 615, 549, 357, 506, 889, 
-    1007, 456, 204, 221, 707, 600, 591, 547, 501, 553, 179, 945, 773, 815, 986, 839, 
-    345, 228, 224, 899, 230, 750, 1, 490, 396, 781, 638, 621, 1018, 912, 1004, 277, 
-    1004, 318, 963, 676, 194, 423, 970, 112, 902, 277, 296, 661, 30, 191, 996, 30, 
-    811, 446, 740, 409, 328, 621, 56, 872, 918, 532, 185, 422, 602, 887, 685, 321, 
-    979, 941, 944, 602, 182, 344, 638, 490, 846, 749, 231, 209, 0, 544, 325, 773, 
-    597, 613, 473, 946, 3, 6, 422, 744, 888, 733, 916, 748, 256, 873, 827, 302, 
-    584, 301, 379, 217, 396, 684, 166, 862, 1000, 654, 478, 490, 847, 899, 76, 320, 
-    602, 967, 512, 653, 242, 165, 125, 267, 945, 66, 202, 972, 383, 18, 255, 44, 
-    138, 528, 204, 882, 518, 307, 638, 771, 137, 507, 257, 937, 194, 591, 1021, 634, 
-    102, 581, 54, 349, 186, 939, 708, 692, 499, 835, 407, 796, 811, 739, 535, 786, 
-    461, 659, 918, 833, 231, 838, 887, 723, 219, 554, 911, 1003, 344, 979, 1021, 146, 
-    264, 104, 503, 170, 391, 607, 106, 359, 974, 992, 944, 490, 309, 99, 5, 945, 
-    81, 1000, 767, 692, 471, 791, 1016, 660, 353, 39, 778, 526, 711, 600, 251, 359, 
-    195, 755, 834, 431, 215, 229, 999, 646, 445, 334, 907, 979, 157, 522, 297, 777, 
-    155, 12, 36, 379, 847, 235, 173, 919, 950, 171, 876, 891, 10, 599, 522, 588, 
-    842, 871, 657, 173, 118, 627, 163, 129, 1023, 870, 791, 726, 296, 279, 320, 887, 
-    213, 616, 754, 329, 450, 187, 273, 975, 835, 507, 192, 649, 919, 211, 1021, 623, 
-    916, 594, 854, 231, 177, 864, 357, 399, 563, 229, 136, 67, 68, 679, 549, 816, 
-    723, 399, 638, 760, 433, 104, 938, 505, 831, 12, 809, 132, 493, 1000, 674, 788, 
-    705, 191, 271, 31, 877, 748, 205, 371, 820, 970, 328, 885, 736, 325, 202, 551, 
-    271, 759, 810, 711, 1007, 317, 876, 291, 763, 702, 160, 663, 907, 932, 389, 367, 
-    450, 686, 562, 980, 97, 238, 237, 901, 740, 681, 349, 460, 265, 959, 901, 274, 
-    379, 140, 820, 460, 441, 93, 721, 969, 651, 9, 607, 124, 376, 334, 21, 523, 
-    145, 268, 901, 38, 66, 340, 32, 662, 510, 704, 347, 821, 409, 544, 570, 506, 
-    551, 407, 698, 628, 705, 860, 457, 1023, 99, 451, 897, 390, 924, 710, 73, 221, 
-    674, 905, 213, 277, 883, 233, 832, 881, 599, 679, 859, 157, 550, 739, 272, 727, 
-    549, 618, 882, 1022, 51, 772, 574, 1022, 424, 683, 253, 199, 224, 915, 22, 403, 
-    859, 569, 954, 537, 391, 887, 1011, 747, 85, 656, 461, 36, 820, 785, 63, 632, 
-    616, 761, 755, 894, 447, 216, 332, 404, 755, 865, 125, 716, 626, 766, 325, 628, 
-    579, 744, 143, 660, 821, 20, 663, 932, 989, 148, 682, 113, 349, 44, 941, 560, 
-    741, 436, 266, 67, 191, 851, 255, 98, 711, 459, 594, 390, 756, 459, 766, 722, 
-    275, 567, 786, 126, 19, 497, 2, 496, 372, 611, 467, 846, 396, 570, 928, 931, 
-    559, 245, 373, 773, 1002, 475, 862, 450, 95, 244, 384, 792, 86, 885, 384, 801, 
-    220, 664, 749, 438, 251, 950, 362, 113, 616, 571, 478, 73, 528, 129, 121, 531, 
-    890, 314, 307, 267, 95, 416, 600, 555, 565, 89, 133, 1017, 577, 269, 171, 591, 
-    341, 555, 323, 374, 356, 153, 933, 832, 983, 444, 376, 720, 765, 746, 261, 493, 
-    604, 78, 602, 621, 436, 550, 99, 13, 79, 432, 641, 121, 140, 488, 106, 149, 
-    768, 890, 159, 880, 454, 330, 234, 351, 830, 375, 545, 446, 848, 407, 416, 836, 
-    750, 129, 222, 79, 204, 264, 459, 737, 128, 127, 19, 628, 235, 224, 670, 631, 
-    329, 43, 425, 734, 324, 697, 721, 114, 74, 670, 712, 720, 646, 554, 231, 757, 
-    729, 832, 58, 944, 65, 1, 770, 573, 196, 1018, 304, 1008, 984, 642, 722, 539, 
-    95, 168, 269, 237, 303, 1001, 825, 710, 477, 483, 850, 997, 355, 535, 757, 46, 
-    439, 325, 506, 362, 782, 374, 850, 920, 443, 493, 626, 813, 856, 947, 976, 353, 
-    554, 103, 448, 923, 487, 861, 956, 591, 114, 774, 818, 510, 264, 306, 252, 441, 
-    794, 613, 525, 344, 262, 151, 975, 185, 217, 682, 788, 260, 859, 1019, 413, 949, 
-    27, 961, 743, 1022, 444, 475, 510, 354, 582, 340, 843, 537, 928, 363, 82, 148, 
-    897, 502, 921, 191, 520, 71, 243, 437, 193, 734, 135, 270, 451, 345, 503, 641, 
-    987, 517, 294, 388, 398, 967, 411, 374, 565, 747, 66, 695, 188, 318, 776, 66, 
-    877, 422, 914, 160, 255, 750, 652, 937, 281, 303, 580, 314, 489, 942, 128, 931, 
-    422, 927, 180, 162, 847, 486, 542, 765, 532, 866, 37, 119, 518, 377, 172, 809, 
-    122, 493, 97, 606, 371, 927, 628, 13, 577, 341, 785, 608, 635, 1, 705, 154, 
-    135, 207, 729, 465, 524, 329, 899, 638, 638, 959, 382, 945, 187, 737, 987, 296, 
-    235, 808, 751, 151, 393, 844, 743, 687, 127, 1011, 1019, 977, 178, 8, 775, 279, 
-    52, 190, 796, 47, 566, 985, 756, 916, 1019, 520, 339, 467, 106, 501, 925, 313, 
-    150, 846, 108, 947, 943, 768, 237, 296, 986, 580, 720, 574, 476, 754, 801, 528, 
-    201, 297, 77, 392, 670, 744, 187, 209, 56, 171, 341, 84, 527, 548, 794, 485, 
-    476, 944, 895, 1017, 57, 928, 229, 811, 29, 180, 697, 1007, 514, 620, 849, 689, 
-    767, 377, 527, 792, 861, 700, 644, 258, 426, 59, 951, 823, 441, 1016, 689, 942, 
-    676, 253, 764, 722, 508, 779, 539, 83, 211, 582, 9, 740, 1019, 936, 853, 60, 
-    784, 335, 82, 724, 258, 693, 834, 334, 389, 414, 446, 295, 236, 217, 794, 920, 
-    745, 110, 855, 788, 862, 139, 369, 546, 801, 905, 388, 448, 31, 938, 592, 751, 
-    686, 2, 420, 1013, 24, 215, 695, 567, 575, 439, 201, 405, 640, 408, 686, 253, 
-    889, 527, 839, 731, 492, 768, 624, 986, 867, 315, 207, 347, 668, 593, 733, 115, 
-    910, 720, 857, 197, 263, 38, 193, 557, 30, 837, 237, 222, 514, 390, 185, 553, 
-    204, 5, 1009, 402, 803, 54, 497, 566, 222, 584, 711, 901, 59, 693, 558, 958, 
-    993, 299, 25, 953, 477, 904, 916, 303, 563, 1017, 563, 701, 848, 784, 990, 199, 
-    980, 99, 972, 415, 709, 919, 238, 176, 175, 863, 232, 735, 508, 238, 111, 104, 
-    359, 683, 973, 340, 962, 874, 326, 165, 684, 20, 861, 724, 984, 789, 629, 140, 
-    795, 650, 367, 806, 306, 234, 181, 265, 318, 300, 1022, 448, 661, 587, 934, 1013, 
-    580, 382, 730, 20, 792, 341, 490, 80, 68, 133, 338, 311, 625, 339, 827, 938, 
-    59, 314, 890, 437, 353, 547, 88, 800, 769, 608, 126, 190, 245, 899, 631, 978, 
-    973, 551, 177, 333, 907, 440, 730, 410, 131, 836, 751, 527, 932, 826, 502, 290, 
-    316, 48, 909, 237, 643, 619, 114, 452, 716, 325, 731, 631, 474, 254, 903, 989, 
-    577, 280, 533, 154, 293, 52, 662, 494, 968, 432, 48, 150, 935, 907, 722, 686, 
-    466, 246, 1016, 319, 433, 161, 808, 364, 21, 479, 796, 765, 864, 825, 357, 478, 
-    969, 393, 533, 453, 324, 919, 780, 523, 219, 41, 233, 38, 443, 516, 440, 171, 
-    292, 840, 804, 164, 633, 987, 943, 795, 197, 933, 805, 262, 439, 555, 213, 665, 
-    1010, 533, 635, 316, 391, 1005, 360, 563, 504, 169, 209, 941, 233, 556, 925, 573, 
-    76, 228, 835, 965, 138, 638, 109, 596, 958, 440, 892, 791, 25, 536, 471, 548, 
-    340, 1021, 753, 576, 100, 106, 294, 779, 145, 9, 714, 761, 887, 867, 21, 353, 
-    485, 286, 346, 508, 987, 110, 258, 745, 649, 904, 278, 241, 363, 736, 427, 899, 
-    370, 397, 605, 699, 48, 465, 356, 250, 415, 488, 527, 247, 553, 338, 9, 883, 
-    322, 603, 385, 81, 898, 164, 816, 419, 704, 655, 227, 108, 547, 364, 269, 709, 
-    920, 190, 844, 942, 816, 129, 711, 459, 597, 750, 860, 366, 726, 8, 281, 914, 
-    975, 410, 946, 741, 408, 389, 182, 687, 482, 29, 596, 47, 595, 336, 944, 119, 
-    919, 815, 836, 1021, 870, 699, 4, 941, 391, 718, 294, 224, 958, 401, 64, 806, 
-    261, 438, 625, 1005, 292, 599, 496, 475, 570, 559, 341, 60, 179, 424, 364, 783, 
-    561, 854, 91, 5, 801, 479, 940, 573, 598, 125, 301, 1013, 234, 405, 302, 599, 
-    288, 243, 951, 355, 730, 649, 522, 515, 382, 384, 212, 530, 945, 269, 60, 173, 
-    493, 654, 722, 560, 0, 495, 990, 165, 591, 188, 579, 331, 166, 650, 808, 611, 
-    683, 558, 623, 361, 630, 959, 526, 835, 936, 301, 379, 831, 64, 822, 592, 53, 
-    152, 569, 142, 362, 376, 953, 232, 934, 281, 874, 849, 969, 33, 572, 177, 502, 
-    121, 98, 90, 179, 829, 697, 240, 320, 34, 442, 965, 846, 752, 496, 364, 606, 
-    992, 234, 366, 649, 150, 892, 351, 434, 816, 426, 829, 25, 531, 4, 353, 693, 
-    303, 42, 970, 600, 408, 846, 802, 952, 36, 885, 855, 405, 485, 65, 442, 842, 
-    304, 444, 193, 907, 77, 484, 70, 110, 448, 722, 265, 315, 863, 669, 820, 1015, 
-    620, 167, 93, 90, 349, 76, 48, 975, 499, 167, 394, 216, 894, 97, 890, 656, 
-    499, 651, 172, 354, 747, 387, 1013, 2, 788, 549, 897, 235, 23, 1011, 745, 502, 
-    373, 909, 239, 840, 538, 958, 670, 552, 363, 103, 669, 331, 762, 411, 205, 700, 
-    256, 115, 76, 19, 278, 444, 329, 613, 658, 96, 705, 385, 614, 57, 788, 105, 
-    697, 809, 75, 326, 105, 695, 164, 651, 156, 773, 842, 562, 272, 809, 804, 789, 
-    477, 555, 108, 410, 33, 426, 362, 477, 781, 820, 152, 592, 17, 1005, 865, 887, 
-    195, 205, 177, 661, 220, 469, 303, 854, 780, 738, 950, 138, 484, 964, 959, 793, 
-    322, 1023, 707, 876, 100, 836, 464, 62, 495, 637, 99, 317, 617, 763, 389, 343, 
-    140, 493, 930, 275, 224, 279, 705, 92, 871, 341, 344, 260, 897, 150, 282, 689, 
-    520, 652, 629, 638, 6, 492, 54, 572, 235, 811, 483, 657, 163, 719, 56, 998, 
-    828, 315, 836, 837, 170, 106, 131, 148, 123, 991, 376, 714, 824, 152, 163, 868, 
-    730, 241, 483, 642, 535, 300, 405, 227, 938, 594, 761, 269, 91, 803, 701, 935, 
-    594, 540, 168, 767, 48, 199, 705, 234, 1020, 226, 432, 396, 374, 55, 945, 957, 
-    242, 693, 768, 148, 330, 381, 942, 448, 342, 456, 973, 855, 845, 113, 622, 771, 
-    258, 787, 211, 617, 507, 228, 426, 731, 613, 543, 378, 330, 878, 1023, 699, 759, 
-    773, 769, 941, 818, 18, 351, 675, 283, 60, 810, 90, 434, 751, 898, 121, 415, 
-    64, 589, 837, 1001, 835, 943, 993, 529, 361, 687, 384, 674, 813, 387, 191, 770, 
-    720, 338, 932, 893, 166, 834, 865, 958, 371, 795, 980, 850, 51, 860, 300, 687, 
-    59, 832, 916, 688, 873, 719, 340, 995, 802, 1004, 970, 158, 859, 146, 189, 347, 
-    915, 835, 970, 246, 593, 193, 359, 620, 660, 630, 900, 768, 823, 258, 225, 124, 
-    393, 147, 599, 799, 213, 668, 488, 932, 606, 461, 782, 1014, 115, 616, 274, 403, 
-    665, 589, 628, 826, 613, 660, 750, 150, 240, 185, 151, 229, 929, 836, 308, 1007, 
-    113, 86, 312, 447, 279, 603, 284, 828, 650, 379, 734, 362, 183, 46, 522, 190, 
-    644, 819, 300, 151, 733, 176, 858, 159, 268, 963, 478, 643, 25, 929, 259, 704, 
-    201, 446, 232, 580, 852, 248, 957, 112, 950, 549, 47, 0, 757, 127, 542, 166, 
-    637, 23, 374, 498, 265, 868, 17, 328, 668, 360, 985, 209, 868, 914, 870, 831, 
-    956, 593, 925, 958, 851, 565, 489, 366, 176, 932, 356, 149, 707, 34, 178, 385, 
-    790, 387, 476, 1, 18, 995, 796, 204, 564, 781, 562, 842, 86, 397, 806, 798, 
-    928, 640, 586, 699, 908, 782, 624, 486, 750, 438, 75, 892, 21, 319, 949, 833, 
-    560, 785, 575, 860, 117, 425, 612, 757, 251, 723, 745, 713, 603, 487, 248, 523, 
-    204, 356, 323, 554, 450, 762, 592, 478, 767, 528, 807, 812, 791, 826, 892, 890, 
-    333, 971, 1001, 517, 304, 239, 26, 934, 172, 969, 582, 1020, 954, 711, 783, 248, 
-    4, 596, 496, 288, 324, 613, 284, 669, 446, 105, 877, 50, 138, 37, 522, 131, 
-    213, 148, 320, 818, 345, 18, 200, 468, 455, 391, 374, 597, 951, 1021, 491, 228, 
-    964, 516, 805, 1023, 511, 34, 76, 656, 807, 784, 883, 144, 567, 462, 296, 979, 
-    886, 304, 264, 421, 411, 232, 825, 866, 864, 195, 148, 594, 379, 594, 63, 16, 
-    963, 366, 91, 715, 751, 392, 573, 1018, 132, 490, 583, 154, 628, 137, 289, 606, 
-    48, 724, 397, 198, 138, 244, 825, 808, 1004, 524, 593, 867, 338, 874, 370, 758, 
-    381, 64, 683, 406, 376, 582, 747, 113, 447, 34, 949, 178, 496, 988, 211, 1011, 
-    587, 535, 714, 202, 913, 248, 108, 872, 78, 255, 803, 123, 180, 507, 345, 185, 
-    942, 259, 579, 616, 828, 850, 606, 823, 654, 238, 423, 14, 992, 503, 325, 419, 
-    634, 629, 847, 345, 322, 662, 313, 872, 365, 719, 969, 422, 576, 939, 638, 115, 
-    136, 598, 140, 339, 482, 931, 999, 197, 112, 1021, 83, 56, 634, 157, 979, 207, 
-    559, 697, 28, 128, 271, 400, 414, 144, 452, 115, 26, 893, 311, 697, 688, 173, 
-    694, 282, 846, 558, 452, 722, 563, 813, 944, 240, 994, 502, 561, 191, 365, 663, 
-    179, 431, 542, 37, 771, 843, 190, 40, 718, 220, 403, 234, 125, 402, 405, 809, 
-    284, 401, 450, 138, 591, 433, 169, 924, 562, 379, 681, 953, 202, 52, 735, 29, 
-    770, 109, 280, 1016, 487, 45, 35, 383, 815, 171, 378, 333, 514, 449, 666, 408, 
-    523, 370, 901, 729, 901, 104, 358, 1007, 235, 55, 336, 736, 6, 556, 178, 962, 
-    101, 25, 946, 889, 312, 194, 855, 189, 961, 199, 974, 133, 553, 373, 401, 384, 
-    717, 310, 707, 948, 555, 591, 239, 865, 267, 835, 253, 181, 735, 475, 428, 612, 
-    626, 266, 969, 158, 958, 673, 445, 415, 236, 98, 988, 909, 887, 354, 958, 977, 
-    1017, 498, 299, 654, 366, 486, 130, 121, 349, 627, 787, 768, 840, 210, 808, 746, 
-    819, 366, 983, 995, 680, 221, 838, 637, 128, 522, 950, 262, 955, 673, 989, 337, 
-    740, 695, 80, 583, 752, 661, 638, 494, 514, 601, 81, 715, 305, 534, 717, 271, 
-    569, 24, 390, 355, 469, 382, 395, 167, 489, 966, 197, 972, 301, 873, 271, 679, 
-    103, 160, 491, 557, 203, 843, 735, 384, 284, 841, 639, 370, 420, 982, 298, 565, 
-    664, 798, 968, 72, 270, 227, 160, 231, 327, 385, 1019, 94, 683, 169, 978, 819, 
-    348, 298, 799, 290, 695, 371, 435, 335, 235, 585, 654, 745, 335, 901, 168, 277, 
-    391, 922, 557, 156, 660, 744, 161, 902, 650, 859, 499, 987, 633, 478, 143, 795, 
-    690, 194, 871, 595, 977, 516, 900, 719, 977, 415, 879, 243, 1003, 895, 610, 177, 
-    760, 77, 892, 942, 174, 759, 784, 53, 700, 282, 701, 692, 160, 352, 358, 237, 
-    1019, 44, 212, 346, 819, 474, 677, 860, 875, 483, 160, 638, 948, 594, 72, 402, 
-    382, 742, 330, 639, 311, 71, 570, 698, 864, 409, 430, 79, 839, 208, 64, 564, 
-    559, 900, 62, 646, 564, 842, 980, 991, 12, 9, 1023, 937, 302, 241, 128, 651, 
-    752, 813, 159, 230, 498, 7, 873, 702, 647, 460, 929, 761, 145, 217, 922, 180, 
-    688, 1016, 415, 782, 976, 144, 278, 1017, 960, 350, 432, 114, 749, 956, 751, 256, 
-    312, 364, 506, 600, 637, 68, 905, 290, 16, 773, 296, 627, 187, 210, 389, 202, 
-    450, 797, 960, 511, 644, 473, 171, 473, 761, 1, 788, 837, 622, 106, 148, 492, 
-    436, 241, 28, 288, 761, 761, 909, 207, 473, 76, 441, 185, 736, 390, 334, 981, 
-    150, 461, 238, 555, 407, 981, 373, 591, 731, 421, 799, 392, 70, 557, 440, 426, 
-    1012, 943, 570, 872, 330, 578, 497, 803, 637, 572, 193, 372, 118, 980, 371, 211, 
-    115, 627, 230, 578, 1014, 781, 964, 93, 908, 140, 424, 567, 369, 833, 980, 742, 
-    325, 474, 237, 354, 213, 921, 341, 330, 831, 70, 415, 574, 351, 739, 192, 412, 
-    78, 470, 956, 344, 978, 482, 182, 557, 638, 521, 496, 468, 912, 547, 502, 1015, 
-    182, 226, 729, 524, 616, 661, 444, 490, 1023, 554, 38, 89, 622, 898, 129, 166, 
-    969, 511, 417, 530, 903, 440, 218, 965, 247, 303, 427, 747, 276, 509, 532, 638, 
-    133, 330, 230, 579, 973, 802, 965, 526, 553, 444, 391, 545, 585, 276, 597, 820, 
-    612, 473, 644, 502, 429, 3, 253, 1012, 815, 85, 879, 602, 121, 703, 842, 975, 
-    243, 128, 904, 766, 258, 891, 359, 384, 202, 833, 1016, 944, 474, 798, 117, 997, 
-    992, 443, 63, 135, 82, 19, 489, 182, 639, 653, 434, 577, 706, 666, 1020, 784, 
-    983, 536, 369, 146, 232, 652, 939, 794, 212, 801, 336, 842, 413, 866, 825, 319, 
-    896, 848, 838, 330, 856, 950, 1010, 972, 294, 271, 940, 346, 582, 343, 591, 652, 
-    1003, 203, 246, 60, 844, 779, 224, 649, 940, 163, 493, 405, 286, 700, 121, 919, 
-    975, 742, 777, 561, 907, 321, 220, 858, 256, 674, 22, 220, 946, 366, 823, 536, 
-    999, 874, 188, 798, 250, 718, 438, 961, 708, 763, 154, 89, 933, 585, 13, 256, 
-    927, 694, 985, 592, 488, 528, 149, 711, 525, 580, 1003, 801, 833, 581, 932, 339, 
-    735, 142, 929, 860, 333, 232, 807, 950, 336, 148, 612, 239, 210, 215, 724, 890, 
-    308, 174, 185, 720, 357, 871, 501, 725, 474, 246, 805, 110, 866, 554, 765, 27, 
-    704, 1020, 898, 921, 165, 275, 503, 286, 988, 544, 790, 223, 874, 697, 532, 526, 
-    633, 204, 711, 187, 537, 814, 293, 454, 101, 557, 991, 683, 294, 511, 374, 358, 
-    616, 760, 376, 170, 605, 601, 714, 348, 543, 200, 961, 191, 378, 364, 585, 926, 
-    279, 1020, 22, 657, 611, 813, 542, 537, 636, 510, 99, 765, 332, 720, 630, 808, 
-    304, 676, 73, 362, 767, 913, 442, 367, 669, 42, 141, 716, 369, 173, 470, 608, 
-    155, 192, 791, 884, 229, 899, 465, 978, 765, 763, 611, 160, 625, 921, 558, 471, 
-    810, 530, 231, 590, 105, 619, 251, 574, 889, 880, 183, 254, 770, 613, 35, 452, 
-    296, 108, 474, 500, 393, 283, 449, 846, 175, 432, 158, 418, 661, 396, 649, 994, 
-    792, 838, 977, 415, 259, 814, 777, 720, 832, 247, 57, 939, 114, 782, 989, 933, 
-    721, 949, 149, 161, 925, 461, 477, 195, 158, 956, 731, 388, 704, 674, 491, 439, 
-    15, 239, 483, 872, 23, 47, 291, 199, 993, 88, 795, 973, 945, 927, 141, 52, 
-    43, 133, 547, 462, 499, 765, 130, 300, 713, 978, 1011, 958, 1022, 42, 865, 279, 
-    434, 247, 185, 281, 207, 240, 799, 720, 999, 944, 717, 998, 339, 402, 636, 142, 
-    889, 340, 905, 302, 974, 366, 551, 627, 821, 712, 196, 564, 664, 638, 841, 258, 
-    124, 623, 380, 859, 986, 770, 1001, 994, 417, 681, 553, 907, 807, 467, 513, 96, 
-    315, 353, 175, 765, 444, 212, 308, 559, 521, 894, 494, 553, 847, 79, 1017, 995, 
-    221, 1002, 829, 11, 13, 209, 149, 694, 269, 830, 862, 289, 419, 18, 683, 701, 
-    355, 230, 874, 860, 958, 316, 916, 998, 303, 249, 336, 742, 433, 88, 120, 957, 
-    916, 296, 496, 319, 617, 819, 843, 731, 80, 253, 282, 47, 358, 948, 57, 961, 
-    177, 380, 306, 34, 654, 344, 89, 682, 908, 995, 213, 222, 587, 368, 566, 763, 
-    551, 942, 333, 371, 807, 265, 898, 431, 232, 215, 749, 707, 412, 947, 976, 974, 
-    332, 249, 342, 845, 807, 914, 893, 236, 506, 82, 958, 334, 627, 844, 345, 410, 
-    517, 572, 493, 566, 462, 1020, 920, 539, 797, 450, 44, 562, 540, 182, 295, 750, 
-    169, 442, 348, 114, 82, 489, 447, 260, 801, 997, 789, 939, 686, 229, 411, 181, 
-    563, 177, 637, 542, 886, 815, 435, 172, 28, 729, 898, 506, 271, 193, 103, 914, 
-    466, 387, 890, 987, 711, 34, 795, 982, 582, 581, 104, 496, 778, 512, 570, 927, 
-    324, 221, 1021, 583, 960, 442, 242, 973, 579, 585, 326, 128, 290, 694, 698, 278, 
-    531, 110, 405, 333, 256, 743, 292, 234, 415, 445, 293, 568, 167, 954, 947, 126, 
-    373, 375, 823, 583, 749, 318, 1023, 1015, 547, 467, 422, 812, 135, 500, 1018, 440, 
-    824, 529, 202, 317, 581, 206, 623, 1001, 862, 273, 752, 973, 883, 624, 72, 130, 
-    766, 645, 470, 571, 382, 684, 218, 636, 855, 307, 997, 39, 587, 851, 699, 770, 
-    639, 727, 637, 210, 535, 992, 120, 87, 498, 1013, 381, 276, 196, 244, 815, 911, 
-    312, 372, 123, 494, 424, 60, 965, 254, 135, 842, 363, 26, 375, 511, 228, 950, 
-    498, 388, 174, 942, 134, 631, 998, 241, 657, 30, 283, 354, 241, 255, 659, 987, 
-    584, 447, 296, 66, 138, 969, 155, 646, 363, 80, 875, 343, 908, 223, 65, 237, 
-    27, 652, 501, 272, 349, 434, 224, 586, 442, 531, 181, 609, 62, 243, 215, 176, 
-    678, 480, 673, 514, 150, 418, 7, 97, 1016, 325, 496, 115, 738, 605, 796, 441, 
-    159, 910, 124, 121, 921, 426, 667, 755, 177, 765, 128, 25, 760, 849, 603, 449, 
-    139, 616, 630, 401, 403, 960, 372, 697, 522, 611, 765, 610, 602, 783, 897, 994, 
-    181, 318, 307, 824, 548, 811, 238, 755, 763, 46, 805, 1006, 673, 564, 678, 583, 
-    178, 24, 265, 1005, 775, 957, 479, 819, 713, 235, 854, 813, 116, 726, 97, 85, 
-    336, 602, 987, 989, 826, 393, 287, 843, 653, 660, 837, 207, 580, 841, 688, 316, 
-    283, 963, 581, 402, 667, 128, 472, 494, 387, 431, 342, 888, 702, 896, 839, 81, 
-    930, 160, 831, 691, 329, 638, 742, 278, 739, 405, 323, 646, 735, 544, 788, 973, 
-    487, 228, 800, 282, 37, 624, 220, 812, 1014, 573, 518, 434, 895, 541, 194, 205, 
-    785, 978, 440, 221, 361, 920, 32, 514, 888, 38, 844, 660, 17, 280, 272, 15, 
-    511, 673, 859, 1000, 995, 346, 357, 752, 596, 628, 403, 424, 975, 227, 136, 480, 
-    787, 967, 263, 597, 623, 553, 102, 232, 179, 629, 997, 858, 596, 190, 164, 429, 
-    173, 648, 872, 97, 477, 616, 395, 442, 983, 476, 513, 1002, 73, 340, 165, 442, 
-    782, 417, 474, 920, 343, 966, 600, 197, 66, 420, 189, 170, 124, 467, 432, 397, 
-    301, 835, 410, 838, 578, 854, 726, 666, 809, 995, 853, 645, 462, 313, 944, 989, 
-    285, 49, 289, 841, 380, 606, 440, 448, 482, 4, 431, 932, 468, 451, 79, 447, 
-    709, 696, 704, 436, 728, 285, 589, 229, 266, 888, 261, 792, 40, 328, 591, 18, 
-    284, 1014, 248, 935, 303, 399, 127, 71, 489, 477, 690, 392, 287, 25, 62, 538, 
-    824, 275, 112, 135, 35, 83, 766, 141, 745, 690, 794, 621, 31, 943, 650, 883, 
-    607, 349, 811, 274, 1011, 807, 384, 763, 132, 832, 871, 313, 796, 876, 918, 5, 
-    994, 199, 654, 870, 804, 666, 283, 319, 420, 436, 589, 611, 372, 344, 445, 253, 
-    296, 777, 513, 964, 286, 548, 603, 307, 966, 413, 280, 230, 275, 237, 885, 463, 
-    899, 355, 899, 152, 611, 268, 320, 195, 485, 634, 364, 45, 2, 473, 76, 833, 
-    960, 87, 1017, 555, 224, 107, 654, 283, 390, 634, 548, 548, 1012, 734, 18, 891, 
-    913, 857, 857, 835, 144, 354, 1017, 659, 339, 191, 976, 329, 436, 36, 250, 333, 
-    918, 156, 561, 416, 335, 456, 347, 794, 305, 97, 329, 268, 311, 510, 512, 192, 
-    11, 862, 972, 730, 30, 559, 786, 150, 351, 329, 901, 494, 33, 808, 1017, 124, 
-    26, 771, 815, 890, 101, 651, 697, 58, 72, 893, 204, 560, 407, 500, 61, 200, 
-    531, 382, 931, 981, 28, 230, 597, 484, 426, 779, 132, 960, 654, 20, 337, 639, 
-    219, 885, 95, 245, 842, 304, 561, 556, 759, 451, 761, 271, 252, 727, 473, 140, 
-    851, 834, 625, 574, 49, 942, 763, 853, 211, 1017, 1006, 711, 1009, 989, 723, 199, 
-    733, 906, 326, 267, 1014, 627, 88, 997, 268, 615, 122, 825, 882, 87, 174, 367, 
-    552, 217, 229, 788, 917, 19, 843, 603, 1006, 54, 390, 201, 620, 112, 832, 25, 
-    754, 64, 891, 337, 288, 45, 415, 369, 782, 197, 728, 764, 1010, 720, 208, 66, 
-    539, 711, 601, 594, 73, 971, 877, 851, 357, 994, 201, 247, 329, 103, 742, 1018, 
-    136, 205, 450, 691, 266, 168, 1000, 457, 293, 442, 281, 185, 806, 858, 853, 324, 
-    579, 275, 988, 626, 42, 253, 610, 500, 526, 763, 936, 128, 542, 881, 864, 725, 
-    826, 275, 263, 323, 468, 328, 393, 617, 1011, 58, 884, 386, 63, 119, 40, 920, 
-    10, 949, 297, 791, 311, 900, 255, 306, 245, 454, 222, 480, 541, 115, 198, 147, 
-    803, 849, 498, 826, 324, 499, 1015, 979, 900, 783, 476, 993, 73, 785, 700, 62, 
-    445, 304, 607, 675, 723, 729, 39, 635, 783, 589, 624, 596, 378, 79, 816, 474, 
-    603, 501, 12, 471, 593, 672, 673, 663, 992, 106, 199, 881, 1009, 353, 726, 784, 
-    826, 476, 481, 324, 320, 946, 851, 571, 859, 912, 902, 610, 361, 498, 817, 90, 
-    20, 582, 396, 689, 175, 144, 68, 51, 138, 326, 776, 270, 394, 230, 657, 597, 
-    17, 723, 261, 237, 787, 652, 533, 388, 720, 310, 112, 390, 836, 720, 167, 782, 
-    947, 216, 210, 324, 615, 925, 251, 62, 644, 864, 504, 876, 273, 197, 518, 680, 
-    186, 267, 193, 874, 406, 809, 282, 335, 197, 16, 972, 524, 752, 533, 319, 1016, 
-    909, 843, 790, 395, 336, 871, 747, 482, 921, 606, 634, 785, 626, 904, 1004, 30, 
-    661, 513, 103, 189, 155, 697, 150, 181, 107, 514, 53, 495, 453, 811, 552, 920, 
-    665, 639, 125, 527, 131, 796, 506, 601, 619, 171, 93, 949, 564, 322, 73, 290, 
-    689, 41, 259, 796, 597, 818, 651, 61, 992, 413, 702, 794, 295, 927, 329, 1011, 
-    553, 627, 978, 993, 45, 277, 598, 1008, 816, 717, 189, 726, 728, 647, 751, 366, 
-    116, 157, 125, 987, 251, 243, 944, 17, 215, 514, 529, 886, 954, 929, 401, 567, 
-    814, 925, 726, 320, 12, 896, 974, 72, 890, 328, 318, 131, 268, 790, 607, 226, 
-    826, 1013, 307, 493, 612, 808, 754, 515, 86, 732, 972, 226, 755, 827, 428, 459, 
-    61, 882, 264, 947, 784, 916, 558, 384, 399, 893, 692, 848, 176, 9, 220, 631, 
-    442, 647, 567, 302, 923, 1022, 35, 768, 791, 450, 548, 590, 617, 715, 427, 908, 
-    17, 849, 35, 925, 694, 590, 556, 95, 461, 971, 365, 863, 595, 882, 820, 560, 
-    747, 376, 807, 426, 770, 790, 848, 889, 565, 762, 937, 323, 473, 402, 685, 874, 
-    361, 918, 81, 366, 574, 225, 500, 540, 838, 908, 615, 714, 332, 606, 236, 986, 
-    507, 932, 430, 970, 509, 524, 788, 724, 709, 477, 117, 987, 422, 96, 607, 366, 
-    340, 66, 649, 290, 233, 1022, 661, 352, 619, 733, 809, 427, 471, 839, 403, 907, 
-    370, 545, 347, 972, 840, 192, 581, 1005, 423, 578, 573, 540, 450, 604, 363, 1007, 
-    216, 104, 39, 587, 71, 469, 563, 338, 567, 20, 555, 476, 858, 539, 52, 433, 
-    945, 284, 274, 1019, 128, 444, 546, 539, 980, 42, 783, 403, 328, 582, 552, 32, 
-    708, 389, 727, 603, 439, 669, 747, 349, 529, 955, 330, 7, 877, 247, 111, 558, 
-    405, 528, 209, 224, 499, 760, 394, 512, 754, 425, 187, 1009, 690, 976, 240, 122, 
-    699, 298, 1016, 753, 451, 135, 644, 782, 215, 783, 843, 919, 152, 95, 305, 795, 
-    24, 293, 330, 21, 881, 981, 951, 976, 664, 930, 196, 987, 250, 251, 248, 653, 
-    995, 241, 541, 713, 939, 369, 118, 136, 469, 381, 239, 727, 971, 718, 38, 996, 
-    345, 731, 965, 266, 811, 870, 503, 812, 75, 952, 807, 552, 911, 345, 853, 957, 
-    560, 373, 236, 387, 773, 938, 317, 776, 295, 932, 89, 379, 89, 102, 40, 398, 
-    391, 75, 152, 253, 726, 169, 510, 815, 908, 664, 365, 728, 112, 125, 785, 149, 
-    90, 479, 468, 563, 850, 732, 840, 753, 939, 247, 154, 776, 42, 282, 924, 458, 
-    549, 83, 897, 703, 753, 777, 267, 214, 858, 643, 208, 977, 574, 823, 220, 305, 
-    167, 770, 556, 91, 394, 1022, 952, 420, 438, 180, 338, 325, 324, 530, 824, 112, 
-    512, 559, 132, 967, 40, 372, 556, 766, 157, 647, 530, 939, 530, 900, 40, 48, 
-    201, 834, 724, 633, 720, 308, 456, 865, 369, 361, 191, 765, 912, 338, 894, 497, 
-    801, 268, 85, 167, 983, 913, 606, 301, 590, 516, 212, 0, 91, 946, 82, 472, 
-    524, 957, 422, 944, 233, 943, 86, 259, 548, 126, 114, 875, 336, 187, 561, 831, 
-    1020, 558, 271, 691, 910, 6, 5, 528, 976, 346, 943, 207, 953, 313, 894, 369, 
-    857, 876, 502, 813, 445, 324, 287, 623, 434, 834, 156, 326, 900, 351, 868, 808, 
-    814, 611, 275, 974, 823, 37, 625, 395, 672, 916, 1, 911, 565, 143, 564, 102, 
-    46, 812, 404, 216, 48, 929, 273, 789, 437, 30, 210, 318, 639, 986, 535, 439, 
-    418, 902, 930, 110, 187, 746, 912, 788, 734, 169, 203, 345, 979, 864, 221, 156, 
-    889, 173, 528, 460, 331, 70, 695, 709, 182, 839, 728, 77, 765, 420, 883, 408, 
-    19, 834, 974, 297, 257, 318, 670, 825, 601, 704, 864, 900, 21, 595, 442, 843, 
-    747, 276, 348, 614, 561, 847, 638, 462, 954, 384, 204, 207, 332, 640, 714, 746, 
-    30, 688, 878, 376, 483, 839, 647, 150, 993, 371, 416, 330, 1014, 104, 356, 404, 
-    737, 691, 695, 842, 714, 297, 35, 742, 1011, 226, 183, 360, 402, 919, 189, 183, 
-    473, 536, 835, 456, 867, 109, 760, 113, 1019, 403, 876, 947, 81, 69, 60, 76, 
-    721, 491, 613, 122, 854, 817, 245, 524, 231, 119, 759, 529, 62, 421, 320, 534, 
-    338, 669, 860, 19, 108, 865, 305, 781, 319, 633, 70, 287, 191, 3, 152, 51, 
-    868, 698, 1022, 77, 624, 144, 213, 192, 495, 798, 385, 801, 667, 765, 859, 812, 
-    481, 222, 477, 414, 950, 713, 235, 728, 918, 700, 129, 145, 814, 30, 722, 240, 
-    988, 116, 431, 406, 161, 635, 842, 647, 780, 650, 148, 883, 743, 368, 395, 335, 
-    676, 252, 1016, 394, 260, 265, 346, 854, 374, 236, 595, 773, 337, 221, 77, 376, 
-    950, 607, 854, 38, 513, 697, 259, 825, 359, 192, 905, 668, 810, 79, 705, 147, 
-    569, 307, 580, 162, 28, 170, 478, 137, 927, 732, 839, 797, 130, 147, 230, 624, 
-    344, 241, 90, 861, 812, 91, 363, 696, 977, 26, 634, 784, 478, 315, 753, 546, 
-    160, 768, 63, 115, 277, 891, 914, 339, 53, 696, 706, 909, 423, 524, 872, 474, 
-    345, 562, 596, 535, 135, 7, 379, 421, 1005, 3, 374, 157, 44, 89, 290, 132, 
-    368, 930, 650, 223, 772, 241, 363, 252, 397, 907, 963, 140, 53, 43, 229, 979, 
-    446, 769, 539, 303, 465, 925, 457, 99, 1001, 891, 499, 332, 975, 482, 992, 760, 
-    129, 113, 680, 72, 522, 309, 845, 1017, 646, 88, 178, 365, 708, 551, 769, 234, 
-    719, 919, 398, 65, 306, 559, 413, 799, 683, 16, 641, 60, 542, 740, 468, 306, 
-    256, 126, 317, 139, 674, 526, 994, 30, 401, 379, 626, 80, 375, 202, 617, 782, 
-    839, 846, 402, 429, 687, 360, 198, 419, 901, 478, 747, 734, 898, 139, 478, 239, 
-    525, 502, 957, 30, 447, 734, 1011, 264, 480, 546, 505, 796, 969, 847, 75, 509, 
-    1021, 109, 375, 329, 199, 364, 115, 438, 640, 693, 888, 813, 250, 642, 29, 492, 
-    504, 253, 130, 1005, 496, 127, 422, 1013, 994, 908, 88, 213, 953, 826, 353, 222, 
-    909, 646, 260, 666, 138, 101, 902, 532, 373, 183, 43, 87, 276, 61, 889, 416, 
-    548, 972, 719, 119, 191, 780, 998, 775, 241, 27, 652, 708, 361, 548, 876, 239, 
-    512, 817, 640, 664, 800, 471, 107, 190, 120, 173, 151, 351, 989, 229, 302, 304, 
-    618, 447, 835, 778, 177, 416, 574, 383, 763, 260, 779, 797, 13, 15, 758, 29, 
-    389, 78, 68, 353, 541, 203, 982, 491, 418, 617, 732, 233, 842, 461, 80, 598, 
-    1003, 27, 837, 589, 119, 199, 959, 435, 603, 959, 513, 649, 333, 406, 538, 446, 
-    163, 762, 623, 109, 373, 194, 514, 964, 55, 129, 808, 988, 370, 105, 205, 440, 
-    700, 170, 375, 696, 653, 984, 897, 965, 255, 895, 201, 203, 761, 709, 389, 746, 
-    773, 629, 182, 443, 92, 425, 317, 450, 370, 465, 828, 465, 725, 875, 1005, 956, 
-    141, 140, 162, 71, 750, 338, 501, 678, 992, 671, 118, 131, 347, 580, 859, 195, 
-    755, 152, 285, 689, 119, 911, 112, 386, 814, 568, 793, 903, 495, 618, 908, 410, 
-    454, 536, 793, 779, 957, 1004, 378, 735, 749, 649, 305, 307, 819, 508, 995, 86, 
-    702, 654, 46, 572, 718, 869, 71, 170, 536, 37, 410, 106, 172, 396, 116, 574, 
-    160, 216, 475, 899, 242, 912, 115, 266, 815, 121, 394, 873, 468, 827, 921, 344, 
-    321, 157, 543, 768, 300, 257, 257, 745, 692, 305, 557, 89, 64, 701, 698, 755, 
-    92, 408, 932, 173, 292, 528, 713, 511, 141, 814, 361, 114, 673, 460, 662, 958, 
-    856, 281, 546, 903, 482, 183, 558, 529, 225, 612, 303, 330, 480, 834, 713, 715, 
-    194, 943, 218, 888, 973, 451, 334, 593, 265, 648, 502, 368, 917, 571, 103, 978, 
-    522, 643, 299, 220, 588, 586, 394, 2, 393, 395, 445, 360, 95, 249, 864, 288, 
-    163, 88, 181, 209, 603, 764, 644, 586, 232, 545, 508, 402, 714, 723, 842, 539, 
-    719, 666, 958, 260, 564, 750, 493, 528, 1003, 811, 916, 787, 852, 602, 427, 23, 
-    562, 983, 151, 413, 883, 494, 231, 21, 196, 773, 265, 347, 890, 951, 686, 637, 
-    966, 606, 978, 626, 383, 346, 709, 719, 96, 362, 364, 361, 995, 814, 870, 416, 
-    240, 277, 6, 505, 603, 858, 958, 917, 245, 392, 976, 306, 497, 970, 175, 876, 
-    560, 956, 245, 745, 223, 253, 445, 138, 295, 129, 1023, 255, 485, 284, 713, 744, 
-    981, 610, 510, 765, 166, 299, 502, 957, 453, 310, 835, 274, 284, 82, 65, 157, 
-    139, 699, 76, 130, 341, 277, 89, 441, 717, 782, 415, 434, 882, 165, 996, 749, 
-    692, 918, 205, 264, 755, 954, 565, 657, 1006, 851, 80, 187, 7, 680, 539, 399, 
-    470, 364, 567, 234, 442, 495, 123, 652, 954, 42, 442, 308, 674, 665, 974, 825, 
-    218, 914, 302, 311, 25, 93, 154, 895, 844, 822, 50, 559, 494, 503, 439, 970, 
-    156, 387, 440, 512, 367, 738, 577, 286, 8, 48, 361, 287, 578, 564, 312, 366, 
-    961, 380, 106, 977, 1022, 57, 448, 78, 986, 1009, 782, 533, 640, 53, 702, 911, 
-    368, 854, 344, 108, 654, 464, 192, 96, 987, 540, 683, 111, 793, 64, 966, 246, 
-    970, 367, 633, 616, 227, 692, 949, 793, 578, 212, 951, 700, 418, 877, 717, 115, 
-    85, 622, 320, 579, 1021, 751, 639, 626, 586, 575, 167, 764, 318, 522, 722, 231, 
-    17, 204, 224, 56, 371, 383, 515, 557, 425, 78, 172, 416, 985, 279, 466, 235, 
-    462, 814, 156, 272, 586, 250, 941, 63, 530, 2, 475, 578, 70, 242, 409, 623, 
-    918, 727, 257, 645, 758, 165, 828, 110, 284, 575, 687, 236, 525, 951, 498, 459, 
-    66, 373, 505, 644, 278, 680, 844, 481, 459, 645, 456, 814, 983, 327, 463, 295, 
-    185, 595, 598, 573, 780, 415, 515, 655, 55, 343, 15, 1016, 27, 946, 836, 833, 
-    973, 820, 38, 490, 634, 806, 254, 690, 313, 297, 529, 901, 372, 851, 508, 502, 
-    276, 942, 729, 594, 199, 97, 633, 759, 187, 132, 380, 300, 667, 14, 216, 782, 
-    629, 416, 696, 339, 904, 299, 847, 934, 953, 781, 633, 301, 340, 510, 150, 108, 
-    734, 719, 427, 320, 864, 179, 486, 3, 786, 276, 590, 427, 651, 456, 551, 60, 
-    589, 957, 907, 142, 459, 279, 885, 486, 700, 695, 778, 598, 613, 747, 524, 912, 
-    902, 785, 350, 796, 344, 163, 46, 521, 210, 996, 529, 879, 114, 573, 195, 12, 
-    631, 281, 402, 120, 393, 81, 241, 727, 461, 388, 53, 895, 601, 47, 252, 561, 
-    88, 483, 649, 463, 603, 279, 795, 946, 689, 825, 865, 232, 959, 437, 442, 538, 
-    413, 100, 160, 394, 575, 741, 700, 431, 356, 739, 696, 456, 270, 756, 152, 194, 
-    849, 190, 433, 798, 462, 846, 1, 955, 824, 465, 826, 73, 424, 179, 406, 406, 
-    570, 482, 740, 137, 59, 540, 996, 662, 778, 58, 931, 882, 769, 434, 434, 663, 
-    845, 254, 786, 987, 253, 532, 968, 910, 211, 665, 559, 787, 795, 537, 507, 452, 
-    577, 539, 444, 746, 726, 469, 857, 1012, 53, 691, 663, 264, 447, 1013, 351, 94, 
-    659, 639, 451, 531, 574, 582, 686, 790, 35, 171, 939, 241, 688, 324, 638, 877, 
-    410, 553, 955, 304, 273, 851, 897, 723, 743, 650, 659, 366, 378, 49, 16, 569, 
-    463, 721, 694, 260, 504, 165, 978, 208, 166, 255, 710, 1010, 501, 872, 484, 70, 
-    266, 144, 912, 737, 289, 386, 875, 497, 864, 468, 380, 120, 225, 492, 27, 829, 
-    756, 492, 52, 233, 494, 824, 787, 40, 97, 509, 710, 228, 607, 354, 636, 547, 
-    877, 212, 261, 520, 848, 591, 159, 903, 753, 977, 203, 536, 559, 168, 128, 639, 
-    507, 169, 901, 297, 494, 557, 602, 85, 409, 410, 114, 688, 463, 32, 726, 483, 
-    743, 267, 102, 756, 1, 950, 736, 376, 316, 943, 674, 254, 425, 381, 854, 1005, 
-    789, 29, 486, 40, 612, 273, 212, 259, 870, 312, 806, 210, 997, 763, 573, 751, 
-    817, 442, 184, 832, 104, 250, 529, 801, 120, 237, 188, 55, 981, 447, 486, 697, 
-    362, 722, 707, 979, 19, 823, 840, 248, 821, 988, 194, 181, 714, 866, 289, 535, 
-    80, 322, 394, 330, 737, 347, 667, 278, 276, 149, 512, 781, 286, 337, 858, 412, 
-    762, 589, 645, 385, 324, 167, 557, 23, 483, 618, 663, 1002, 296, 104, 878, 317, 
-    852, 352, 135, 536, 685, 277, 392, 267, 630, 16, 103, 982, 532, 328, 419, 83, 
-    927, 902, 567, 313, 925, 235, 626, 154, 326, 312, 801, 579, 444, 209, 193, 710, 
-    215, 96, 236, 1010, 760, 751, 368, 401, 332, 878, 80, 567, 942, 323, 706, 167, 
-    715, 707, 927, 789, 866, 83, 690, 251, 40, 633, 165, 762, 95, 799, 236, 449, 
-    822, 59, 291, 503, 377, 447, 695, 656, 37, 88, 678, 445, 435, 972, 775, 114, 
-    529, 711, 960, 77, 790, 54, 351, 49, 638, 525, 451, 292, 698, 988, 51, 783, 
-    366, 27, 67, 118, 468, 789, 644, 131, 905, 734, 163, 395, 867, 720, 41, 546, 
-    192, 624, 213, 477, 990, 329, 879, 594, 578, 525, 719, 689, 598, 35, 377, 241, 
-    597, 528, 259, 917, 815, 143, 97, 60, 528, 855, 64, 398, 176, 515, 623, 536, 
-    555, 808, 156, 858, 397, 928, 977, 904, 251, 876, 824, 8, 987, 1020, 40, 748, 
-    207, 100, 345, 630, 744, 890, 554, 648, 980, 264, 738, 981, 16, 941, 999, 911, 
-    628, 897, 958, 476, 818, 180, 96, 297, 109, 714, 847, 736, 917, 1015, 900, 603, 
-    889, 661, 551, 26, 469, 820, 663, 359, 398, 375, 175, 400, 587, 362, 647, 180, 
-    543, 431, 371, 343, 193, 76, 475, 846, 380, 482, 51, 84, 428, 516, 150, 459, 
-    470, 554, 425, 25, 190, 54, 383, 117, 495, 929, 403, 55, 757, 820, 83, 214, 
-    578, 284, 969, 689, 94, 276, 259, 241, 600, 855, 506, 583, 632, 809, 887, 293, 
-    1008, 278, 10, 213, 838, 302, 117, 579, 355, 580, 302, 415, 367, 350, 810, 51, 
-    90, 268, 922, 407, 362, 777, 492, 11, 28, 664, 847, 381, 26, 144, 58, 46, 
-    124, 595, 738, 822, 174, 766, 7, 622, 515, 181, 937, 368, 955, 640, 1023, 39, 
-    1007, 641, 1012, 652, 897, 382, 651, 44, 353, 472, 174, 784, 404, 34, 266, 990, 
-    125, 755, 906, 800, 181, 630, 775, 149, 197, 579, 646, 430, 235, 302, 417, 629, 
-    403, 857, 544, 795, 334, 657, 943, 170, 358, 685, 140, 396, 430, 467, 29, 305, 
-    471, 910, 879, 699, 725, 93, 665, 984, 883, 838, 948, 423, 105, 815, 910, 259, 
-    881, 861, 471, 95, 1001, 743, 642, 357, 923, 515, 307, 126, 165, 480, 206, 730, 
-    98, 155, 1012, 617, 936, 417, 943, 167, 96, 403, 742, 575, 27, 438, 88, 813, 
-    835, 99, 227, 90, 470, 246, 100, 997, 295, 164, 227, 337, 554, 459, 492, 254, 
-    669, 513, 13, 894, 539, 821, 834, 504, 939, 930, 630, 829, 987, 410, 900, 801, 
-    530, 992, 560, 15, 86, 700, 213, 419, 46, 28, 358, 578, 898, 767, 1014, 744, 
-    984, 725, 186, 206, 308, 11, 797, 416, 403, 97, 431, 684, 788, 221, 581, 645, 
-    15, 650, 371, 206, 522, 483, 662, 478, 707, 293, 556, 951, 384, 147, 676, 456, 
-    812, 960, 829, 1016, 378, 269, 911, 626, 629, 1003, 344, 1003, 307, 996, 141, 320, 
-    403, 499, 618, 208, 387, 70, 1001, 90, 284, 369, 431, 75, 843, 222, 585, 225, 
-    130, 948, 790, 508, 782, 466, 623, 640, 701, 15, 414, 518, 659, 338, 872, 348, 
-    36, 489, 731, 10, 980, 198, 660, 208, 180, 396, 985, 31, 983, 0, 866, 126, 
-    63, 533, 781, 784, 41, 497, 128, 1014, 219, 1023, 830, 694, 893, 1012, 411, 130, 
-    938, 11, 1022, 483, 56, 160, 413, 556, 974, 873, 317, 860, 641, 280, 524, 794, 
-    646, 157, 313, 998, 417, 560, 1009, 202, 809, 892, 604, 966, 601, 93, 803, 434, 
-    503, 185, 746, 899, 339, 289, 473, 286, 720, 963, 835, 874, 895, 712, 33, 488, 
-    332, 439, 882, 19, 586, 92, 305, 833, 95, 942, 34, 342, 636, 956, 463, 923, 
-    947, 209, 252, 404, 502, 392, 901, 79, 33, 829, 910, 702, 774, 765, 180, 666, 
-    70, 350, 375, 69, 638, 977, 420, 977, 966, 906, 608, 953, 628, 700, 262, 569, 
-    431, 295, 465, 691, 544, 689, 535, 385, 281, 883, 614, 764, 731, 215, 324, 702, 
-    838, 426, 755, 326, 137, 84, 25, 537, 431, 832, 820, 564, 358, 827, 975, 167, 
-    58, 596, 150, 194, 557, 523, 125, 994, 124, 92, 404, 868, 305, 524, 70, 220, 
-    286, 1016, 876, 181, 558, 943, 481, 520, 613, 203, 414, 527, 139, 977, 32, 982, 
-    917, 947, 940, 1019, 633, 654, 618, 200, 862, 254, 478, 704, 136, 483, 406, 292, 
-    241, 879, 71, 59, 220, 647, 127, 284, 480, 767, 608, 425, 1004, 457, 866, 846, 
-    227, 218, 106, 312, 194, 868, 350, 980, 803, 535, 816, 540, 733, 878, 124, 15, 
-    1004, 550, 304, 457, 419, 651, 750, 622, 477, 773, 894, 518, 138, 534, 909, 203, 
-    614, 234, 570, 56, 523, 81, 417, 587, 987, 237, 44, 197, 933, 809, 627, 672, 
-    199, 64, 631, 304, 203, 995, 958, 80, 987, 210, 309, 680, 402, 663, 267, 312, 
-    670, 800, 492, 69, 682, 429, 511, 833, 903, 713, 5, 984, 674, 814, 435, 264, 
-    88, 536, 683, 280, 973, 59, 391, 514, 194, 718, 353, 990, 480, 199, 162, 123, 
-    182, 417, 375, 313, 721, 682, 564, 944, 324, 484, 172, 685, 995, 867, 345, 351, 
-    573, 1000, 241, 457, 490, 585, 456, 234, 997, 931, 183, 1016, 268, 643, 818, 731, 
-    715, 869, 626, 953, 608, 225, 833, 182, 167, 431, 808, 756, 32, 1021, 1006, 822, 
-    586, 508, 855, 942, 922, 265, 760, 550, 573, 26, 763, 1019, 939, 701, 929, 4, 
-    494, 934, 932, 510, 1019, 99, 362, 707, 742, 92, 450, 998, 317, 37, 762, 55, 
-    934, 479, 597, 519, 950, 541, 118, 868, 762, 600, 574, 69, 602, 45, 759, 147, 
-    63, 443, 238, 177, 4, 258, 760, 99, 831, 805, 94, 23, 565, 225, 1017, 479, 
-    297, 576, 815, 872, 373, 403, 195, 70, 404, 568, 118, 704, 34, 764, 586, 741, 
-    29, 108, 753, 135, 196, 247, 238, 278, 76, 35, 331, 117, 910, 806, 524, 263, 
-    1001, 446, 846, 356, 209, 831, 816, 436, 988, 562, 64, 133, 814, 247, 614, 657, 
-    683, 553, 331, 575, 660, 613, 355, 84, 772, 943, 508, 514, 26, 11, 597, 521, 
-    238, 117, 883, 474, 996, 910, 370, 708, 915, 934, 700, 1015, 218, 309, 174, 471, 
-    450, 60, 336, 419, 935, 839, 303, 988, 969, 598, 721, 190, 469, 672, 5, 817, 
-    652, 15, 475, 549, 645, 427, 206, 417, 688, 16, 783, 831, 165, 250, 691, 82, 
-    734, 997, 281, 807, 811, 655, 702, 997, 628, 221, 446, 862, 518, 1007, 946, 544, 
-    725, 351, 4, 413, 132, 719, 937, 297, 337, 291, 915, 500, 818, 167, 27, 232, 
-    705, 307, 889, 928, 1001, 518, 748, 880, 220, 360, 133, 395, 716, 87, 860, 18, 
-    214, 1016, 727, 127, 437, 611, 377, 178, 910, 325, 961, 327, 674, 910, 895, 140, 
-    510, 6, 526, 781, 835, 208, 832, 774, 242, 298, 989, 569, 519, 172, 54, 65, 
-    406, 504, 193, 395, 51, 460, 490, 610, 643, 620, 648, 966, 133, 538, 308, 505, 
-    8, 40, 548, 486, 809, 1000, 903, 469, 108, 444, 345, 78, 354, 449, 169, 871, 
-    390, 58, 69, 479, 777, 109, 749, 557, 502, 127, 635, 858, 425, 646, 566, 555, 
-    610, 191, 173, 146, 242, 495, 541, 640, 71, 426, 984, 669, 991, 370, 85, 635, 
-    406, 408, 829, 451, 56, 1000, 555, 71, 581, 435, 796, 702, 103, 111, 905, 48, 
-    163, 226, 538, 193, 987, 434, 663, 258, 581, 632, 824, 854, 324, 1001, 607, 367, 
-    942, 711, 753, 279, 673, 257, 367, 941, 89, 54, 961, 656, 912, 218, 147, 238, 
-    901, 668, 996, 770, 780, 347, 290, 583, 629, 495, 594, 71, 208, 143, 949, 570, 
-    547, 213, 943, 64, 950, 332, 927, 297, 93, 670, 120, 972, 342, 554, 340, 997, 
-    733, 487, 674, 971, 934, 469, 686, 26, 770, 500, 754, 717, 666, 914, 58, 468, 
-    577, 476, 947, 670, 345, 132, 804, 902, 80, 527, 786, 766, 569, 187, 918, 726, 
-    670, 962, 617, 234, 161, 897, 437, 845, 1003, 185, 527, 856, 381, 984, 333, 745, 
-    14, 546, 100, 219, 541, 237, 851, 663, 871, 592, 765, 910, 680, 272, 319, 566, 
-    821, 757, 56, 872, 986, 556, 1003, 554, 533, 483, 543, 980, 873, 958, 953, 474, 
-    1020, 51, 231, 809, 530, 388, 671, 477, 848, 430, 597, 445, 236, 822, 872, 746, 
-    624, 143, 101, 564, 1001, 247, 643, 571, 1008, 137, 677, 586, 956, 482, 1016, 169, 
-    963, 631, 722, 664, 26, 618, 10, 939, 1011, 350, 250, 955, 553, 253, 572, 1012, 
-    836, 197, 211, 791, 725, 804, 612, 403, 157, 372, 770, 176, 171, 979, 739, 253, 
-    132, 172, 660, 68, 900, 551, 367, 374, 796, 836, 14, 457, 440, 115, 76, 775, 
-    519, 978, 523, 803, 996, 464, 624, 30, 124, 57, 413, 986, 774, 290, 284, 816, 
-    488, 645, 655, 757, 706, 160, 500, 347, 530, 830, 367, 357, 671, 152, 409, 648, 
-    428, 50, 448, 253, 541, 595, 922, 683, 732, 600, 443, 524, 1019, 998, 327, 482, 
-    834, 140, 573, 462, 876, 740, 247, 894, 916, 695, 348, 459, 176, 801, 64, 388, 
-    732, 179, 581, 931, 8, 927, 841, 705, 513, 694, 800, 395, 661, 541, 941, 284, 
-    988, 547, 377, 777, 190, 564, 468, 470, 117, 369, 434, 512, 21, 173, 827, 505, 
-    724, 507, 189, 167, 836, 541, 515, 491, 902, 836, 687, 817, 173, 1023, 744, 107, 
-    42, 750, 825, 855, 761, 57, 130, 827, 737, 30, 358, 1012, 675, 415, 482, 541, 
-    484, 685, 320, 854, 544, 213, 772, 2, 486, 951, 918, 625, 936, 243, 80, 689, 
-    130, 865, 611, 901, 696, 671, 191, 719, 287, 694, 226, 495, 761, 1017, 419, 47, 
-    1005, 253, 1006, 423, 115, 435, 50, 275, 421, 512, 882, 505, 338, 615, 305, 144, 
-    949, 227, 546, 425, 34, 382, 252, 934, 240, 195, 555, 879, 270, 512, 806, 628, 
-    212, 65, 989, 478, 744, 592, 210, 947, 451, 934, 232, 1002, 219, 113, 642, 255, 
-    135, 741, 294, 919, 153, 714, 890, 455, 292, 421, 472, 746, 413, 365, 369, 412, 
-    807, 535, 941, 969, 693, 573, 822, 659, 202, 949, 651, 179, 82, 542, 291, 591, 
-    795, 124, 324, 64, 731, 470, 781, 629, 247, 644, 147, 646, 362, 975, 495, 472, 
-    114, 773, 208, 411, 561, 275, 114, 985, 238, 517, 188, 715, 303, 980, 533, 431, 
-    678, 419, 744, 827, 799, 688, 138, 141, 806, 651, 543, 253, 895, 1012, 397, 501, 
-    313, 380, 29, 240, 689, 519, 696, 499, 687, 5, 424, 325, 997, 59, 337, 987, 
-    885, 502, 837, 184, 688, 818, 203, 811, 680, 548, 849, 446, 320, 172, 973, 149, 
-    942, 133, 26, 688, 40, 829, 203, 811, 602, 65, 218, 675, 189, 268, 418, 650, 
-    385, 62, 309, 971, 855, 978, 196, 916, 178, 617, 586, 175, 819, 193, 18, 919, 
-    828, 248, 39, 943, 947, 839, 722, 620, 184, 737, 728, 933, 886, 512, 316, 314, 
-    953, 355, 462, 305, 438, 256, 1008, 764, 296, 441, 1019, 136, 427, 633, 895, 494, 
-    947, 515, 281, 168, 283, 917, 371, 469, 334, 427, 902, 1002, 894, 19, 889, 751, 
-    759, 989, 683, 665, 35, 342, 888, 417, 15, 645, 264, 486, 470, 153, 542, 597, 
-    381, 432, 708, 802, 36, 681, 897, 83, 489, 305, 944, 601, 979, 67, 131, 853, 
-    623, 719, 919, 526, 143, 472, 236, 634, 81, 809, 235, 264, 694, 540, 612, 261, 
-    346, 334, 351, 282, 162, 611, 942, 935, 400, 211, 897, 94, 569, 165, 167, 294, 
-    579, 1023, 51, 277, 620, 712, 561, 149, 463, 788, 100, 250, 694, 889, 34, 305, 
-    94, 638, 63, 331, 887, 797, 580, 209, 0, 205, 855, 750, 709, 922, 667, 840, 
-    352, 615, 318, 263, 339, 414, 46, 135, 941, 796, 805, 925, 692, 628, 819, 298, 
-    532, 477, 776, 201, 424, 866, 685, 977, 898, 762, 269, 105, 559, 936, 433, 519, 
-    387, 270, 298, 155, 828, 732, 926, 957, 662, 124, 971, 957, 411, 534, 628, 37, 
-    850, 715, 745, 576, 208, 985, 783, 603, 29, 294, 107, 38, 419, 918, 992, 283, 
-    214, 380, 702, 734, 633, 229, 377, 962, 1013, 553, 180, 706, 237, 271, 688, 413, 
-    722, 87, 46, 717, 905, 931, 296, 470, 494, 913, 564, 617, 828, 869, 848, 347, 
-    423, 164, 756, 271, 410, 795, 321, 69, 228, 123, 518, 715, 830, 613, 528, 554, 
-    2, 253, 837, 841, 796, 427, 76, 207, 298, 38, 822, 716, 817, 96, 841, 917, 
-    100, 165, 733, 45, 289, 507, 776, 636, 813, 267, 354, 864, 405, 797, 34, 353, 
-    760, 445, 225, 499, 976, 806, 900, 993, 828, 1023, 677, 107, 776, 406, 303, 99, 
-    753, 662, 766, 33, 418, 339, 185, 1022, 616, 710, 707, 545, 733, 1009, 698, 539, 
-    165, 975, 685, 53, 619, 732, 61, 456, 799, 531, 173, 395, 853, 966, 612, 401, 
-    183, 952, 918, 11, 176, 191, 797, 247, 805, 645, 777, 300, 148, 840, 830, 462, 
-    819, 806, 820, 100, 122, 240, 583, 831, 786, 962, 12, 768, 600, 462, 172, 464, 
-    627, 79, 996, 918, 397, 113, 40, 416, 892, 436, 370, 791, 122, 846, 626, 210, 
-    935, 977, 84, 742, 688, 541, 624, 988, 143, 109, 792, 758, 249, 856, 1000, 101, 
-    792, 458, 610, 62, 142, 732, 671, 19, 535, 956, 532, 985, 947, 531, 1018, 262, 
-    830, 600, 378, 274, 286, 316, 397, 307, 171, 986, 616, 223, 821, 693, 883, 826, 
-    32, 959, 721, 475, 346, 339, 708, 329, 197, 738, 957, 618, 642, 894, 209, 256, 
-    503, 404, 890, 58, 293, 850, 719, 246, 904, 611, 969, 824, 461, 29, 354, 714, 
-    397, 119, 729, 400, 477, 446, 972, 266, 431, 314, 517, 151, 881, 704, 622, 862, 
-    755, 886, 490, 199, 365, 919, 233, 874, 19, 349, 550, 288, 621, 19, 36, 105, 
-    446, 406, 790, 347, 675, 448, 93, 1019, 73, 136, 481, 529, 775, 357, 667, 969, 
-    394, 829, 939, 40, 55, 929, 1017, 719, 143, 526, 575, 313, 542, 157, 88, 784, 
-    937, 154, 739, 2, 286, 29, 629, 315, 505, 203, 993, 993, 2, 115, 98, 852, 
-    354, 241, 261, 1012, 707, 186, 978, 1011, 351, 542, 463, 349, 765, 114, 289, 490, 
-    568, 414, 446, 783, 263, 786, 845, 713, 937, 479, 700, 719, 950, 178, 992, 801, 
-    433, 353, 580, 312, 344, 713, 482, 315, 155, 211, 134, 565, 940, 235, 994, 719, 
-    925, 367, 4, 987, 248, 754, 382, 206, 198, 498, 785, 761, 861, 248, 82, 946, 
-    687, 89, 68, 302, 571, 976, 32, 429, 194, 188, 124, 105, 450, 62, 408, 722, 
-    541, 266, 397, 671, 177, 96, 127, 355, 176, 851, 574, 405, 30, 460, 993, 920, 
-    983, 307, 1022, 187, 30, 747, 163, 355, 433, 993, 711, 640, 349, 409, 574, 719, 
-    154, 569, 76, 585, 286, 256, 675, 228, 744, 626, 947, 263, 369, 243, 922, 152, 
-    315, 841, 296, 317, 748, 601, 642, 516, 426, 253, 147, 692, 300, 100, 360, 138, 
-    252, 110, 855, 36, 76, 319, 529, 674, 454, 669, 693, 805, 75, 139, 737, 700, 
-    387, 191, 614, 554, 291, 178, 219, 254, 884, 537, 106, 854, 270, 881, 603, 785, 
-    505, 63, 60, 263, 615, 15, 843, 751, 841, 181, 465, 915, 378, 279, 929, 11, 
-    755, 304, 269, 469, 561, 82, 48, 831, 106, 305, 136, 94, 993, 711, 928, 928, 
-    997, 190, 551, 195, 31, 966, 101, 793, 917, 1016, 344, 241, 112, 355, 533, 72, 
-    722, 306, 417, 733, 912, 894, 820, 797, 690, 770, 292, 604, 31, 351, 210, 106, 
-    717, 422, 874, 46, 72, 335, 599, 661, 907, 872, 23, 531, 287, 747, 362, 728, 
-    738, 977, 1012, 643, 304, 261, 180, 846, 608, 974, 145, 529, 874, 17, 850, 248, 
-    548, 73, 408, 513, 757, 505, 760, 626, 14, 935, 775, 272, 277, 195, 403, 698, 
-    108, 225, 367, 787, 399, 804, 171, 540, 688, 172, 687, 334, 734, 677, 930, 740, 
-    192, 1018, 793, 113, 503, 10, 254, 945, 629, 249, 1013, 949, 272, 639, 488, 34, 
-    99, 1009, 202, 509, 88, 171, 130, 24, 197, 128, 680, 46, 510, 154, 369, 710, 
-    628, 452, 353, 968, 392, 42, 54, 429, 798, 402, 801, 666, 984, 249, 804, 164, 
-    276, 161, 945, 970, 9, 342, 204, 209, 149, 279, 917, 774, 698, 596, 545, 390, 
-    958, 619, 906, 554, 752, 660, 606, 851, 682, 544, 94, 996, 802, 356, 706, 635, 
-    390, 879, 949, 307, 802, 255, 680, 784, 1018, 194, 323, 452, 492, 744, 44, 412, 
-    341, 12, 845, 592, 782, 193, 802, 219, 485, 110, 103, 536, 992, 391, 780, 62, 
-    556, 795, 661, 312, 411, 2, 167, 733, 238, 36, 511, 482, 555, 790, 13, 300, 
-    113, 586, 74, 285, 483, 617, 956, 220, 219, 792, 100, 289, 1022, 260, 743, 754, 
-    962, 897, 766, 992, 563, 343, 600, 507, 218, 524, 327, 859, 76, 679, 504, 540, 
-    490, 791, 875, 517, 179, 656, 1, 539, 274, 523, 443, 874, 260, 155, 711, 756, 
-    774, 604, 673, 837, 334, 112, 118, 606, 349, 91, 139, 568, 6, 877, 655, 718, 
-    302, 563, 240, 45, 101, 102, 786, 406, 178, 385, 905, 443, 630, 328, 555, 366, 
-    838, 625, 750, 719, 847, 69, 561, 969, 770, 624, 957, 1022, 498, 461, 600, 770, 
-    908, 832, 968, 670, 533, 301, 441, 724, 43, 13, 1012, 457, 617, 321, 1015, 414, 
-    408, 300, 536, 780, 240, 846, 520, 928, 123, 616, 888, 541, 521, 630, 489, 225, 
-    641, 717, 532, 554, 199, 920, 60, 996, 141, 92, 496, 845, 904, 102, 734, 731, 
-    761, 273, 362, 830, 352, 534, 212, 655, 826, 865, 23, 582, 475, 321, 102, 780, 
-    697, 365, 924, 872, 498, 822, 618, 312, 627, 599, 586, 841, 788, 326, 912, 547, 
-    559, 159, 364, 1000, 196, 552, 328, 723, 81, 472, 265, 617, 333, 202, 749, 470, 
-    702, 727, 461, 195, 192, 984, 800, 1014, 793, 215, 1, 448, 379, 41, 233, 571, 
-    657, 757, 229, 61, 391, 156, 556, 331, 308, 197, 364, 278, 263, 650, 483, 910, 
-    381, 642, 495, 887, 763, 214, 137, 221, 1009, 731, 616, 659, 340, 166, 866, 935, 
-    371, 669, 855, 455, 316, 771, 131, 1021, 692, 422, 217, 231, 726, 589, 379, 990, 
-    777, 448, 119, 877, 828, 388, 177, 77, 69, 467, 40, 852, 104, 623, 979, 759, 
-    5, 21, 1012, 505, 799, 707, 1, 358, 555, 45, 117, 657, 905, 500, 803, 630, 
-    529, 355, 293, 53, 567, 979, 440, 303, 24, 203, 983, 486, 526, 240, 788, 153, 
-    971, 713, 620, 624, 469, 610, 396, 365, 926, 901, 736, 463, 189, 122, 929, 345, 
-    24, 617, 822, 777, 358, 873, 1018, 445, 609, 430, 952, 457, 422, 76, 450, 286, 
-    626, 304, 940, 936, 387, 1022, 801, 796, 429, 1012, 494, 832, 219, 476, 529, 157, 
-    322, 978, 355, 964, 712, 726, 114, 473, 850, 339, 102, 493, 641, 200, 819, 32, 
-    714, 544, 376, 995, 866, 23, 737, 636, 465, 381, 876, 555, 1, 602, 37, 406, 
-    591, 951, 266, 364, 46, 928, 738, 856, 36, 201, 1019, 938, 846, 657, 667, 790, 
-    90, 720, 234, 988, 278, 27, 18, 801, 338, 133, 689, 855, 530, 789, 886, 755, 
-    938, 97, 69, 368, 206, 495, 554, 788, 51, 227, 59, 928, 234, 472, 420, 217, 
-    790, 80, 106, 92, 377, 94, 407, 198, 541, 788, 937, 105, 688, 330, 993, 931, 
-    394, 522, 574, 545, 529, 549, 464, 771, 60, 871, 458, 770, 48, 212, 13, 698, 
-    409, 589, 794, 595, 384, 225, 604, 281, 823, 738, 207, 961, 749, 446, 958, 681, 
-    206, 270, 695, 853, 276, 303, 44, 499, 841, 842, 617, 310, 863, 418, 934, 994, 
-    183, 992, 892, 248, 85, 667, 488, 124, 142, 697, 338, 126, 739, 14, 1016, 160, 
-    876, 788, 526, 393, 22, 789, 216, 898, 165, 919, 165, 498, 664, 368, 662, 943, 
-    1009, 380, 879, 165, 37, 604, 839, 253, 505, 34, 940, 881, 700, 583, 220, 459, 
-    442, 464, 915, 921, 894, 418, 136, 254, 273, 279, 543, 401, 132, 479, 155, 310, 
-    804, 469, 421, 412, 42, 110, 195, 312, 241, 502, 524, 212, 585, 772, 170, 193, 
-    836, 270, 67, 363, 513, 928, 220, 143, 892, 672, 640, 31, 28, 789, 466, 449, 
-    364, 249, 441, 707, 175, 598, 654, 671, 480, 698, 217, 667, 105, 570, 450, 3, 
-    290, 68, 989, 752, 298, 364, 628, 719, 590, 840, 164, 903, 35, 699, 357, 94, 
-    119, 737, 307, 466, 1007, 1005, 882, 256, 51, 937, 512, 421, 545, 725, 816, 246, 
-    245, 615, 939, 536, 236, 492, 6, 909, 710, 379, 109, 883, 777, 595, 92, 809, 
-    601, 749, 675, 69, 834, 29, 78, 204, 412, 465, 610, 876, 956, 110, 907, 887, 
-    883, 681, 875, 234, 168, 203, 480, 280, 923, 920, 491, 295, 925, 253, 194, 536, 
-    226, 660, 377, 115, 508, 611, 492, 43, 108, 942, 663, 944, 507, 461, 805, 305, 
-    1015, 343, 382, 862, 659, 328, 624, 905, 958, 329, 219, 251, 357, 717, 456, 293, 
-    145, 354, 67, 573, 507, 76, 637, 911, 534, 765, 869, 580, 306, 526, 292, 116, 
-    439, 274, 212, 309, 17, 322, 236, 203, 378, 874, 460, 547, 862, 228, 1021, 16, 
-    426, 662, 951, 168, 828, 388, 804, 614, 989, 260, 512, 42, 926, 236, 802, 39, 
-    137, 820, 909, 810, 71, 866, 69, 146, 65, 544, 906, 601, 700, 271, 637, 505, 
-    939, 770, 362, 530, 224, 801, 1020, 144, 589, 880, 509, 147, 588, 482, 569, 832, 
-    296, 814, 113, 324, 61, 649, 557, 848, 57, 319, 130, 416, 954, 721, 916, 183, 
-    436, 248, 528, 716, 900, 905, 158, 853, 842, 309, 240, 229, 917, 222, 237, 590, 
-    306, 330, 321, 740, 921, 945, 90, 443, 510, 558, 761, 1004, 684, 825, 554, 227, 
-    321, 618, 162, 209, 789, 348, 808, 775, 120, 292, 642, 779, 312, 466, 612, 718, 
-    712, 675, 452, 18, 432, 586, 583, 174, 781, 100, 311, 129, 232, 811, 728, 442, 
-    16, 524, 23, 75, 629, 56, 101, 1020, 81, 104, 470, 96, 568, 153, 976, 853, 
-    625, 889, 802, 914, 931, 306, 528, 814, 572, 226, 82, 1004, 282, 594, 965, 631, 
-    387, 374, 1014, 324, 489, 251, 83, 915, 369, 300, 836, 267, 545, 931, 41, 198, 
-    291, 482, 871, 310, 442, 317, 969, 592, 839, 243, 768, 823, 993, 620, 901, 327, 
-    946, 8, 299, 699, 906, 723, 104, 448, 138, 229, 832, 763, 234, 916, 896, 703, 
-    858, 841, 316, 543, 733, 502, 187, 502, 613, 202, 692, 89, 524, 5, 688, 99, 
-    39, 587, 27, 579, 329, 585, 11, 219, 269, 78, 442, 724, 922, 378, 321, 233
-
-};
@@ -0,0 +1,292 @@
+/**
+ ******************************************************************************
+ * @file    block_renderer.c
+ * @brief   DMA Double-Buffered Block Renderer
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#include "block_renderer.h"
+
+#include "audio_config.h"
+#include "config.h"
+#include "profiler.h"
+#include "rcc.h"
+#include "sample_timer.h"
+
+/* Private includes ----------------------------------------------------------*/
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "stm32h5xx_hal.h"
+
+/* Private typedef -----------------------------------------------------------*/
+
+/**
+ * @brief Linked-list item reloaded by the DMA after every full buffer
+ * @note Field order follows the GPDMA register order for UB1 | USA | UDA | ULL,
+ *       CBR2 (the frame skip) is not reloaded and keeps its programmed value
+ */
+typedef struct
+{
+  uint32_t CBR1;
+  uint32_t CSAR;
+  uint32_t CDAR;
+  uint32_t CLLR;
+} block_renderer_node_t;
+
+/* Function Prototypes -------------------------------------------------------*/
+
+static void render_half(uint32_t half);
+
+void block_renderer_start();
+void block_renderer_stop();
+
+static void __block_renderer_handler(uint32_t *frames, uint16_t count);
+static void block_renderer_dma_wait_frame(DMA_Channel_TypeDef *dma, uint32_t count);
+static void block_renderer_timer_burst_config(TIM_TypeDef *timer, uint32_t source, uint32_t count);
+static void block_renderer_dma_channel_config(DMA_Channel_TypeDef *dma, block_renderer_node_t *node, uint32_t request, uint32_t *src, TIM_TypeDef *timer, uint32_t count);
+static void block_renderer_dma_config();
+
+void block_renderer_register_cb(block_renderer_cb_t cb);
+void block_renderer_init();
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+#define CHANNEL1_4_COUNT 4 // CCR values sent to CHANNEL1_4_TIMER per frame
+#define CHANNEL5_7_COUNT 3 // CCR values sent to CHANNEL5_7_TIMER per frame
+
+#define FRAME_BYTES (BLOCK_RENDERER_CHANNELS * 4) // One 32-bit CCR per channel
+#define BUFFER_FRAMES (2 * AUDIO_BLOCK_SIZE)
+
+#define BURST_BASE_CCR1 (offsetof(TIM_TypeDef, CCR1) / 4) // DCR.DBA, the burst starts at CCR1
+#define BURST_SOURCE_CC4 (TIM_DCR_DBSS_2 | TIM_DCR_DBSS_0) // DCR.DBSS, burst on the compare 4 request
+#define BURST_SOURCE_TRIG (TIM_DCR_DBSS_2 | TIM_DCR_DBSS_1 | TIM_DCR_DBSS_0) // DCR.DBSS, burst on the trigger request
+
+#if BLOCK_RENDERER_CHANNELS != (CHANNEL1_4_COUNT + CHANNEL5_7_COUNT)
+#error "Each frame must hold exactly one CCR per timer channel"
+#endif
+
+#if BUFFER_FRAMES > (DMA_CBR1_BRC_Msk >> DMA_CBR1_BRC_Pos) + 1
+#error "AUDIO_BLOCK_SIZE is too large for the GPDMA block repeat counter"
+#endif
+
+static block_renderer_cb_t event_cb = __block_renderer_handler;
+
+static uint32_t frame_buffer[2][AUDIO_BLOCK_SIZE][BLOCK_RENDERER_CHANNELS];
+static block_renderer_node_t loop_node1_4, loop_node5_7;
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Interrupt Functions                                                     */
+/*                                                                            */
+/* ========================================================================== */
+
+AUDIO_RAMFUNC void GPDMA1_Channel7_IRQHandler()
+{
+  uint32_t status = BLOCK_RENDERER_DMA->CSR;
+
+  if ((status | BLOCK_RENDERER_DMA5_7->CSR) & (DMA_CSR_DTEF | DMA_CSR_ULEF | DMA_CSR_USEF))
+    Error_Handler(); // Channels 5 - 7 raise no interrupt of their own, check them here
+
+  // First half has been sent, refill it while the second half plays
+  if (status & DMA_CSR_HTF)
+  {
+    BLOCK_RENDERER_DMA->CFCR = DMA_CFCR_HTF;
+    render_half(0);
+  }
+
+  // Second half has been sent, refill it while the first half plays
+  if (status & DMA_CSR_TCF)
+  {
+    BLOCK_RENDERER_DMA->CFCR = DMA_CFCR_TCF;
+    render_half(1);
+  }
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+AUDIO_RAMFUNC static void render_half(uint32_t half)
+{
+  PROFILER_START(start);
+
+  event_cb(&frame_buffer[half][0][0], AUDIO_BLOCK_SIZE);
+
+  // The DMA already finished the other half, it has been sending this one while it was rendered
+  PROFILER_CALLBACK(start, BLOCK_RENDERER_DMA->CSR & (half ? DMA_CSR_HTF : DMA_CSR_TCF));
+}
+
+void block_renderer_start()
+{
+  block_renderer_dma_config();
+
+  // Fill both halves so the first transfer never sends stale data
+  render_half(0);
+  render_half(1);
+
+  // Arm the DMAs, they wait on the timer burst requests
+  BLOCK_RENDERER_DMA5_7->CCR |= DMA_CCR_EN;
+  BLOCK_RENDERER_DMA->CCR |= DMA_CCR_EN;
+  sample_timer_start();
+}
+
+void block_renderer_stop()
+{
+  sample_timer_stop();
+
+  // Let the bursts already requested by the timers finish so no DMAR write is left pending
+  block_renderer_dma_wait_frame(BLOCK_RENDERER_DMA, CHANNEL1_4_COUNT);
+  block_renderer_dma_wait_frame(BLOCK_RENDERER_DMA5_7, CHANNEL5_7_COUNT);
+
+  BLOCK_RENDERER_DMA->CCR |= DMA_CCR_SUSP; // Suspend, both channels are between frames
+  BLOCK_RENDERER_DMA5_7->CCR |= DMA_CCR_SUSP;
+  while (!(BLOCK_RENDERER_DMA->CSR & DMA_CSR_SUSPF) || !(BLOCK_RENDERER_DMA5_7->CSR & DMA_CSR_SUSPF))
+    ;
+  BLOCK_RENDERER_DMA->CCR |= DMA_CCR_RESET; // Reset the channels, start() reprograms them
+  BLOCK_RENDERER_DMA5_7->CCR |= DMA_CCR_RESET;
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Placeholder Function for the render callback
+ */
+static void __block_renderer_handler(uint32_t *frames, uint16_t count)
+{
+  return;
+}
+
+/**
+ * @brief Wait until a channel is between two frames
+ * @param dma The channel to poll
+ * @param count Words of each frame the channel sends
+ * @note The block counter reloads once the last word of a frame is written
+ */
+static void block_renderer_dma_wait_frame(DMA_Channel_TypeDef *dma, uint32_t count)
+{
+  while ((dma->CBR1 & DMA_CBR1_BNDT) != count * 4)
+    ;
+}
+
+/**
+ * @brief Program the DMA burst of a timer, each request is expanded into count DMAR accesses
+ * @param timer The PWM timer
+ * @param source DCR.DBSS, the timer request starting each burst
+ * @param count Compare registers written per burst, from CCR1
+ */
+static void block_renderer_timer_burst_config(TIM_TypeDef *timer, uint32_t source, uint32_t count)
+{
+  timer->DCR = source | ((count - 1) << TIM_DCR_DBL_Pos) | (BURST_BASE_CCR1 << TIM_DCR_DBA_Pos);
+}
+
+/**
+ * @brief Program a DMA channel to feed part of each frame through the DMA burst register of a timer
+ * @param dma The 2D addressing channel to program
+ * @param node Linked-list item of the channel
+ * @param request Timer DMA request selected as the burst source
+ * @param src First word of the frame part in the first frame
+ * @param timer Timer receiving the words through DMAR
+ * @param count Words of each frame to send
+ * @note One block is one frame part, the timer raises one request per word. The block is
+ *       repeated for every frame of the buffer, the repeated block source offset skips the rest
+ *       of the frame, the linked-list item rewinds the source (circular)
+ */
+static void block_renderer_dma_channel_config(DMA_Channel_TypeDef *dma, block_renderer_node_t *node, uint32_t request, uint32_t *src, TIM_TypeDef *timer, uint32_t count)
+{
+  uint32_t frame_part_bytes = count * 4;
+  uint32_t node_cllr = ((uint32_t)node & DMA_CLLR_LA) | DMA_CLLR_UB1 | DMA_CLLR_USA | DMA_CLLR_UDA | DMA_CLLR_ULL;
+
+  node->CBR1 = ((BUFFER_FRAMES - 1) << DMA_CBR1_BRC_Pos) | frame_part_bytes;
+  node->CSAR = (uint32_t)src;
+  node->CDAR = (uint32_t)&timer->DMAR;
+  node->CLLR = node_cllr;
+
+  dma->CCR = 0;
+  dma->CFCR = 0x7F00; // Clear all the flags
+
+  dma->CTR1 = DMA_CTR1_SDW_LOG2_1 | DMA_CTR1_SINC | DMA_CTR1_SAP | // Word reads from SRAM on port 1
+              DMA_CTR1_DDW_LOG2_1;                                 // Word writes to the fixed DMAR on port 0
+  dma->CTR2 = (request << DMA_CTR2_REQSEL_Pos) | DMA_CTR2_DREQ |  // One word per timer request
+              DMA_CTR2_TCEM_0;                                     // Half / full events count repeated blocks (frames)
+  dma->CTR3 = 0;
+  dma->CBR1 = node->CBR1;
+  dma->CBR2 = (FRAME_BYTES - frame_part_bytes) << DMA_CBR2_BRSAO_Pos; // Skip to the next frame
+  dma->CSAR = node->CSAR;
+  dma->CDAR = node->CDAR;
+
+  dma->CLBAR = (uint32_t)node & DMA_CLBAR_LBA;
+  dma->CLLR = node_cllr;
+}
+
+/**
+ * @brief Program the DMAs and timer bursts to load one frame into the CCRs of both timers per sample
+ * @note The sample timer TRGO reaches both PWM timers as their trigger input (see channel_timer_init()).
+ *       Channels 1 - 4 burst on the trigger request and raise the half / full buffer interrupts,
+ *       TIM4 has no trigger request, channels 5 - 7 burst on compare 4 capturing the trigger input
+ */
+static void block_renderer_dma_config()
+{
+  block_renderer_timer_burst_config(CHANNEL1_4_TIMER, BURST_SOURCE_TRIG, CHANNEL1_4_COUNT);
+  CHANNEL1_4_TIMER->DIER |= TIM_DIER_TDE;
+
+  CHANNEL5_7_TIMER->CCER &= ~TIM_CCER_CC4E;                                                  // CC4S is only writable while disabled
+  CHANNEL5_7_TIMER->CCMR2 &= ~(TIM_CCMR2_OC4M | TIM_CCMR2_IC4F | TIM_CCMR2_IC4PSC);          // Drop the PWM mode, no filter or prescaler
+  CHANNEL5_7_TIMER->CCMR2 |= TIM_CCMR2_CC4S;                                                  // IC4 mapped on TRC, the trigger input
+  CHANNEL5_7_TIMER->CCER = (CHANNEL5_7_TIMER->CCER & ~(TIM_CCER_CC4P | TIM_CCER_CC4NP)) | TIM_CCER_CC4E; // Capture the rising edge
+  block_renderer_timer_burst_config(CHANNEL5_7_TIMER, BURST_SOURCE_CC4, CHANNEL5_7_COUNT);
+  CHANNEL5_7_TIMER->DIER |= TIM_DIER_CC4DE;
+
+  block_renderer_dma_channel_config(BLOCK_RENDERER_DMA, &loop_node1_4, CHANNEL1_4_DMA_REQUEST,
+                                    &frame_buffer[0][0][0], CHANNEL1_4_TIMER, CHANNEL1_4_COUNT);
+  block_renderer_dma_channel_config(BLOCK_RENDERER_DMA5_7, &loop_node5_7, CHANNEL5_7_DMA_REQUEST,
+                                    &frame_buffer[0][0][CHANNEL1_4_COUNT], CHANNEL5_7_TIMER, CHANNEL5_7_COUNT);
+
+  BLOCK_RENDERER_DMA5_7->CCR = DMA_CCR_LAP;
+  BLOCK_RENDERER_DMA->CCR = DMA_CCR_LAP | DMA_CCR_HTIE | DMA_CCR_TCIE | DMA_CCR_DTEIE | DMA_CCR_ULEIE | DMA_CCR_USEIE;
+}
+
+void block_renderer_register_cb(block_renderer_cb_t cb)
+{
+  event_cb = cb;
+}
+
+void block_renderer_init()
+{
+  // Enable the RCC for the DMA
+  RCC_GPDMA1_CLK_Enable();
+
+  sample_timer_init();
+  sample_timer_enable_dma();
+
+  // Enable the cycle counter, the scheduler times its ticks with it
+  DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  NVIC_EnableIRQ(BLOCK_RENDERER_DMA_IRQ);
+}
\ No newline at end of file
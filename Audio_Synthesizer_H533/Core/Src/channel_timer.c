@@ -0,0 +1,344 @@
+/**
+ ******************************************************************************
+ * @file    channel_timer.c
+ * @brief   Channel 1 to 7 Timer Control Interface
+ * @author  Adrian Sucahyo
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#include "channel_timer.h"
+
+#include "audio_config.h"
+#include "channel_common.h"
+#include "config.h"
+#include "profiler.h"
+#include "rcc.h"
+#include "sample_timer.h"
+#include "synth.h"
+
+/* Private includes ----------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+
+#include "stm32h5xx_hal.h"
+
+#include "effects.h"
+#include "midi.h"
+#include "mixer.h"
+#include "modulation.h"
+#include "voice_bank.h"
+
+/* Function Prototypes -------------------------------------------------------*/
+
+void channel_enable(channel_t channel);
+void channel_disable(channel_t channel);
+void channel_set_waveform(channel_t channel, waveforms_t wave);
+void channel_on_off(channel_t channel, uint8_t state);
+void channel_volume(channel_t channel, uint8_t volume);
+void channel_envelope(channel_t channel, uint16_t attack_ms, uint16_t decay_ms, uint8_t sustain, uint16_t release_ms);
+void channel_filter(channel_t channel, filter_mode_t mode, uint8_t cutoff, uint8_t resonance);
+void channel_pulse_width(channel_t channel, uint8_t width);
+void channel_frequency(channel_t channel, uint16_t freq);
+void channel_frequency_q16(channel_t channel, uint32_t freq);
+uint32_t channel_sample_rate(uint32_t rate);
+
+void channel_update();
+uint32_t channel_get_voice_cycles(uint8_t voice);
+uint32_t channel_get_mix_cycles();
+uint32_t channel_get_modulation_cycles();
+uint32_t channel_get_effect_cycles(effect_t effect);
+
+static void channel_timer_pwm_init(TIM_TypeDef *timer);
+static void channel_timer_slave_init(TIM_TypeDef *timer);
+static void channel_timer_gpio_init();
+void channel_timer_init();
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+#define CHANNEL_TIMER_PSC (1 - 1)
+#define CHANNEL_TIMER_ARR VOICE_BANK_FULL // ~240 kHz (244 kHz)
+
+/**
+ * @brief Output enable of a channel, indexed by channel_t
+ */
+typedef struct
+{
+  TIM_TypeDef *timer; // Timer generating the PWM
+  uint32_t ccer;      // Output enable bit in the timer CCER
+} channel_output_t;
+
+static const channel_output_t channel_outputs[VOICE_COUNT] = {
+    {CHANNEL1_4_TIMER, TIM_CCER_CC1E},
+    {CHANNEL1_4_TIMER, TIM_CCER_CC2E},
+    {CHANNEL1_4_TIMER, TIM_CCER_CC3E},
+    {CHANNEL1_4_TIMER, TIM_CCER_CC4E},
+    {CHANNEL5_7_TIMER, TIM_CCER_CC1E},
+    {CHANNEL5_7_TIMER, TIM_CCER_CC2E},
+    {CHANNEL5_7_TIMER, TIM_CCER_CC3E},
+};
+
+// Compare register holding the duty cycle, indexed by channel_t
+static volatile uint32_t *const channel_ccr[VOICE_COUNT] = {
+    &CHANNEL1_4_TIMER->CCR1,
+    &CHANNEL1_4_TIMER->CCR2,
+    &CHANNEL1_4_TIMER->CCR3,
+    &CHANNEL1_4_TIMER->CCR4,
+    &CHANNEL5_7_TIMER->CCR1,
+    &CHANNEL5_7_TIMER->CCR2,
+    &CHANNEL5_7_TIMER->CCR3,
+};
+
+#if !AUDIO_BLOCK_RENDER
+static uint16_t control_countdown; // Samples until the next control tick of channel_update()
+#endif
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+void channel_enable(channel_t channel)
+{
+  if (channel >= VOICE_COUNT)
+    return;
+
+  voice_enable(channel, 1);
+  channel_outputs[channel].timer->CCER |= channel_outputs[channel].ccer;
+}
+
+void channel_disable(channel_t channel)
+{
+  if (channel >= VOICE_COUNT)
+    return;
+
+  voice_enable(channel, 0);
+  channel_outputs[channel].timer->CCER &= ~channel_outputs[channel].ccer;
+}
+
+void channel_set_waveform(channel_t channel, waveforms_t wave)
+{
+  voice_set_waveform(channel, wave);
+}
+
+void channel_on_off(channel_t channel, uint8_t state)
+{
+  voice_on_off(channel, state);
+}
+
+void channel_volume(channel_t channel, uint8_t volume)
+{
+  voice_volume(channel, volume);
+}
+
+void channel_envelope(channel_t channel, uint16_t attack_ms, uint16_t decay_ms, uint8_t sustain, uint16_t release_ms)
+{
+  voice_envelope(channel, attack_ms, decay_ms, sustain, release_ms);
+}
+
+void channel_filter(channel_t channel, filter_mode_t mode, uint8_t cutoff, uint8_t resonance)
+{
+  voice_filter(channel, mode, cutoff, resonance);
+}
+
+void channel_pulse_width(channel_t channel, uint8_t width)
+{
+  voice_pulse_width(channel, width);
+}
+
+void channel_frequency(channel_t channel, uint16_t freq)
+{
+  voice_frequency(channel, (uint32_t)freq << 16);
+}
+
+void channel_frequency_q16(channel_t channel, uint32_t freq)
+{
+  voice_frequency(channel, freq);
+}
+
+uint32_t channel_sample_rate(uint32_t rate)
+{
+  rate = sample_timer_set_rate(rate);
+
+  synth_sample_rate();
+#if AUDIO_PROFILER
+  profiler_reset(); // New deadline
+#endif
+
+  return rate;
+}
+
+AUDIO_RAMFUNC void channel_update()
+{
+#if !AUDIO_BLOCK_RENDER
+  if (control_countdown == 0)
+  {
+    midi_dispatch(); // No scheduler, the queued MIDI is applied in the sample interrupt
+
+#if AUDIO_MODULATION
+    PROFILER_START(start);
+
+    modulation_tick();
+
+    PROFILER_STAGE(PROFILER_STAGE_MODULATION, start);
+#endif
+    control_countdown = CONTROL_TICK_SAMPLES;
+  }
+  control_countdown--;
+#endif
+
+  voice_bank_control(); // ENVELOPE_TICK_SAMPLES is 1 when rendering per sample
+
+#if AUDIO_MIXER
+  uint32_t frame[VOICE_COUNT];
+
+  mixer_render(frame, 1);
+
+  for (uint8_t channel = 0; channel < VOICE_COUNT; channel++)
+    *channel_ccr[channel] = frame[channel];
+#else
+  voice_bank_update(channel_ccr);
+#endif
+}
+
+uint32_t channel_get_voice_cycles(uint8_t voice)
+{
+#if AUDIO_PROFILER
+  return profiler_get_voice_cycles(voice);
+#else
+  (void)voice;
+  return 0;
+#endif
+}
+
+uint32_t channel_get_mix_cycles()
+{
+#if AUDIO_PROFILER
+  return profiler_get_stage_cycles(PROFILER_STAGE_MIX);
+#else
+  return 0;
+#endif
+}
+
+uint32_t channel_get_modulation_cycles()
+{
+#if AUDIO_PROFILER
+  return profiler_get_stage_cycles(PROFILER_STAGE_MODULATION);
+#else
+  return 0;
+#endif
+}
+
+uint32_t channel_get_effect_cycles(effect_t effect)
+{
+#if AUDIO_MIXER && AUDIO_EFFECTS && AUDIO_PROFILER
+  return effects_get_cycles(effect);
+#else
+  (void)effect;
+  return 0;
+#endif
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Configure all four compare channels of a timer as PWM outputs at 50%
+ */
+static void channel_timer_pwm_init(TIM_TypeDef *timer)
+{
+  timer->PSC = CHANNEL_TIMER_PSC;
+  timer->ARR = CHANNEL_TIMER_ARR;
+
+  timer->CCMR1 &= ~TIM_CCMR1_CC1S;                                                           // Select CCS Mode 0 - CC1 (output)
+  timer->CCMR1 = ((~TIM_CCMR1_OC1M) & timer->CCMR1) | (TIM_CCMR1_OC1M_2 | TIM_CCMR1_OC1M_1); // Enable PWM Mode 1 - OC1M
+  timer->CCMR1 = ((~TIM_CCMR1_OC1CE) & timer->CCMR1) | TIM_CCMR1_OC1CE;                      // Enable Clear - OC1C
+  timer->CCMR1 &= ~TIM_CCMR1_CC2S;                                                           // Select CCS Mode 0 - CC2(output)
+  timer->CCMR1 = ((~TIM_CCMR1_OC2M) & timer->CCMR1) | (TIM_CCMR1_OC2M_2 | TIM_CCMR1_OC2M_1); // Enable PWM Mode 1 - OC2M
+  timer->CCMR1 = ((~TIM_CCMR1_OC2CE) & timer->CCMR1) | TIM_CCMR1_OC2CE;                      // Enable Clear - OC2C
+
+  timer->CCMR2 &= ~TIM_CCMR2_CC3S;                                                           // Select CCS Mode 0 - CC3 (output)
+  timer->CCMR2 = ((~TIM_CCMR2_OC3M) & timer->CCMR2) | (TIM_CCMR2_OC3M_2 | TIM_CCMR2_OC3M_1); // Enable PWM Mode 1 - OC3M
+  timer->CCMR2 = ((~TIM_CCMR2_OC3CE) & timer->CCMR2) | TIM_CCMR2_OC3CE;                      // Enable Clear - OC3C
+  timer->CCMR2 &= ~TIM_CCMR2_CC4S;                                                           // Select CCS Mode 0 - CC4(output)
+  timer->CCMR2 = ((~TIM_CCMR2_OC4M) & timer->CCMR2) | (TIM_CCMR2_OC4M_2 | TIM_CCMR2_OC4M_1); // Enable PWM Mode 1 - OC4M
+  timer->CCMR2 = ((~TIM_CCMR2_OC4CE) & timer->CCMR2) | TIM_CCMR2_OC4CE;                      // Enable Clear - OC4C
+
+  timer->CCR1 = VOICE_BANK_MID; // Set default duty cycle to 50%
+  timer->CCR2 = VOICE_BANK_MID; // Set default duty cycle to 50%
+  timer->CCR3 = VOICE_BANK_MID; // Set default duty cycle to 50%
+  timer->CCR4 = VOICE_BANK_MID; // Set default duty cycle to 50%
+}
+
+/**
+ * @brief Listen to the sample timer TRGO, the first edge starts the counter
+ * @note The trigger stays routed to the timer, it also starts the DMA burst of each frame
+ */
+static void channel_timer_slave_init(TIM_TypeDef *timer)
+{
+  timer->CNT = 0;
+  timer->SMCR = (timer->SMCR & ~(TIM_SMCR_TS | TIM_SMCR_SMS)) | SAMPLE_TIMER_TRIGGER; // Select ITR1 - TS
+  timer->SMCR |= TIM_SMCR_SMS_2 | TIM_SMCR_SMS_1;                                     // Enable Trigger Mode - SMS
+}
+
+static void channel_timer_gpio_init()
+{
+  RCC_GPIOB_CLK_Enable();
+  RCC_GPIOC_CLK_Enable();
+
+  GPIO_InitTypeDef initChannel1_4 = {
+      CHANNEL1_GPIO_PIN | CHANNEL2_GPIO_PIN | CHANNEL3_GPIO_PIN | CHANNEL4_GPIO_PIN,
+      GPIO_MODE_AF_PP,
+      GPIO_NOPULL,
+      GPIO_SPEED_FREQ_HIGH,
+      GPIO_AF2_TIM3};
+
+  GPIO_InitTypeDef initChannel5_7 = {
+      CHANNEL5_GPIO_PIN | CHANNEL6_GPIO_PIN | CHANNEL7_GPIO_PIN,
+      GPIO_MODE_AF_PP,
+      GPIO_NOPULL,
+      GPIO_SPEED_FREQ_HIGH,
+      GPIO_AF2_TIM4};
+
+  HAL_GPIO_Init(CHANNEL1_4_GPIO_PORT, &initChannel1_4);
+  HAL_GPIO_Init(CHANNEL5_7_GPIO_PORT, &initChannel5_7);
+}
+
+void channel_timer_init()
+{
+  // Enable the RCC for the Timers
+  RCC_TIM3_CLK_Enable();
+  RCC_TIM4_CLK_Enable();
+
+  channel_timer_gpio_init();
+
+  synth_init();
+
+  channel_timer_pwm_init(CHANNEL1_4_TIMER);
+  channel_timer_pwm_init(CHANNEL5_7_TIMER);
+
+  // Both timers start on the same sample timer edge so the PWM periods stay aligned
+  channel_timer_slave_init(CHANNEL1_4_TIMER);
+  channel_timer_slave_init(CHANNEL5_7_TIMER);
+  sample_timer_enable_trigger();
+}
\ No newline at end of file
@@ -0,0 +1,665 @@
+/**
+ ******************************************************************************
+ * @file    effects.c
+ * @brief   Master Effects Bus
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "effects.h"
+
+#include "audio_config.h"
+#include "sample_rate.h"
+#include "wavetable.h"
+
+/* Private includes ----------------------------------------------------------*/
+#include <string.h>
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include "cmsis_compiler.h"
+#define EFFECTS_DSP 1 // Saturation instruction
+#else
+#define EFFECTS_DSP 0 // Portable C equivalent (host builds)
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+
+typedef struct
+{
+  int16_t *left;         // Delay lines, EFFECTS_DELAY_SAMPLES each
+  int16_t *right;        //
+  uint16_t write;        // Next position written
+  uint16_t left_delay;   // Delay in samples (1 to EFFECTS_DELAY_SAMPLES - 1)
+  uint16_t right_delay;  //
+  int32_t feedback;      // Echo into the same side (Q15)
+  int32_t cross;         // Echo into the other side (Q15)
+  int32_t mix;           // Echo into the output (Q15)
+  uint16_t left_ms;      // Delay times as set, the lengths follow the sample rate
+  uint16_t right_ms;     //
+} effects_delay_t;
+
+typedef struct
+{
+  int16_t *line;      // EFFECTS_CHORUS_SAMPLES, a power of two
+  uint16_t write;     // Next position written
+  uint32_t phase;     // Sweep position, a full turn is 2^32
+  uint32_t phase_inc; // Sweep advance per sample, precomputed from rate
+  uint32_t rate;      // Sweep frequency in Hz (Q16.16)
+  int32_t base;       // Centre of the sweep in samples (Q16)
+  int32_t depth;      // Sweep amplitude in samples (Q16)
+  int32_t amount;     // Depth as set (Q15), the amplitude follows the sample rate
+  int32_t mix;        // Swept taps into the output (Q15)
+} effects_chorus_t;
+
+typedef struct
+{
+  int16_t *line;   // Delay line
+  uint16_t length; // Samples in the line
+  uint16_t index;  // Next position read then written
+  int32_t store;   // Damping low-pass state (combs only)
+} effects_line_t;
+
+typedef struct
+{
+  effects_line_t comb[2][EFFECTS_REVERB_COMBS];        // Per side
+  effects_line_t allpass[2][EFFECTS_REVERB_ALLPASSES]; // Per side
+  int32_t feedback;                                    // Comb feedback (Q15), from the size
+  int32_t damp;                                        // Comb low-pass pole (Q15), from the damping
+  int32_t mix;                                         // Reverb into the output (Q15)
+} effects_reverb_t;
+
+/* Function Prototypes -------------------------------------------------------*/
+
+static inline int32_t effects_midi_q15(uint8_t value);
+static inline int32_t effects_saturate(int32_t sample);
+static inline int32_t effects_decay(int32_t product);
+static inline uint32_t effects_now();
+static inline uint32_t effects_ms_to_samples(uint32_t ms);
+static int16_t *effects_alloc(uint32_t samples);
+static void effects_clear(effect_t effect);
+static void effects_delay_lengths();
+static void effects_chorus_sweep();
+
+void effects_enable(effect_t effect, uint8_t state);
+void effects_delay(uint16_t left_ms, uint16_t right_ms, uint8_t feedback, uint8_t cross, uint8_t mix);
+void effects_delay_sync(uint16_t bpm, uint8_t numerator, uint8_t denominator);
+void effects_chorus(uint32_t rate, uint8_t depth, uint8_t mix);
+void effects_reverb(uint8_t size, uint8_t damping, uint8_t mix);
+
+static void effects_chorus_process(const int16_t *send, int16_t *left, int16_t *right, uint16_t count);
+static void effects_delay_process(int16_t *left, int16_t *right, uint16_t count);
+static void effects_comb(effects_line_t *comb, const int32_t *input, int32_t *wet, uint16_t count);
+static void effects_allpass(effects_line_t *allpass, int32_t *wet, uint16_t count);
+static void effects_reverb_process(int16_t *left, int16_t *right, uint16_t count);
+void effects_process(const int16_t *send, int16_t *left, int16_t *right, uint16_t count);
+uint8_t effects_active();
+uint32_t effects_get_cycles(effect_t effect);
+void effects_cycle_counter(uint32_t (*counter)());
+uint32_t effects_arena_used();
+
+static void effects_carve();
+void effects_sample_rate();
+void effects_init();
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+#define ARENA_SAMPLES (EFFECTS_ARENA_BYTES / sizeof(int16_t))
+#define ARENA_ALIGN 16 // Samples, lines start on a cache line
+
+#define CHORUS_MASK (EFFECTS_CHORUS_SAMPLES - 1)
+#define DECAY_BIAS (((int32_t)0x1 << 15) - 1) // Turns the shift of a negative Q30 product into a truncation towards zero
+
+// Freeverb tunings (samples at 44.1 kHz), scaled to the sample rate when the lines are carved
+#define REVERB_TUNING_RATE 44100
+#define REVERB_SPREAD 23                 // Extra length of the right side, decorrelates the tails
+#define REVERB_INPUT_GAIN 492            // 0.015 (Q15), keeps the sum of the combs in range
+#define REVERB_WET_SCALE 3               // Output gain of the tail
+#define REVERB_FEEDBACK_MIN 22938        // 0.70 (Q15), smallest room
+#define REVERB_FEEDBACK_RANGE 9175       // 0.28 (Q15), up to 0.98 for the largest room
+#define REVERB_DAMP_RANGE 13107          // 0.40 (Q15), strongest damping
+
+#if (EFFECTS_CHORUS_SAMPLES & CHORUS_MASK)
+#error "EFFECTS_CHORUS_SAMPLES must be a power of two"
+#endif
+
+#if ((EFFECTS_CHORUS_BASE_MS + EFFECTS_CHORUS_DEPTH_MS) * SAMPLE_FREQUENCY_MAX / 1000 + 2 >= EFFECTS_CHORUS_SAMPLES)
+#error "The chorus sweep does not fit in EFFECTS_CHORUS_SAMPLES at SAMPLE_FREQUENCY_MAX"
+#endif
+
+static const uint16_t comb_tuning[EFFECTS_REVERB_COMBS] = {1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617};
+static const uint16_t allpass_tuning[EFFECTS_REVERB_ALLPASSES] = {556, 441, 341, 225};
+
+static int16_t arena[ARENA_SAMPLES] __attribute__((aligned(32)));
+static uint32_t arena_used; // Samples handed out
+
+static effects_delay_t delay;
+static effects_chorus_t chorus;
+static effects_reverb_t reverb;
+
+static uint8_t enabled[EFFECT_COUNT];
+static uint8_t allocated[EFFECT_COUNT]; // The lines fit in the arena, the effect can be enabled
+static uint32_t cycles[EFFECT_COUNT];
+static uint32_t (*cycle_counter)();
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Scale a MIDI value to Q15, 127 is full scale
+ */
+static inline int32_t effects_midi_q15(uint8_t value)
+{
+  if (value > MIDI_MAX_VAL)
+    value = MIDI_MAX_VAL;
+
+  return (value << 8) | (value << 1) | (value >> 6);
+}
+
+/**
+ * @brief Saturate to a Q15 sample
+ */
+static inline int32_t effects_saturate(int32_t sample)
+{
+#if EFFECTS_DSP
+  return __SSAT(sample, 16);
+#else
+  return sample > INT16_MAX ? INT16_MAX : (sample < INT16_MIN ? INT16_MIN : sample);
+#endif
+}
+
+/**
+ * @brief Q30 product of a feedback loop to Q15, truncated towards zero
+ * @note Rounding or flooring lets a loop gain below 1 hold small values (or a DC offset)
+ *       forever, truncating towards zero always shrinks them so the tails decay to silence
+ */
+static inline int32_t effects_decay(int32_t product)
+{
+  return (product + ((product >> 31) & DECAY_BIAS)) >> 15;
+}
+
+/**
+ * @brief Read the cycle counter, 0 if none is set
+ */
+static inline uint32_t effects_now()
+{
+  return cycle_counter ? cycle_counter() : 0;
+}
+
+/**
+ * @brief Convert a time to samples at the current sample rate
+ */
+static inline uint32_t effects_ms_to_samples(uint32_t ms)
+{
+  return (uint32_t)(((uint64_t)ms * sample_rate_get()) / 1000);
+}
+
+/**
+ * @brief Take a line from the arena
+ * @return The line, NULL if the arena is exhausted
+ */
+static int16_t *effects_alloc(uint32_t samples)
+{
+  uint32_t size = (samples + ARENA_ALIGN - 1) & ~(uint32_t)(ARENA_ALIGN - 1);
+
+  if (size > ARENA_SAMPLES - arena_used)
+    return NULL;
+
+  int16_t *line = &arena[arena_used];
+  arena_used += size;
+  return line;
+}
+
+/**
+ * @brief Silence the lines of an effect
+ */
+static void effects_clear(effect_t effect)
+{
+  switch (effect)
+  {
+  case EFFECT_CHORUS:
+    memset(chorus.line, 0, EFFECTS_CHORUS_SAMPLES * sizeof(int16_t));
+    break;
+  case EFFECT_DELAY:
+    memset(delay.left, 0, EFFECTS_DELAY_SAMPLES * sizeof(int16_t));
+    memset(delay.right, 0, EFFECTS_DELAY_SAMPLES * sizeof(int16_t));
+    break;
+  case EFFECT_REVERB:
+    for (uint8_t side = 0; side < 2; side++)
+    {
+      for (uint8_t n = 0; n < EFFECTS_REVERB_COMBS; n++)
+      {
+        memset(reverb.comb[side][n].line, 0, reverb.comb[side][n].length * sizeof(int16_t));
+        reverb.comb[side][n].store = 0;
+      }
+      for (uint8_t n = 0; n < EFFECTS_REVERB_ALLPASSES; n++)
+        memset(reverb.allpass[side][n].line, 0, reverb.allpass[side][n].length * sizeof(int16_t));
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+void effects_enable(effect_t effect, uint8_t state)
+{
+  if (effect >= EFFECT_COUNT || !allocated[effect])
+    return;
+
+  if (state && !enabled[effect])
+    effects_clear(effect); // Start from silence, not from what was left in the lines
+
+  enabled[effect] = state ? 1 : 0;
+  cycles[effect] = 0;
+}
+
+/**
+ * @brief Convert the delay times to line lengths, clamped to the line
+ */
+static void effects_delay_lengths()
+{
+  uint32_t left = effects_ms_to_samples(delay.left_ms);
+  uint32_t right = effects_ms_to_samples(delay.right_ms);
+
+  delay.left_delay = left < 1 ? 1 : (left >= EFFECTS_DELAY_SAMPLES ? EFFECTS_DELAY_SAMPLES - 1 : left);
+  delay.right_delay = right < 1 ? 1 : (right >= EFFECTS_DELAY_SAMPLES ? EFFECTS_DELAY_SAMPLES - 1 : right);
+}
+
+/**
+ * @brief Convert the chorus rate and depth to a sweep in samples
+ */
+static void effects_chorus_sweep()
+{
+  chorus.phase_inc = wavetable_phase_increment(chorus.rate, sample_rate_get());
+  chorus.base = (int32_t)(effects_ms_to_samples(EFFECTS_CHORUS_BASE_MS) << 16);
+  chorus.depth = (int32_t)((effects_ms_to_samples(EFFECTS_CHORUS_DEPTH_MS) * (uint32_t)chorus.amount) << 1); // Q16
+}
+
+void effects_delay(uint16_t left_ms, uint16_t right_ms, uint8_t feedback, uint8_t cross, uint8_t mix)
+{
+  delay.left_ms = left_ms;
+  delay.right_ms = right_ms;
+  effects_delay_lengths();
+
+  delay.feedback = effects_midi_q15(feedback);
+  delay.cross = effects_midi_q15(cross);
+  delay.mix = effects_midi_q15(mix);
+}
+
+void effects_delay_sync(uint16_t bpm, uint8_t numerator, uint8_t denominator)
+{
+  if (bpm == 0 || denominator == 0)
+    return;
+
+  // A whole note lasts four beats of 60000 / bpm ms
+  uint32_t ms = (240000UL * numerator) / ((uint32_t)bpm * denominator);
+
+  if (ms > 0xFFFF)
+    ms = 0xFFFF;
+
+  effects_delay((uint16_t)ms, (uint16_t)ms, (uint8_t)(delay.feedback >> 8), (uint8_t)(delay.cross >> 8),
+                (uint8_t)(delay.mix >> 8));
+}
+
+void effects_chorus(uint32_t rate, uint8_t depth, uint8_t mix)
+{
+  chorus.rate = rate;
+  chorus.amount = effects_midi_q15(depth);
+  effects_chorus_sweep();
+  chorus.mix = effects_midi_q15(mix);
+}
+
+void effects_reverb(uint8_t size, uint8_t damping, uint8_t mix)
+{
+  reverb.feedback = REVERB_FEEDBACK_MIN + ((REVERB_FEEDBACK_RANGE * effects_midi_q15(size)) >> 15);
+  reverb.damp = (REVERB_DAMP_RANGE * effects_midi_q15(damping)) >> 15;
+  reverb.mix = effects_midi_q15(mix);
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Render Functions                                                        */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Mono to stereo chorus, two taps swept a quarter period apart
+ * @note The sweep is evaluated at both ends of the block and ramped in between
+ */
+AUDIO_RAMFUNC static void effects_chorus_process(const int16_t *send, int16_t *left, int16_t *right, uint16_t count)
+{
+  const wavetable_level_t *sine = &wavetable_sine.levels[0];
+  const int32_t base = chorus.base;
+  uint32_t phase_end = chorus.phase + chorus.phase_inc * count;
+
+  // Delay of each tap (Q16 samples) at both ends of the block
+  int32_t left_delay = base + (int32_t)(((int64_t)chorus.depth * wavetable_lookup(sine, chorus.phase)) >> 15);
+  int32_t right_delay = base + (int32_t)(((int64_t)chorus.depth * wavetable_lookup(sine, chorus.phase + 0x40000000)) >> 15);
+  int32_t left_end = base + (int32_t)(((int64_t)chorus.depth * wavetable_lookup(sine, phase_end)) >> 15);
+  int32_t right_end = base + (int32_t)(((int64_t)chorus.depth * wavetable_lookup(sine, phase_end + 0x40000000)) >> 15);
+  int32_t left_step = (left_end - left_delay) / count;
+  int32_t right_step = (right_end - right_delay) / count;
+
+  int16_t *line = chorus.line;
+  uint32_t write = chorus.write;
+  const int32_t mix = chorus.mix;
+
+  for (uint16_t n = 0; n < count; n++)
+  {
+    int32_t input = send[n];
+
+    line[write] = (int16_t)input;
+    left_delay += left_step;
+    right_delay += right_step;
+
+    // Read between two samples of the line, the fraction weights the later one
+    uint32_t position = (write << 16) - (uint32_t)left_delay;
+    int32_t a = line[(position >> 16) & CHORUS_MASK];
+    int32_t b = line[((position >> 16) + 1) & CHORUS_MASK];
+    int32_t left_tap = a + (((b - a) * (int32_t)((position & 0xFFFF) >> 1)) >> 15);
+
+    position = (write << 16) - (uint32_t)right_delay;
+    a = line[(position >> 16) & CHORUS_MASK];
+    b = line[((position >> 16) + 1) & CHORUS_MASK];
+    int32_t right_tap = a + (((b - a) * (int32_t)((position & 0xFFFF) >> 1)) >> 15);
+
+    left[n] = (int16_t)effects_saturate(input + ((left_tap * mix) >> 15));
+    right[n] = (int16_t)effects_saturate(input + ((right_tap * mix) >> 15));
+    write = (write + 1) & CHORUS_MASK;
+  }
+
+  chorus.write = (uint16_t)write;
+  chorus.phase = phase_end;
+}
+
+/**
+ * @brief Stereo delay with feedback and cross-feedback (ping-pong), in place
+ */
+AUDIO_RAMFUNC static void effects_delay_process(int16_t *left, int16_t *right, uint16_t count)
+{
+  int16_t *left_line = delay.left;
+  int16_t *right_line = delay.right;
+  int32_t write = delay.write;
+  int32_t left_read = write - delay.left_delay;
+  int32_t right_read = write - delay.right_delay;
+  const int32_t feedback = delay.feedback;
+  const int32_t cross = delay.cross;
+  const int32_t mix = delay.mix;
+
+  if (left_read < 0)
+    left_read += EFFECTS_DELAY_SAMPLES;
+  if (right_read < 0)
+    right_read += EFFECTS_DELAY_SAMPLES;
+
+  for (uint16_t n = 0; n < count; n++)
+  {
+    int32_t in_left = left[n];
+    int32_t in_right = right[n];
+    int32_t echo_left = left_line[left_read];
+    int32_t echo_right = right_line[right_read];
+
+    left_line[write] = (int16_t)effects_saturate(in_left + effects_decay(echo_left * feedback + echo_right * cross));
+    right_line[write] = (int16_t)effects_saturate(in_right + effects_decay(echo_right * feedback + echo_left * cross));
+
+    left[n] = (int16_t)effects_saturate(in_left + ((echo_left * mix) >> 15));
+    right[n] = (int16_t)effects_saturate(in_right + ((echo_right * mix) >> 15));
+
+    if (++write == EFFECTS_DELAY_SAMPLES)
+      write = 0;
+    if (++left_read == EFFECTS_DELAY_SAMPLES)
+      left_read = 0;
+    if (++right_read == EFFECTS_DELAY_SAMPLES)
+      right_read = 0;
+  }
+
+  delay.write = (uint16_t)write;
+}
+
+/**
+ * @brief Run a block through one feedback comb with a one-pole low-pass in the loop
+ * @param comb The comb
+ * @param input Scaled mono input (Q15)
+ * @param wet Sum of the combs, the output of this one is added
+ * @param count Number of samples
+ */
+AUDIO_RAMFUNC static void effects_comb(effects_line_t *comb, const int32_t *input, int32_t *wet, uint16_t count)
+{
+  int16_t *line = comb->line;
+  uint32_t index = comb->index;
+  int32_t store = comb->store;
+  const int32_t feedback = reverb.feedback;
+  const int32_t damp = reverb.damp;
+
+  for (uint16_t n = 0; n < count; n++)
+  {
+    int32_t out = line[index];
+
+    store = out + effects_decay((store - out) * damp);
+    line[index] = (int16_t)effects_saturate(input[n] + effects_decay(store * feedback));
+    if (++index == comb->length)
+      index = 0;
+
+    wet[n] += out;
+  }
+
+  comb->index = (uint16_t)index;
+  comb->store = store;
+}
+
+/**
+ * @brief Run a block through one allpass (feedback of 0.5), in place
+ */
+AUDIO_RAMFUNC static void effects_allpass(effects_line_t *allpass, int32_t *wet, uint16_t count)
+{
+  int16_t *line = allpass->line;
+  uint32_t index = allpass->index;
+
+  for (uint16_t n = 0; n < count; n++)
+  {
+    int32_t out = line[index];
+
+    line[index] = (int16_t)effects_saturate(wet[n] + out / 2); // Towards zero, like effects_decay()
+    if (++index == allpass->length)
+      index = 0;
+
+    wet[n] = out - wet[n];
+  }
+
+  allpass->index = (uint16_t)index;
+}
+
+/**
+ * @brief Freeverb-style stereo reverb, in place
+ * @note Each line runs over the whole block before the next, its state stays in registers
+ */
+AUDIO_RAMFUNC static void effects_reverb_process(int16_t *left, int16_t *right, uint16_t count)
+{
+  int32_t input[AUDIO_BLOCK_SIZE];
+  int32_t wet[AUDIO_BLOCK_SIZE];
+  const int32_t mix = reverb.mix * REVERB_WET_SCALE;
+
+  for (uint16_t n = 0; n < count; n++)
+    input[n] = ((left[n] + right[n]) * REVERB_INPUT_GAIN) >> 15;
+
+  for (uint8_t side = 0; side < 2; side++)
+  {
+    int16_t *samples = side ? right : left;
+
+    memset(wet, 0, count * sizeof(int32_t));
+
+    // Parallel combs, then series allpasses diffusing the echoes
+    for (uint8_t n = 0; n < EFFECTS_REVERB_COMBS; n++)
+      effects_comb(&reverb.comb[side][n], input, wet, count);
+    for (uint8_t n = 0; n < EFFECTS_REVERB_ALLPASSES; n++)
+      effects_allpass(&reverb.allpass[side][n], wet, count);
+
+    // The tail reaches 2^18 and the scaled mix 2^17, multiply in 64 bits
+    for (uint16_t n = 0; n < count; n++)
+      samples[n] = (int16_t)effects_saturate(samples[n] + (int32_t)(((int64_t)wet[n] * mix) >> 15));
+  }
+}
+
+AUDIO_RAMFUNC void effects_process(const int16_t *send, int16_t *left, int16_t *right, uint16_t count)
+{
+  uint32_t start;
+
+  if (count == 0)
+    return;
+
+  start = effects_now();
+  if (enabled[EFFECT_CHORUS])
+  {
+    effects_chorus_process(send, left, right, count);
+    cycles[EFFECT_CHORUS] = effects_now() - start;
+  }
+  else
+  {
+    memcpy(left, send, count * sizeof(int16_t));
+    memcpy(right, send, count * sizeof(int16_t));
+  }
+
+  start = effects_now();
+  if (enabled[EFFECT_DELAY])
+  {
+    effects_delay_process(left, right, count);
+    cycles[EFFECT_DELAY] = effects_now() - start;
+  }
+
+  start = effects_now();
+  if (enabled[EFFECT_REVERB])
+  {
+    effects_reverb_process(left, right, count);
+    cycles[EFFECT_REVERB] = effects_now() - start;
+  }
+}
+
+uint8_t effects_active()
+{
+  return enabled[EFFECT_CHORUS] | enabled[EFFECT_DELAY] | enabled[EFFECT_REVERB];
+}
+
+uint32_t effects_get_cycles(effect_t effect)
+{
+  if (effect >= EFFECT_COUNT)
+    return 0;
+
+  return cycles[effect];
+}
+
+void effects_cycle_counter(uint32_t (*counter)())
+{
+  cycle_counter = counter;
+}
+
+uint32_t effects_arena_used()
+{
+  return arena_used * sizeof(int16_t);
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Carve the lines of every effect out of the arena at the current sample rate
+ * @note The longest lines first, an effect that does not fit gives its lines back and stays off
+ */
+static void effects_carve()
+{
+  arena_used = 0;
+
+  delay.left = effects_alloc(EFFECTS_DELAY_SAMPLES);
+  delay.right = effects_alloc(EFFECTS_DELAY_SAMPLES);
+  delay.write = 0;
+  allocated[EFFECT_DELAY] = delay.left && delay.right;
+
+  uint32_t reverb_start = arena_used;
+  uint32_t rate = sample_rate_get();
+
+  allocated[EFFECT_REVERB] = 1;
+  for (uint8_t side = 0; side < 2; side++)
+  {
+    for (uint8_t n = 0; n < EFFECTS_REVERB_COMBS; n++)
+    {
+      effects_line_t *comb = &reverb.comb[side][n];
+
+      comb->length = (uint16_t)((uint32_t)(comb_tuning[n] + side * REVERB_SPREAD) * rate / REVERB_TUNING_RATE);
+      comb->line = effects_alloc(comb->length);
+      comb->index = 0;
+      comb->store = 0;
+      allocated[EFFECT_REVERB] &= comb->line != NULL;
+    }
+
+    for (uint8_t n = 0; n < EFFECTS_REVERB_ALLPASSES; n++)
+    {
+      effects_line_t *allpass = &reverb.allpass[side][n];
+
+      allpass->length = (uint16_t)((uint32_t)(allpass_tuning[n] + side * REVERB_SPREAD) * rate / REVERB_TUNING_RATE);
+      allpass->line = effects_alloc(allpass->length);
+      allpass->index = 0;
+      allpass->store = 0;
+      allocated[EFFECT_REVERB] &= allpass->line != NULL;
+    }
+  }
+
+  if (!allocated[EFFECT_REVERB])
+    arena_used = reverb_start; // Leave the room to the chorus
+
+  chorus.line = effects_alloc(EFFECTS_CHORUS_SAMPLES);
+  chorus.write = 0;
+  chorus.phase = 0;
+  allocated[EFFECT_CHORUS] = chorus.line != NULL;
+}
+
+void effects_sample_rate()
+{
+  uint8_t state[EFFECT_COUNT];
+
+  for (uint8_t effect = 0; effect < EFFECT_COUNT; effect++)
+  {
+    state[effect] = enabled[effect];
+    enabled[effect] = 0;
+  }
+
+  effects_carve();
+  effects_delay_lengths();
+  effects_chorus_sweep();
+
+  // Back on from silent lines, an effect that no longer fits stays off
+  for (uint8_t effect = 0; effect < EFFECT_COUNT; effect++)
+    effects_enable((effect_t)effect, state[effect]);
+}
+
+void effects_init()
+{
+  for (uint8_t effect = 0; effect < EFFECT_COUNT; effect++)
+  {
+    enabled[effect] = 0;
+    cycles[effect] = 0;
+  }
+
+  effects_carve();
+
+  effects_delay(125, 188, 48, 32, 64);
+  effects_chorus(0x1 << 15, 64, 96); // 0.5 Hz
+  effects_reverb(80, 64, 48);
+}
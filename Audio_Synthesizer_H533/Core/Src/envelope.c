@@ -0,0 +1,170 @@
+/**
+ ******************************************************************************
+ * @file    envelope.c
+ * @brief   ADSR Envelope Generator
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "envelope.h"
+
+#include "audio_config.h"
+#include "sample_rate.h"
+
+/* Private includes ----------------------------------------------------------*/
+#include <math.h>
+
+/* Function Prototypes -------------------------------------------------------*/
+
+static inline int32_t envelope_step(int32_t level, int32_t target, int32_t coef);
+static int32_t envelope_coefficient(uint16_t time_ms, float distance, float overshoot);
+
+void envelope_set(envelope_t *env, uint16_t attack_ms, uint16_t decay_ms, uint8_t sustain, uint16_t release_ms);
+void envelope_gate(envelope_t *env, uint8_t state);
+int32_t envelope_tick(envelope_t *env);
+void envelope_sample_rate(envelope_t *env);
+
+void envelope_init(envelope_t *env);
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+#define ENVELOPE_OVERSHOOT (ENVELOPE_FULL >> 10) // Targets lie ~60 dB past each segment end
+
+#define ENVELOPE_DEFAULT_ATTACK_MS 2
+#define ENVELOPE_DEFAULT_DECAY_MS 0
+#define ENVELOPE_DEFAULT_RELEASE_MS 20
+
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Move a level by a fraction of its distance to the target
+ */
+static inline int32_t envelope_step(int32_t level, int32_t target, int32_t coef)
+{
+  return level + (int32_t)(((int64_t)(target - level) * coef) >> 30);
+}
+
+/**
+ * @brief Per-tick coefficient of a one-pole segment
+ * @param time_ms Time to cover the distance
+ * @param distance Distance to cover (1.0 is full scale)
+ * @param overshoot How far past the end the target lies (1.0 is full scale)
+ * @return Fraction of the remaining distance covered per tick (Q30), full scale jumps in one tick
+ */
+static int32_t envelope_coefficient(uint16_t time_ms, float distance, float overshoot)
+{
+  if (time_ms == 0 || distance <= 0.0f)
+    return ENVELOPE_FULL;
+
+  // distance + overshoot shrinks to overshoot in time_ms: exp(-time / tau) = overshoot / (distance + overshoot)
+  float tick_ms = 1000.0f * ENVELOPE_TICK_SAMPLES / sample_rate_get();
+  float tau_ms = time_ms / logf((distance + overshoot) / overshoot);
+  float coef = 1.0f - expf(-tick_ms / tau_ms);
+
+  return (int32_t)(coef * ENVELOPE_FULL);
+}
+
+void envelope_set(envelope_t *env, uint16_t attack_ms, uint16_t decay_ms, uint8_t sustain, uint16_t release_ms)
+{
+  const float overshoot = (float)ENVELOPE_OVERSHOOT / ENVELOPE_FULL;
+
+  if (sustain > MIDI_MAX_VAL)
+    sustain = MIDI_MAX_VAL;
+
+  float sustain_level = (float)sustain / MIDI_MAX_VAL;
+
+  env->attack_ms = attack_ms;
+  env->decay_ms = decay_ms;
+  env->release_ms = release_ms;
+  env->sustain_value = sustain;
+
+  env->sustain = (int32_t)(sustain_level * ENVELOPE_FULL);
+  env->attack = envelope_coefficient(attack_ms, 1.0f, overshoot);
+  env->decay = envelope_coefficient(decay_ms, 1.0f - sustain_level, overshoot);
+  env->release = envelope_coefficient(release_ms, sustain_level > 0.0f ? sustain_level : 1.0f, overshoot);
+}
+
+void envelope_gate(envelope_t *env, uint8_t state)
+{
+  if (state)
+    env->stage = ENVELOPE_ATTACK; // Retrigger from the current level, no jump
+  else if (env->stage != ENVELOPE_IDLE)
+    env->stage = ENVELOPE_RELEASE;
+}
+
+int32_t envelope_tick(envelope_t *env)
+{
+  switch (env->stage)
+  {
+  case ENVELOPE_ATTACK:
+    env->level = envelope_step(env->level, ENVELOPE_FULL + ENVELOPE_OVERSHOOT, env->attack);
+    if (env->level >= ENVELOPE_FULL)
+    {
+      env->level = ENVELOPE_FULL;
+      env->stage = ENVELOPE_DECAY;
+    }
+    break;
+  case ENVELOPE_DECAY:
+    env->level = envelope_step(env->level, env->sustain - ENVELOPE_OVERSHOOT, env->decay);
+    if (env->level <= env->sustain)
+    {
+      env->level = env->sustain;
+      env->stage = ENVELOPE_SUSTAIN;
+    }
+    break;
+  case ENVELOPE_SUSTAIN:
+    env->level = env->sustain; // Follows sustain changes while held
+    break;
+  case ENVELOPE_RELEASE:
+    env->level = envelope_step(env->level, -ENVELOPE_OVERSHOOT, env->release);
+    if (env->level <= 0)
+    {
+      env->level = 0;
+      env->stage = ENVELOPE_IDLE;
+    }
+    break;
+  default:
+    env->level = 0;
+    break;
+  }
+
+  return env->level;
+}
+
+void envelope_sample_rate(envelope_t *env)
+{
+  envelope_set(env, env->attack_ms, env->decay_ms, env->sustain_value, env->release_ms);
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+void envelope_init(envelope_t *env)
+{
+  env->level = 0;
+  env->stage = ENVELOPE_IDLE;
+  envelope_set(env, ENVELOPE_DEFAULT_ATTACK_MS, ENVELOPE_DEFAULT_DECAY_MS, MIDI_MAX_VAL, ENVELOPE_DEFAULT_RELEASE_MS);
+}
@@ -0,0 +1,215 @@
+/**
+ ******************************************************************************
+ * @file    filter.c
+ * @brief   Resonant State-Variable Filter
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "filter.h"
+
+#include "audio_config.h"
+#include "sample_rate.h"
+
+/* Private includes ----------------------------------------------------------*/
+#include <math.h>
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include "cmsis_compiler.h"
+#define FILTER_DSP 1 // Saturation instruction
+#else
+#define FILTER_DSP 0 // Portable C equivalent (host builds)
+#endif
+
+/* Function Prototypes -------------------------------------------------------*/
+
+static inline int32_t filter_q31(float value);
+static inline int32_t filter_mul(int32_t coef, int32_t state);
+static inline int32_t filter_saturate(int32_t sample);
+
+void filter_set(filter_t *filter, filter_mode_t mode, uint8_t cutoff, uint8_t resonance);
+void filter_modulate(filter_t *filter, int32_t offset);
+void filter_process(filter_t *filter, int16_t *samples, uint16_t count, uint16_t stride);
+void filter_reset(filter_t *filter);
+
+void filter_table_init();
+void filter_init(filter_t *filter);
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+#define FILTER_STATE_SHIFT 8 // Q15 samples to Q23 states, room for a resonant peak of 25 (+28 dB)
+#define FILTER_KEY_MAX (((FILTER_KEYS - 1) << 8))
+#define FILTER_CUTOFF_LIMIT 0.45f // Highest cutoff as a fraction of the sample rate
+
+#define FILTER_DAMPING_MAX 2.0f  // Q = 0.5, no resonance
+#define FILTER_DAMPING_MIN 0.04f // Q = 25
+
+static float cutoff_table[FILTER_KEYS + 1]; // tan(pi * fc / fs) of each key, plus a guard entry
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Convert a coefficient in [0, 1] to Q31
+ */
+static inline int32_t filter_q31(float value)
+{
+  if (value >= 1.0f)
+    return INT32_MAX;
+
+  return (int32_t)(value * 2147483648.0f);
+}
+
+void filter_set(filter_t *filter, filter_mode_t mode, uint8_t cutoff, uint8_t resonance)
+{
+  if (cutoff > FILTER_KEYS - 1)
+    cutoff = FILTER_KEYS - 1;
+  if (resonance > MIDI_MAX_VAL)
+    resonance = MIDI_MAX_VAL;
+
+  filter->mode = mode;
+  filter->key = (int32_t)cutoff << 8;
+  filter->damping = FILTER_DAMPING_MAX - (FILTER_DAMPING_MAX - FILTER_DAMPING_MIN) * resonance / MIDI_MAX_VAL;
+  filter->bp = (int32_t)(filter->damping * (float)(0x1 << 29));
+
+  filter_modulate(filter, 0);
+}
+
+void filter_modulate(filter_t *filter, int32_t offset)
+{
+  int32_t key = filter->key + ((offset * FILTER_MODULATION_RANGE) >> 7); // Q15 semitone range to Q8 keys
+
+  if (key < 0)
+    key = 0;
+  if (key > FILTER_KEY_MAX)
+    key = FILTER_KEY_MAX;
+
+  // Interpolate the prewarped cutoff between two keys, then solve the trapezoidal integrators
+  const float *g_key = &cutoff_table[key >> 8];
+  float g = g_key[0] + (g_key[1] - g_key[0]) * (float)(key & 0xFF) * (1.0f / 256.0f);
+  float a1 = 1.0f / (1.0f + g * (g + filter->damping));
+  float a2 = g * a1;
+
+  filter->a1 = filter_q31(a1);
+  filter->a2 = filter_q31(a2);
+  filter->a3 = filter_q31(g * a2);
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Render Functions                                                        */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Multiply a state by a Q31 coefficient
+ */
+static inline int32_t filter_mul(int32_t coef, int32_t state)
+{
+  return (int32_t)(((int64_t)coef * state) >> 31);
+}
+
+/**
+ * @brief Saturate to a Q15 sample
+ */
+static inline int32_t filter_saturate(int32_t sample)
+{
+#if FILTER_DSP
+  return __SSAT(sample, 16);
+#else
+  return sample > INT16_MAX ? INT16_MAX : (sample < INT16_MIN ? INT16_MIN : sample);
+#endif
+}
+
+AUDIO_RAMFUNC void filter_process(filter_t *filter, int16_t *samples, uint16_t count, uint16_t stride)
+{
+  if (filter->mode == FILTER_OFF)
+    return;
+
+  // Work on a local copy of the filter, written back once per block
+  int32_t ic1 = filter->ic1;
+  int32_t ic2 = filter->ic2;
+  const int32_t a1 = filter->a1;
+  const int32_t a2 = filter->a2;
+  const int32_t a3 = filter->a3;
+
+  if (filter->mode == FILTER_LOW_PASS)
+  {
+    for (uint16_t n = 0; n < count; n++, samples += stride)
+    {
+      int32_t v3 = ((int32_t)*samples << FILTER_STATE_SHIFT) - ic2;
+      int32_t v1 = filter_mul(a1, ic1) + filter_mul(a2, v3);
+      int32_t v2 = ic2 + filter_mul(a2, ic1) + filter_mul(a3, v3);
+
+      ic1 = 2 * v1 - ic1;
+      ic2 = 2 * v2 - ic2;
+      *samples = (int16_t)filter_saturate(v2 >> FILTER_STATE_SHIFT);
+    }
+  }
+  else
+  {
+    const int32_t bp = filter->bp;
+
+    for (uint16_t n = 0; n < count; n++, samples += stride)
+    {
+      int32_t v3 = ((int32_t)*samples << FILTER_STATE_SHIFT) - ic2;
+      int32_t v1 = filter_mul(a1, ic1) + filter_mul(a2, v3);
+      int32_t v2 = ic2 + filter_mul(a2, ic1) + filter_mul(a3, v3);
+
+      ic1 = 2 * v1 - ic1;
+      ic2 = 2 * v2 - ic2;
+      *samples = (int16_t)filter_saturate((int32_t)(((int64_t)v1 * bp) >> (29 + FILTER_STATE_SHIFT)));
+    }
+  }
+
+  filter->ic1 = ic1;
+  filter->ic2 = ic2;
+}
+
+void filter_reset(filter_t *filter)
+{
+  filter->ic1 = 0;
+  filter->ic2 = 0;
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+void filter_table_init()
+{
+  for (uint16_t key = 0; key <= FILTER_KEYS; key++)
+  {
+    float freq = 440.0f * powf(2.0f, ((float)key - 69.0f) / 12.0f);
+    float limit = FILTER_CUTOFF_LIMIT * sample_rate_get();
+
+    // The top keys pass Nyquist at low rates, tan() would blow up, hold them just below it
+    cutoff_table[key] = tanf(3.14159265f * (freq < limit ? freq : limit) / sample_rate_get());
+  }
+}
+
+void filter_init(filter_t *filter)
+{
+  filter_reset(filter);
+  filter_set(filter, FILTER_OFF, FILTER_KEYS - 1, 0);
+}
@@ -0,0 +1,43 @@
+/**
+ ******************************************************************************
+ * @file    gain.c
+ * @brief   Gain Stage
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "gain.h"
+
+#include "audio_config.h"
+
+/* Private includes ----------------------------------------------------------*/
+#include "gain_data.h" // Generated by Tools/gain_gen.py at build time
+
+/* Function Prototypes -------------------------------------------------------*/
+
+int32_t gain_from_midi(uint8_t value);
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+int32_t gain_from_midi(uint8_t value)
+{
+  if (value > MIDI_MAX_VAL)
+    value = MIDI_MAX_VAL;
+
+  return gain_table[value];
+}
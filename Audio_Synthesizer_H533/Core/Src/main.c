@@ -22,28 +22,58 @@
 
 /* Private includes ----------------------------------------------------------*/
 
+#include "audio_config.h"
 #include "sample_timer.h"
+#include "block_renderer.h"
 #include "channel_common.h"
-#include "channel1_4_timer.h"
+#include "channel_timer.h"
+#include "midi.h"
+#include "noise_channel.h"
+#include "scheduler.h"
+#include "synth.h"
+#include "uart.h"
 
 /* Private typedef -----------------------------------------------------------*/
 
 /* Private define ------------------------------------------------------------*/
 
+// 1: Drone channels 1 - 4 and sweep their pitch from the main loop, 0: The voices only play the MIDI input
+#ifndef MAIN_DEMO
+#define MAIN_DEMO 0
+#endif
+
 /* Private macro -------------------------------------------------------------*/
 
 /* Private variables ---------------------------------------------------------*/
 
-extern volatile channel_state_t channel1_state, channel2_state, channel3_state, channel4_state;
-
 /* Private function prototypes -----------------------------------------------*/
 
 /* Private user code ---------------------------------------------------------*/
 
-void sample_timer_handler(uint16_t counter)
+AUDIO_RAMFUNC void sample_timer_handler(uint16_t counter)
+{
+  channel_update();
+}
+
+#if AUDIO_SCHEDULER
+/**
+ * @brief Audio rate, render the block then let the scheduler count it
+ */
+AUDIO_RAMFUNC void block_handler(uint32_t *frames, uint16_t count)
+{
+  synth_render(frames, count);
+  scheduler_block();
+}
+
+/**
+ * @brief Control rate, apply the queued MIDI events then tick the modulation and envelopes
+ */
+void control_handler()
 {
-  channel1_4_update();
+  midi_dispatch();
+  synth_control();
 }
+#endif
 
 /* ========================================================================== */
 /*                                                                            */
@@ -63,56 +93,87 @@ int main(void)
   MX_ICACHE_Init();
 
   // ==== SAMPLE TIMER ====
+#if AUDIO_BLOCK_RENDER
+#if AUDIO_SCHEDULER
+  block_renderer_register_cb(block_handler); // Render whole blocks, the DMA feeds the CCRs
+  block_renderer_init();
+  scheduler_register_cb(control_handler); // Control rate work in PendSV, below the block render
+  scheduler_init();
+#else
+  block_renderer_register_cb(synth_render); // Render whole blocks, the DMA feeds the CCRs
+  block_renderer_init();
+#endif
+#else
   sample_timer_register_cb(sample_timer_handler); // Register the Sample Timer Callback
   sample_timer_init();
+#endif
 
   // ==== OUTPUT CHANNELS ====
-  // Channels 1 - 4
-  channel1_4_timer_init();
+  // Channels 1 - 7
+  channel_timer_init();
 
+  for (channel_t channel = CHANNEL1; channel <= CHANNEL7; channel++)
+    channel_enable(channel); // Drive the PWM pin of every channel
+
+  // ==== MIDI VOICES ====
+  midi_init(); // Every MIDI channel drives its voice, all notes off
+
+#if MAIN_DEMO
   // Channel 1 Settings
-  channel1_4_enable(CHANNEL1);
-  channel1_4_set_waveform(CHANNEL1, WAVEFORM_SINE);
-  channel1_4_on_off(CHANNEL1, 1);
-  channel1_4_frequency(CHANNEL1, 100);
-  channel1_4_volume(CHANNEL1, 127);
+  channel_set_waveform(CHANNEL1, WAVEFORM_SINE);
+  channel_on_off(CHANNEL1, 1);
+  channel_frequency(CHANNEL1, 100);
+  channel_volume(CHANNEL1, 127);
 
   // Channel 2 Settings
-  channel1_4_enable(CHANNEL2);
-  channel1_4_set_waveform(CHANNEL2, WAVEFORM_TRIG);
-  channel1_4_on_off(CHANNEL2, 1);
-  channel1_4_frequency(CHANNEL2, 100);
-  channel1_4_volume(CHANNEL2, 127);
+  channel_set_waveform(CHANNEL2, WAVEFORM_TRIG);
+  channel_on_off(CHANNEL2, 1);
+  channel_frequency(CHANNEL2, 100);
+  channel_volume(CHANNEL2, 127);
 
   // Channel 3 Settings
-  channel1_4_enable(CHANNEL3);
-  channel1_4_set_waveform(CHANNEL3, WAVEFORM_RAMP);
-  channel1_4_on_off(CHANNEL3, 1);
-  channel1_4_frequency(CHANNEL3, 100);
-  channel1_4_volume(CHANNEL3, 127);
+  channel_set_waveform(CHANNEL3, WAVEFORM_RAMP);
+  channel_on_off(CHANNEL3, 1);
+  channel_frequency(CHANNEL3, 100);
+  channel_volume(CHANNEL3, 127);
 
   // Channel 4 Settings
-  channel1_4_enable(CHANNEL4);
-  channel1_4_set_waveform(CHANNEL4, WAVEFORM_SQUARE);
-  channel1_4_on_off(CHANNEL4, 1);
-  channel1_4_frequency(CHANNEL4, 100);
-  channel1_4_volume(CHANNEL4, 127);
+  channel_set_waveform(CHANNEL4, WAVEFORM_SQUARE);
+  channel_on_off(CHANNEL4, 1);
+  channel_frequency(CHANNEL4, 100);
+  channel_volume(CHANNEL4, 127);
+#endif
+
+  // Channel 8 (DAC noise), pitched for percussion, silent until noise_channel_on_off(1)
+  noise_channel_init();
+  noise_channel_frequency(4000);
+  noise_channel_volume(96);
+  noise_channel_enable();
+
+  // ==== MIDI INPUT ====
+  uart_midi_init(); // Received messages are applied at the control tick
 
   // Start the sample timer (advance the sampled waveforms)
+#if AUDIO_BLOCK_RENDER
+  block_renderer_start();
+#else
   sample_timer_start();
+#endif
 
+#if MAIN_DEMO
   uint16_t current_f = 100;
+#endif
 
   while (1)
   {
+#if MAIN_DEMO
     HAL_Delay(100);
 
     current_f += 100;
     current_f = current_f % 12000;
 
-    channel1_state.freq = current_f;
-    channel2_state.freq = current_f;
-    channel3_state.freq = current_f;
-    channel4_state.freq = current_f;
+    for (channel_t channel = CHANNEL1; channel <= CHANNEL4; channel++)
+      channel_frequency(channel, current_f);
+#endif
   };
 }
\ No newline at end of file
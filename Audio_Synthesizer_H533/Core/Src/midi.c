@@ -0,0 +1,430 @@
+/**
+ ******************************************************************************
+ * @file    midi.c
+ * @brief   MIDI Message Handling
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "midi.h"
+
+#include "audio_config.h"
+#include "channel_common.h"
+#include "modulation.h"
+#include "voice_bank.h"
+
+/* Function Prototypes -------------------------------------------------------*/
+
+void midi_note_on(uint8_t channel, uint8_t key, uint8_t velocity);
+void midi_note_off(uint8_t channel, uint8_t key);
+void midi_control_change(uint8_t channel, uint8_t control, uint8_t value);
+void midi_channel_pressure(uint8_t channel, uint8_t pressure);
+static midi_event_t *midi_parser_event(midi_parser_t *parser, uint8_t type, uint8_t status, uint8_t data1, uint8_t data2);
+static const midi_event_t *midi_parse_status(midi_parser_t *parser, uint8_t status);
+const midi_event_t *midi_parse(midi_parser_t *parser, uint8_t byte);
+void midi_apply(const midi_event_t *event);
+void midi_process(const uint8_t *data, uint16_t length);
+uint8_t midi_receive(uint8_t byte);
+uint8_t midi_post(const uint8_t *data, uint16_t length);
+void midi_dispatch();
+uint32_t midi_note_frequency(uint8_t key);
+
+void midi_parser_init(midi_parser_t *parser, uint8_t *sysex, uint16_t capacity);
+void midi_init();
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+// Status codes
+#define NOTE_OFF_EVENT (0x8)
+#define NOTE_ON_EVENT (0x9)
+#define POLYPHONIC_KEY_PRESSURE (0xA)
+#define CONTROL_CHANGE (0xB)
+#define PROGRAM_CHANGE (0xC)
+#define CHANNEL_PRESSURE (0xD)
+#define PITCH_BEND (0xE)
+#define SYSTEM_MESSAGE (0xF)
+
+// System messages
+#define BEGIN_SYSTEM_EXCLUSIVE (0xF0)
+#define MIDI_TIME_CODE (0xF1)
+#define SONG_POSITION_POINTER (0xF2)
+#define SONG_SELECT (0xF3)
+#define TUNE_REQUEST (0xF6)
+#define END_SYSTEM_EXCLUSIVE (0xF7)
+#define SYSTEM_REAL_TIME (0xF8) // F8 - FF, single bytes allowed inside any message
+#define REAL_TIME_UNDEFINED_F9 (0xF9)
+#define REAL_TIME_UNDEFINED_FD (0xFD)
+
+// Bit masks
+#define STATUS_msk (0x80)
+#define MESSAGETYPE_msk (0xF0)
+#define CHANNEL_msk (0x0F)
+#define DATA_msk (0x7F)
+
+// Controllers
+#define MODULATION_WHEEL (1)
+#define CHANNEL_VOLUME (7)
+
+#define MIDI_CHANNELS 16
+#define MIDI_VOICES (MIDI_CHANNELS < VOICE_BANK_VOICES ? MIDI_CHANNELS : VOICE_BANK_VOICES)
+
+// Octave -1 (C-1 to B-1) in Hz (Q16.16), higher octaves are left shifts
+static const uint32_t note_frequency[12] = {
+    535809,  // C   8.176 Hz
+    567670,  // Db  8.662 Hz
+    601425,  // D   9.177 Hz
+    637188,  // Eb  9.723 Hz
+    675077,  // E  10.301 Hz
+    715219,  // F  10.913 Hz
+    757749,  // Gb 11.562 Hz
+    802807,  // G  12.250 Hz
+    850544,  // Ab 12.978 Hz
+    901120,  // A  13.750 Hz
+    954703,  // Bb 14.568 Hz
+    1011473, // B  15.434 Hz
+};
+
+#define QUEUE_MASK (MIDI_QUEUE_LENGTH - 1)
+
+#if MIDI_QUEUE_LENGTH & QUEUE_MASK
+#error "MIDI_QUEUE_LENGTH must be a power of two"
+#endif
+
+static uint8_t voice_key[MIDI_VOICES]; // Key played by the voice of each channel
+
+static volatile uint32_t queue[MIDI_QUEUE_LENGTH]; // Messages packed as status | data1 << 8 | data2 << 16
+static volatile uint16_t queue_head;               // Next message written, only moved by midi_post()
+static volatile uint16_t queue_tail;               // Next message applied, only moved by midi_dispatch()
+
+static midi_parser_t receive_parser; // Stream of midi_receive(), system exclusive bytes skipped
+static midi_parser_t process_parser; // Stream of midi_process()
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+void midi_note_on(uint8_t channel, uint8_t key, uint8_t velocity)
+{
+  if (velocity == 0)
+  {
+    midi_note_off(channel, key); // Running note offs are sent as note ons at zero velocity
+    return;
+  }
+
+  if (channel >= MIDI_VOICES)
+    return;
+
+  voice_key[channel] = key;
+  voice_frequency(channel, midi_note_frequency(key));
+  voice_velocity(channel, velocity);
+  voice_on_off(channel, 1);
+}
+
+void midi_note_off(uint8_t channel, uint8_t key)
+{
+  if (channel >= MIDI_VOICES || voice_key[channel] != key)
+    return;
+
+  voice_key[channel] = MIDI_NOTE_NONE;
+  voice_on_off(channel, 0);
+}
+
+void midi_control_change(uint8_t channel, uint8_t control, uint8_t value)
+{
+  if (channel >= MIDI_VOICES)
+    return;
+
+  switch (control)
+  {
+  case MODULATION_WHEEL:
+    modulation_controller(channel, MODULATION_SOURCE_MOD_WHEEL, value);
+    break;
+  case CHANNEL_VOLUME:
+    voice_volume(channel, value);
+    break;
+  default:
+    break;
+  }
+}
+
+void midi_channel_pressure(uint8_t channel, uint8_t pressure)
+{
+  if (channel >= MIDI_VOICES)
+    return;
+
+  modulation_controller(channel, MODULATION_SOURCE_AFTERTOUCH, pressure);
+}
+
+/**
+ * @brief Complete a message in the parser event
+ */
+static midi_event_t *midi_parser_event(midi_parser_t *parser, uint8_t type, uint8_t status, uint8_t data1, uint8_t data2)
+{
+  midi_event_t *event = &parser->event;
+
+  event->type = type;
+  event->status = status;
+  event->data1 = data1;
+  event->data2 = data2;
+  event->sysex = NULL;
+  event->sysex_length = 0;
+
+  return event;
+}
+
+/**
+ * @brief Handle a status byte other than real-time
+ */
+static const midi_event_t *midi_parse_status(midi_parser_t *parser, uint8_t status)
+{
+  parser->count = 0;
+
+  if ((status & MESSAGETYPE_msk) >> 4 != SYSTEM_MESSAGE)
+  {
+    // Channel message, the status stays running until another status arrives
+    uint8_t type = (status & MESSAGETYPE_msk) >> 4;
+
+    parser->status = status;
+    parser->expected = (type == PROGRAM_CHANGE || type == CHANNEL_PRESSURE) ? 1 : 2;
+    return NULL;
+  }
+
+  // System common messages cancel the running status
+  parser->status = 0;
+
+  switch (status)
+  {
+  case BEGIN_SYSTEM_EXCLUSIVE:
+    parser->in_sysex = 1;
+    parser->sysex_length = 0;
+    break;
+  case END_SYSTEM_EXCLUSIVE:
+    break; // Stray, no message open
+  case MIDI_TIME_CODE:
+  case SONG_SELECT:
+    parser->status = status;
+    parser->expected = 1;
+    break;
+  case SONG_POSITION_POINTER:
+    parser->status = status;
+    parser->expected = 2;
+    break;
+  case TUNE_REQUEST:
+    return midi_parser_event(parser, MIDI_EVENT_SYSTEM_COMMON, status, 0, 0);
+  default:
+    break; // F4, F5 undefined
+  }
+
+  return NULL;
+}
+
+const midi_event_t *midi_parse(midi_parser_t *parser, uint8_t byte)
+{
+  if (byte >= SYSTEM_REAL_TIME)
+  {
+    // May sit between any two bytes, the message in progress is left untouched
+    if (byte == REAL_TIME_UNDEFINED_F9 || byte == REAL_TIME_UNDEFINED_FD)
+      return NULL;
+    return midi_parser_event(parser, MIDI_EVENT_REAL_TIME, byte, 0, 0);
+  }
+
+  if (byte & STATUS_msk)
+  {
+    if (parser->in_sysex)
+    {
+      parser->in_sysex = 0;
+
+      if (byte == END_SYSTEM_EXCLUSIVE)
+      {
+        midi_event_t *event = midi_parser_event(parser, MIDI_EVENT_SYSTEM_EXCLUSIVE, BEGIN_SYSTEM_EXCLUSIVE, 0, 0);
+        event->sysex = parser->sysex;
+        event->sysex_length = parser->sysex ? parser->sysex_length : 0;
+        return event;
+      }
+      // Any other status cuts the system exclusive message short, it is dropped
+    }
+
+    return midi_parse_status(parser, byte);
+  }
+
+  if (parser->in_sysex)
+  {
+    if (parser->sysex_length < parser->sysex_capacity)
+      parser->sysex[parser->sysex_length++] = byte;
+    return NULL;
+  }
+
+  if (parser->status == 0)
+    return NULL; // Data byte without a status, skip it
+
+  parser->data[parser->count++] = byte;
+  if (parser->count < parser->expected)
+    return NULL;
+
+  uint8_t status = parser->status;
+  uint8_t data2 = parser->expected > 1 ? parser->data[1] : 0;
+
+  parser->count = 0;
+
+  if ((status & MESSAGETYPE_msk) >> 4 == SYSTEM_MESSAGE)
+  {
+    parser->status = 0; // System common messages never run
+    return midi_parser_event(parser, MIDI_EVENT_SYSTEM_COMMON, status, parser->data[0], data2);
+  }
+
+  return midi_parser_event(parser, (status & MESSAGETYPE_msk) >> 4, status, parser->data[0], data2);
+}
+
+void midi_apply(const midi_event_t *event)
+{
+  uint8_t channel = event->status & CHANNEL_msk;
+
+  switch (event->type)
+  {
+  case MIDI_EVENT_NOTE_ON:
+    midi_note_on(channel, event->data1, event->data2);
+    break;
+  case MIDI_EVENT_NOTE_OFF:
+    midi_note_off(channel, event->data1);
+    break;
+  case MIDI_EVENT_CONTROL_CHANGE:
+    midi_control_change(channel, event->data1, event->data2);
+    break;
+  case MIDI_EVENT_CHANNEL_PRESSURE:
+    midi_channel_pressure(channel, event->data1);
+    break;
+  default:
+    break;
+  }
+}
+
+void midi_process(const uint8_t *data, uint16_t length)
+{
+  for (uint16_t index = 0; index < length; index++)
+  {
+    const midi_event_t *event = midi_parse(&process_parser, data[index]);
+
+    if (event)
+      midi_apply(event);
+  }
+}
+
+uint8_t midi_receive(uint8_t byte)
+{
+  const midi_event_t *event = midi_parse(&receive_parser, byte);
+
+  if (!event)
+    return 1;
+
+  switch (event->type)
+  {
+  case MIDI_EVENT_NOTE_ON:
+  case MIDI_EVENT_NOTE_OFF:
+  case MIDI_EVENT_CONTROL_CHANGE:
+  case MIDI_EVENT_CHANNEL_PRESSURE:
+  {
+    uint16_t head = queue_head;
+    uint16_t next = (head + 1) & QUEUE_MASK;
+
+    if (next == queue_tail)
+      return 0; // Full, the control tick has fallen behind
+
+    queue[head] = event->status | (uint32_t)event->data1 << 8 | (uint32_t)event->data2 << 16;
+    queue_head = next; // Publish after the message is written
+    break;
+  }
+  default:
+    break;
+  }
+
+  return 1;
+}
+
+uint8_t midi_post(const uint8_t *data, uint16_t length)
+{
+  uint8_t queued = 1;
+
+  for (uint16_t index = 0; index < length; index++)
+    queued &= midi_receive(data[index]);
+
+  return queued;
+}
+
+void midi_dispatch()
+{
+  uint16_t tail = queue_tail;
+  uint16_t head = queue_head; // Messages posted while dispatching wait for the next tick
+
+  while (tail != head)
+  {
+    uint32_t message = queue[tail];
+    midi_event_t event = {0};
+
+    event.status = (uint8_t)message;
+    event.type = event.status >> 4; // Only channel messages are queued
+    event.data1 = (uint8_t)(message >> 8);
+    event.data2 = (uint8_t)(message >> 16);
+    midi_apply(&event);
+
+    tail = (tail + 1) & QUEUE_MASK;
+  }
+
+  queue_tail = tail;
+}
+
+uint32_t midi_note_frequency(uint8_t key)
+{
+  key &= DATA_msk;
+
+  return note_frequency[key % 12] << (key / 12);
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+void midi_parser_init(midi_parser_t *parser, uint8_t *sysex, uint16_t capacity)
+{
+  parser->status = 0;
+  parser->expected = 0;
+  parser->count = 0;
+  parser->in_sysex = 0;
+  parser->sysex = sysex;
+  parser->sysex_capacity = sysex ? capacity : 0;
+  parser->sysex_length = 0;
+}
+
+void midi_init()
+{
+  queue_head = 0;
+  queue_tail = 0;
+
+  midi_parser_init(&receive_parser, NULL, 0);
+  midi_parser_init(&process_parser, NULL, 0);
+
+  for (uint8_t channel = 0; channel < MIDI_VOICES; channel++)
+  {
+    voice_key[channel] = MIDI_NOTE_NONE;
+    voice_on_off(channel, 0);
+    voice_enable(channel, 1);
+  }
+}
@@ -0,0 +1,422 @@
+/**
+ ******************************************************************************
+ * @file    mixer.c
+ * @brief   Virtual Voice Mixer
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "mixer.h"
+
+#include "audio_config.h"
+#include "channel_common.h"
+#include "voice_bank.h"
+
+#if AUDIO_EFFECTS
+#include "effects.h"
+#endif
+
+/* Private includes ----------------------------------------------------------*/
+#include <string.h>
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include "cmsis_compiler.h"
+#define MIXER_DSP 1 // SIMD multiply-accumulate and saturation instructions
+#else
+#define MIXER_DSP 0 // Portable C equivalents (host builds)
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+
+#define MIXER_PAIRS (MIXER_VOICE_COUNT / 2) // Voices are mixed two per instruction
+
+/**
+ * @brief Q15 samples of every voice, interleaved so one word holds two neighbouring voices
+ */
+typedef union
+{
+  int16_t q15[AUDIO_BLOCK_SIZE][MIXER_VOICE_COUNT]; // Written by the voices
+  uint32_t pairs[AUDIO_BLOCK_SIZE][MIXER_PAIRS];    // Read by the mixer
+} mixer_block_t;
+
+/**
+ * @brief Q15 route gains, one row per output packed in the voice pair order of mixer_block_t
+ */
+typedef union
+{
+  int16_t q15[MIXER_OUTPUT_COUNT][MIXER_VOICE_COUNT];
+  uint32_t pairs[MIXER_OUTPUT_COUNT][MIXER_PAIRS];
+} mixer_gains_t;
+
+/* Function Prototypes -------------------------------------------------------*/
+
+static inline int64_t mixer_mac_pair(uint32_t voices, uint32_t gains, int64_t acc);
+static inline int32_t mixer_saturate(int64_t acc);
+static void mixer_mix_output(uint8_t output, int16_t *samples, uint16_t count);
+static void mixer_quantize_output(uint8_t output, const int16_t *samples, uint32_t *frame, uint16_t count);
+static inline uint8_t mixer_returned(uint8_t output);
+static void mixer_add_return(uint8_t output, int16_t *samples, const int16_t *left, const int16_t *right, uint16_t count);
+
+void mixer_route(uint8_t voice, uint8_t output, int16_t gain);
+int16_t mixer_get_route(uint8_t voice, uint8_t output);
+void mixer_return(uint8_t output, int16_t left, int16_t right);
+
+void mixer_render_voice(uint8_t voice, uint16_t count);
+void mixer_mix(uint32_t *frames, uint16_t count);
+void mixer_render(uint32_t *frames, uint16_t count);
+const int16_t *mixer_dac_bus();
+
+void mixer_init();
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+#define SAMPLE_SHIFT (16 - PWM_OUTPUT_BITS) // Q15 sample to a compare offset around VOICE_BANK_MID
+
+#define QUANTIZE_ROUND ((int32_t)0x1 << (SAMPLE_SHIFT - 1)) // Round to the nearest compare value
+
+#if MIXER_VOICE_COUNT & 0x1
+#error "The mixer sums voices in pairs, MIXER_VOICE_COUNT must be even"
+#endif
+
+#if PWM_NOISE_SHAPING > 2
+#error "PWM_NOISE_SHAPING supports up to second order error feedback"
+#endif
+
+static mixer_block_t mixer_block __attribute__((aligned(VOICE_BANK_LINE)));
+static mixer_gains_t mixer_gains __attribute__((aligned(VOICE_BANK_LINE)));
+static uint8_t output_routes[MIXER_OUTPUT_COUNT]; // Voices routed to each output, unrouted outputs are not mixed
+static uint8_t voice_routes[MIXER_VOICE_COUNT];   // Outputs each voice reaches, unrouted voices are not rendered
+static int16_t return_gains[MIXER_OUTPUT_FX][2];  // Q15 gains of the left and right effects return in each output
+
+#if PWM_NOISE_SHAPING
+static int32_t shaper_error[VOICE_COUNT][2]; // Last two quantization errors of each PWM output (Q15)
+#endif
+
+static int16_t dac_bus[2][AUDIO_BLOCK_SIZE];
+static uint8_t dac_write;                  // Half of the DAC bus being filled
+static uint16_t dac_fill;                  // Samples already mixed into that half
+static const int16_t *volatile dac_ready; // Last complete half, NULL until one is mixed
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+void mixer_route(uint8_t voice, uint8_t output, int16_t gain)
+{
+  if (voice >= MIXER_VOICE_COUNT || output >= MIXER_OUTPUT_COUNT)
+    return;
+
+  int16_t *route = &mixer_gains.q15[output][voice];
+
+  if (*route == 0 && gain != 0)
+  {
+    output_routes[output]++;
+    voice_routes[voice]++;
+  }
+  else if (*route != 0 && gain == 0)
+  {
+    output_routes[output]--;
+    voice_routes[voice]--;
+  }
+
+  *route = gain;
+}
+
+int16_t mixer_get_route(uint8_t voice, uint8_t output)
+{
+  if (voice >= MIXER_VOICE_COUNT || output >= MIXER_OUTPUT_COUNT)
+    return 0;
+
+  return mixer_gains.q15[output][voice];
+}
+
+void mixer_return(uint8_t output, int16_t left, int16_t right)
+{
+  if (output >= MIXER_OUTPUT_FX)
+    return;
+
+  return_gains[output][0] = left;
+  return_gains[output][1] = right;
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Render Functions                                                        */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Multiply two voices by their gains and add both products to the accumulator
+ * @note SMLALD, the 64-bit accumulating form of SMLAD, 16 full-scale products overflow 32 bits
+ */
+static inline int64_t mixer_mac_pair(uint32_t voices, uint32_t gains, int64_t acc)
+{
+#if MIXER_DSP
+  return (int64_t)__SMLALD(voices, gains, (uint64_t)acc);
+#else
+  return acc + (int32_t)(int16_t)voices * (int16_t)gains + (int32_t)(int16_t)(voices >> 16) * (int16_t)(gains >> 16);
+#endif
+}
+
+/**
+ * @brief Q30 sum of products to a saturated Q15 sample
+ */
+static inline int32_t mixer_saturate(int64_t acc)
+{
+  int32_t sample = (int32_t)(acc >> 15); // At most 2^19, fits before saturating
+
+#if MIXER_DSP
+  return __SSAT(sample, 16);
+#else
+  return sample > INT16_MAX ? INT16_MAX : (sample < INT16_MIN ? INT16_MIN : sample);
+#endif
+}
+
+/**
+ * @brief Mix every voice of the block into one output
+ * @param output The output whose gain row is applied
+ * @param samples Q15 output, one sample per frame
+ * @param count Number of samples to mix
+ */
+AUDIO_RAMFUNC static void mixer_mix_output(uint8_t output, int16_t *samples, uint16_t count)
+{
+  const uint32_t *gains = mixer_gains.pairs[output];
+
+  for (uint16_t n = 0; n < count; n++)
+  {
+    const uint32_t *voices = mixer_block.pairs[n];
+    int64_t acc = 0;
+
+    for (uint8_t pair = 0; pair < MIXER_PAIRS; pair++)
+      acc = mixer_mac_pair(voices[pair], gains[pair], acc);
+
+    samples[n] = (int16_t)mixer_saturate(acc);
+  }
+}
+
+/**
+ * @brief Quantize the mix of a PWM output to compare values
+ * @param output The PWM output, selects the noise shaper state
+ * @param samples Q15 mix of the output
+ * @param frame First frame word of the output
+ * @param count Number of samples to quantize
+ * @note The error feedback makes the quantization noise transfer (1 - z^-1)^order, the noise falls
+ *       in the audio band and rises towards SAMPLE_FREQUENCY / 2 where the output low-pass removes it
+ */
+AUDIO_RAMFUNC static void mixer_quantize_output(uint8_t output, const int16_t *samples, uint32_t *frame, uint16_t count)
+{
+#if PWM_NOISE_SHAPING
+  int32_t e1 = shaper_error[output][0];
+  int32_t e2 = shaper_error[output][1];
+
+  for (uint16_t n = 0; n < count; n++, frame += VOICE_COUNT)
+  {
+#if PWM_NOISE_SHAPING == 1
+    int32_t wanted = samples[n] - e1;
+#else
+    int32_t wanted = samples[n] - 2 * e1 + e2;
+#endif
+    int32_t code = (wanted + QUANTIZE_ROUND) >> SAMPLE_SHIFT;
+
+    e2 = e1;
+    e1 = (code << SAMPLE_SHIFT) - wanted; // Error before clipping keeps the loop stable
+
+    code += VOICE_BANK_MID;
+    if (code < 0)
+      code = 0;
+    else if (code > (int32_t)VOICE_BANK_FULL)
+      code = VOICE_BANK_FULL;
+
+    *frame = code;
+  }
+
+  shaper_error[output][0] = e1;
+  shaper_error[output][1] = e2;
+#else
+  for (uint16_t n = 0; n < count; n++, frame += VOICE_COUNT)
+    *frame = VOICE_BANK_MID + (samples[n] >> SAMPLE_SHIFT);
+#endif
+}
+
+/**
+ * @brief Check if the effects return reaches an output
+ */
+static inline uint8_t mixer_returned(uint8_t output)
+{
+#if AUDIO_EFFECTS
+  return output_routes[MIXER_OUTPUT_FX] && effects_active() && (return_gains[output][0] || return_gains[output][1]);
+#else
+  (void)output;
+  return 0;
+#endif
+}
+
+/**
+ * @brief Add the effects return to the mix of an output
+ * @param output The output whose return gains are applied
+ * @param samples Q15 mix of the output, updated in place
+ * @param left Q15 left return
+ * @param right Q15 right return
+ * @param count Number of samples to add
+ */
+AUDIO_RAMFUNC static void mixer_add_return(uint8_t output, int16_t *samples, const int16_t *left, const int16_t *right, uint16_t count)
+{
+  const int32_t left_gain = return_gains[output][0];
+  const int32_t right_gain = return_gains[output][1];
+
+  for (uint16_t n = 0; n < count; n++)
+  {
+    // Each term reaches 2^30, their sum only fits in 64 bits
+    int64_t acc = ((int64_t)samples[n] << 15) + (int64_t)left[n] * left_gain + (int64_t)right[n] * right_gain;
+
+    samples[n] = (int16_t)mixer_saturate(acc);
+  }
+}
+
+AUDIO_RAMFUNC void mixer_render_voice(uint8_t voice, uint16_t count)
+{
+  // Every gain of an unrouted voice is 0, its stale samples add nothing to the mix
+  if (voice >= MIXER_VOICE_COUNT || !voice_routes[voice])
+    return;
+
+  voice_bank_render_q15(voice, &mixer_block.q15[0][0], count, MIXER_VOICE_COUNT);
+}
+
+AUDIO_RAMFUNC void mixer_mix(uint32_t *frames, uint16_t count)
+{
+  int16_t mixed[AUDIO_BLOCK_SIZE];
+  int16_t fx_left[AUDIO_BLOCK_SIZE];
+  int16_t fx_right[AUDIO_BLOCK_SIZE];
+
+#if AUDIO_EFFECTS
+  // The send goes through the chain first, its return is added to the outputs below
+  if (output_routes[MIXER_OUTPUT_FX] && effects_active())
+  {
+    mixer_mix_output(MIXER_OUTPUT_FX, mixed, count);
+    effects_process(mixed, fx_left, fx_right, count);
+  }
+#endif
+
+  for (uint8_t output = 0; output < VOICE_COUNT; output++)
+  {
+    uint32_t *frame = &frames[output];
+    uint8_t returned = mixer_returned(output);
+
+    // Nothing routed, hold 50% without touching the voices
+    if (!output_routes[output] && !returned)
+    {
+      for (uint16_t n = 0; n < count; n++, frame += VOICE_COUNT)
+        *frame = VOICE_BANK_MID;
+      continue;
+    }
+
+    if (output_routes[output])
+      mixer_mix_output(output, mixed, count);
+    else
+      memset(mixed, 0, count * sizeof(int16_t));
+
+    if (returned)
+      mixer_add_return(output, mixed, fx_left, fx_right, count);
+
+    mixer_quantize_output(output, mixed, frame, count);
+  }
+
+  uint8_t dac_returned = mixer_returned(MIXER_OUTPUT_DAC);
+
+  if (!output_routes[MIXER_OUTPUT_DAC] && !dac_returned)
+    return;
+
+  // The DAC consumes whole blocks on its own DMA, publish each half once it is complete
+  if (count > AUDIO_BLOCK_SIZE - dac_fill)
+    dac_fill = 0; // Misaligned block, restart the half rather than overrun it
+
+  int16_t *dac = &dac_bus[dac_write][dac_fill];
+
+  if (output_routes[MIXER_OUTPUT_DAC])
+    mixer_mix_output(MIXER_OUTPUT_DAC, dac, count);
+  else
+    memset(dac, 0, count * sizeof(int16_t));
+
+  if (dac_returned)
+    mixer_add_return(MIXER_OUTPUT_DAC, dac, fx_left, fx_right, count);
+
+  dac_fill += count;
+
+  if (dac_fill >= AUDIO_BLOCK_SIZE)
+  {
+    dac_ready = dac_bus[dac_write];
+    dac_write ^= 1;
+    dac_fill = 0;
+  }
+}
+
+AUDIO_RAMFUNC void mixer_render(uint32_t *frames, uint16_t count)
+{
+  while (count)
+  {
+    uint16_t block = count < AUDIO_BLOCK_SIZE ? count : AUDIO_BLOCK_SIZE;
+
+    // Blocks must not straddle a DAC bus half
+    if (block > AUDIO_BLOCK_SIZE - dac_fill)
+      block = AUDIO_BLOCK_SIZE - dac_fill;
+
+    for (uint8_t voice = 0; voice < MIXER_VOICE_COUNT; voice++)
+      mixer_render_voice(voice, block);
+
+    mixer_mix(frames, block);
+
+    frames += block * VOICE_COUNT;
+    count -= block;
+  }
+}
+
+const int16_t *mixer_dac_bus()
+{
+  if (!output_routes[MIXER_OUTPUT_DAC] && !mixer_returned(MIXER_OUTPUT_DAC))
+    return NULL;
+
+  return dac_ready;
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+void mixer_init()
+{
+  memset(&mixer_gains, 0, sizeof(mixer_gains));
+  memset(output_routes, 0, sizeof(output_routes));
+  memset(voice_routes, 0, sizeof(voice_routes));
+  memset(return_gains, 0, sizeof(return_gains));
+  memset(&mixer_block, 0, sizeof(mixer_block));
+#if PWM_NOISE_SHAPING
+  memset(shaper_error, 0, sizeof(shaper_error));
+#endif
+
+  dac_write = 0;
+  dac_fill = 0;
+  dac_ready = NULL;
+
+  // The voices past the PWM outputs (MIDI channels 8 - 16) wrap around onto them
+  for (uint8_t voice = 0; voice < MIXER_VOICE_COUNT; voice++)
+    mixer_route(voice, voice % VOICE_COUNT, MIXER_GAIN_UNITY);
+}
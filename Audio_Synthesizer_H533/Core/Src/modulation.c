@@ -0,0 +1,364 @@
+/**
+ ******************************************************************************
+ * @file    modulation.c
+ * @brief   LFO and Modulation Matrix
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "modulation.h"
+
+#include "audio_config.h"
+#include "channel_common.h"
+#include "envelope.h"
+#include "gain.h"
+#include "sample_rate.h"
+#include "voice_bank.h"
+#include "wavetable.h"
+
+/* Private typedef -----------------------------------------------------------*/
+
+typedef struct
+{
+  uint32_t phase;    // Position in the wave, a full turn is 2^32
+  uint32_t tick_inc; // Phase advance per tick, precomputed from rate
+  uint32_t rate;     // Frequency in Hz (Q16.16)
+  int32_t value;     // Output of the last tick (Q15)
+  uint8_t wave;      // modulation_lfo_wave_t
+  uint8_t unipolar;  // Values from 0 to full scale
+} modulation_lfo_t;
+
+typedef struct
+{
+  uint8_t source;      // modulation_source_t
+  uint8_t destination; // modulation_destination_t
+  int16_t depth;       // Amount of the source (Q15)
+} modulation_route_t;
+
+/* Function Prototypes -------------------------------------------------------*/
+
+void modulation_lfo(uint8_t lfo, modulation_lfo_wave_t wave, uint32_t rate, uint8_t unipolar);
+void modulation_route(uint8_t slot, modulation_source_t source, modulation_destination_t destination, int16_t depth);
+void modulation_controller(uint8_t voice, modulation_source_t source, uint8_t value);
+
+static inline int32_t modulation_midi_q15(uint8_t value);
+static inline uint32_t xorshift32(uint32_t x);
+static void modulation_lfo_tick(modulation_lfo_t *lfo);
+static inline int32_t modulation_source(uint8_t source, uint8_t voice);
+static int32_t modulation_pitch_ratio(int32_t pitch);
+static inline int32_t modulation_volume_gain(int32_t volume);
+void modulation_sample_rate();
+void modulation_tick();
+int32_t modulation_output(uint8_t voice, modulation_destination_t destination);
+
+void modulation_init();
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+#define MODULATION_MAX 32767
+#define MODULATION_MIN (-32768)
+
+#define EXP2_SEGMENT_BITS 6 // 64 linear segments per octave, under 0.03 cents of error
+#define MODULATION_SEED 0x2545F491UL
+#define PITCH_RATIO_UNITY ((int32_t)0x1 << 16) // Frequency ratio of 1.0 (Q16)
+
+// 2^(i / 64) for one octave (Q16), interpolated by modulation_pitch_ratio()
+static const uint32_t exp2_table[(1 << EXP2_SEGMENT_BITS) + 1] = {
+    65536, 66250, 66971, 67700, 68438, 69183, 69936, 70698, 71468, 72246, 73032, 73828, 74632,
+    75444, 76266, 77096, 77936, 78785, 79642, 80510, 81386, 82273, 83169, 84074, 84990, 85915,
+    86851, 87796, 88752, 89719, 90696, 91684, 92682, 93691, 94711, 95743, 96785, 97839, 98905,
+    99982, 101070, 102171, 103283, 104408, 105545, 106694, 107856, 109031, 110218, 111418, 112631, 113858,
+    115098, 116351, 117618, 118899, 120194, 121502, 122825, 124163, 125515, 126882, 128263, 129660, 131072,
+};
+
+static modulation_lfo_t lfos[MODULATION_LFO_COUNT];
+static modulation_route_t routes[MODULATION_ROUTE_COUNT];
+static modulation_route_t global_routes[MODULATION_ROUTE_COUNT]; // Slots in use with an LFO source, summed once per tick
+static modulation_route_t voice_routes[MODULATION_ROUTE_COUNT];  // Slots in use with a per-voice source
+static uint8_t global_count;
+static uint8_t voice_count;
+
+static uint8_t mod_wheel[VOICE_BANK_VOICES];  // Controller 1 per voice (up to 127)
+static uint8_t aftertouch[VOICE_BANK_VOICES]; // Channel pressure per voice (up to 127)
+
+static int32_t outputs[MODULATION_DEST_COUNT][VOICE_BANK_VOICES]; // Destination sums of the last tick (Q15)
+
+static uint32_t random_state = MODULATION_SEED; // Sample-and-hold generator, never 0
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+void modulation_lfo(uint8_t lfo, modulation_lfo_wave_t wave, uint32_t rate, uint8_t unipolar)
+{
+  if (lfo >= MODULATION_LFO_COUNT || wave > MODULATION_LFO_SAMPLE_HOLD)
+    return;
+
+  lfos[lfo].wave = wave;
+  lfos[lfo].rate = rate;
+  lfos[lfo].tick_inc = wavetable_phase_increment(rate, sample_rate_get()) * MODULATION_TICK_SAMPLES;
+  lfos[lfo].unipolar = unipolar ? 1 : 0;
+}
+
+void modulation_sample_rate()
+{
+  for (uint8_t lfo = 0; lfo < MODULATION_LFO_COUNT; lfo++)
+    lfos[lfo].tick_inc = wavetable_phase_increment(lfos[lfo].rate, sample_rate_get()) * MODULATION_TICK_SAMPLES;
+}
+
+void modulation_route(uint8_t slot, modulation_source_t source, modulation_destination_t destination, int16_t depth)
+{
+  if (slot >= MODULATION_ROUTE_COUNT || source >= MODULATION_SOURCE_COUNT || destination >= MODULATION_DEST_COUNT)
+    return;
+
+  routes[slot].source = source;
+  routes[slot].destination = destination;
+  routes[slot].depth = depth;
+
+  // Pack the slots in use so the tick skips nothing
+  global_count = 0;
+  voice_count = 0;
+  for (uint8_t n = 0; n < MODULATION_ROUTE_COUNT; n++)
+  {
+    if (routes[n].source == MODULATION_SOURCE_NONE || routes[n].depth == 0)
+      continue;
+
+    if (routes[n].source <= MODULATION_SOURCE_LFO4)
+      global_routes[global_count++] = routes[n];
+    else
+      voice_routes[voice_count++] = routes[n];
+  }
+}
+
+void modulation_controller(uint8_t voice, modulation_source_t source, uint8_t value)
+{
+  if (voice >= VOICE_BANK_VOICES)
+    return;
+
+  if (value > MIDI_MAX_VAL)
+    value = MIDI_MAX_VAL;
+
+  if (source == MODULATION_SOURCE_MOD_WHEEL)
+    mod_wheel[voice] = value;
+  else if (source == MODULATION_SOURCE_AFTERTOUCH)
+    aftertouch[voice] = value;
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Evaluation Functions                                                    */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Scale a MIDI value to Q15, 127 is full scale
+ */
+static inline int32_t modulation_midi_q15(uint8_t value)
+{
+  return (value << 8) | (value << 1) | (value >> 6);
+}
+
+/**
+ * @brief Advance the xorshift32 generator (period 2^32 - 1)
+ */
+static inline uint32_t xorshift32(uint32_t x)
+{
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return x;
+}
+
+/**
+ * @brief Advance an LFO by one tick and update its output
+ */
+static void modulation_lfo_tick(modulation_lfo_t *lfo)
+{
+  uint32_t next = lfo->phase + lfo->tick_inc;
+  int32_t value;
+
+  switch (lfo->wave)
+  {
+  case MODULATION_LFO_TRIANGLE:
+    value = wavetable_lookup(&wavetable_trig.levels[0], next);
+    break;
+  case MODULATION_LFO_SAMPLE_HOLD:
+    if (next < lfo->phase) // Wrapped, draw a new value
+    {
+      random_state = xorshift32(random_state);
+      lfo->value = (int16_t)(random_state >> 16);
+      if (lfo->unipolar)
+        lfo->value = (lfo->value + 32768) >> 1;
+    }
+    lfo->phase = next;
+    return;
+  default:
+    value = wavetable_lookup(&wavetable_sine.levels[0], next);
+    break;
+  }
+
+  lfo->phase = next;
+  lfo->value = lfo->unipolar ? (value + 32768) >> 1 : value;
+}
+
+/**
+ * @brief Read a source for a voice
+ * @return The source value (Q15)
+ */
+static inline int32_t modulation_source(uint8_t source, uint8_t voice)
+{
+  switch (source)
+  {
+  case MODULATION_SOURCE_LFO1:
+  case MODULATION_SOURCE_LFO2:
+  case MODULATION_SOURCE_LFO3:
+  case MODULATION_SOURCE_LFO4:
+    return lfos[source - MODULATION_SOURCE_LFO1].value;
+  case MODULATION_SOURCE_ENVELOPE:
+    return voice_bank.envelope[voice].level >> 15; // Q30 to Q15
+  case MODULATION_SOURCE_VELOCITY:
+    return modulation_midi_q15(voice_bank.velocity[voice]);
+  case MODULATION_SOURCE_MOD_WHEEL:
+    return modulation_midi_q15(mod_wheel[voice]);
+  case MODULATION_SOURCE_AFTERTOUCH:
+    return modulation_midi_q15(aftertouch[voice]);
+  default:
+    return 0;
+  }
+}
+
+/**
+ * @brief Convert a pitch modulation to a frequency ratio
+ * @param pitch Pitch modulation (Q15), full scale is MODULATION_PITCH_RANGE semitones
+ * @return 2^(semitones / 12) (Q16)
+ */
+static int32_t modulation_pitch_ratio(int32_t pitch)
+{
+  int32_t octaves = (pitch * MODULATION_PITCH_RANGE * 2) / 12; // Q16
+  int32_t whole = octaves >> 16;                               // Rounds towards minus infinity
+  uint32_t frac = (uint32_t)octaves & 0xFFFF;
+  uint32_t index = frac >> (16 - EXP2_SEGMENT_BITS);
+  uint32_t t = frac & ((0x1 << (16 - EXP2_SEGMENT_BITS)) - 1);
+  uint32_t a = exp2_table[index];
+  uint32_t ratio = a + (((exp2_table[index + 1] - a) * t) >> (16 - EXP2_SEGMENT_BITS));
+
+  return whole >= 0 ? (int32_t)(ratio << whole) : (int32_t)(ratio >> -whole);
+}
+
+/**
+ * @brief Convert a volume modulation to a gain
+ * @param volume Volume modulation (Q15), negative attenuates
+ * @return The gain (Q16, up to GAIN_UNITY)
+ */
+static inline int32_t modulation_volume_gain(int32_t volume)
+{
+  int32_t gain = GAIN_UNITY + (volume << 1);
+
+  if (gain < 0)
+    return 0;
+  if (gain > GAIN_UNITY)
+    return GAIN_UNITY;
+  return gain;
+}
+
+void modulation_tick()
+{
+  int32_t global[MODULATION_DEST_COUNT] = {0};
+
+  // The LFOs are shared by every voice, advance and route them once
+  for (uint8_t lfo = 0; lfo < MODULATION_LFO_COUNT; lfo++)
+    modulation_lfo_tick(&lfos[lfo]);
+
+  for (uint8_t n = 0; n < global_count; n++)
+    global[global_routes[n].destination] += (modulation_source(global_routes[n].source, 0) * global_routes[n].depth) >> 15;
+
+  int32_t global_ratio = modulation_pitch_ratio(global[MODULATION_DEST_PITCH]);
+
+  for (uint8_t voice = 0; voice < VOICE_BANK_VOICES; voice++)
+  {
+    int32_t sum[MODULATION_DEST_COUNT];
+
+    // Silent voices keep their last modulation, the tick after a note on catches up before it renders
+    if (!voice_bank.enabled[voice] || envelope_idle(&voice_bank.envelope[voice]))
+      continue;
+
+    for (uint8_t destination = 0; destination < MODULATION_DEST_COUNT; destination++)
+      sum[destination] = global[destination];
+
+    for (uint8_t n = 0; n < voice_count; n++)
+      sum[voice_routes[n].destination] += (modulation_source(voice_routes[n].source, voice) * voice_routes[n].depth) >> 15;
+
+    for (uint8_t destination = 0; destination < MODULATION_DEST_COUNT; destination++)
+    {
+      int32_t value = sum[destination];
+
+      if (value > MODULATION_MAX)
+        value = MODULATION_MAX;
+      if (value < MODULATION_MIN)
+        value = MODULATION_MIN;
+
+      outputs[destination][voice] = value;
+    }
+
+    int32_t pitch = outputs[MODULATION_DEST_PITCH][voice];
+    int32_t ratio = (pitch == global[MODULATION_DEST_PITCH]) ? global_ratio : modulation_pitch_ratio(pitch);
+
+    voice_modulate(voice, ratio, modulation_volume_gain(outputs[MODULATION_DEST_VOLUME][voice]),
+                   outputs[MODULATION_DEST_CUTOFF][voice], outputs[MODULATION_DEST_PULSE_WIDTH][voice]);
+  }
+}
+
+int32_t modulation_output(uint8_t voice, modulation_destination_t destination)
+{
+  if (voice >= VOICE_BANK_VOICES || destination >= MODULATION_DEST_COUNT)
+    return 0;
+
+  return outputs[destination][voice];
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+void modulation_init()
+{
+  for (uint8_t lfo = 0; lfo < MODULATION_LFO_COUNT; lfo++)
+  {
+    lfos[lfo].phase = 0;
+    lfos[lfo].value = 0;
+    modulation_lfo(lfo, MODULATION_LFO_SINE, 0x1 << 16, 0);
+  }
+
+  for (uint8_t slot = 0; slot < MODULATION_ROUTE_COUNT; slot++)
+    modulation_route(slot, MODULATION_SOURCE_NONE, MODULATION_DEST_PITCH, 0);
+
+  for (uint8_t voice = 0; voice < VOICE_BANK_VOICES; voice++)
+  {
+    mod_wheel[voice] = 0;
+    aftertouch[voice] = 0;
+
+    for (uint8_t destination = 0; destination < MODULATION_DEST_COUNT; destination++)
+      outputs[destination][voice] = 0;
+
+    voice_modulate(voice, PITCH_RATIO_UNITY, GAIN_UNITY, 0, 0);
+  }
+}
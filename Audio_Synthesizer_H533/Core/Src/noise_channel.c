@@ -1,170 +1,384 @@
-// /**
-//  *******************************************************************************
-//  * @file    noise_channel.c
-//  * @brief   DAC-based Noise Channel Control Interface Source File
-//  * @attention
-//  *
-//  * This file implements the noise channel functionality using a DAC.
-//  * The noise waveform data is taken from noise_base.h.
-//  *
-//  *******************************************************************************
-//  */
-
-// /* Includes ------------------------------------------------------------------*/
-// #include "main.h"
-// #include "noise_channel.h"
-// #include "audio_config.h"
-// #include "channel_common.h"
-// #include "config.h"
-// #include "rcc.h"
-
-// #include "stm32h5xx_hal.h"
-// #include "noise_base.h"  // Noise sample data
-
-// /* Private Variables ---------------------------------------------------------*/
-
-// /* Noise channel state structure */
-// typedef struct {
-//     uint32_t count;       // Sample index
-//     uint16_t freq;        // Index increment value (controls output frequency)
-//     uint8_t vol;          // Volume (0~127)
-//     uint8_t on_off;       // Channel on/off status (1: on, 0: off)
-//     waveforms_t waveform; // Current waveform (should be WAVEFORM_NOISE)
-// } noise_channel_state_t;
-
-// static noise_channel_state_t noise_state;
-
-// /* DAC handle (configured in CubeMX or other initialization code) */
-// extern DAC_HandleTypeDef hdac1;  // Using DAC1, for example
-
-// /* Private Function Prototypes ---------------------------------------------*/
-// static void reset_noise_channel(void);
-
-// /* Exported Functions --------------------------------------------------------*/
-
-// /**
-//  * @brief Enable the noise channel output via DAC.
-//  * @note  Starts the DAC conversion on DAC_CHANNEL_1.
-//  */
-// void noise_channel_enable(void)
-// {
-//   if (HAL_DAC_Start(&hdac1, DAC_CHANNEL_1) != HAL_OK)
-//   {
-//     Error_Handler();
-//   }
-// }
-
-// /**
-//  * @brief Disable the noise channel output.
-//  * @note  Stops the DAC conversion on DAC_CHANNEL_1.
-//  */
-// void noise_channel_disable(void)
-// {
-//   if (HAL_DAC_Stop(&hdac1, DAC_CHANNEL_1) != HAL_OK)
-//   {
-//     Error_Handler();
-//   }
-// }
-
-// /**
-//  * @brief Set the waveform for the noise channel.
-//  * @param wave The waveform to use (must be WAVEFORM_NOISE).
-//  */
-// void noise_channel_set_waveform(waveforms_t wave)
-// {
-//   if (wave != WAVEFORM_NOISE)
-//     return;  // Only WAVEFORM_NOISE is supported for the noise channel
-  
-//   noise_state.waveform = wave;
-//   // Using the noise_base array, so no extra allocation is required.
-// }
-
-// /**
-//  * @brief Turn the noise channel on or off.
-//  * @param state 1 to turn on, 0 to turn off.
-//  * @note  Resets the sample counter when turning on.
-//  */
-// void noise_channel_on_off(uint8_t state)
-// {
-//   if (state)
-//   {
-//     noise_state.on_off = 1;
-//     noise_state.count = 0;
-//   }
-//   else
-//   {
-//     noise_state.on_off = 0;
-//   }
-// }
-
-// /**
-//  * @brief Set the noise channel volume.
-//  * @param volume Volume level (0 ~ 127).
-//  */
-// void noise_channel_volume(uint8_t volume)
-// {
-//   noise_state.vol = volume;
-// }
-
-// /**
-//  * @brief Set the noise channel frequency.
-//  * @param freq Frequency parameter affecting the sample index increment.
-//  */
-// void noise_channel_frequency(uint16_t freq)
-// {
-//   noise_state.freq = freq;
-// }
-
-// /**
-//  * @brief Update the DAC output based on the noise channel state.
-//  * @note  This function should be called periodically to update the DAC output.
-//  */
-// void noise_channel_update(void)
-// {
-//   if (!noise_state.on_off)
-//   {
-//     // If the channel is off, set the DAC output to the mid-level value (e.g., 2048 for 12-bit DAC)
-//     HAL_DAC_SetValue(&hdac1, DAC_CHANNEL_1, DAC_ALIGN_12B_R, 2048);
-//     return;
-//   }
-
-//   // Increment sample counter
-//   noise_state.count += noise_state.freq;
-//   while (noise_state.count >= SAMPLE_FREQUENCY)
-//   {
-//     noise_state.count -= SAMPLE_FREQUENCY;
-//   }
-
-//   // Get the sample from noise_base array (assumed to have 65536 samples)
-//   uint16_t sample = noise_base[noise_state.count];
-
-//   // Adjust sample value based on volume (lower volume reduces the signal amplitude)
-//   uint8_t shift = ((MIDI_MAX_VAL - noise_state.vol) >> 4);
-//   sample = sample >> shift;
-
-//   // Update DAC output (assuming a 12-bit DAC)
-//   HAL_DAC_SetValue(&hdac1, DAC_CHANNEL_1, DAC_ALIGN_12B_R, sample);
-// }
-
-// /**
-//  * @brief Initialize the DAC-based noise channel.
-//  */
-// void noise_channel_init(void)
-// {
-//   reset_noise_channel();
-//   // DAC initialization (HAL_DAC_Init()) is assumed to be handled elsewhere (e.g., CubeMX)
-// }
-
-// /* Private Functions ---------------------------------------------------------*/
-
-// /**
-//  * @brief Reset the noise channel state.
-//  */
-// static void reset_noise_channel(void)
-// {
-//   noise_state.count = 0;
-//   noise_state.on_off = 0;
-//   noise_state.freq = 0;
-//   noise_state.vol = MIDI_MAX_VAL;  // Set volume to maximum
-//   noise_state.waveform = WAVEFORM_NOISE;
-// }
+/**
+ ******************************************************************************
+ * @file    noise_channel.c
+ * @brief   DAC Noise Channel Control Interface
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#include "noise_channel.h"
+
+#include "audio_config.h"
+#include "channel_common.h"
+#include "config.h"
+#include "rcc.h"
+#include "sample_rate.h"
+#include "sample_timer.h"
+
+/* Private includes ----------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+
+#include "stm32h5xx_hal.h"
+
+#include "gain.h"
+#include "mixer.h"
+#include "wavetable.h"
+
+/* Private typedef -----------------------------------------------------------*/
+
+/**
+ * @brief Linked-list item reloaded by the DMA after every full buffer
+ * @note Field order follows the GPDMA register order for UB1 | USA | UDA | ULL
+ */
+typedef struct
+{
+  uint32_t CBR1;
+  uint32_t CSAR;
+  uint32_t CDAR;
+  uint32_t CLLR;
+} noise_channel_node_t;
+
+/* Function Prototypes -------------------------------------------------------*/
+
+static inline uint32_t xorshift32(uint32_t x);
+static void noise_channel_mix_bus(uint32_t *samples, uint16_t count);
+
+void noise_channel_enable();
+void noise_channel_disable();
+void noise_channel_on_off(uint8_t state);
+void noise_channel_volume(uint8_t volume);
+void noise_channel_frequency(uint16_t freq);
+void noise_channel_frequency_q16(uint32_t freq);
+void noise_channel_sample_rate();
+void noise_channel_render(uint32_t *samples, uint16_t count);
+
+static uint32_t noise_channel_seed();
+static void noise_channel_dma_config();
+static void noise_channel_dac_init();
+void noise_channel_init();
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+#define SAMPLE_SHIFT (16 - NOISE_DAC_BITS) // Q15 sample to a DAC offset around NOISE_DAC_MID
+#define BUFFER_BYTES (2 * AUDIO_BLOCK_SIZE * 4)
+
+#define NOISE_SEED_FALLBACK 0x2545F491UL // Used if the RNG fails, any non-zero value works
+#define NOISE_SEED_TIMEOUT 100000
+
+#if AUDIO_BLOCK_SIZE & 0x1
+#error "The noise generator renders two samples per step, AUDIO_BLOCK_SIZE must be even"
+#endif
+
+typedef struct
+{
+  uint32_t state;    // xorshift32 state, never 0
+  uint32_t phase;    // Sample-and-hold position, a new value on every wrap
+  uint32_t hold_inc; // Phase advance per sample, 0 for white noise
+  uint32_t held;     // Value held between wraps (already scaled)
+  uint32_t freq;     // Sample-and-hold rate in Hz (Q16.16)
+  int32_t gain;      // Gain reached by the last block (Q16), ramped per block
+  int32_t vol_gain;  // Volume gain (Q16), precomputed from vol
+  uint8_t vol;       // Volume (up to 127)
+  uint8_t on_off;    // Noise playing
+} noise_state_t;
+
+static noise_state_t noise_state;
+
+static uint32_t sample_buffer[2][AUDIO_BLOCK_SIZE];
+static noise_channel_node_t loop_node;
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Interrupt Functions                                                     */
+/*                                                                            */
+/* ========================================================================== */
+
+AUDIO_RAMFUNC void GPDMA1_Channel5_IRQHandler()
+{
+  uint32_t status = CHANNEL8_DMA->CSR;
+
+  if (status & (DMA_CSR_DTEF | DMA_CSR_ULEF | DMA_CSR_USEF))
+    Error_Handler();
+
+  // First half has been sent, refill it while the second half plays
+  if (status & DMA_CSR_HTF)
+  {
+    CHANNEL8_DMA->CFCR = DMA_CFCR_HTF;
+    noise_channel_render(sample_buffer[0], AUDIO_BLOCK_SIZE);
+  }
+
+  // Second half has been sent, refill it while the first half plays
+  if (status & DMA_CSR_TCF)
+  {
+    CHANNEL8_DMA->CFCR = DMA_CFCR_TCF;
+    noise_channel_render(sample_buffer[1], AUDIO_BLOCK_SIZE);
+  }
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Advance the xorshift32 generator (period 2^32 - 1)
+ */
+static inline uint32_t xorshift32(uint32_t x)
+{
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return x;
+}
+
+void noise_channel_enable()
+{
+  // Fill both halves so the first transfer never sends stale data
+  noise_channel_render(sample_buffer[0], AUDIO_BLOCK_SIZE);
+  noise_channel_render(sample_buffer[1], AUDIO_BLOCK_SIZE);
+
+  noise_channel_dma_config();
+  CHANNEL8_DMA->CCR |= DMA_CCR_EN; // Arm the DMA, it waits on the DAC requests
+
+  CHANNEL8_DAC->DHR12R2 = NOISE_DAC_MID;
+  CHANNEL8_DAC->CR |= DAC_CR_DMAEN2 | DAC_CR_EN2; // Every sample timer trigger converts and requests the next value
+}
+
+void noise_channel_disable()
+{
+  CHANNEL8_DAC->CR &= ~(DAC_CR_DMAEN2 | DAC_CR_EN2);
+
+  CHANNEL8_DMA->CCR |= DMA_CCR_SUSP; // Suspend at the end of the current transfer
+  while (!(CHANNEL8_DMA->CSR & DMA_CSR_SUSPF))
+    ;
+  CHANNEL8_DMA->CCR |= DMA_CCR_RESET; // Reset the channel, enable() reprograms it
+}
+
+void noise_channel_on_off(uint8_t state)
+{
+  noise_state.on_off = state ? 1 : 0;
+  noise_state.phase = 0xFFFFFFFF; // Draw a new value on the first sample
+}
+
+void noise_channel_volume(uint8_t volume)
+{
+  if (volume > MIDI_MAX_VAL)
+    volume = MIDI_MAX_VAL;
+
+  noise_state.vol = volume;
+  noise_state.vol_gain = gain_from_midi(volume);
+}
+
+void noise_channel_frequency(uint16_t freq)
+{
+  noise_channel_frequency_q16((uint32_t)freq << 16);
+}
+
+void noise_channel_frequency_q16(uint32_t freq)
+{
+  noise_state.freq = freq;
+  noise_state.hold_inc = wavetable_phase_increment(freq, sample_rate_get());
+}
+
+void noise_channel_sample_rate()
+{
+  noise_channel_frequency_q16(noise_state.freq);
+}
+
+/**
+ * @brief Add the voices the mixer routes to the DAC on top of the noise
+ */
+AUDIO_RAMFUNC static void noise_channel_mix_bus(uint32_t *samples, uint16_t count)
+{
+#if AUDIO_MIXER
+  const int16_t *bus = mixer_dac_bus();
+
+  if (bus == NULL || count > AUDIO_BLOCK_SIZE)
+    return;
+
+  for (uint16_t n = 0; n < count; n++)
+    samples[n] = __USAT((int32_t)samples[n] + (bus[n] >> SAMPLE_SHIFT), NOISE_DAC_BITS);
+#endif
+}
+
+AUDIO_RAMFUNC void noise_channel_render(uint32_t *samples, uint16_t count)
+{
+  if (!noise_state.on_off)
+  {
+    for (uint16_t n = 0; n < count; n++)
+      samples[n] = NOISE_DAC_MID;
+    noise_state.gain = 0; // Fade in from silence when turned back on
+    noise_channel_mix_bus(samples, count);
+    return;
+  }
+
+  // Work on a local copy of the generator, written back once per block
+  uint32_t x = noise_state.state;
+  int32_t gain_step;
+  int32_t gain = gain_ramp(&noise_state.gain, noise_state.vol_gain, count, &gain_step);
+
+  if (noise_state.hold_inc == 0)
+  {
+    // White noise, each 32-bit step yields two independent 16-bit samples
+    for (uint16_t n = 0; n < count; n += 2)
+    {
+      x = xorshift32(x);
+      gain += gain_step;
+      samples[n] = NOISE_DAC_MID + (gain_apply(gain, (int32_t)x) >> SAMPLE_SHIFT);
+      gain += gain_step;
+      samples[n + 1] = NOISE_DAC_MID + (gain_apply(gain, (int32_t)(x >> 16)) >> SAMPLE_SHIFT);
+    }
+  }
+  else
+  {
+    // Pitched noise, hold each value until the phase wraps
+    uint32_t phase = noise_state.phase;
+    uint32_t hold_inc = noise_state.hold_inc;
+    uint32_t held = noise_state.held;
+
+    for (uint16_t n = 0; n < count; n++)
+    {
+      uint32_t next = phase + hold_inc;
+
+      gain += gain_step;
+      if (next < phase) // Wrapped, draw a new value
+      {
+        x = xorshift32(x);
+        held = NOISE_DAC_MID + (gain_apply(gain, (int32_t)(x >> 16)) >> SAMPLE_SHIFT);
+      }
+
+      phase = next;
+      samples[n] = held;
+    }
+
+    noise_state.phase = phase;
+    noise_state.held = held;
+  }
+
+  noise_state.state = x;
+
+  noise_channel_mix_bus(samples, count);
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Draw a seed from the RNG peripheral
+ * @return A non-zero seed, NOISE_SEED_FALLBACK if the RNG reports an error or times out
+ */
+static uint32_t noise_channel_seed()
+{
+  uint32_t seed = 0;
+
+  RCC_HSI48_Enable(); // RNG kernel clock
+  RCC_RNG_CLK_Enable();
+
+  RNG->CR |= RNG_CR_RNGEN;
+
+  for (uint32_t i = 0; i < NOISE_SEED_TIMEOUT; i++)
+  {
+    uint32_t status = RNG->SR;
+
+    if (status & (RNG_SR_SECS | RNG_SR_CECS))
+      break;
+
+    if (status & RNG_SR_DRDY)
+    {
+      seed = RNG->DR;
+      break;
+    }
+  }
+
+  RNG->CR &= ~RNG_CR_RNGEN; // Only needed once, save the power
+
+  return seed ? seed : NOISE_SEED_FALLBACK;
+}
+
+/**
+ * @brief Program the DMA to write one sample into the DAC per DAC request
+ * @note The linked-list item rewinds the source to the start of the buffer (circular)
+ */
+static void noise_channel_dma_config()
+{
+  uint32_t node_cllr = ((uint32_t)&loop_node & DMA_CLLR_LA) | DMA_CLLR_UB1 | DMA_CLLR_USA | DMA_CLLR_UDA | DMA_CLLR_ULL;
+
+  loop_node.CBR1 = BUFFER_BYTES;
+  loop_node.CSAR = (uint32_t)&sample_buffer[0][0];
+  loop_node.CDAR = (uint32_t)&CHANNEL8_DAC->DHR12R2;
+  loop_node.CLLR = node_cllr;
+
+  CHANNEL8_DMA->CCR = 0;
+  CHANNEL8_DMA->CFCR = 0x7F00; // Clear all the flags
+
+  CHANNEL8_DMA->CTR1 = DMA_CTR1_SDW_LOG2_1 | DMA_CTR1_SINC | DMA_CTR1_SAP | // Word reads from SRAM on port 1
+                       DMA_CTR1_DDW_LOG2_1;                                 // Word writes to the DAC on port 0
+  CHANNEL8_DMA->CTR2 = (CHANNEL8_DMA_REQUEST << DMA_CTR2_REQSEL_Pos) | DMA_CTR2_DREQ; // One word per DAC request
+  CHANNEL8_DMA->CBR1 = loop_node.CBR1;
+  CHANNEL8_DMA->CSAR = loop_node.CSAR;
+  CHANNEL8_DMA->CDAR = loop_node.CDAR;
+
+  CHANNEL8_DMA->CLBAR = (uint32_t)&loop_node & DMA_CLBAR_LBA;
+  CHANNEL8_DMA->CLLR = node_cllr;
+
+  CHANNEL8_DMA->CCR = DMA_CCR_LAP | DMA_CCR_HTIE | DMA_CCR_TCIE | DMA_CCR_DTEIE | DMA_CCR_ULEIE | DMA_CCR_USEIE;
+}
+
+static void noise_channel_dac_init()
+{
+  RCC_GPIOA_CLK_Enable();
+  RCC_DAC1_CLK_Enable();
+
+  GPIO_InitTypeDef initChannel8 = {
+      CHANNEL8_GPIO_PIN,
+      GPIO_MODE_ANALOG,
+      GPIO_NOPULL,
+      GPIO_SPEED_FREQ_LOW,
+      0};
+
+  HAL_GPIO_Init(CHANNEL8_GPIO_PORT, &initChannel8);
+
+  CHANNEL8_DAC->MCR = (CHANNEL8_DAC->MCR & ~(DAC_MCR_HFSEL | DAC_MCR_MODE2)) | DAC_MCR_HFSEL_1; // AHB above 160 MHz, buffered output to the pin
+  CHANNEL8_DAC->CR = (CHANNEL8_DAC->CR & ~DAC_CR_TSEL2) | CHANNEL8_DAC_TRIGGER | DAC_CR_TEN2;   // Convert on the sample timer trigger
+}
+
+void noise_channel_init()
+{
+  // Enable the RCC for the DMA
+  RCC_GPDMA1_CLK_Enable();
+
+  noise_channel_dac_init();
+  sample_timer_enable_trigger();
+
+  noise_state.state = noise_channel_seed();
+  noise_state.phase = 0xFFFFFFFF;
+  noise_state.held = NOISE_DAC_MID;
+  noise_state.on_off = 0;
+  noise_state.gain = 0;
+  noise_channel_frequency_q16(0);
+  noise_channel_volume(MIDI_MAX_VAL);
+
+  NVIC_EnableIRQ(CHANNEL8_DMA_IRQ);
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+/**
+ ******************************************************************************
+ * @file    oscillator.cpp
+ * @brief   Oscillator Kernel Instantiations
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "oscillator.h"
+
+#include "audio_config.h"
+#include "channel_common.h"
+
+/* Private includes ----------------------------------------------------------*/
+#include "oscillator.hpp"
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+typedef oscillator::Pwm<PWM_OUTPUT_BITS> PwmOutput;
+typedef oscillator::Q15 Q15Output;
+typedef oscillator::QuarterTable<oscillator::DefaultInterp> QuarterWave;
+typedef oscillator::FullTable<oscillator::DefaultInterp> FullWave;
+typedef oscillator::PulseTable<oscillator::DefaultInterp> PulseWave;
+
+// Placed with the rest of the hot path, only an explicit instantiation takes a section attribute
+template AUDIO_RAMFUNC uint32_t oscillator::render<QuarterWave, PwmOutput>(const wavetable_level_t *, uint32_t, uint32_t, uint32_t, int32_t,
+                                                                          int32_t, PwmOutput::value_type *, uint16_t, uint16_t);
+template AUDIO_RAMFUNC uint32_t oscillator::render<FullWave, PwmOutput>(const wavetable_level_t *, uint32_t, uint32_t, uint32_t, int32_t,
+                                                                       int32_t, PwmOutput::value_type *, uint16_t, uint16_t);
+template AUDIO_RAMFUNC uint32_t oscillator::render<PulseWave, PwmOutput>(const wavetable_level_t *, uint32_t, uint32_t, uint32_t, int32_t,
+                                                                        int32_t, PwmOutput::value_type *, uint16_t, uint16_t);
+template AUDIO_RAMFUNC uint32_t oscillator::render<QuarterWave, Q15Output>(const wavetable_level_t *, uint32_t, uint32_t, uint32_t, int32_t,
+                                                                          int32_t, Q15Output::value_type *, uint16_t, uint16_t);
+template AUDIO_RAMFUNC uint32_t oscillator::render<FullWave, Q15Output>(const wavetable_level_t *, uint32_t, uint32_t, uint32_t, int32_t,
+                                                                       int32_t, Q15Output::value_type *, uint16_t, uint16_t);
+template AUDIO_RAMFUNC uint32_t oscillator::render<PulseWave, Q15Output>(const wavetable_level_t *, uint32_t, uint32_t, uint32_t, int32_t,
+                                                                        int32_t, Q15Output::value_type *, uint16_t, uint16_t);
+
+// Indexed by waveforms_t, one specialized kernel per waveform
+static const oscillator_kernel_t kernels[] = {
+    oscillator::render<QuarterWave, PwmOutput>, // WAVEFORM_SINE
+    oscillator::render<FullWave, PwmOutput>,    // WAVEFORM_TRIG
+    oscillator::render<FullWave, PwmOutput>,    // WAVEFORM_RAMP
+    oscillator::render<PulseWave, PwmOutput>,   // WAVEFORM_SQUARE, read from the ramp
+};
+
+// Indexed by waveforms_t, the same kernels writing Q15 samples for the mixer
+static const oscillator_q15_kernel_t q15_kernels[] = {
+    oscillator::render<QuarterWave, Q15Output>, // WAVEFORM_SINE
+    oscillator::render<FullWave, Q15Output>,    // WAVEFORM_TRIG
+    oscillator::render<FullWave, Q15Output>,    // WAVEFORM_RAMP
+    oscillator::render<PulseWave, Q15Output>,   // WAVEFORM_SQUARE, read from the ramp
+};
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+oscillator_kernel_t oscillator_kernel(waveforms_t wave)
+{
+  if ((uint32_t)wave >= sizeof(kernels) / sizeof(kernels[0]))
+    return NULL;
+
+  return kernels[wave];
+}
+
+oscillator_q15_kernel_t oscillator_q15_kernel(waveforms_t wave)
+{
+  if ((uint32_t)wave >= sizeof(q15_kernels) / sizeof(q15_kernels[0]))
+    return NULL;
+
+  return q15_kernels[wave];
+}
\ No newline at end of file
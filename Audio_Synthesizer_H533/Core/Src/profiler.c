@@ -0,0 +1,174 @@
+/**
+ ******************************************************************************
+ * @file    profiler.c
+ * @brief   Audio Interrupt Cycle Profiler
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#include "profiler.h"
+
+#include "audio_config.h"
+#include "config.h"
+
+/* Private includes ----------------------------------------------------------*/
+#include <string.h>
+
+#include "stm32h5xx_hal.h"
+
+#if AUDIO_PROFILER
+
+/* Function Prototypes -------------------------------------------------------*/
+
+static inline void profiler_count(volatile profiler_counter_t *counter, uint32_t cycles);
+static void profiler_clear(volatile profiler_counter_t *counter);
+
+void profiler_callback(uint32_t cycles, uint8_t missed);
+void profiler_stage(profiler_stage_t stage, uint32_t cycles);
+void profiler_voice(uint8_t voice, uint32_t cycles);
+uint32_t profiler_get_stage_cycles(profiler_stage_t stage);
+uint32_t profiler_get_voice_cycles(uint8_t voice);
+void profiler_get_stats(profiler_stats_t *stats);
+void profiler_reset();
+
+void profiler_init();
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+static volatile profiler_stats_t profile;
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Add a timing to a counter
+ */
+static inline void profiler_count(volatile profiler_counter_t *counter, uint32_t cycles)
+{
+  counter->count++;
+  counter->last_cycles = cycles;
+  counter->total_cycles += cycles;
+  if (cycles < counter->min_cycles)
+    counter->min_cycles = cycles;
+  if (cycles > counter->max_cycles)
+    counter->max_cycles = cycles;
+}
+
+/**
+ * @brief Empty a counter, the first timing sets its minimum
+ */
+static void profiler_clear(volatile profiler_counter_t *counter)
+{
+  counter->count = 0;
+  counter->last_cycles = 0;
+  counter->min_cycles = UINT32_MAX;
+  counter->max_cycles = 0;
+  counter->total_cycles = 0;
+}
+
+AUDIO_RAMFUNC void profiler_callback(uint32_t cycles, uint8_t missed)
+{
+  profiler_count(&profile.callback, cycles);
+
+  uint32_t bin = profile.budget ? cycles * PROFILER_HISTOGRAM_BINS / profile.budget : 0;
+
+  profile.histogram[bin < PROFILER_HISTOGRAM_BINS ? bin : PROFILER_HISTOGRAM_BINS - 1]++;
+  profile.missed += missed;
+}
+
+AUDIO_RAMFUNC void profiler_stage(profiler_stage_t stage, uint32_t cycles)
+{
+  if (stage >= PROFILER_STAGE_COUNT)
+    return;
+
+  profiler_count(&profile.stage[stage], cycles);
+}
+
+AUDIO_RAMFUNC void profiler_voice(uint8_t voice, uint32_t cycles)
+{
+  if (voice >= VOICE_BANK_VOICES)
+    return;
+
+  profiler_count(&profile.voice[voice], cycles);
+}
+
+uint32_t profiler_get_stage_cycles(profiler_stage_t stage)
+{
+  if (stage >= PROFILER_STAGE_COUNT)
+    return 0;
+
+  return profile.stage[stage].last_cycles;
+}
+
+uint32_t profiler_get_voice_cycles(uint8_t voice)
+{
+  if (voice >= VOICE_BANK_VOICES)
+    return 0;
+
+  return profile.voice[voice].last_cycles;
+}
+
+void profiler_get_stats(profiler_stats_t *stats)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  // The audio interrupt and PendSV both record, mask everything for the copy
+  __disable_irq();
+  memcpy(stats, (const void *)&profile, sizeof(profiler_stats_t));
+  __set_PRIMASK(primask);
+}
+
+void profiler_reset()
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  profiler_clear(&profile.callback);
+  for (uint8_t bin = 0; bin < PROFILER_HISTOGRAM_BINS; bin++)
+    profile.histogram[bin] = 0;
+  profile.missed = 0;
+  profile.budget = (SAMPLE_TIMER->ARR + 1) * (SAMPLE_TIMER->PSC + 1) * PROFILER_CALLBACK_SAMPLES; // Timer clock = HCLK
+  for (uint8_t stage = 0; stage < PROFILER_STAGE_COUNT; stage++)
+    profiler_clear(&profile.stage[stage]);
+  for (uint8_t voice = 0; voice < VOICE_BANK_VOICES; voice++)
+    profiler_clear(&profile.voice[voice]);
+  __set_PRIMASK(primask);
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+void profiler_init()
+{
+  // Enable the cycle counter
+  DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  profiler_reset();
+}
+
+#endif /* AUDIO_PROFILER */
@@ -33,6 +33,16 @@ void RCC_GPIOC_CLK_Enable();
 
 void RCC_TIM2_CLK_Enable();
 void RCC_TIM3_CLK_Enable();
+void RCC_TIM4_CLK_Enable();
+
+void RCC_GPDMA1_CLK_Enable();
+
+void RCC_USART1_CLK_Enable();
+void RCC_USART3_CLK_Enable();
+
+void RCC_DAC1_CLK_Enable();
+void RCC_RNG_CLK_Enable();
+void RCC_HSI48_Enable();
 
 /* ========================================================================== */
 /*                                                                            */
@@ -78,4 +88,65 @@ void RCC_TIM2_CLK_Enable()
 void RCC_TIM3_CLK_Enable()
 {
     RCC->APB1LENR |= RCC_APB1LENR_TIM3EN;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Enable the RCC Clock for TIM4
+ */
+void RCC_TIM4_CLK_Enable()
+{
+    RCC->APB1LENR |= RCC_APB1LENR_TIM4EN;
+}
+
+/**
+ * @brief Enable the RCC Clock for GPDMA1
+ */
+void RCC_GPDMA1_CLK_Enable()
+{
+    RCC->AHB1ENR |= RCC_AHB1ENR_GPDMA1EN;
+}
+
+/**
+ * @brief Enable the RCC Clock for USART1
+ * @note The kernel clock defaults to PCLK2
+ */
+void RCC_USART1_CLK_Enable()
+{
+    RCC->APB2ENR |= RCC_APB2ENR_USART1EN;
+}
+
+/**
+ * @brief Enable the RCC Clock for USART3
+ * @note The kernel clock defaults to PCLK1
+ */
+void RCC_USART3_CLK_Enable()
+{
+    RCC->APB1LENR |= RCC_APB1LENR_USART3EN;
+}
+
+/**
+ * @brief Enable the RCC Clock for DAC1
+ */
+void RCC_DAC1_CLK_Enable()
+{
+    RCC->AHB2ENR |= RCC_AHB2ENR_DAC1EN;
+}
+
+/**
+ * @brief Enable the RCC Clock for the RNG
+ * @note The RNG kernel clock defaults to HSI48, see RCC_HSI48_Enable()
+ */
+void RCC_RNG_CLK_Enable()
+{
+    RCC->AHB2ENR |= RCC_AHB2ENR_RNGEN;
+}
+
+/**
+ * @brief Turn on the HSI48 oscillator and wait until it is stable
+ */
+void RCC_HSI48_Enable()
+{
+    RCC->CR |= RCC_CR_HSI48ON;
+    while (!(RCC->CR & RCC_CR_HSI48RDY))
+        ;
+}
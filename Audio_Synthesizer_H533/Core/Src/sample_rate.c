@@ -0,0 +1,55 @@
+/**
+ ******************************************************************************
+ * @file    sample_rate.c
+ * @brief   Runtime Sample Rate
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "sample_rate.h"
+
+#include "audio_config.h"
+
+/* Function Prototypes -------------------------------------------------------*/
+
+uint32_t sample_rate_set(uint32_t rate);
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+#if SAMPLE_FREQUENCY < SAMPLE_FREQUENCY_MIN || SAMPLE_FREQUENCY > SAMPLE_FREQUENCY_MAX
+#error "The default SAMPLE_FREQUENCY must lie between SAMPLE_FREQUENCY_MIN and SAMPLE_FREQUENCY_MAX"
+#endif
+
+uint32_t sample_rate_hz = SAMPLE_FREQUENCY;
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+uint32_t sample_rate_set(uint32_t rate)
+{
+  if (rate < SAMPLE_FREQUENCY_MIN)
+    rate = SAMPLE_FREQUENCY_MIN;
+  else if (rate > SAMPLE_FREQUENCY_MAX)
+    rate = SAMPLE_FREQUENCY_MAX;
+
+  sample_rate_hz = rate;
+  return rate;
+}
@@ -23,7 +23,9 @@
 
 #include "audio_config.h"
 #include "config.h"
+#include "profiler.h"
 #include "rcc.h"
+#include "sample_rate.h"
 
 /* Private includes ----------------------------------------------------------*/
 #include <stdio.h>
@@ -35,10 +37,13 @@
 
 void sample_timer_stop();
 void sample_timer_start();
+uint32_t sample_timer_set_rate(uint32_t rate);
 
 static void __sample_timer_handler(uint16_t counter);
 
 void sample_timer_register_cb(sample_timer_cb_t cb);
+void sample_timer_enable_dma();
+void sample_timer_enable_trigger();
 void sample_timer_init();
 
 /* ========================================================================== */
@@ -48,7 +53,7 @@ void sample_timer_init();
 /* ========================================================================== */
 
 #define SAMPLE_TIMER_PSC (0)
-#define SAMPLE_TIMER_ARR (3813) // 65536 kHz
+#define SAMPLE_TIMER_CLOCK SystemCoreClock // APB1 is not divided, the timer counts at HCLK
 
 static sample_timer_cb_t event_cb = __sample_timer_handler;
 
@@ -60,11 +65,15 @@ static volatile uint16_t counter;
 /*                                                                            */
 /* ========================================================================== */
 
-void TIM2_IRQHandler()
+AUDIO_RAMFUNC void TIM2_IRQHandler()
 {
+  PROFILER_START(start);
+
   SAMPLE_TIMER->SR &= ~(0x0001); // Clear the interrupt request
   event_cb(counter);
   counter++;
+
+  PROFILER_CALLBACK(start, SAMPLE_TIMER->SR & TIM_SR_UIF); // The next sample is already due
 }
 
 /* ========================================================================== */
@@ -88,6 +97,17 @@ void sample_timer_start()
   SAMPLE_TIMER->CR1 |= (0x1); // Enable the Timer
 }
 
+uint32_t sample_timer_set_rate(uint32_t rate)
+{
+  rate = sample_rate_set(rate);
+
+  // Nearest period, the rate the timer actually runs at is what the phase increments use
+  uint32_t period = (SAMPLE_TIMER_CLOCK + rate / 2) / rate;
+
+  SAMPLE_TIMER->ARR = period - 1; // Preloaded, takes effect at the next update
+  return sample_rate_set(SAMPLE_TIMER_CLOCK / period);
+}
+
 /* ========================================================================== */
 /*                                                                            */
 /*    Initialization Functions                                                */
@@ -113,11 +133,34 @@ void sample_timer_init()
   RCC_TIM2_CLK_Enable();
 
   SAMPLE_TIMER->PSC = SAMPLE_TIMER_PSC;
-  SAMPLE_TIMER->ARR = SAMPLE_TIMER_ARR;
+  SAMPLE_TIMER->CR1 |= TIM_CR1_ARPE; // Buffer ARR so a new rate never lands behind the counter
+  sample_timer_set_rate(sample_rate_get());
+
+  // Load the preloaded ARR and PSC now, the reset ARR would hold the first update for 2^32 ticks
+  SAMPLE_TIMER->EGR = TIM_EGR_UG;
+  SAMPLE_TIMER->SR &= ~TIM_SR_UIF; // The forced update raises no sample
 
   counter = 0;
 
+#if AUDIO_PROFILER
+  profiler_init(); // The deadline of each audio callback is the timer period
+#endif
+
   SAMPLE_TIMER->DIER |= (0x1); // Enable the UDE
 
   NVIC_EnableIRQ(SAMPLE_TIMER_IRQ);
-}
\ No newline at end of file
+}
+
+void sample_timer_enable_dma()
+{
+  NVIC_DisableIRQ(SAMPLE_TIMER_IRQ);
+
+  SAMPLE_TIMER->DIER &= ~TIM_DIER_UIE; // Disable the update interrupt
+
+  sample_timer_enable_trigger(); // The channel timers request their DMA bursts on TRGO instead
+}
+
+void sample_timer_enable_trigger()
+{
+  SAMPLE_TIMER->CR2 = (SAMPLE_TIMER->CR2 & ~TIM_CR2_MMS) | TIM_CR2_MMS_1; // TRGO on every update
+}
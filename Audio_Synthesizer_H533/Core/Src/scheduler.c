@@ -0,0 +1,158 @@
+/**
+ ******************************************************************************
+ * @file    scheduler.c
+ * @brief   Control Rate / Audio Rate Scheduler
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#include "scheduler.h"
+
+#include "audio_config.h"
+#include "config.h"
+#include "sample_rate.h"
+
+/* Private includes ----------------------------------------------------------*/
+#include <string.h>
+
+#include "stm32h5xx_hal.h"
+
+/* Function Prototypes -------------------------------------------------------*/
+
+void scheduler_block();
+void scheduler_handler();
+void scheduler_get_stats(scheduler_stats_t *stats);
+void scheduler_reset_stats();
+
+static void __scheduler_handler();
+void scheduler_register_cb(scheduler_cb_t cb);
+void scheduler_init();
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+#if CONTROL_RATE_DIVIDER < 1
+#error "CONTROL_RATE_DIVIDER must be at least one block per control tick"
+#endif
+
+static scheduler_cb_t event_cb = __scheduler_handler;
+
+static uint16_t block_countdown;   // Blocks until the next tick is pended
+static volatile uint8_t running;    // A tick is in progress, set and cleared by scheduler_handler()
+
+static volatile scheduler_stats_t control_stats;
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+AUDIO_RAMFUNC void scheduler_block()
+{
+  if (running)
+    control_stats.late++; // This block preempted the tick, the voices saw part of its updates
+
+  if (--block_countdown)
+    return;
+
+  block_countdown = CONTROL_RATE_DIVIDER;
+
+  // Never queue a tick behind one still running, the parameters would fall further behind
+  if (running)
+  {
+    control_stats.overruns++;
+    return;
+  }
+
+  SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+}
+
+void scheduler_handler()
+{
+  running = 1;
+
+  uint32_t start = DWT->CYCCNT;
+
+  event_cb();
+
+  uint32_t cycles = DWT->CYCCNT - start;
+
+  control_stats.ticks++;
+  control_stats.last_cycles = cycles;
+  control_stats.total_cycles += cycles;
+  if (cycles > control_stats.max_cycles)
+    control_stats.max_cycles = cycles;
+
+  running = 0;
+}
+
+void scheduler_get_stats(scheduler_stats_t *stats)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  // PendSV has no NVIC enable bit, mask everything for the copy
+  __disable_irq();
+  memcpy(stats, (const void *)&control_stats, sizeof(scheduler_stats_t));
+  __set_PRIMASK(primask);
+}
+
+void scheduler_reset_stats()
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  control_stats.ticks = 0;
+  control_stats.last_cycles = 0;
+  control_stats.max_cycles = 0;
+  control_stats.total_cycles = 0;
+  control_stats.late = 0;
+  control_stats.overruns = 0;
+  control_stats.budget = SystemCoreClock / sample_rate_get() * CONTROL_TICK_SAMPLES;
+  __set_PRIMASK(primask);
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Placeholder Function for the control tick callback
+ */
+static void __scheduler_handler()
+{
+  return;
+}
+
+void scheduler_register_cb(scheduler_cb_t cb)
+{
+  event_cb = cb;
+}
+
+void scheduler_init()
+{
+  block_countdown = CONTROL_RATE_DIVIDER;
+  running = 0;
+
+  scheduler_reset_stats();
+
+  NVIC_SetPriority(SCHEDULER_IRQ, SCHEDULER_IRQ_PRIORITY);
+}
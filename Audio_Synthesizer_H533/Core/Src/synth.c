@@ -0,0 +1,154 @@
+/**
+ ******************************************************************************
+ * @file    synth.c
+ * @brief   Hardware Independent Synthesis Core
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "synth.h"
+
+#include "audio_config.h"
+#include "channel_common.h"
+#include "effects.h"
+#include "midi.h"
+#include "mixer.h"
+#include "modulation.h"
+#include "profiler.h"
+#include "voice_bank.h"
+
+/* Function Prototypes -------------------------------------------------------*/
+
+void synth_control();
+void synth_render(uint32_t *frames, uint16_t count);
+void synth_sample_rate();
+
+#if AUDIO_MIXER && AUDIO_EFFECTS && AUDIO_PROFILER
+static uint32_t synth_cycle_counter();
+#endif
+void synth_init();
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+void synth_control()
+{
+#if AUDIO_MODULATION
+  PROFILER_START(modulation_start);
+
+  modulation_tick();
+
+  PROFILER_STAGE(PROFILER_STAGE_MODULATION, modulation_start);
+#endif
+
+  PROFILER_START(envelope_start);
+
+  voice_bank_control();
+
+  PROFILER_STAGE(PROFILER_STAGE_ENVELOPES, envelope_start);
+}
+
+AUDIO_RAMFUNC void synth_render(uint32_t *frames, uint16_t count)
+{
+#if !AUDIO_SCHEDULER
+  midi_dispatch(); // No scheduler, the queued MIDI and the control tick run before every block
+  synth_control();
+#endif
+
+  PROFILER_START(voices_start);
+
+#if AUDIO_MIXER
+  for (uint8_t voice = 0; voice < MIXER_VOICE_COUNT; voice++)
+  {
+    PROFILER_START(start);
+
+    mixer_render_voice(voice, count);
+
+    PROFILER_VOICE(voice, start);
+  }
+
+  PROFILER_STAGE(PROFILER_STAGE_VOICES, voices_start);
+  PROFILER_START(mix_start);
+
+  mixer_mix(frames, count);
+
+  PROFILER_STAGE(PROFILER_STAGE_MIX, mix_start);
+#if AUDIO_EFFECTS && AUDIO_PROFILER
+  uint32_t effect_cycles = 0;
+
+  for (uint8_t effect = 0; effect < EFFECT_COUNT; effect++)
+    effect_cycles += effects_get_cycles((effect_t)effect);
+
+  profiler_stage(PROFILER_STAGE_EFFECTS, effect_cycles);
+#endif
+#else
+  for (uint8_t voice = 0; voice < VOICE_COUNT; voice++)
+  {
+    PROFILER_START(start);
+
+    voice_bank_render_voice(voice, frames, count, VOICE_COUNT);
+
+    PROFILER_VOICE(voice, start);
+  }
+
+  PROFILER_STAGE(PROFILER_STAGE_VOICES, voices_start);
+#endif
+}
+
+void synth_sample_rate()
+{
+  voice_bank_sample_rate();
+#if AUDIO_MODULATION
+  modulation_sample_rate();
+#endif
+#if AUDIO_MIXER && AUDIO_EFFECTS
+  effects_sample_rate();
+#endif
+}
+
+#if AUDIO_MIXER && AUDIO_EFFECTS && AUDIO_PROFILER
+/**
+ * @brief Read the cycle counter, times each stage of the effects bus
+ */
+AUDIO_RAMFUNC static uint32_t synth_cycle_counter()
+{
+  return DWT->CYCCNT;
+}
+#endif
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+void synth_init()
+{
+  voice_bank_init();
+#if AUDIO_MIXER
+  mixer_init();
+#endif
+#if AUDIO_MIXER && AUDIO_EFFECTS
+  effects_init();
+#if AUDIO_PROFILER
+  effects_cycle_counter(synth_cycle_counter);
+#endif
+#endif
+#if AUDIO_MODULATION
+  modulation_init();
+#endif
+}
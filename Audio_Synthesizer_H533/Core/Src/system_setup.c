@@ -87,9 +87,10 @@ void MX_ICACHE_Init(void)
 
   /* USER CODE END ICACHE_Init 1 */
 
-  /** Enable instruction cache in 1-way (direct mapped cache)
+  /** Enable instruction cache in 2-ways set associative mode, the control code and the flash
+   *  constants it reads share the C-AHB bus and no longer evict each other on a shared index
    */
-  if (HAL_ICACHE_ConfigAssociativityMode(ICACHE_1WAY) != HAL_OK)
+  if (HAL_ICACHE_ConfigAssociativityMode(ICACHE_2WAYS) != HAL_OK)
   {
     Error_Handler();
   }
@@ -0,0 +1,265 @@
+/**
+ ******************************************************************************
+ * @file    uart.c
+ * @brief   UART Control Interface
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#include "uart.h"
+
+#include "config.h"
+#include "midi.h"
+#include "rcc.h"
+
+/* Private includes ----------------------------------------------------------*/
+#include "stm32h5xx_hal.h"
+
+/* Private typedef -----------------------------------------------------------*/
+
+/**
+ * @brief Linked-list item reloaded by the DMA after every full buffer
+ * @note Field order follows the GPDMA register order for UB1 | USA | UDA | ULL
+ */
+typedef struct
+{
+  uint32_t CBR1;
+  uint32_t CSAR;
+  uint32_t CDAR;
+  uint32_t CLLR;
+} uart_midi_node_t;
+
+/* Function Prototypes -------------------------------------------------------*/
+
+void GPDMA1_Channel0_IRQHandler();
+void USART3_IRQHandler();
+
+static inline void uart_user_put(uint8_t byte);
+void uart_user_write(const uint8_t *data, uint16_t length);
+int __io_putchar(int ch);
+static void uart_midi_drain();
+
+static void uart_user_gpio_init();
+void uart_user_init();
+static void uart_midi_dma_config();
+static void uart_midi_gpio_init();
+void uart_midi_init();
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+#define MIDI_RX_BUFFER_LENGTH 64 // Bytes, each half is 10 ms of a saturated MIDI stream
+
+static uint8_t midi_rx_buffer[MIDI_RX_BUFFER_LENGTH];
+static uint16_t midi_rx_read; // Next byte handed to the parser
+static uart_midi_node_t midi_rx_node;
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Interrupt Functions                                                     */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Half or all of the receive buffer is full, parse it before the DMA comes back around
+ */
+void GPDMA1_Channel0_IRQHandler()
+{
+  uint32_t status = MIDI_UART_DMA->CSR;
+
+  if (status & (DMA_CSR_DTEF | DMA_CSR_ULEF | DMA_CSR_USEF))
+    Error_Handler();
+
+  MIDI_UART_DMA->CFCR = status & (DMA_CSR_HTF | DMA_CSR_TCF);
+  uart_midi_drain();
+}
+
+/**
+ * @brief The line went idle after a burst, parse the bytes received since the last interrupt
+ */
+void USART3_IRQHandler()
+{
+  uint32_t status = MIDI_UART->ISR;
+
+  // Framing and noise errors come from a plugged or unplugged cable, the byte is taken as received
+  MIDI_UART->ICR = status & (USART_ISR_IDLE | USART_ISR_ORE | USART_ISR_FE | USART_ISR_NE | USART_ISR_PE);
+
+  if (status & USART_ISR_IDLE)
+    uart_midi_drain();
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Queue a byte once the transmit register (or FIFO) has room
+ */
+static inline void uart_user_put(uint8_t byte)
+{
+  while (!(USER_UART->ISR & USART_ISR_TXE_TXFNF))
+    ;
+  USER_UART->TDR = byte;
+}
+
+void uart_user_write(const uint8_t *data, uint16_t length)
+{
+  // Not initialized, the flags never set without the clock
+  if (!(USER_UART->CR1 & USART_CR1_UE))
+    return;
+
+  for (uint16_t n = 0; n < length; n++)
+    uart_user_put(data[n]);
+
+  while (!(USER_UART->ISR & USART_ISR_TC))
+    ;
+}
+
+/**
+ * @brief Character output of printf(), see _write() in syscalls.c
+ */
+int __io_putchar(int ch)
+{
+  if (USER_UART->CR1 & USART_CR1_UE)
+    uart_user_put((uint8_t)ch);
+
+  return ch;
+}
+
+/**
+ * @brief Hand the bytes the DMA wrote since the last call to the MIDI parser
+ * @note Both interrupts calling it share MIDI_UART_IRQ_PRIORITY, so it never preempts itself
+ */
+static void uart_midi_drain()
+{
+  // BNDT counts the bytes left in the buffer, it reloads to the full length on the wrap
+  uint16_t write = (MIDI_RX_BUFFER_LENGTH - (MIDI_UART_DMA->CBR1 & DMA_CBR1_BNDT)) % MIDI_RX_BUFFER_LENGTH;
+  uint16_t read = midi_rx_read;
+
+  while (read != write)
+  {
+    midi_receive(midi_rx_buffer[read]); // A full queue drops the message, like a dropped byte
+    read = (read + 1) % MIDI_RX_BUFFER_LENGTH;
+  }
+
+  midi_rx_read = read;
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+static void uart_user_gpio_init()
+{
+  RCC_GPIOB_CLK_Enable();
+
+  GPIO_InitTypeDef initUart = {
+      USER_UART_TX_PIN | USER_UART_RX_PIN,
+      GPIO_MODE_AF_PP,
+      GPIO_PULLUP,
+      GPIO_SPEED_FREQ_LOW,
+      USER_UART_AF};
+
+  HAL_GPIO_Init(USER_UART_PORT, &initUart);
+}
+
+void uart_user_init()
+{
+  RCC_USART1_CLK_Enable();
+
+  uart_user_gpio_init();
+
+  USER_UART->CR1 = 0;                                                              // Disable to configure, 8 data bits, no parity
+  USER_UART->CR2 = 0;                                                              // 1 stop bit
+  USER_UART->CR3 = 0;                                                              // No flow control
+  USER_UART->PRESC = 0;                                                            // Kernel clock undivided
+  USER_UART->BRR = (HAL_RCC_GetPCLK2Freq() + USER_UART_BAUD / 2) / USER_UART_BAUD; // Oversampling by 16
+  USER_UART->CR1 = USART_CR1_FIFOEN | USART_CR1_TE | USART_CR1_UE;                 // Enable the transmitter
+}
+
+/**
+ * @brief Program the DMA to copy every received byte into the circular buffer
+ * @note The linked-list item rewinds the destination to the start of the buffer (circular)
+ */
+static void uart_midi_dma_config()
+{
+  uint32_t node_cllr = ((uint32_t)&midi_rx_node & DMA_CLLR_LA) | DMA_CLLR_UB1 | DMA_CLLR_USA | DMA_CLLR_UDA | DMA_CLLR_ULL;
+
+  midi_rx_node.CBR1 = MIDI_RX_BUFFER_LENGTH;
+  midi_rx_node.CSAR = (uint32_t)&MIDI_UART->RDR;
+  midi_rx_node.CDAR = (uint32_t)&midi_rx_buffer[0];
+  midi_rx_node.CLLR = node_cllr;
+
+  MIDI_UART_DMA->CCR = 0;
+  MIDI_UART_DMA->CFCR = 0x7F00; // Clear all the flags
+
+  MIDI_UART_DMA->CTR1 = DMA_CTR1_DINC | DMA_CTR1_DAP; // Byte reads from the fixed RDR on port 0, byte writes to SRAM on port 1
+  MIDI_UART_DMA->CTR2 = (MIDI_UART_DMA_REQUEST << DMA_CTR2_REQSEL_Pos); // One byte per receive request
+  MIDI_UART_DMA->CBR1 = midi_rx_node.CBR1;
+  MIDI_UART_DMA->CSAR = midi_rx_node.CSAR;
+  MIDI_UART_DMA->CDAR = midi_rx_node.CDAR;
+
+  MIDI_UART_DMA->CLBAR = (uint32_t)&midi_rx_node & DMA_CLBAR_LBA;
+  MIDI_UART_DMA->CLLR = node_cllr;
+
+  MIDI_UART_DMA->CCR = DMA_CCR_LAP | DMA_CCR_HTIE | DMA_CCR_TCIE | DMA_CCR_DTEIE | DMA_CCR_ULEIE | DMA_CCR_USEIE;
+}
+
+static void uart_midi_gpio_init()
+{
+  RCC_GPIOB_CLK_Enable();
+
+  GPIO_InitTypeDef initUart = {
+      MIDI_UART_TX_PIN | MIDI_UART_RX_PIN,
+      GPIO_MODE_AF_PP,
+      GPIO_PULLUP, // The optocoupler output idles high
+      GPIO_SPEED_FREQ_LOW,
+      MIDI_UART_AF};
+
+  HAL_GPIO_Init(MIDI_UART_PORT, &initUart);
+}
+
+void uart_midi_init()
+{
+  RCC_USART3_CLK_Enable();
+  RCC_GPDMA1_CLK_Enable();
+
+  uart_midi_gpio_init();
+  uart_midi_dma_config();
+  midi_rx_read = 0;
+
+  MIDI_UART->CR1 = 0;                                                              // Disable to configure, 8 data bits, no parity
+  MIDI_UART->CR2 = 0;                                                              // 1 stop bit
+  MIDI_UART->CR3 = USART_CR3_DMAR | USART_CR3_OVRDIS;                              // Every received byte requests the DMA, an overrun never stalls it
+  MIDI_UART->PRESC = 0;                                                            // Kernel clock undivided
+  MIDI_UART->BRR = (HAL_RCC_GetPCLK1Freq() + MIDI_UART_BAUD / 2) / MIDI_UART_BAUD; // Oversampling by 16
+
+  MIDI_UART_DMA->CCR |= DMA_CCR_EN; // Arm the DMA, it waits on the receive requests
+
+  NVIC_SetPriority(MIDI_UART_DMA_IRQ, MIDI_UART_IRQ_PRIORITY);
+  NVIC_SetPriority(MIDI_UART_IRQ, MIDI_UART_IRQ_PRIORITY);
+  NVIC_EnableIRQ(MIDI_UART_DMA_IRQ);
+  NVIC_EnableIRQ(MIDI_UART_IRQ);
+
+  MIDI_UART->CR1 = USART_CR1_IDLEIE | USART_CR1_RE | USART_CR1_UE; // Enable the receiver, no FIFO so the DMA takes each byte at once
+}
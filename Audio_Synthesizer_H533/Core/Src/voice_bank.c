@@ -0,0 +1,408 @@
+/**
+ ******************************************************************************
+ * @file    voice_bank.c
+ * @brief   Voice Bank Synthesis Interface
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "voice_bank.h"
+
+#include "audio_config.h"
+#include "channel_common.h"
+#include "envelope.h"
+#include "filter.h"
+#include "gain.h"
+#include "oscillator.h"
+#include "sample_rate.h"
+#include "wavetable.h"
+
+/* Function Prototypes -------------------------------------------------------*/
+
+void voice_enable(uint8_t voice, uint8_t state);
+void voice_set_waveform(uint8_t voice, waveforms_t wave);
+void voice_on_off(uint8_t voice, uint8_t state);
+void voice_envelope(uint8_t voice, uint16_t attack_ms, uint16_t decay_ms, uint8_t sustain, uint16_t release_ms);
+void voice_filter(uint8_t voice, filter_mode_t mode, uint8_t cutoff, uint8_t resonance);
+void voice_pulse_width(uint8_t voice, uint8_t width);
+void voice_volume(uint8_t voice, uint8_t volume);
+void voice_velocity(uint8_t voice, uint8_t velocity);
+void voice_frequency(uint8_t voice, uint32_t freq);
+void voice_modulate(uint8_t voice, int32_t pitch, int32_t gain, int32_t cutoff, int32_t width);
+void voice_bank_sample_rate();
+void voice_bank_control();
+
+static inline uint8_t voice_silent(uint8_t voice);
+static inline int32_t voice_gain_ramp(uint8_t voice, uint16_t count, int32_t *step);
+void voice_bank_render_voice(uint8_t voice, uint32_t *frames, uint16_t count, uint16_t stride);
+void voice_bank_render_q15(uint8_t voice, int16_t *samples, uint16_t count, uint16_t stride);
+void voice_bank_render(uint32_t *frames, uint16_t count);
+void voice_bank_update(volatile uint32_t *const *ccr);
+
+void voice_bank_init();
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+#define SAMPLE_SHIFT (16 - PWM_OUTPUT_BITS) // Q15 sample to a compare offset around VOICE_BANK_MID
+#define PULSE_WIDTH_SHIFT 25                // 128ths of a period to a phase
+#define PULSE_MODULATION_SHIFT 16           // Full scale Q15 offset to half a period
+
+#if VOICE_BANK_VOICES < VOICE_COUNT
+#error "Every PWM output needs a voice of its own"
+#endif
+
+voice_bank_t voice_bank;
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+void voice_enable(uint8_t voice, uint8_t state)
+{
+  if (voice >= VOICE_BANK_VOICES)
+    return;
+
+  voice_bank.enabled[voice] = state ? 1 : 0;
+}
+
+void voice_set_waveform(uint8_t voice, waveforms_t wave)
+{
+  const wavetable_t *curr_wave;
+
+  if (voice >= VOICE_BANK_VOICES)
+    return;
+
+  switch (wave)
+  {
+  case WAVEFORM_SINE:
+    curr_wave = &wavetable_sine;
+    break;
+  case WAVEFORM_TRIG:
+    curr_wave = &wavetable_trig;
+    break;
+  case WAVEFORM_RAMP:
+    curr_wave = &wavetable_ramp;
+    break;
+  case WAVEFORM_SQUARE:
+    curr_wave = &wavetable_ramp; // Pulse of two ramp reads, see wavetable_pulse()
+    break;
+  default:
+    return;
+  }
+
+  voice_bank.waveform[voice] = wave;
+  voice_bank.wavetable[voice] = curr_wave;
+  voice_bank.kernel[voice] = oscillator_kernel(wave);
+  voice_bank.q15_kernel[voice] = oscillator_q15_kernel(wave);
+}
+
+void voice_on_off(uint8_t voice, uint8_t state)
+{
+  if (voice >= VOICE_BANK_VOICES)
+    return;
+
+  if (state)
+  {
+    if (envelope_idle(&voice_bank.envelope[voice]))
+      voice_bank.phase[voice] = 0; // Reset the phase when starting a new tone from silence
+    voice_bank.on_off[voice] = 1;
+  }
+  else
+    voice_bank.on_off[voice] = 0;
+
+  envelope_gate(&voice_bank.envelope[voice], voice_bank.on_off[voice]);
+}
+
+void voice_envelope(uint8_t voice, uint16_t attack_ms, uint16_t decay_ms, uint8_t sustain, uint16_t release_ms)
+{
+  if (voice >= VOICE_BANK_VOICES)
+    return;
+
+  envelope_set(&voice_bank.envelope[voice], attack_ms, decay_ms, sustain, release_ms);
+}
+
+void voice_filter(uint8_t voice, filter_mode_t mode, uint8_t cutoff, uint8_t resonance)
+{
+  if (voice >= VOICE_BANK_VOICES)
+    return;
+
+  filter_set(&voice_bank.filter[voice], mode, cutoff, resonance);
+}
+
+void voice_pulse_width(uint8_t voice, uint8_t width)
+{
+  if (voice >= VOICE_BANK_VOICES)
+    return;
+
+  if (width < 1)
+    width = 1;
+  if (width > MIDI_MAX_VAL)
+    width = MIDI_MAX_VAL;
+
+  voice_bank.width_base[voice] = (uint32_t)width << PULSE_WIDTH_SHIFT;
+  voice_bank.pulse_width[voice] = voice_bank.width_base[voice]; // Until the next modulation tick
+}
+
+void voice_volume(uint8_t voice, uint8_t volume)
+{
+  if (voice >= VOICE_BANK_VOICES)
+    return;
+
+  if (volume > MIDI_MAX_VAL)
+    volume = MIDI_MAX_VAL;
+
+  voice_bank.vol[voice] = volume;
+  voice_bank.vol_gain[voice] = gain_mul(gain_from_midi(volume), gain_from_midi(voice_bank.velocity[voice]));
+}
+
+void voice_velocity(uint8_t voice, uint8_t velocity)
+{
+  if (voice >= VOICE_BANK_VOICES)
+    return;
+
+  if (velocity > MIDI_MAX_VAL)
+    velocity = MIDI_MAX_VAL;
+
+  voice_bank.velocity[voice] = velocity;
+  voice_volume(voice, voice_bank.vol[voice]);
+}
+
+void voice_frequency(uint8_t voice, uint32_t freq)
+{
+  if (voice >= VOICE_BANK_VOICES)
+    return;
+
+  voice_bank.freq[voice] = freq;
+  voice_bank.base_inc[voice] = wavetable_phase_increment(freq, sample_rate_get());
+  voice_bank.phase_inc[voice] = voice_bank.base_inc[voice]; // Until the next modulation tick
+}
+
+void voice_modulate(uint8_t voice, int32_t pitch, int32_t gain, int32_t cutoff, int32_t width)
+{
+  if (voice >= VOICE_BANK_VOICES)
+    return;
+
+  voice_bank.phase_inc[voice] = (uint32_t)(((uint64_t)voice_bank.base_inc[voice] * (uint32_t)pitch) >> 16);
+  voice_bank.mod_gain[voice] = gain;
+
+  int64_t pulse = (int64_t)voice_bank.width_base[voice] + ((int64_t)width << PULSE_MODULATION_SHIFT);
+
+  if (pulse < WAVETABLE_PULSE_MIN)
+    pulse = WAVETABLE_PULSE_MIN;
+  if (pulse > WAVETABLE_PULSE_MAX)
+    pulse = WAVETABLE_PULSE_MAX;
+  voice_bank.pulse_width[voice] = (uint32_t)pulse;
+
+  if (voice_bank.filter[voice].mode != FILTER_OFF)
+    filter_modulate(&voice_bank.filter[voice], cutoff);
+}
+
+void voice_bank_sample_rate()
+{
+  filter_table_init();
+
+  for (uint8_t voice = 0; voice < VOICE_BANK_VOICES; voice++)
+  {
+    voice_frequency(voice, voice_bank.freq[voice]);
+    envelope_sample_rate(&voice_bank.envelope[voice]);
+
+    if (voice_bank.filter[voice].mode != FILTER_OFF)
+      filter_modulate(&voice_bank.filter[voice], 0); // Until the next modulation tick
+  }
+}
+
+void voice_bank_control()
+{
+  for (uint8_t voice = 0; voice < VOICE_BANK_VOICES; voice++)
+  {
+    if (!voice_bank.enabled[voice] || envelope_idle(&voice_bank.envelope[voice]))
+      continue;
+
+    int32_t envelope = envelope_tick(&voice_bank.envelope[voice]);
+    int32_t volume = gain_mul(voice_bank.vol_gain[voice], voice_bank.mod_gain[voice]);
+
+    voice_bank.gain_target[voice] = (int32_t)(((int64_t)envelope * volume) >> 30); // One word, read whole by the renderers
+  }
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Render Functions                                                        */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Check if a voice has nothing to render
+ * @note A silent voice restarts its gain ramp from 0 and its filter from rest
+ */
+static inline uint8_t voice_silent(uint8_t voice)
+{
+  if (voice_bank.enabled[voice] && !envelope_idle(&voice_bank.envelope[voice]))
+    return 0;
+
+  voice_bank.gain[voice] = 0;
+  filter_reset(&voice_bank.filter[voice]);
+  return 1;
+}
+
+/**
+ * @brief Ramp the gain of a voice to the target of the last control tick across the block
+ * @param voice The voice to ramp
+ * @param count Samples in the block
+ * @param step Output, gain change per sample
+ * @return Gain before the first sample (Q16)
+ * @note The target is reached within the block and held until the next tick
+ */
+static inline int32_t voice_gain_ramp(uint8_t voice, uint16_t count, int32_t *step)
+{
+  return gain_ramp(&voice_bank.gain[voice], voice_bank.gain_target[voice], count, step);
+}
+
+AUDIO_RAMFUNC void voice_bank_render_voice(uint8_t voice, uint32_t *frames, uint16_t count, uint16_t stride)
+{
+  uint32_t *frame = &frames[voice];
+
+  // Silent voices hold 50%, a disabled output pin ignores its compare value anyway
+  if (voice_silent(voice))
+  {
+    for (uint16_t n = 0; n < count; n++, frame += stride)
+      *frame = VOICE_BANK_MID;
+    return;
+  }
+
+  // Band limit once per block, the envelope was evaluated by the control tick
+  const wavetable_level_t *level = wavetable_select(voice_bank.wavetable[voice], voice_bank.phase_inc[voice]);
+  int32_t gain_step;
+  int32_t gain = voice_gain_ramp(voice, count, &gain_step);
+
+#if OSCILLATOR_KERNELS
+  voice_bank.phase[voice] = voice_bank.kernel[voice](level, voice_bank.phase[voice], voice_bank.phase_inc[voice],
+                                                     voice_bank.pulse_width[voice], gain, gain_step, frame, count, stride);
+#else
+  // Work on a local copy of the voice, written back once per block
+  uint32_t phase = voice_bank.phase[voice];
+  uint32_t phase_inc = voice_bank.phase_inc[voice];
+  uint32_t width = voice_bank.pulse_width[voice];
+  int32_t pulse_gain = wavetable_pulse_gain(width);
+  uint8_t pulse = (voice_bank.waveform[voice] == WAVEFORM_SQUARE);
+
+  for (uint16_t n = 0; n < count; n++, frame += stride)
+  {
+    phase += phase_inc; // Wraps for free at 2^32
+    gain += gain_step;
+    int16_t sample = pulse ? wavetable_pulse(level, phase, width, pulse_gain) : wavetable_lookup(level, phase);
+    *frame = VOICE_BANK_MID + (gain_apply(gain, sample) >> SAMPLE_SHIFT);
+  }
+
+  voice_bank.phase[voice] = phase;
+#endif
+}
+
+AUDIO_RAMFUNC void voice_bank_render_q15(uint8_t voice, int16_t *samples, uint16_t count, uint16_t stride)
+{
+  int16_t *sample = &samples[voice];
+
+  if (voice_silent(voice))
+  {
+    for (uint16_t n = 0; n < count; n++, sample += stride)
+      *sample = 0;
+    return;
+  }
+
+  const wavetable_level_t *level = wavetable_select(voice_bank.wavetable[voice], voice_bank.phase_inc[voice]);
+  int32_t gain_step;
+  int32_t gain = voice_gain_ramp(voice, count, &gain_step);
+
+#if OSCILLATOR_KERNELS
+  voice_bank.phase[voice] = voice_bank.q15_kernel[voice](level, voice_bank.phase[voice], voice_bank.phase_inc[voice],
+                                                         voice_bank.pulse_width[voice], gain, gain_step, sample, count, stride);
+#else
+  uint32_t phase = voice_bank.phase[voice];
+  uint32_t phase_inc = voice_bank.phase_inc[voice];
+  uint32_t width = voice_bank.pulse_width[voice];
+  int32_t pulse_gain = wavetable_pulse_gain(width);
+  uint8_t pulse = (voice_bank.waveform[voice] == WAVEFORM_SQUARE);
+
+  for (uint16_t n = 0; n < count; n++, sample += stride)
+  {
+    phase += phase_inc;
+    gain += gain_step;
+    int16_t wave = pulse ? wavetable_pulse(level, phase, width, pulse_gain) : wavetable_lookup(level, phase);
+    *sample = (int16_t)gain_apply(gain, wave);
+  }
+
+  voice_bank.phase[voice] = phase;
+#endif
+
+  filter_process(&voice_bank.filter[voice], &samples[voice], count, stride);
+}
+
+AUDIO_RAMFUNC void voice_bank_render(uint32_t *frames, uint16_t count)
+{
+  for (uint8_t voice = 0; voice < VOICE_COUNT; voice++)
+    voice_bank_render_voice(voice, frames, count, VOICE_COUNT);
+}
+
+AUDIO_RAMFUNC void voice_bank_update(volatile uint32_t *const *ccr)
+{
+  uint32_t frame[VOICE_COUNT];
+
+  voice_bank_render(frame, 1);
+
+  for (uint8_t voice = 0; voice < VOICE_COUNT; voice++)
+  {
+    if (voice_bank.enabled[voice]) // Don't touch the outputs that are disabled
+      *ccr[voice] = frame[voice];
+  }
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+void voice_bank_init()
+{
+  filter_table_init();
+
+  for (uint8_t voice = 0; voice < VOICE_BANK_VOICES; voice++)
+  {
+    voice_bank.phase[voice] = 0;
+    voice_bank.phase_inc[voice] = 0;
+    voice_bank.base_inc[voice] = 0;
+    voice_bank.width_base[voice] = WAVETABLE_PULSE_SQUARE;
+    voice_bank.pulse_width[voice] = WAVETABLE_PULSE_SQUARE;
+    voice_bank.mod_gain[voice] = GAIN_UNITY;
+    voice_bank.freq[voice] = 0;
+    voice_bank.on_off[voice] = 0;
+    voice_bank.enabled[voice] = 0;
+    voice_bank.waveform[voice] = WAVEFORM_SINE;
+    voice_bank.wavetable[voice] = &wavetable_sine;
+    voice_bank.kernel[voice] = oscillator_kernel(WAVEFORM_SINE);
+    voice_bank.q15_kernel[voice] = oscillator_q15_kernel(WAVEFORM_SINE);
+    voice_bank.gain[voice] = 0;
+    voice_bank.gain_target[voice] = 0;
+    voice_bank.velocity[voice] = MIDI_MAX_VAL;
+    envelope_init(&voice_bank.envelope[voice]);
+    filter_init(&voice_bank.filter[voice]);
+    voice_volume(voice, MIDI_MAX_VAL);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+/**
+ ******************************************************************************
+ * @file    wavetable.c
+ * @brief   Compact Wavetable Definitions
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "wavetable.h"
+
+#include "audio_config.h"
+
+/* Private includes ----------------------------------------------------------*/
+#include "wavetable_data.h" // Generated by Tools/wavetable_gen.py at build time
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Wavetable Definitions                                                   */
+/*                                                                            */
+/* ========================================================================== */
+
+// A pure sine never aliases, a single level serves every frequency
+static const wavetable_level_t sine_levels[1] = {{sine_quarter, WAVETABLE_QUARTER_BITS, 1}};
+
+const wavetable_t wavetable_sine = {sine_levels, 1, 0};
+const wavetable_t wavetable_trig = {trig_levels, WAVETABLE_MIP_LEVELS, WAVETABLE_MIP_BASE};
+const wavetable_t wavetable_ramp = {ramp_levels, WAVETABLE_MIP_LEVELS, WAVETABLE_MIP_BASE};
\ No newline at end of file
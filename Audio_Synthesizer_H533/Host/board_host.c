@@ -0,0 +1,138 @@
+/**
+ ******************************************************************************
+ * @file    board_host.c
+ * @brief   Host Board Layer, In-Memory Sample Sink
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "board_host.h"
+
+#include "audio_config.h"
+#include "channel_common.h"
+#include "midi.h"
+#include "sample_rate.h"
+#include "synth.h"
+
+/* Private includes ----------------------------------------------------------*/
+#include <string.h>
+
+/* Function Prototypes -------------------------------------------------------*/
+
+static void board_host_dma(const uint32_t *frames, uint16_t count);
+void board_host_sink(uint32_t *frames, uint32_t capacity);
+uint32_t board_host_run(uint32_t samples);
+uint8_t board_host_midi(const uint8_t *data, uint16_t length);
+
+uint32_t board_host_init(uint32_t rate);
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+board_host_timer_t board_host_timer;
+
+static uint32_t block[AUDIO_BLOCK_SIZE * VOICE_COUNT]; // Half of the block renderer buffer
+
+static uint32_t *sink;          // Destination of the frames, NULL discards
+static uint32_t sink_capacity;  // Frames the sink holds
+static uint32_t sink_count;     // Frames stored in the sink
+
+#if AUDIO_SCHEDULER
+static uint16_t block_countdown; // Blocks until the next control tick
+#endif
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Move a rendered block out as the DMA burst does, one frame per sample period
+ */
+static void board_host_dma(const uint32_t *frames, uint16_t count)
+{
+  for (uint16_t n = 0; n < count; n++)
+  {
+    const uint32_t *frame = &frames[n * VOICE_COUNT];
+
+    memcpy(board_host_timer.CCR, frame, sizeof(board_host_timer.CCR));
+    board_host_timer.frames++;
+
+    if (sink && sink_count < sink_capacity)
+      memcpy(&sink[sink_count++ * VOICE_COUNT], frame, VOICE_COUNT * sizeof(uint32_t));
+  }
+}
+
+void board_host_sink(uint32_t *frames, uint32_t capacity)
+{
+  sink = frames;
+  sink_capacity = frames ? capacity : 0;
+  sink_count = 0;
+}
+
+uint32_t board_host_run(uint32_t samples)
+{
+  for (uint32_t done = 0; done < samples; done += AUDIO_BLOCK_SIZE)
+  {
+    synth_render(block, AUDIO_BLOCK_SIZE);
+    board_host_dma(block, AUDIO_BLOCK_SIZE);
+
+#if AUDIO_SCHEDULER
+    // The control tick is pended by the block and runs once it returns, as scheduler_block()
+    if (--block_countdown == 0)
+    {
+      block_countdown = CONTROL_RATE_DIVIDER;
+      midi_dispatch();
+      synth_control();
+    }
+#endif
+  }
+
+  return sink_count;
+}
+
+uint8_t board_host_midi(const uint8_t *data, uint16_t length)
+{
+  return midi_post(data, length);
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+uint32_t board_host_init(uint32_t rate)
+{
+  rate = sample_rate_set(rate);
+
+  synth_init();
+  midi_init();
+
+  for (uint8_t channel = 0; channel < VOICE_COUNT; channel++)
+    board_host_timer.CCR[channel] = VOICE_BANK_MID; // 50% duty cycle, as channel_timer_pwm_init()
+  board_host_timer.frames = 0;
+
+  board_host_sink(NULL, 0);
+
+#if AUDIO_SCHEDULER
+  block_countdown = CONTROL_RATE_DIVIDER;
+#endif
+
+  return rate;
+}
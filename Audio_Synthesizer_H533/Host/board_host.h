@@ -0,0 +1,108 @@
+/**
+ ******************************************************************************
+ * @file           : board_host.h
+ * @brief          : Host Board Layer Header, In-Memory Sample Sink
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "audio_config.h"
+#include "voice_bank.h"
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Host Board Definitions                                                  */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef _BOARD_HOST_H_
+#define _BOARD_HOST_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*
+ * Stands in for the board on the machine running the build. The synthesis core (synth.h) runs
+ * exactly as on target:
+ *   block renderer - synth_render() fills a block of AUDIO_BLOCK_SIZE frames
+ *   DMA burst      - each frame is written to the mocked compare registers, then to the sink
+ *   scheduler      - every CONTROL_RATE_DIVIDER blocks the queued MIDI is applied and the
+ *                    control tick runs, after the block like PendSV (AUDIO_SCHEDULER),
+ *                    without it synth_render() does both before every block
+ * Time only moves in board_host_run(), there are no interrupts.
+ */
+
+/**
+ * @brief Mocked compare registers of the channel timers, indexed by channel_t
+ */
+typedef struct
+{
+  uint32_t CCR[VOICE_COUNT]; // Duty cycle of each channel, last frame written
+  uint32_t frames;           // Frames written since board_host_init()
+} board_host_timer_t;
+
+extern board_host_timer_t board_host_timer;
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Control Functions                                                       */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Set where the rendered frames are stored
+ * @param frames Destination, VOICE_COUNT compare values per frame (as synth_render()), NULL discards them
+ * @param capacity Number of frames the destination holds
+ * @note Rewinds the sink, the next board_host_run() writes from frames[0]
+ */
+void board_host_sink(uint32_t *frames, uint32_t capacity);
+
+/**
+ * @brief Render audio into the sink
+ * @param samples Number of frames to render, rounded up to whole blocks
+ * @return Frames stored in the sink since board_host_sink(), stops growing once it is full
+ */
+uint32_t board_host_run(uint32_t samples);
+
+/**
+ * @brief Queue MIDI messages as the UART would, applied at the next control tick
+ * @param data Message bytes
+ * @param length Number of bytes
+ * @return 1 if every message was queued, see midi_post()
+ */
+uint8_t board_host_midi(const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Convert a compare value to a signed sample
+ * @param ccr Compare value, 0 - VOICE_BANK_FULL
+ * @return Q15 sample, VOICE_BANK_MID is 0
+ */
+static inline int16_t board_host_q15(uint32_t ccr)
+{
+  return (int16_t)(((int32_t)ccr - (int32_t)VOICE_BANK_MID) * (1 << (16 - PWM_OUTPUT_BITS)));
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Initialization Functions                                                */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Reset the synthesis core and the mocked board at a sample rate
+ * @param rate Samples per second, clamped to SAMPLE_FREQUENCY_MIN - SAMPLE_FREQUENCY_MAX
+ * @return The rate stored
+ * @note The MIDI voices are enabled and silent, the sink discards until board_host_sink()
+ */
+uint32_t board_host_init(uint32_t rate);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BOARD_HOST_H_ */
@@ -0,0 +1,226 @@
+/**
+ ******************************************************************************
+ * @file    midi_parse_test.c
+ * @brief   Byte-Sequence Test of the MIDI Parser
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ *
+ * Feeds byte sequences to midi_parse() one byte at a time, on a fresh parser
+ * per case, and checks every completed message against the expected type,
+ * status, data bytes and system exclusive payload:
+ *   running status          - data bytes reuse the last channel status
+ *   real-time mid-message   - F8 - FF complete at once, the message around them is kept
+ *   system exclusive        - payload cut at sysex_capacity, the parser carries on
+ *   running status cancel   - F0 - F7 clear the running status, later data is skipped
+ *
+ * Run from Audio_Synthesizer_H533:
+ *   cmake --preset Host && cmake --build --preset Host && ctest --preset Host
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+
+#include "midi.h"
+
+/* Private typedef -----------------------------------------------------------*/
+
+typedef struct
+{
+  uint8_t type;
+  uint8_t status;
+  uint8_t data1;
+  uint8_t data2;
+  const uint8_t *sysex; // Expected payload of a system exclusive message
+  uint16_t sysex_length;
+} parse_expect_t;
+
+typedef struct
+{
+  const char *name;
+  const uint8_t *bytes;
+  uint16_t length;
+  const parse_expect_t *events;
+  uint8_t event_count;
+} parse_case_t;
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Function Prototypes                                                     */
+/*                                                                            */
+/* ========================================================================== */
+
+static int run_case(const parse_case_t *test);
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+#define SYSEX_CAPACITY 4 // Small enough for the cases to overflow it
+
+#define COUNT(array) (sizeof(array) / sizeof((array)[0]))
+#define CASE(name, bytes, events) {name, bytes, COUNT(bytes), events, COUNT(events)}
+#define EXPECT(type, status, data1, data2) {(type), (status), (data1), (data2), NULL, 0}
+#define EXPECT_SYSEX(payload, length) {MIDI_EVENT_SYSTEM_EXCLUSIVE, 0xF0, 0, 0, (payload), (length)}
+
+// Note ons, then note offs and program changes sent on running status
+static const uint8_t running_bytes[] = {0x90, 60, 100, 62, 101, 0x80, 60, 0, 62, 0, 0xC2, 5, 6};
+static const parse_expect_t running_events[] = {
+    EXPECT(MIDI_EVENT_NOTE_ON, 0x90, 60, 100),
+    EXPECT(MIDI_EVENT_NOTE_ON, 0x90, 62, 101),
+    EXPECT(MIDI_EVENT_NOTE_OFF, 0x80, 60, 0),
+    EXPECT(MIDI_EVENT_NOTE_OFF, 0x80, 62, 0),
+    EXPECT(MIDI_EVENT_PROGRAM_CHANGE, 0xC2, 5, 0),
+    EXPECT(MIDI_EVENT_PROGRAM_CHANGE, 0xC2, 6, 0),
+};
+
+// Real-time bytes after the status, between the data bytes and under running status, F9 and FD ignored
+static const uint8_t realtime_bytes[] = {0xB1, 0xF8, 7, 0xFE, 90, 0xF9, 1, 0xFA, 64, 0xFD, 0xFF};
+static const parse_expect_t realtime_events[] = {
+    EXPECT(MIDI_EVENT_REAL_TIME, 0xF8, 0, 0),
+    EXPECT(MIDI_EVENT_REAL_TIME, 0xFE, 0, 0),
+    EXPECT(MIDI_EVENT_CONTROL_CHANGE, 0xB1, 7, 90),
+    EXPECT(MIDI_EVENT_REAL_TIME, 0xFA, 0, 0),
+    EXPECT(MIDI_EVENT_CONTROL_CHANGE, 0xB1, 1, 64),
+    EXPECT(MIDI_EVENT_REAL_TIME, 0xFF, 0, 0),
+};
+
+// A real-time byte inside, a payload longer than the buffer, then a message after it
+static const uint8_t sysex_payload[] = {0x7E, 0x01, 0x02, 0x03};
+static const uint8_t sysex_bytes[] = {0xF0, 0x7E, 0x01, 0xF8, 0x02, 0x03, 0x04, 0x05, 0xF7, 0x91, 60, 100};
+static const parse_expect_t sysex_events[] = {
+    EXPECT(MIDI_EVENT_REAL_TIME, 0xF8, 0, 0),
+    EXPECT_SYSEX(sysex_payload, SYSEX_CAPACITY),
+    EXPECT(MIDI_EVENT_NOTE_ON, 0x91, 60, 100),
+};
+
+// Payload shorter than the buffer, and one cut short by a status byte (dropped)
+static const uint8_t sysex_short_payload[] = {0x41};
+static const uint8_t sysex_short_bytes[] = {0xF0, 0x41, 0xF7, 0xF0, 0x42, 0x43, 0x92, 61, 1};
+static const parse_expect_t sysex_short_events[] = {
+    EXPECT_SYSEX(sysex_short_payload, 1),
+    EXPECT(MIDI_EVENT_NOTE_ON, 0x92, 61, 1),
+};
+
+// Each of F0 - F7 after a note on, the data bytes following the system message join nothing
+static const uint8_t cancel_bytes[] = {
+    0x90, 60, 100, 0xF0, 0x10, 0xF7, 62, 101, // System exclusive
+    0x90, 60, 100, 0xF1, 0x23, 62, 101,       // MIDI time code
+    0x90, 60, 100, 0xF2, 0x01, 0x02, 62, 101, // Song position pointer
+    0x90, 60, 100, 0xF3, 0x04, 62, 101,       // Song select
+    0x90, 60, 100, 0xF4, 62, 101,             // Undefined
+    0x90, 60, 100, 0xF5, 62, 101,             // Undefined
+    0x90, 60, 100, 0xF6, 62, 101,             // Tune request
+    0x90, 60, 100, 0xF7, 62, 101,             // Stray end of system exclusive
+};
+static const uint8_t cancel_payload[] = {0x10};
+static const parse_expect_t cancel_events[] = {
+    EXPECT(MIDI_EVENT_NOTE_ON, 0x90, 60, 100),
+    EXPECT_SYSEX(cancel_payload, 1),
+    EXPECT(MIDI_EVENT_NOTE_ON, 0x90, 60, 100),
+    EXPECT(MIDI_EVENT_SYSTEM_COMMON, 0xF1, 0x23, 0),
+    EXPECT(MIDI_EVENT_NOTE_ON, 0x90, 60, 100),
+    EXPECT(MIDI_EVENT_SYSTEM_COMMON, 0xF2, 0x01, 0x02),
+    EXPECT(MIDI_EVENT_NOTE_ON, 0x90, 60, 100),
+    EXPECT(MIDI_EVENT_SYSTEM_COMMON, 0xF3, 0x04, 0),
+    EXPECT(MIDI_EVENT_NOTE_ON, 0x90, 60, 100),
+    EXPECT(MIDI_EVENT_NOTE_ON, 0x90, 60, 100),
+    EXPECT(MIDI_EVENT_NOTE_ON, 0x90, 60, 100),
+    EXPECT(MIDI_EVENT_SYSTEM_COMMON, 0xF6, 0, 0),
+    EXPECT(MIDI_EVENT_NOTE_ON, 0x90, 60, 100),
+};
+
+static const parse_case_t cases[] = {
+    CASE("running_status", running_bytes, running_events),
+    CASE("realtime", realtime_bytes, realtime_events),
+    CASE("sysex_truncated", sysex_bytes, sysex_events),
+    CASE("sysex_short", sysex_short_bytes, sysex_short_events),
+    CASE("running_cancel", cancel_bytes, cancel_events),
+};
+
+#define CASE_COUNT COUNT(cases)
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Test                                                                    */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Parse the bytes of one case and compare the messages
+ * @return Number of mismatches
+ */
+static int run_case(const parse_case_t *test)
+{
+  static uint8_t sysex[SYSEX_CAPACITY];
+  midi_parser_t parser;
+  uint8_t seen = 0;
+  int failures = 0;
+
+  midi_parser_init(&parser, sysex, SYSEX_CAPACITY);
+
+  for (uint16_t index = 0; index < test->length; index++)
+  {
+    const midi_event_t *event = midi_parse(&parser, test->bytes[index]);
+
+    if (!event)
+      continue;
+
+    if (seen >= test->event_count)
+    {
+      printf("%s: byte %u, unexpected message %02X\n", test->name, index, event->status);
+      failures++;
+      continue;
+    }
+
+    const parse_expect_t *expect = &test->events[seen++];
+
+    if (event->type != expect->type || event->status != expect->status ||
+        event->data1 != expect->data1 || event->data2 != expect->data2 ||
+        event->sysex_length != expect->sysex_length ||
+        (expect->sysex_length && memcmp(event->sysex, expect->sysex, expect->sysex_length) != 0))
+    {
+      printf("%s: byte %u, got type %X %02X %u %u (%u sysex bytes), expected type %X %02X %u %u (%u sysex bytes)\n",
+             test->name, index, event->type, event->status, event->data1, event->data2, event->sysex_length,
+             expect->type, expect->status, expect->data1, expect->data2, expect->sysex_length);
+      failures++;
+    }
+  }
+
+  if (seen < test->event_count)
+  {
+    printf("%s: %u of %u messages parsed\n", test->name, seen, test->event_count);
+    failures++;
+  }
+
+  return failures;
+}
+
+int main(void)
+{
+  int failures = 0;
+
+  for (uint32_t c = 0; c < CASE_COUNT; c++)
+  {
+    int result = run_case(&cases[c]);
+
+    printf("%-16s %s\n", cases[c].name, result ? "FAIL" : "ok");
+    failures += result;
+  }
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,420 @@
+/**
+ ******************************************************************************
+ * @file    synth_audio_test.c
+ * @brief   Golden-Audio Regression Test of the Synthesis Core
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ *
+ * Plays reference notes and MIDI sequences through the board layer, takes the
+ * spectrum of one PWM output once the note has settled (arm_rfft_fast_f32(),
+ * Blackman-Harris window) and measures it up to AUDIO_BAND_HZ:
+ *   snr   - fundamental against the noise, harmonics and aliases excluded (dB)
+ *   thdn  - everything but the fundamental against the fundamental (dB)
+ *   alias - harmonics between fs / 2 and fs folded into the band, against the harmonics (dB)
+ * Each case is checked against audio_baseline.txt, a case fails when a figure
+ * is worse than its baseline by more than the tolerance. Better figures pass,
+ * --update rewrites the baseline once the change is accepted.
+ *
+ * Run from Audio_Synthesizer_H533:
+ *   cmake --preset Host && cmake --build --preset Host && ctest --preset Host
+ *   ./build/Host/Host/synth_audio_test Host/audio_baseline.txt --update
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "audio_config.h"
+#include "board_host.h"
+#include "midi.h"
+#include "sample_rate.h"
+#include "voice_bank.h"
+
+/* Private includes ----------------------------------------------------------*/
+#include "arm_math.h"
+
+/* Private typedef -----------------------------------------------------------*/
+
+/**
+ * @brief MIDI message sent once the case has played for at_ms
+ */
+typedef struct
+{
+  uint16_t at_ms;
+  uint8_t message[3];
+} audio_event_t;
+
+/**
+ * @brief Reference note or sequence, the output of channel is measured at key
+ */
+typedef struct
+{
+  const char *name;
+  uint32_t rate;               // Sample rate, 0 is a synthetic sine through the analysis only
+  waveforms_t wave;            // Waveform of the voice of channel
+  uint8_t width;               // Pulse width of a square in 128ths, 64 is a square
+  uint8_t channel;             // MIDI channel, its voice and PWM output
+  uint8_t key;                 // Key held when the capture starts
+  uint16_t settle_ms;          // Start of the capture
+  const audio_event_t *events; // Sorted by at_ms
+  uint8_t event_count;
+} audio_case_t;
+
+typedef struct
+{
+  float snr;
+  float thdn;
+  float alias;
+} audio_metrics_t;
+
+/* Function Prototypes -------------------------------------------------------*/
+
+static float power_db(double power, double reference);
+static void mark_lobe(double frequency, uint32_t rate, uint32_t band, uint8_t kind);
+static void analyze(const float *samples, uint32_t rate, double f0, audio_metrics_t *metrics);
+static double render_case(const audio_case_t *test, float *samples);
+
+static int baseline_find(const char *path, const char *name, audio_metrics_t *baseline);
+static int baseline_write(const char *path, const audio_metrics_t *results);
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+#ifndef AUDIO_TEST_FFT_LENGTH
+#define AUDIO_TEST_FFT_LENGTH 4096 // Frames captured per case, must match Tools/fft_table_gen.py --length
+#endif
+
+#define AUDIO_BAND_HZ 20000.0 // Top of the measured band, the PWM noise shaping lives above it
+#define LOBE_BINS 4           // Half width of the Blackman-Harris main lobe
+#define FLOOR_DB -150.0f      // Reported for a band holding no energy
+
+#define TOLERANCE_SNR_DB 1.0f
+#define TOLERANCE_THDN_DB 1.0f
+#define TOLERANCE_ALIAS_DB 3.0f
+
+enum
+{
+  BIN_NOISE,
+  BIN_DC,
+  BIN_FUNDAMENTAL,
+  BIN_HARMONIC,
+  BIN_ALIAS
+};
+
+static const audio_event_t sequence_events[] = {
+    {0, {0x90, 72, 100}},   // C5
+    {60, {0x80, 72, 0}},
+    {60, {0x90, 76, 90}},   // E5, legato
+    {120, {0x90, 76, 0}},   // Note off as a zero velocity note on
+    {120, {0x90, 79, 110}}, // G5
+    {150, {0xB0, 7, 90}},   // Channel volume
+    {180, {0x80, 79, 0}},
+    {180, {0x90, 84, 127}}, // C6, held
+};
+
+static const audio_event_t chord_events[] = {
+    {0, {0x90, 60, 100}}, // C4
+    {0, {0x91, 64, 100}}, // E4
+    {0, {0x92, 67, 100}}, // G4
+};
+
+#define NOTE(key) {{0, {0x90, (key), 100}}}
+
+static const audio_event_t note_a4[] = NOTE(69);
+static const audio_event_t note_c5[] = NOTE(72);
+static const audio_event_t note_c6[] = NOTE(84);
+static const audio_event_t note_c7[] = NOTE(96);
+static const audio_event_t note_c8[] = NOTE(108);
+
+#define EVENTS(events) (events), (uint8_t)(sizeof(events) / sizeof((events)[0]))
+
+static const audio_case_t cases[] = {
+    {"reference", 0, WAVEFORM_SINE, 64, 0, 69, 0, NULL, 0},
+    {"sine_a4", SAMPLE_FREQUENCY, WAVEFORM_SINE, 64, 0, 69, 250, EVENTS(note_a4)},
+    {"sine_c7", SAMPLE_FREQUENCY, WAVEFORM_SINE, 64, 0, 96, 250, EVENTS(note_c7)},
+    {"trig_c5", SAMPLE_FREQUENCY, WAVEFORM_TRIG, 64, 0, 72, 250, EVENTS(note_c5)},
+    {"ramp_c6", SAMPLE_FREQUENCY, WAVEFORM_RAMP, 64, 0, 84, 250, EVENTS(note_c6)},
+    {"ramp_c8", SAMPLE_FREQUENCY, WAVEFORM_RAMP, 64, 0, 108, 250, EVENTS(note_c8)},
+    {"square_c7", SAMPLE_FREQUENCY, WAVEFORM_SQUARE, 64, 0, 96, 250, EVENTS(note_c7)},
+    {"square_c7_48k", 48000, WAVEFORM_SQUARE, 64, 0, 96, 250, EVENTS(note_c7)},
+    {"pulse_c6", SAMPLE_FREQUENCY, WAVEFORM_SQUARE, 16, 0, 84, 250, EVENTS(note_c6)},
+    {"sequence_c6", SAMPLE_FREQUENCY, WAVEFORM_SQUARE, 64, 0, 84, 400, EVENTS(sequence_events)},
+    {"chord_e4", SAMPLE_FREQUENCY, WAVEFORM_TRIG, 64, 1, 64, 250, EVENTS(chord_events)},
+};
+
+#define CASE_COUNT (sizeof(cases) / sizeof(cases[0]))
+
+static arm_rfft_fast_instance_f32 fft;
+
+static float window[AUDIO_TEST_FFT_LENGTH];
+static float windowed[AUDIO_TEST_FFT_LENGTH];
+static float spectrum[AUDIO_TEST_FFT_LENGTH];
+static float power[AUDIO_TEST_FFT_LENGTH / 2];
+static uint8_t bin_kind[AUDIO_TEST_FFT_LENGTH / 2];
+static uint32_t frames[AUDIO_TEST_FFT_LENGTH * VOICE_COUNT];
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Analysis Functions                                                      */
+/*                                                                            */
+/* ========================================================================== */
+
+static float power_db(double power, double reference)
+{
+  if (reference <= 0.0)
+    return -FLOOR_DB;
+  if (power <= 0.0)
+    return FLOOR_DB;
+
+  double db = 10.0 * log10(power / reference);
+
+  return db < FLOOR_DB ? FLOOR_DB : (float)db;
+}
+
+/**
+ * @brief Mark the bins of the main lobe at frequency as kind, unless already claimed
+ */
+static void mark_lobe(double frequency, uint32_t rate, uint32_t band, uint8_t kind)
+{
+  int32_t center = (int32_t)lround(frequency * AUDIO_TEST_FFT_LENGTH / rate);
+
+  for (int32_t bin = center - LOBE_BINS; bin <= center + LOBE_BINS; bin++)
+  {
+    if (bin >= 0 && (uint32_t)bin <= band && bin_kind[bin] == BIN_NOISE)
+      bin_kind[bin] = kind;
+  }
+}
+
+/**
+ * @brief Measure one captured output
+ * @param samples AUDIO_TEST_FFT_LENGTH samples, full scale is 1.0
+ * @param rate Sample rate of the capture
+ * @param f0 Frequency of the note in Hz
+ */
+static void analyze(const float *samples, uint32_t rate, double f0, audio_metrics_t *metrics)
+{
+  double nyquist = rate / 2.0;
+  uint32_t band = (uint32_t)(fmin(AUDIO_BAND_HZ, nyquist) * AUDIO_TEST_FFT_LENGTH / rate);
+
+  if (band >= AUDIO_TEST_FFT_LENGTH / 2)
+    band = AUDIO_TEST_FFT_LENGTH / 2 - 1;
+
+  arm_mult_f32(samples, window, windowed, AUDIO_TEST_FFT_LENGTH);
+  arm_rfft_fast_f32(&fft, windowed, spectrum, 0);
+
+  // spectrum[1] holds the Nyquist bin, outside every band
+  power[0] = spectrum[0] * spectrum[0];
+  arm_cmplx_mag_squared_f32(&spectrum[2], &power[1], AUDIO_TEST_FFT_LENGTH / 2 - 1);
+
+  // The lobes claim their bins in order: DC, fundamental, harmonics, then the aliases left over
+  memset(bin_kind, BIN_NOISE, sizeof(bin_kind));
+  mark_lobe(0.0, rate, band, BIN_DC);
+  mark_lobe(f0, rate, band, BIN_FUNDAMENTAL);
+
+  for (double harmonic = 2.0 * f0; harmonic < nyquist; harmonic += f0)
+    mark_lobe(harmonic, rate, band, BIN_HARMONIC);
+
+  // First fold only, a band-limited table leaking past fs / 2 aliases there first
+  for (double harmonic = ceil(nyquist / f0) * f0; harmonic < rate; harmonic += f0)
+    mark_lobe(rate - harmonic, rate, band, BIN_ALIAS);
+
+  double sums[BIN_ALIAS + 1] = {0};
+
+  for (uint32_t bin = 0; bin <= band; bin++)
+    sums[bin_kind[bin]] += power[bin];
+
+  metrics->snr = power_db(sums[BIN_FUNDAMENTAL], sums[BIN_NOISE]);
+  metrics->thdn = power_db(sums[BIN_HARMONIC] + sums[BIN_ALIAS] + sums[BIN_NOISE], sums[BIN_FUNDAMENTAL]);
+  metrics->alias = power_db(sums[BIN_ALIAS], sums[BIN_FUNDAMENTAL] + sums[BIN_HARMONIC]);
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Render Functions                                                        */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Play a case and capture AUDIO_TEST_FFT_LENGTH samples of its output
+ * @return Frequency of the held key in Hz
+ */
+static double render_case(const audio_case_t *test, float *samples)
+{
+  double f0 = midi_note_frequency(test->key) / 65536.0;
+
+  if (test->rate == 0)
+  {
+    // Checks the analysis itself, a sine the FFT tables must resolve far below the PWM noise
+    for (uint32_t n = 0; n < AUDIO_TEST_FFT_LENGTH; n++)
+      samples[n] = (float)(0.5 * sin(2.0 * M_PI * f0 * n / SAMPLE_FREQUENCY));
+    return f0;
+  }
+
+  uint32_t rate = board_host_init(test->rate);
+
+  for (uint8_t voice = 0; voice < VOICE_COUNT; voice++)
+  {
+    voice_set_waveform(voice, test->wave);
+    voice_pulse_width(voice, test->width);
+  }
+
+  for (uint8_t event = 0; event < test->event_count; event++)
+  {
+    uint32_t at = (uint32_t)((uint64_t)test->events[event].at_ms * rate / 1000);
+
+    if (at > board_host_timer.frames)
+      board_host_run(at - board_host_timer.frames);
+    board_host_midi(test->events[event].message, sizeof(test->events[event].message));
+  }
+
+  uint32_t settle = (uint32_t)((uint64_t)test->settle_ms * rate / 1000);
+
+  if (settle > board_host_timer.frames)
+    board_host_run(settle - board_host_timer.frames);
+
+  board_host_sink(frames, AUDIO_TEST_FFT_LENGTH);
+  board_host_run(AUDIO_TEST_FFT_LENGTH);
+
+  for (uint32_t n = 0; n < AUDIO_TEST_FFT_LENGTH; n++)
+    samples[n] = board_host_q15(frames[n * VOICE_COUNT + test->channel]) / 32768.0f;
+
+  return f0;
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Baseline Functions                                                      */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Look up the baseline of a case, one "name snr thdn alias" line per case, # comments
+ * @return 1 if found
+ */
+static int baseline_find(const char *path, const char *name, audio_metrics_t *baseline)
+{
+  FILE *file = fopen(path, "r");
+  char line[256];
+  char entry[64];
+  int found = 0;
+
+  if (!file)
+    return 0;
+
+  while (!found && fgets(line, sizeof(line), file))
+  {
+    if (line[0] == '#')
+      continue;
+
+    found = sscanf(line, "%63s %f %f %f", entry, &baseline->snr, &baseline->thdn, &baseline->alias) == 4 &&
+            strcmp(entry, name) == 0;
+  }
+
+  fclose(file);
+  return found;
+}
+
+static int baseline_write(const char *path, const audio_metrics_t *results)
+{
+  FILE *file = fopen(path, "w");
+
+  if (!file)
+    return 1;
+
+  fprintf(file, "# Golden-audio baseline of synth_audio_test, regenerate with --update\n");
+  fprintf(file, "# FFT %d, band up to %.0f Hz, figures in dB\n", AUDIO_TEST_FFT_LENGTH, AUDIO_BAND_HZ);
+  fprintf(file, "# %-14s %8s %8s %8s\n", "case", "snr", "thdn", "alias");
+
+  for (uint32_t c = 0; c < CASE_COUNT; c++)
+    fprintf(file, "%-16s %8.2f %8.2f %8.2f\n", cases[c].name, results[c].snr, results[c].thdn, results[c].alias);
+
+  return fclose(file) ? 1 : 0;
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Main                                                                    */
+/*                                                                            */
+/* ========================================================================== */
+
+int main(int argc, char **argv)
+{
+  const char *path = argc > 1 ? argv[1] : "audio_baseline.txt";
+  int update = argc > 2 && strcmp(argv[2], "--update") == 0;
+  audio_metrics_t results[CASE_COUNT];
+  int failures = 0;
+
+  if (arm_rfft_fast_init_f32(&fft, AUDIO_TEST_FFT_LENGTH) != ARM_MATH_SUCCESS)
+  {
+    fprintf(stderr, "synth_audio_test: no FFT tables for %d points\n", AUDIO_TEST_FFT_LENGTH);
+    return 1;
+  }
+
+  // 4-term Blackman-Harris, sidelobes at -92 dB keep the leakage under the PWM noise
+  for (uint32_t n = 0; n < AUDIO_TEST_FFT_LENGTH; n++)
+  {
+    double x = 2.0 * M_PI * n / AUDIO_TEST_FFT_LENGTH;
+    window[n] = (float)(0.35875 - 0.48829 * cos(x) + 0.14128 * cos(2.0 * x) - 0.01168 * cos(3.0 * x));
+  }
+
+  printf("%-16s %8s %8s %8s   %8s %8s %8s\n", "case", "snr", "thdn", "alias", "base", "base", "base");
+
+  for (uint32_t c = 0; c < CASE_COUNT; c++)
+  {
+    static float samples[AUDIO_TEST_FFT_LENGTH];
+    audio_metrics_t baseline;
+    int known = !update && baseline_find(path, cases[c].name, &baseline);
+    const char *verdict = "ok";
+
+    double f0 = render_case(&cases[c], samples);
+    analyze(samples, cases[c].rate ? sample_rate_get() : SAMPLE_FREQUENCY, f0, &results[c]);
+
+    if (update)
+      verdict = "updated";
+    else if (!known)
+    {
+      verdict = "FAIL no baseline";
+      failures++;
+    }
+    else if (results[c].snr < baseline.snr - TOLERANCE_SNR_DB ||
+             results[c].thdn > baseline.thdn + TOLERANCE_THDN_DB ||
+             results[c].alias > baseline.alias + TOLERANCE_ALIAS_DB)
+    {
+      verdict = "FAIL";
+      failures++;
+    }
+
+    printf("%-16s %8.2f %8.2f %8.2f", cases[c].name, results[c].snr, results[c].thdn, results[c].alias);
+    if (known)
+      printf("   %8.2f %8.2f %8.2f", baseline.snr, baseline.thdn, baseline.alias);
+    printf("   %s\n", verdict);
+  }
+
+  if (update && baseline_write(path, results))
+  {
+    fprintf(stderr, "synth_audio_test: cannot write %s\n", path);
+    return 1;
+  }
+
+  if (failures)
+    printf("%d of %u cases below their baseline\n", failures, (unsigned)CASE_COUNT);
+
+  return failures ? 1 : 0;
+}
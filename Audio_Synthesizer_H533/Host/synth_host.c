@@ -0,0 +1,148 @@
+/**
+ ******************************************************************************
+ * @file    synth_host.c
+ * @brief   Host Render of the Synthesis Core to a WAV File
+ * @author  Adrian Sucahyo, Kenneth Gordon, Bryant Watson, Hayoung In
+ ******************************************************************************
+ * @attention
+ *
+ * Copyright (c) 2025 Synthetic Bits.
+ * All rights reserved.
+ *
+ * This software is licensed under terms that can be found in the LICENSE file
+ * in the root directory of this software component.
+ * If no LICENSE file comes with this software, it is provided AS-IS.
+ *
+ ******************************************************************************
+ *
+ * Plays a chord through the MIDI queue, releases it halfway and writes every
+ * PWM channel of the sink as one channel of a 16-bit WAV file.
+ *
+ * Build and run from Audio_Synthesizer_H533:
+ *   cmake --preset Host && cmake --build --preset Host
+ *   ./build/Host/Host/synth_host chord.wav 2 48000
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "audio_config.h"
+#include "board_host.h"
+
+/* Function Prototypes -------------------------------------------------------*/
+
+static void write_u16(FILE *file, uint16_t value);
+static void write_u32(FILE *file, uint32_t value);
+static int write_wav(const char *path, const uint32_t *frames, uint32_t count, uint32_t rate);
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+static const uint8_t chord_on[] = {
+    0x90, 60, 100, // C4 on MIDI channel 1
+    0x91, 64, 100, // E4 on MIDI channel 2
+    0x92, 67, 100, // G4 on MIDI channel 3
+};
+
+static const uint8_t chord_off[] = {
+    0x80, 60, 0,
+    0x81, 64, 0,
+    0x82, 67, 0,
+};
+
+/* ========================================================================== */
+/*                                                                            */
+/*    WAV Functions                                                           */
+/*                                                                            */
+/* ========================================================================== */
+
+static void write_u16(FILE *file, uint16_t value)
+{
+  uint8_t bytes[2] = {(uint8_t)value, (uint8_t)(value >> 8)};
+
+  fwrite(bytes, 1, sizeof(bytes), file);
+}
+
+static void write_u32(FILE *file, uint32_t value)
+{
+  write_u16(file, (uint16_t)value);
+  write_u16(file, (uint16_t)(value >> 16));
+}
+
+/**
+ * @brief Write the frames as a PCM WAV file, one channel per PWM output
+ * @return 0 on success
+ */
+static int write_wav(const char *path, const uint32_t *frames, uint32_t count, uint32_t rate)
+{
+  FILE *file = fopen(path, "wb");
+
+  if (!file)
+    return 1;
+
+  uint32_t data_bytes = count * VOICE_COUNT * sizeof(int16_t);
+
+  fwrite("RIFF", 1, 4, file);
+  write_u32(file, 36 + data_bytes);
+  fwrite("WAVEfmt ", 1, 8, file);
+  write_u32(file, 16);                                    // Format chunk size
+  write_u16(file, 1);                                     // PCM
+  write_u16(file, VOICE_COUNT);                           // Channels
+  write_u32(file, rate);                                  // Sample rate
+  write_u32(file, rate * VOICE_COUNT * sizeof(int16_t));  // Byte rate
+  write_u16(file, VOICE_COUNT * sizeof(int16_t));         // Block align
+  write_u16(file, 16);                                    // Bits per sample
+  fwrite("data", 1, 4, file);
+  write_u32(file, data_bytes);
+
+  for (uint32_t n = 0; n < count * VOICE_COUNT; n++)
+    write_u16(file, (uint16_t)board_host_q15(frames[n]));
+
+  return fclose(file) ? 1 : 0;
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Main                                                                    */
+/*                                                                            */
+/* ========================================================================== */
+
+int main(int argc, char **argv)
+{
+  const char *path = argc > 1 ? argv[1] : "synth_host.wav";
+  double seconds = argc > 2 ? atof(argv[2]) : 2.0;
+  uint32_t rate = board_host_init(argc > 3 ? (uint32_t)atoi(argv[3]) : SAMPLE_FREQUENCY);
+
+  uint32_t total = (uint32_t)(seconds * rate);
+  uint32_t *frames = malloc((size_t)total * VOICE_COUNT * sizeof(uint32_t));
+
+  if (!frames || total == 0)
+  {
+    fprintf(stderr, "synth_host: nothing to render\n");
+    return 1;
+  }
+
+  board_host_sink(frames, total);
+
+  board_host_midi(chord_on, sizeof(chord_on));
+  board_host_run(total / 2);
+  board_host_midi(chord_off, sizeof(chord_off));
+  uint32_t count = board_host_run(total - total / 2);
+
+  if (write_wav(path, frames, count, rate))
+  {
+    fprintf(stderr, "synth_host: cannot write %s\n", path);
+    free(frames);
+    return 1;
+  }
+
+  printf("%s: %u frames, %u channels at %u Hz\n", path, (unsigned)count, VOICE_COUNT, (unsigned)rate);
+  free(frames);
+  return 0;
+}
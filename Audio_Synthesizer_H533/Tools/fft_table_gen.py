@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""
+FFT Table Generator
+
+Generates the floating-point tables arm_rfft_fast_f32() needs for one real
+FFT length. The vendored CMSIS-DSP ships without CommonTables/
+arm_common_tables.c, this file stands in for the part of it the host tests
+use. The names and sizes match the declarations of arm_common_tables.h, the
+build selects them with ARM_DSP_CONFIG_TABLES:
+  twiddleCoef_<N/2>         - complex FFT twiddles, cos / sin interleaved
+  twiddleCoef_rfft_<N>      - real FFT split twiddles, sin / cos interleaved
+  armBitRevIndexTable<N/2>  - swaps reordering the radix-8 output
+
+The complex FFT is a radix-8 decimation in frequency, after a radix-2 or
+radix-4 first stage when log2(N/2) is not a multiple of 3. Its output comes
+out in mixed-radix digit reversed order, the table lists the swaps (byte
+offsets of complex floats) that undo it, one cycle of the permutation at a time.
+
+Usage: fft_table_gen.py --length 4096 --output fft_tables.c
+"""
+
+import argparse
+import math
+
+
+def radices(length):
+    """Radix of each stage of the complex FFT, first stage first"""
+    stages = []
+    bits = length.bit_length() - 1
+    if bits % 3:
+        stages.append(1 << (bits % 3))
+    stages.extend([8] * (bits // 3))
+    return stages
+
+
+def digit_reversal(length):
+    """Source index of each output of the complex FFT"""
+    order = []
+    for index in range(length):
+        rest = index
+        source = 0
+        for radix in radices(length):
+            source = source * radix + rest % radix
+            rest //= radix
+        order.append(source)
+    return order
+
+
+def bit_reversal_swaps(length):
+    """Swaps applying the permutation in place, in byte offsets of complex floats"""
+    order = digit_reversal(length)
+    swaps = []
+    for index in range(length):
+        source = order[index]
+        while source < index: # Already moved by an earlier swap of its cycle, follow it
+            source = order[source]
+        if source != index:
+            swaps.extend((index * 8, source * 8))
+    return swaps
+
+
+def cfft_twiddles(length):
+    table = []
+    for i in range(length):
+        table.extend((math.cos(2.0 * math.pi * i / length), math.sin(2.0 * math.pi * i / length)))
+    return table
+
+
+def rfft_twiddles(length):
+    table = []
+    for i in range(length // 2):
+        table.extend((math.sin(2.0 * math.pi * i / length), math.cos(2.0 * math.pi * i / length)))
+    return table
+
+
+def emit_floats(out, name, values):
+    out.write("const float32_t %s[%d] = {\n" % (name, len(values)))
+    for i in range(0, len(values), 4):
+        out.write("    " + ", ".join("%.9ff" % v for v in values[i:i + 4]) + ",\n")
+    out.write("};\n\n")
+
+
+def emit_swaps(out, name, swaps):
+    # Unsized, the compiler rejects a count differing from the TABLE_LENGTH of arm_common_tables.h
+    out.write("const uint16_t %s[] = {\n" % name)
+    for i in range(0, len(swaps), 12):
+        out.write("    " + ", ".join("%d" % s for s in swaps[i:i + 12]) + ",\n")
+    out.write("};\n\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the CMSIS-DSP real FFT tables of one length")
+    parser.add_argument("--length", type=int, default=4096, choices=[64, 128, 256, 512, 1024, 2048, 4096],
+                        help="Real FFT length")
+    parser.add_argument("--output", required=True, help="Source to generate")
+    args = parser.parse_args()
+
+    half = args.length // 2
+
+    with open(args.output, "w") as out:
+        out.write("/* %s - Generated by Tools/fft_table_gen.py, do not edit */\n\n" % args.output.split("/")[-1])
+        out.write("#include \"arm_common_tables.h\"\n\n")
+        emit_floats(out, "twiddleCoef_%d" % half, cfft_twiddles(half))
+        emit_floats(out, "twiddleCoef_rfft_%d" % args.length, rfft_twiddles(args.length))
+        emit_swaps(out, "armBitRevIndexTable%d" % half, bit_reversal_swaps(half))
+
+
+if __name__ == "__main__":
+    main()
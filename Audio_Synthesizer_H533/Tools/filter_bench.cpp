@@ -0,0 +1,123 @@
+/**
+ ******************************************************************************
+ * @file    filter_bench.cpp
+ * @brief   Host Benchmark of the Voice Filters
+ ******************************************************************************
+ *
+ * Renders every virtual voice into a mixer block as voice_bank_render_q15()
+ * does, with the filter off, low-pass and band-pass, and moves the cutoff of
+ * each voice every block like the modulation matrix does. Prints the cost per
+ * voice-sample of each mode and how many voices fit in the render budget of
+ * one sample period at SAMPLE_FREQUENCY on the machine running the bench.
+ *
+ * The filtered / unfiltered ratio carries over to the target, the absolute
+ * voice counts do not. Pass the unfiltered cost measured on the board
+ * (channel_get_voice_cycles() / AUDIO_BLOCK_SIZE) to project the voice counts
+ * of the target:
+ *   ./filter_bench 18
+ *
+ * Built by the host build (see Host/CMakeLists.txt), from Audio_Synthesizer_H533:
+ *   cmake --preset Host && cmake --build --preset Host --target filter_bench
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "audio_config.h"
+#include "channel_common.h"
+#include "filter.h"
+#include "gain.h"
+#include "voice_bank.h"
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+#define BENCH_BLOCKS 20000
+#define BENCH_BUDGET 0.75          // Share of a sample period given to the voices, the rest is left to the mix and control
+#define BENCH_CORE_CLOCK 250000000 // Target core clock in Hz
+
+static const char *const mode_names[] = {"off", "low-pass", "band-pass"};
+
+static int16_t block[AUDIO_BLOCK_SIZE * VOICE_BANK_VOICES];
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Benchmark Functions                                                     */
+/*                                                                            */
+/* ========================================================================== */
+
+static double now_ns()
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * @brief Time every voice through one filter mode
+ * @return Cost per voice-sample in ns
+ */
+static double bench_mode(filter_mode_t mode)
+{
+  voice_bank_init();
+
+  for (uint8_t voice = 0; voice < VOICE_BANK_VOICES; voice++)
+  {
+    voice_enable(voice, 1);
+    voice_set_waveform(voice, WAVEFORM_RAMP);
+    voice_frequency(voice, CHANNEL_FREQ_Q16(110.0f * (voice + 1)));
+    voice_filter(voice, mode, 60 + voice, 100);
+    voice_on_off(voice, 1);
+  }
+
+  double start = now_ns();
+  for (uint32_t n = 0; n < BENCH_BLOCKS; n++)
+  {
+    int32_t sweep = (int32_t)((n * 97) & 0xFFFF) - 0x8000; // A new cutoff every block
+
+    voice_bank_control();
+    for (uint8_t voice = 0; voice < VOICE_BANK_VOICES; voice++)
+    {
+      voice_modulate(voice, 0x1 << 16, GAIN_UNITY, sweep, 0);
+      voice_bank_render_q15(voice, block, AUDIO_BLOCK_SIZE, VOICE_BANK_VOICES);
+    }
+  }
+  double elapsed = now_ns() - start;
+
+  return elapsed / ((double)BENCH_BLOCKS * AUDIO_BLOCK_SIZE * VOICE_BANK_VOICES);
+}
+
+int main(int argc, char **argv)
+{
+  double budget_ns = BENCH_BUDGET * 1e9 / SAMPLE_FREQUENCY;
+  double budget_cycles = BENCH_BUDGET * BENCH_CORE_CLOCK / SAMPLE_FREQUENCY;
+  double target_cycles = argc > 1 ? atof(argv[1]) : 0.0; // Unfiltered cycles per voice-sample on the target
+  double unfiltered = 0.0;
+
+  printf("Per voice-sample, %d voices, %d blocks of %d samples, cutoff moved every block\n", VOICE_BANK_VOICES,
+         BENCH_BLOCKS, AUDIO_BLOCK_SIZE);
+
+  for (int mode = FILTER_OFF; mode <= FILTER_BAND_PASS; mode++)
+  {
+    double ns = bench_mode((filter_mode_t)mode);
+
+    if (mode == FILTER_OFF)
+      unfiltered = ns;
+
+    printf("%-10s %6.3f ns  x%4.2f  %6.0f voices in %.0f%% of a sample period", mode_names[mode], ns,
+           ns / unfiltered, budget_ns / ns, BENCH_BUDGET * 100);
+    if (target_cycles > 0.0)
+      printf("  target %4.0f voices", budget_cycles / (target_cycles * ns / unfiltered));
+    printf("\n");
+  }
+
+  return 0;
+}
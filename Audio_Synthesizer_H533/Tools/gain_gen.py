@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+"""
+Gain Table Generator
+
+Generates the volume law used by gain.c, one Q16 linear gain per MIDI value.
+Value 127 is unity, every step below falls by the same number of decibels so
+that --range dB separates values 1 and 127, value 0 is silent.
+
+Usage: gain_gen.py --range 48 --output gain_data.h
+"""
+
+import argparse
+
+MIDI_MAX = 127
+Q16_ONE = 1 << 16
+
+
+def gain_q16(value, range_db):
+    if value == 0:
+        return 0
+    db = -range_db * (MIDI_MAX - value) / (MIDI_MAX - 1)
+    return int(round(Q16_ONE * 10.0 ** (db / 20.0)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the MIDI volume gain table")
+    parser.add_argument("--range", type=float, default=48.0, help="Attenuation of value 1 below value 127 in dB")
+    parser.add_argument("--output", required=True, help="Header to generate")
+    args = parser.parse_args()
+
+    table = [gain_q16(value, args.range) for value in range(MIDI_MAX + 1)]
+
+    with open(args.output, "w") as out:
+        out.write("/* %s - Generated by Tools/gain_gen.py, do not edit */\n\n" % args.output.split("/")[-1])
+        out.write("#ifndef _GAIN_DATA_H_\n#define _GAIN_DATA_H_\n\n")
+        out.write("#define GAIN_RANGE_DB %g\n\n" % args.range)
+        out.write("static const int32_t gain_table[%d] = {\n" % len(table))
+        for i in range(0, len(table), 12):
+            out.write("    " + ", ".join("%d" % g for g in table[i:i + 12]) + ",\n")
+        out.write("};\n\n")
+        out.write("#endif /* _GAIN_DATA_H_ */\n")
+
+
+if __name__ == "__main__":
+    main()
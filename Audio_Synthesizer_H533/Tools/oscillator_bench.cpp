@@ -0,0 +1,113 @@
+/**
+ ******************************************************************************
+ * @file    oscillator_bench.cpp
+ * @brief   Host Benchmark of the Oscillator Kernels against the C Render Loop
+ ******************************************************************************
+ *
+ * Renders the same voices through the C loop in voice_bank.c (built with
+ * OSCILLATOR_KERNELS=0) and through the kernels of oscillator.hpp, checks that
+ * both produce identical frames and prints the cost of each per voice-sample.
+ *
+ * Built by the host build (see Host/CMakeLists.txt), from Audio_Synthesizer_H533:
+ *   cmake --preset Host && cmake --build --preset Host --target oscillator_bench
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "audio_config.h"
+#include "channel_common.h"
+#include "oscillator.h"
+#include "voice_bank.h"
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+#define BENCH_BLOCKS 200000
+
+static const char *const wave_names[] = {"sine", "trig", "ramp", "square"};
+
+static uint32_t c_frames[AUDIO_BLOCK_SIZE * VOICE_COUNT];
+static uint32_t kernel_frames[AUDIO_BLOCK_SIZE * VOICE_COUNT];
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Benchmark Functions                                                     */
+/*                                                                            */
+/* ========================================================================== */
+
+static double now_ns()
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * @brief Time one waveform through both paths
+ * @return 0 if the frames of both paths match
+ */
+static int bench_waveform(waveforms_t wave)
+{
+  voice_bank_init();
+  voice_enable(CHANNEL1, 1);
+  voice_set_waveform(CHANNEL1, wave);
+  voice_frequency(CHANNEL1, CHANNEL_FREQ_Q16(440.0f));
+  voice_volume(CHANNEL1, 100);
+  voice_envelope(CHANNEL1, 0, 0, MIDI_MAX_VAL, 0);
+  voice_on_off(CHANNEL1, 1);
+
+  // Let the envelope and the gain ramp settle, then both paths render at a constant gain
+  voice_bank_control();
+  voice_bank_render_voice(CHANNEL1, c_frames, AUDIO_BLOCK_SIZE, VOICE_COUNT);
+  voice_bank_control();
+  voice_bank_render_voice(CHANNEL1, c_frames, AUDIO_BLOCK_SIZE, VOICE_COUNT);
+
+  oscillator_kernel_t kernel = oscillator_kernel(wave);
+  uint32_t phase_inc = voice_bank.phase_inc[CHANNEL1];
+  const wavetable_level_t *level = wavetable_select(voice_bank.wavetable[CHANNEL1], phase_inc);
+  int32_t gain = voice_bank.gain[CHANNEL1];
+  uint32_t phase = voice_bank.phase[CHANNEL1];
+
+  // C path, the voice bank render loop
+  double start = now_ns();
+  for (uint32_t block = 0; block < BENCH_BLOCKS; block++)
+    voice_bank_render_voice(CHANNEL1, c_frames, AUDIO_BLOCK_SIZE, VOICE_COUNT);
+  double c_ns = now_ns() - start;
+
+  // Kernel path, the same voice through the specialized kernel
+  start = now_ns();
+  for (uint32_t block = 0; block < BENCH_BLOCKS; block++)
+    phase = kernel(level, phase, phase_inc, voice_bank.pulse_width[CHANNEL1], gain, 0, kernel_frames, AUDIO_BLOCK_SIZE, VOICE_COUNT);
+  double kernel_ns = now_ns() - start;
+
+  int mismatch = (phase != voice_bank.phase[CHANNEL1]);
+  for (uint32_t n = 0; n < AUDIO_BLOCK_SIZE; n++)
+    mismatch |= (c_frames[n * VOICE_COUNT] != kernel_frames[n * VOICE_COUNT]);
+
+  double samples = (double)BENCH_BLOCKS * AUDIO_BLOCK_SIZE;
+  printf("%-8s C %6.3f ns  kernel %6.3f ns  speedup %4.2fx  %s\n", wave_names[wave],
+         c_ns / samples, kernel_ns / samples, c_ns / kernel_ns, mismatch ? "MISMATCH" : "match");
+
+  return mismatch;
+}
+
+int main()
+{
+  int failed = 0;
+
+  printf("Per voice-sample, %d blocks of %d samples\n", BENCH_BLOCKS, AUDIO_BLOCK_SIZE);
+
+  for (int wave = WAVEFORM_SINE; wave <= WAVEFORM_SQUARE; wave++)
+    failed |= bench_waveform((waveforms_t)wave);
+
+  return failed;
+}
\ No newline at end of file
@@ -0,0 +1,381 @@
+/**
+ ******************************************************************************
+ * @file    synth_bench.cpp
+ * @brief   Host Benchmark of every Stage of the Render Path
+ ******************************************************************************
+ *
+ * Times each stage of synth_render() and synth_control() on its own as the
+ * voice count grows from 1 to VOICE_BANK_VOICES (64 in the bench build):
+ *   oscillator - each waveform through voice_bank_render_q15() at a held gain
+ *   volume     - the sine with the gain ramping every block (volume changes)
+ *   filter     - the ramp through the low-pass and the band-pass filter
+ *   mix        - mixer_mix() of the rendered voices into the PWM outputs
+ *   control    - synth_control(), the LFOs, modulation matrix and envelopes
+ *   render     - the whole synth_render() with every effect on
+ *   effects    - each effect alone and the chain, on one send (no voice count)
+ *
+ * Every stage reports ns per frame (one sample of every output), ns per voice
+ * sample, frames per second and that rate over the sample rate. The table goes
+ * to stdout, the same results to a JSON file for comparing two commits:
+ *   synth_bench [--json synth_bench.json] [--time 50] [--label text]
+ *
+ * Built from the sources of the firmware by the host build (see Host/):
+ *   cmake --preset Host && cmake --build --preset Host --target bench
+ *
+ * The mixer sums every one of MIXER_VOICE_COUNT voices whatever the number in
+ * use, the mix and render costs follow the capacity the bench is built with.
+ *
+ ******************************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "audio_config.h"
+#include "channel_common.h"
+#include "effects.h"
+#include "filter.h"
+#include "gain.h"
+#include "mixer.h"
+#include "sample_rate.h"
+#include "synth.h"
+#include "voice_bank.h"
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Local Variables Definitions                                             */
+/*                                                                            */
+/* ========================================================================== */
+
+#define BENCH_BATCH 16    // Calls between two clock reads
+#define BENCH_TIME_MS 50  // Default time spent on each measurement
+#define BENCH_RESULTS 256 // Room for every stage, variant and voice count
+
+#if !AUDIO_MIXER || !AUDIO_EFFECTS
+#error "The bench times the mixer and the effects bus, build it with AUDIO_MIXER and AUDIO_EFFECTS"
+#endif
+
+/**
+ * @brief One stage to time
+ */
+typedef struct
+{
+  const char *stage;                      // Part of the render path
+  const char *variant;                    // Waveform, filter mode or effect
+  void (*setup)(uint8_t voices, int arg); // Voices, routes and effects before timing
+  void (*run)(uint8_t voices);            // One call, frames frames of audio
+  int arg;                                // Passed to setup
+  uint16_t frames;                        // Frames of audio per call of run
+  uint8_t scales;                         // 1 if the stage is timed at every voice count
+} bench_case_t;
+
+typedef struct
+{
+  const char *stage;
+  const char *variant;
+  uint8_t voices;
+  double ns_per_frame;
+  double ns_per_voice_sample;
+  double frames_per_sec;
+  double realtime;
+} bench_result_t;
+
+static uint32_t frames[AUDIO_BLOCK_SIZE * VOICE_COUNT];
+static int16_t send[AUDIO_BLOCK_SIZE];
+static int16_t left[AUDIO_BLOCK_SIZE];
+static int16_t right[AUDIO_BLOCK_SIZE];
+static uint32_t ramp_block; // Blocks rendered by run_volume(), flips the gain target
+
+static bench_result_t results[BENCH_RESULTS];
+static uint16_t result_count;
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Setup Functions                                                         */
+/*                                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Start the first voices on a held note, each routed to a PWM output and the effects send
+ */
+static void setup_voices(uint8_t voices, waveforms_t wave)
+{
+  synth_init();
+
+  for (uint8_t voice = 0; voice < voices; voice++)
+  {
+    voice_enable(voice, 1);
+    voice_set_waveform(voice, wave);
+    voice_frequency(voice, CHANNEL_FREQ_Q16(110.0f * (voice % 32 + 1)));
+    voice_volume(voice, 100);
+    voice_envelope(voice, 0, 0, MIDI_MAX_VAL, 0);
+    voice_on_off(voice, 1);
+
+    mixer_route(voice, voice % VOICE_COUNT, MIXER_GAIN_UNITY / voices);
+    mixer_route(voice, MIXER_OUTPUT_FX, MIXER_GAIN_UNITY / voices);
+  }
+
+  // Let the envelopes and the gain ramps settle
+  for (uint8_t tick = 0; tick < 2; tick++)
+  {
+    synth_control();
+    for (uint8_t voice = 0; voice < voices; voice++)
+      mixer_render_voice(voice, AUDIO_BLOCK_SIZE);
+  }
+}
+
+static void setup_oscillator(uint8_t voices, int wave)
+{
+  setup_voices(voices, (waveforms_t)wave);
+}
+
+static void setup_filter(uint8_t voices, int mode)
+{
+  setup_voices(voices, WAVEFORM_RAMP);
+
+  for (uint8_t voice = 0; voice < voices; voice++)
+    voice_filter(voice, (filter_mode_t)mode, 60 + voice % 40, 100);
+}
+
+static void setup_render(uint8_t voices, int arg)
+{
+  (void)arg;
+  setup_voices(voices, WAVEFORM_SINE);
+
+  for (uint8_t output = 0; output < VOICE_COUNT; output++)
+    mixer_return(output, MIXER_GAIN_UNITY / 4, MIXER_GAIN_UNITY / 4);
+  for (uint8_t effect = 0; effect < EFFECT_COUNT; effect++)
+    effects_enable((effect_t)effect, 1);
+}
+
+/**
+ * @brief One effect on (the whole chain with EFFECT_COUNT), a ramp on the send
+ */
+static void setup_effects(uint8_t voices, int effect)
+{
+  (void)voices;
+  synth_init();
+
+  for (uint8_t each = 0; each < EFFECT_COUNT; each++)
+    effects_enable((effect_t)each, effect == EFFECT_COUNT || effect == each);
+
+  for (uint16_t n = 0; n < AUDIO_BLOCK_SIZE; n++)
+    send[n] = (int16_t)((n * 2048) - 0x8000); // One ramp period per block
+}
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Run Functions                                                           */
+/*                                                                            */
+/* ========================================================================== */
+
+static void run_oscillator(uint8_t voices)
+{
+  for (uint8_t voice = 0; voice < voices; voice++)
+    mixer_render_voice(voice, AUDIO_BLOCK_SIZE);
+}
+
+/**
+ * @brief Render with a new gain target every block, as a volume change or an envelope does
+ */
+static void run_volume(uint8_t voices)
+{
+  int32_t target = (ramp_block++ & 0x1) ? gain_from_midi(60) : gain_from_midi(120);
+
+  for (uint8_t voice = 0; voice < voices; voice++)
+  {
+    voice_bank.gain_target[voice] = target;
+    mixer_render_voice(voice, AUDIO_BLOCK_SIZE);
+  }
+}
+
+static void run_mix(uint8_t voices)
+{
+  (void)voices;
+  mixer_mix(frames, AUDIO_BLOCK_SIZE);
+}
+
+static void run_control(uint8_t voices)
+{
+  (void)voices;
+  synth_control();
+}
+
+static void run_render(uint8_t voices)
+{
+  (void)voices;
+  synth_render(frames, AUDIO_BLOCK_SIZE);
+}
+
+static void run_effects(uint8_t voices)
+{
+  (void)voices;
+  effects_process(send, left, right, AUDIO_BLOCK_SIZE);
+}
+
+static const bench_case_t cases[] = {
+    {"oscillator", "sine", setup_oscillator, run_oscillator, WAVEFORM_SINE, AUDIO_BLOCK_SIZE, 1},
+    {"oscillator", "trig", setup_oscillator, run_oscillator, WAVEFORM_TRIG, AUDIO_BLOCK_SIZE, 1},
+    {"oscillator", "ramp", setup_oscillator, run_oscillator, WAVEFORM_RAMP, AUDIO_BLOCK_SIZE, 1},
+    {"oscillator", "square", setup_oscillator, run_oscillator, WAVEFORM_SQUARE, AUDIO_BLOCK_SIZE, 1},
+    {"volume", "ramped", setup_oscillator, run_volume, WAVEFORM_SINE, AUDIO_BLOCK_SIZE, 1},
+    {"filter", "low-pass", setup_filter, run_oscillator, FILTER_LOW_PASS, AUDIO_BLOCK_SIZE, 1},
+    {"filter", "band-pass", setup_filter, run_oscillator, FILTER_BAND_PASS, AUDIO_BLOCK_SIZE, 1},
+    {"mix", "outputs", setup_oscillator, run_mix, WAVEFORM_SINE, AUDIO_BLOCK_SIZE, 1},
+    {"control", "tick", setup_oscillator, run_control, WAVEFORM_SINE, CONTROL_TICK_SAMPLES, 1},
+    {"render", "block", setup_render, run_render, 0, AUDIO_BLOCK_SIZE, 1},
+    {"effects", "chorus", setup_effects, run_effects, EFFECT_CHORUS, AUDIO_BLOCK_SIZE, 0},
+    {"effects", "delay", setup_effects, run_effects, EFFECT_DELAY, AUDIO_BLOCK_SIZE, 0},
+    {"effects", "reverb", setup_effects, run_effects, EFFECT_REVERB, AUDIO_BLOCK_SIZE, 0},
+    {"effects", "chain", setup_effects, run_effects, EFFECT_COUNT, AUDIO_BLOCK_SIZE, 0},
+};
+
+/* ========================================================================== */
+/*                                                                            */
+/*    Benchmark Functions                                                     */
+/*                                                                            */
+/* ========================================================================== */
+
+static double now_ns()
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * @brief Time a stage at a voice count, in batches until time_ns has passed
+ */
+static void bench_case(const bench_case_t *bench, uint8_t voices, double time_ns)
+{
+  bench->setup(voices, bench->arg);
+  bench->run(voices); // Warm the caches
+
+  uint64_t calls = 0;
+  double start = now_ns();
+  double elapsed;
+
+  do
+  {
+    for (uint8_t n = 0; n < BENCH_BATCH; n++)
+      bench->run(voices);
+    calls += BENCH_BATCH;
+    elapsed = now_ns() - start;
+  } while (elapsed < time_ns);
+
+  if (result_count >= BENCH_RESULTS)
+    return;
+
+  bench_result_t *result = &results[result_count++];
+
+  result->stage = bench->stage;
+  result->variant = bench->variant;
+  result->voices = bench->scales ? voices : 0;
+  result->ns_per_frame = elapsed / ((double)calls * bench->frames);
+  result->ns_per_voice_sample = bench->scales ? result->ns_per_frame / voices : result->ns_per_frame;
+  result->frames_per_sec = 1e9 / result->ns_per_frame;
+  result->realtime = result->frames_per_sec / sample_rate_get();
+
+  printf("%-10s %-9s %2u voices  %9.3f ns/frame  %7.3f ns/voice-sample  %12.0f frames/s  %8.1fx realtime\n",
+         result->stage, result->variant, result->voices, result->ns_per_frame, result->ns_per_voice_sample,
+         result->frames_per_sec, result->realtime);
+}
+
+/**
+ * @brief Write a JSON string, quotes and backslashes escaped
+ */
+static void json_string(FILE *file, const char *text)
+{
+  fputc('"', file);
+  for (; *text; text++)
+  {
+    if (*text == '"' || *text == '\\')
+      fputc('\\', file);
+    fputc(*text, file);
+  }
+  fputc('"', file);
+}
+
+/**
+ * @brief Write every result and the build it came from
+ * @return 0 on success
+ */
+static int bench_json(const char *path, const char *label)
+{
+  FILE *file = fopen(path, "w");
+
+  if (!file)
+    return 1;
+
+  fprintf(file, "{\n");
+  fprintf(file, "  \"label\": ");
+  json_string(file, label);
+  fprintf(file, ",\n  \"compiler\": ");
+  json_string(file, __VERSION__);
+  fprintf(file, ",\n");
+  fprintf(file, "  \"sample_rate\": %u,\n", (unsigned)sample_rate_get());
+  fprintf(file, "  \"block_size\": %u,\n", (unsigned)AUDIO_BLOCK_SIZE);
+  fprintf(file, "  \"control_tick_samples\": %u,\n", (unsigned)CONTROL_TICK_SAMPLES);
+  fprintf(file, "  \"mixer_voice_count\": %u,\n", (unsigned)MIXER_VOICE_COUNT);
+  fprintf(file, "  \"oscillator_kernels\": %u,\n", (unsigned)OSCILLATOR_KERNELS);
+  fprintf(file, "  \"results\": [\n");
+
+  for (uint16_t n = 0; n < result_count; n++)
+  {
+    const bench_result_t *result = &results[n];
+
+    fprintf(file,
+            "    {\"stage\": \"%s\", \"variant\": \"%s\", \"voices\": %u, \"ns_per_frame\": %.4f, "
+            "\"ns_per_voice_sample\": %.4f, \"frames_per_sec\": %.0f, \"realtime\": %.2f}%s\n",
+            result->stage, result->variant, result->voices, result->ns_per_frame, result->ns_per_voice_sample,
+            result->frames_per_sec, result->realtime, n + 1 < result_count ? "," : "");
+  }
+
+  fprintf(file, "  ]\n}\n");
+  return fclose(file) ? 1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+  const char *json = "synth_bench.json";
+  const char *label = "";
+  double time_ns = BENCH_TIME_MS * 1e6;
+
+  for (int n = 1; n + 1 < argc; n += 2)
+  {
+    if (!strcmp(argv[n], "--json"))
+      json = argv[n + 1];
+    else if (!strcmp(argv[n], "--time"))
+      time_ns = atof(argv[n + 1]) * 1e6;
+    else if (!strcmp(argv[n], "--label"))
+      label = argv[n + 1];
+  }
+
+  printf("%u Hz, blocks of %u frames, %u voices built in\n", (unsigned)sample_rate_get(), AUDIO_BLOCK_SIZE,
+         VOICE_BANK_VOICES);
+
+  for (const bench_case_t &bench : cases)
+  {
+    if (!bench.scales)
+    {
+      bench_case(&bench, 0, time_ns);
+      continue;
+    }
+
+    for (uint16_t voices = 1; voices <= VOICE_BANK_VOICES; voices *= 2)
+      bench_case(&bench, (uint8_t)voices, time_ns);
+  }
+
+  if (bench_json(json, label))
+  {
+    fprintf(stderr, "synth_bench: cannot write %s\n", json);
+    return 1;
+  }
+
+  printf("Results written to %s\n", json);
+  return 0;
+}
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""
+Wavetable Generator
+
+Generates the compact Q15 wavetables used by wavetable.c. Every table holds
+2^bits samples plus one guard sample so the interpolating lookup never has to
+wrap its index. The sine table only holds the first quarter-wave, the lookup
+rebuilds the other three quarters through symmetry.
+
+The triangle and ramp are band-limited mipmaps built by additive synthesis,
+one level per octave of phase increment. Level l serves phase increments in
+[2^(base + l), 2^(base + l + 1)) and keeps 2^(30 - base - l) harmonics, so no
+harmonic can pass the Nyquist frequency whatever the sample rate. Higher
+levels hold fewer harmonics and so need fewer samples, each level is shortened
+down to --oversample samples per period of its top harmonic. The square and
+the narrower pulses are the difference of two ramp reads, no table of their own.
+
+Usage: wavetable_gen.py --bits 11 --output wavetable_data.h
+"""
+
+import argparse
+import math
+
+Q15_MAX = 32767
+
+
+def q15(value):
+    return max(-Q15_MAX - 1, min(Q15_MAX, int(round(value * Q15_MAX))))
+
+
+def sine_quarter(length):
+    # length + 1 samples spanning [0, pi/2], the guard sample is sin(pi/2)
+    return [q15(math.sin(0.5 * math.pi * i / length)) for i in range(length + 1)]
+
+
+def triangle_harmonic(n):
+    # Odd cosines falling at 1/n^2, starts at the minimum and peaks half way
+    return (-8.0 / (math.pi * math.pi * n * n), 0.0) if n & 1 else (0.0, 0.0)
+
+
+def ramp_harmonic(n):
+    # Every sine falling at 1/n, rises from the minimum to the maximum
+    return (0.0, -2.0 / (math.pi * n))
+
+
+def additive(harmonic, harmonics, length):
+    """Sum the harmonics over one period of length samples
+
+    The sigma factors (Lanczos) taper the top harmonics to tame the Gibbs
+    ringing at the discontinuities.
+    """
+    cos_table = [math.cos(2.0 * math.pi * i / length) for i in range(length)]
+    sin_table = [math.sin(2.0 * math.pi * i / length) for i in range(length)]
+    wave = [0.0] * length
+
+    for n in range(1, harmonics + 1):
+        a, b = harmonic(n)
+        if a == 0.0 and b == 0.0:
+            continue
+        x = math.pi * n / (harmonics + 1)
+        sigma = math.sin(x) / x
+        a *= sigma
+        b *= sigma
+        for i in range(length):
+            k = (n * i) % length
+            wave[i] += a * cos_table[k] + b * sin_table[k]
+
+    return wave
+
+
+def mipmap(harmonic, bits, base, levels, oversample, min_bits):
+    """Build every level of a band-limited wave, normalized to a shared peak"""
+    waves = []
+    for level in range(levels):
+        harmonics = 1 << (30 - base - level)
+        length = min(1 << bits, max(1 << min_bits, harmonics * oversample))
+        harmonics = min(harmonics, length // 2 - 1)
+        waves.append(additive(harmonic, harmonics, length))
+
+    # One scale for every level so the loudness doesn't step between octaves
+    peak = max(max(abs(s) for s in wave) for wave in waves)
+    tables = []
+    for wave in waves:
+        samples = [q15(s / peak) for s in wave]
+        samples.append(samples[0]) # Guard sample wraps back to the start
+        tables.append(samples)
+
+    return tables
+
+
+def emit_table(out, name, samples):
+    out.write("static const int16_t %s[%d] AUDIO_RAMDATA = {\n" % (name, len(samples)))
+    for i in range(0, len(samples), 16):
+        out.write("    " + ", ".join("%d" % s for s in samples[i:i + 16]) + ",\n")
+    out.write("};\n\n")
+
+
+def emit_mipmap(out, name, tables):
+    for level, samples in enumerate(tables):
+        emit_table(out, "%s_level%d" % (name, level), samples)
+
+    out.write("static const wavetable_level_t %s_levels[%d] = {\n" % (name, len(tables)))
+    for level, samples in enumerate(tables):
+        out.write("    {%s_level%d, %d, 0},\n" % (name, level, (len(samples) - 1).bit_length() - 1))
+    out.write("};\n\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the compact Q15 wavetables")
+    parser.add_argument("--bits", type=int, default=11, help="log2 of the full-wave table length")
+    parser.add_argument("--oversample", type=int, default=8, help="Samples per period of the top harmonic of a level")
+    parser.add_argument("--min-bits", type=int, default=8, help="log2 of the shortest mip level")
+    parser.add_argument("--output", required=True, help="Header to generate")
+    args = parser.parse_args()
+
+    quarter_bits = args.bits - 2
+
+    # The first level keeps every harmonic the full table can hold, the last a lone fundamental
+    base = 31 - args.bits
+    levels = 31 - base
+
+    with open(args.output, "w") as out:
+        out.write("/* %s - Generated by Tools/wavetable_gen.py, do not edit */\n\n" % args.output.split("/")[-1])
+        out.write("#ifndef _WAVETABLE_DATA_H_\n#define _WAVETABLE_DATA_H_\n\n")
+        out.write("#define WAVETABLE_BITS %d\n" % args.bits)
+        out.write("#define WAVETABLE_QUARTER_BITS %d\n" % quarter_bits)
+        out.write("#define WAVETABLE_MIP_BASE %d\n" % base)
+        out.write("#define WAVETABLE_MIP_LEVELS %d\n\n" % levels)
+        # The samples are read at random strides by the render kernels, the firmware keeps them in SRAM
+        out.write("#ifndef AUDIO_RAMDATA\n#define AUDIO_RAMDATA\n#endif\n\n")
+        emit_table(out, "sine_quarter", sine_quarter(1 << quarter_bits))
+        for name, harmonic in (("trig", triangle_harmonic), ("ramp", ramp_harmonic)):
+            emit_mipmap(out, name, mipmap(harmonic, args.bits, base, levels, args.oversample, args.min_bits))
+        out.write("#endif /* _WAVETABLE_DATA_H_ */\n")
+
+
+if __name__ == "__main__":
+    main()
\ No newline at end of file
@@ -40,6 +40,13 @@ defined in linker script */
 .word	_sdata
 /* end address for the .data section. defined in linker script */
 .word	_edata
+/* start, end and load addresses of the .ramfunc and .ramdata sections. defined in linker script */
+.word	_sramfunc
+.word	_eramfunc
+.word	_siramfunc
+.word	_sramdata
+.word	_eramdata
+.word	_siramdata
 /* start address for the .bss section. defined in linker script */
 .word	_sbss
 /* end address for the .bss section. defined in linker script */
@@ -81,6 +88,40 @@ LoopCopyDataInit:
   cmp r4, r1
   bcc CopyDataInit
 
+/* Copy the audio hot path code from flash to SRAM */
+  ldr r0, =_sramfunc
+  ldr r1, =_eramfunc
+  ldr r2, =_siramfunc
+  movs r3, #0
+  b LoopCopyRamFunc
+
+CopyRamFunc:
+  ldr r4, [r2, r3]
+  str r4, [r0, r3]
+  adds r3, r3, #4
+
+LoopCopyRamFunc:
+  adds r4, r0, r3
+  cmp r4, r1
+  bcc CopyRamFunc
+
+/* Copy the tables of the audio hot path from flash to SRAM */
+  ldr r0, =_sramdata
+  ldr r1, =_eramdata
+  ldr r2, =_siramdata
+  movs r3, #0
+  b LoopCopyRamData
+
+CopyRamData:
+  ldr r4, [r2, r3]
+  str r4, [r0, r3]
+  adds r3, r3, #4
+
+LoopCopyRamData:
+  adds r4, r0, r3
+  cmp r4, r1
+  bcc CopyRamData
+
 /* Zero fill the bss segment. */
   ldr r2, =_sbss
   ldr r4, =_ebss